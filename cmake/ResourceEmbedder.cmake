@@ -11,8 +11,15 @@ function(EmbedResources EXPORT_DIRECTORY WORKING_DIRECTORY EMBED_RESOURCES_LIST)
     endif()
     endif()
     else()
+        ## Without zlib the pack is stored uncompressed, otherwise resources can't be unpacked at runtime.
+        if (SR_COMMON_ZLIB)
+            set(EMBED_RESOURCES_COMPRESSION "zlib")
+        else()
+            set(EMBED_RESOURCES_COMPRESSION "none")
+        endif()
+
         add_custom_target(EmbedResourcesTarget
-                COMMAND python ResourceEmbedder.py --working-directory "${WORKING_DIRECTORY}" --export-directory ${EXPORT_DIRECTORY} --resources "\"${EMBED_RESOURCES_LIST}\""
+                COMMAND python ResourceEmbedder.py --working-directory "${WORKING_DIRECTORY}" --export-directory ${EXPORT_DIRECTORY} --resources "\"${EMBED_RESOURCES_LIST}\"" --compression ${EMBED_RESOURCES_COMPRESSION}
                 WORKING_DIRECTORY "${CMAKE_SOURCE_DIR}/Engine/Core/libs/Utils/py")
     endif()
 endfunction()
@@ -0,0 +1,7 @@
+#include <Utils/stdInclude.h>
+
+#include "../src/Benchmarks/Benchmark.cpp"
+#include "../src/Benchmarks/BenchCommon.cpp"
+#include "../src/Benchmarks/BenchSerialization.cpp"
+#include "../src/Benchmarks/BenchWorld.cpp"
+#include "../src/Benchmarks/Main.cpp"
@@ -16,4 +16,5 @@
 #include "../src/Utils/ECS/Prefab.cpp"
 #include "../src/Utils/ECS/Migration.cpp"
 #include "../src/Utils/ECS/TagManager.cpp"
-#include "../src/Utils/ECS/LayerManager.cpp"
\ No newline at end of file
+#include "../src/Utils/ECS/LayerManager.cpp"
+#include "../src/Utils/ECS/ObjectMask.cpp"
\ No newline at end of file
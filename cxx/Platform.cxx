@@ -17,3 +17,4 @@
 #endif
 
 #include "../src/Utils/Platform/PlatformSharedVars.cpp"
+#include "../src/Utils/Platform/Stacktrace.cpp"
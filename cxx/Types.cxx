@@ -9,6 +9,7 @@
 #include "../src/Utils/Types/RawMesh.cpp"
 #include "../src/Utils/Types/UnicodeString.cpp"
 #include "../src/Utils/Types/Stream.cpp"
+#include "../src/Utils/Types/MappedFile.cpp"
 #include "../src/Utils/Types/Regex.cpp"
 #include "../src/Utils/Types/IRawMeshHolder.cpp"
 #include "../src/Utils/Types/Mutex.cpp"
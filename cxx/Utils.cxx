@@ -68,6 +68,11 @@
 #include "../src/Utils/Game/DebugLogComponent.cpp"
 
 #include "../src/Utils/Localization/LocalizationManager.cpp"
+#include "../src/Utils/Localization/LocalizationTable.cpp"
+#include "../src/Utils/Localization/Transcode.cpp"
+
+#include "../src/Utils/Profile/Metrics.cpp"
+#include "../src/Utils/Profile/MemoryTracker.cpp"
 
 #ifdef SR_TRACY_ENABLE
     #include "../src/Utils/Profile/TracyContext.cpp"
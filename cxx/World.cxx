@@ -3,10 +3,13 @@
 #include "../src/Utils/World/Chunk.cpp"
 #include "../src/Utils/World/Observer.cpp"
 #include "../src/Utils/World/Region.cpp"
+#include "../src/Utils/World/RegionStreamer.cpp"
 #include "../src/Utils/World/Scene.cpp"
 #include "../src/Utils/World/SceneUpdater.cpp"
+#include "../src/Utils/World/Tensor.cpp"
 #include "../src/Utils/World/SceneAllocator.cpp"
 #include "../src/Utils/World/SceneLogic.cpp"
 #include "../src/Utils/World/SceneDefaultLogic.cpp"
 #include "../src/Utils/World/SceneCubeChunkLogic.cpp"
-#include "../src/Utils/World/ScenePrefabLogic.cpp"
\ No newline at end of file
+#include "../src/Utils/World/ScenePrefabLogic.cpp"
+#include "../src/Utils/World/WorldGen.cpp"
\ No newline at end of file
@@ -22,6 +22,12 @@ namespace SR_UTILS_NS {
         struct SR_DLL_EXPORT Cmd {
             ReversibleCommand* m_cmd;
             CmdType m_type;
+            Cmd* m_next;
+        };
+
+        struct HistoryEntry {
+            ReversibleCommand* pCmd = nullptr;
+            uint64_t memory = 0;
         };
 
     public:
@@ -30,6 +36,12 @@ namespace SR_UTILS_NS {
 
     public:
         SR_NODISCARD std::string GetLastCmdName() const;
+        SR_NODISCARD uint32_t GetHistorySize() const;
+        SR_NODISCARD uint64_t GetHistoryMemory() const;
+        SR_NODISCARD bool CanUndo() const;
+        SR_NODISCARD bool CanRedo() const;
+
+        /// Async, Redo и Cancel можно вызывать с любого потока без блокировки, команды выполнятся в Update
         bool Execute(ReversibleCommand* cmd, SyncType sync);
         bool Redo();
         bool Cancel();
@@ -38,18 +50,46 @@ namespace SR_UTILS_NS {
 
         void Clear();
 
+        /// при превышении любого из лимитов удаляются самые старые команды
+        void SetMaxHistorySize(uint32_t size);
+        void SetMaxHistoryMemory(uint64_t bytes);
+
     private:
         bool ExecuteImpl(ReversibleCommand* cmd, SyncType sync);
         bool Execute(ReversibleCommand* cmd);
         bool DoCmd(const Cmd& cmd);
         bool Close();
 
+        void Push(ReversibleCommand* cmd, CmdType type);
+        /// забирает все отправленные команды в порядке отправки
+        SR_NODISCARD Cmd* TakePending();
+        void ProcessPending();
+
+        SR_NODISCARD HistoryEntry& HistoryAt(uint32_t index);
+        void PushHistory(ReversibleCommand* cmd);
+        void PopHistoryFront();
+        void DropRedoHistory();
+        void TrimHistory();
+        void SetHistoryCapacity(uint32_t capacity);
+
     private:
-        std::queue<Cmd> m_commands;
-        std::vector<ReversibleCommand*> m_history;
-        uint32_t m_historyPC = UINT32_MAX;
+        /// стек Трайбера: производители добавляют через CAS, потребитель забирает все разом
+        std::atomic<Cmd*> m_pending = nullptr;
+
+        /// кольцевой буфер, m_historyPC - число примененных команд от начала истории
+        std::vector<HistoryEntry> m_history;
+        uint32_t m_historyBegin = 0;
+        uint32_t m_historySize = 0;
+        uint32_t m_historyPC = 0;
         uint32_t m_maxHistorySize = 128;
 
+        uint64_t m_historyMemory = 0;
+        uint64_t m_maxHistoryMemory = 64 * 1024 * 1024;
+
+        /// склеивать можно только с командой, выполненной непосредственно перед этой,
+        /// после Undo/Redo/Force последняя команда истории уже не "предыдущая правка"
+        bool m_canMerge = false;
+
         mutable std::recursive_mutex m_mutex;
         std::string m_lastCmdName;
 
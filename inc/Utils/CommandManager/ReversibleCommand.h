@@ -22,6 +22,15 @@ namespace SR_UTILS_NS {
         virtual bool Undo() = 0;
         virtual std::string GetName() = 0;
 
+        /// Сколько памяти держит команда в истории, учитывается в бюджете CmdManager.
+        /// Команды со снимками состояния должны возвращать размер снимков.
+        SR_NODISCARD virtual uint64_t GetMemorySize() const { return sizeof(ReversibleCommand); }
+
+        /// Вызывается для последней команды истории, когда следом выполнена pNext (например, то же
+        /// перетаскивание того же объекта). Если команда поглотила pNext, то ее Undo должен откатить обе,
+        /// а pNext удаляется менеджером.
+        virtual bool Merge(ReversibleCommand* pNext) { return false; }
+
     public:
         virtual bool Load(const Xml::Node& node) { return false; }
         SR_NODISCARD virtual Xml::Node Save() const { return Xml::Node(); }
@@ -38,6 +47,7 @@ namespace SR_UTILS_NS {
         bool Redo() override;
         bool Undo() override;
         std::string GetName() override { return "GroupCommand"; } ;
+        SR_NODISCARD uint64_t GetMemorySize() const override;
 
     public:
         bool Load(const Xml::Node& node) override { return false; }
@@ -47,6 +57,63 @@ namespace SR_UTILS_NS {
         std::vector<ReversibleCommand*> m_commands;
 
     };
+
+    /**
+     * Разница двух снимков состояния (например, сериализованного объекта до и после правки).
+     * Хранится только различающаяся середина обоих снимков, общие начало и конец берутся из текущего состояния.
+    */
+    class SR_DLL_EXPORT StateDelta {
+    public:
+        StateDelta() = default;
+        StateDelta(std::string_view before, std::string_view after);
+
+    public:
+        /// восстанавливает состояние "до" из текущего состояния "после"
+        SR_NODISCARD std::string ApplyBackward(std::string_view after) const;
+        /// восстанавливает состояние "после" из текущего состояния "до"
+        SR_NODISCARD std::string ApplyForward(std::string_view before) const;
+
+        SR_NODISCARD bool Empty() const noexcept { return m_before.empty() && m_after.empty(); }
+        SR_NODISCARD uint64_t GetMemorySize() const noexcept { return sizeof(StateDelta) + m_before.capacity() + m_after.capacity(); }
+
+    private:
+        SR_NODISCARD std::string Apply(std::string_view state, const std::string& middle, uint64_t stateMiddleSize) const;
+
+    private:
+        uint64_t m_prefixSize = 0;
+        uint64_t m_suffixSize = 0;
+        std::string m_before;
+        std::string m_after;
+
+    };
+
+    /**
+     * Правка одной цели, сохраненная как StateDelta между снимками до и после.
+     * Наследник снимает и применяет снимок цели, последовательные правки одной цели
+     * (перетаскивание, ввод текста) склеиваются в одну запись истории.
+    */
+    class SR_DLL_EXPORT StateDeltaCommand : public ReversibleCommand {
+    public:
+        /// target - идентификатор цели (например, хеш пути объекта), склеиваются команды одного типа с одной целью
+        StateDeltaCommand(uint64_t target, std::string_view before, std::string_view after);
+
+    public:
+        bool Redo() override;
+        bool Undo() override;
+        bool Merge(ReversibleCommand* pNext) override;
+        SR_NODISCARD uint64_t GetMemorySize() const override;
+
+        SR_NODISCARD uint64_t GetTarget() const noexcept { return m_target; }
+
+    protected:
+        SR_NODISCARD virtual std::string GetState() const = 0;
+        virtual bool SetState(std::string_view state) = 0;
+
+    private:
+        uint64_t m_target = 0;
+        StateDelta m_delta;
+
+    };
 }
 
 #define SR_MAKE_REVERSIBLE_CMD_ALLOCATOR(type, pEngine) [pEngine]() -> SR_UTILS_NS::ReversibleCommand* { return dynamic_cast<SR_UTILS_NS::ReversibleCommand*>(new type(pEngine)); }
@@ -29,6 +29,107 @@ namespace Codegen {
     }
 }
 
+namespace SR_UTILS_NS::EnumReflectorDetails {
+    struct HashIndex {
+        uint64_t hash = 0;
+        uint32_t index = 0;
+
+        constexpr bool operator<(const HashIndex& other) const noexcept {
+            return hash < other.hash || (hash == other.hash && index < other.index);
+        }
+    };
+
+    /// Имена перечислителей, разобранные из текста тела перечисления на этапе компиляции.
+    /// Хеши совпадают с хешами StringAtom, таблицы отсортированы для бинарного поиска.
+    template<size_t N> struct NamesTable {
+        std::array<std::string_view, N> names;
+        std::array<HashIndex, N> byHash;
+        std::array<HashIndex, N> byLowerHash;
+    };
+
+    SR_NODISCARD constexpr bool IsIdentChar(char c) noexcept {
+        return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || (c == '_');
+    }
+
+    SR_NODISCARD constexpr char ToLower(char c) noexcept {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    SR_NODISCARD constexpr uint64_t ComputeLowerHash(std::string_view text) noexcept {
+        uint64_t hash = SR_FNV_OFFSET_BASIS;
+        for (const char c : text) {
+            hash = (hash ^ static_cast<uint64_t>(static_cast<uint8_t>(ToLower(c)))) * SR_FNV_PRIME;
+        }
+        return hash;
+    }
+
+    /// Обходит имена в теле вида "(A = 1 << 0, B, C = (A | B))", инициализаторы пропускаются
+    template<typename Fn> constexpr void ForEachEnumeratorName(std::string_view body, const Fn& function) {
+        size_t i = body.empty() || body.front() != '(' ? 0 : 1;
+        int32_t level = 0;
+        bool skip = false;
+
+        while (i < body.size()) {
+            const char c = body[i];
+
+            if (c == '\'' || c == '"') {
+                for (++i; i < body.size() && body[i] != c; ++i) {
+                    i += body[i] == '\\' ? 1 : 0;
+                }
+                ++i;
+                continue;
+            }
+
+            if (c == '(') {
+                ++level;
+            }
+            else if (c == ')') {
+                if (level == 0) {
+                    return;
+                }
+                --level;
+            }
+            else if (c == ',' && level == 0) {
+                skip = false;
+            }
+            else if (!skip && IsIdentChar(c)) {
+                const size_t start = i;
+                while (i < body.size() && IsIdentChar(body[i])) {
+                    ++i;
+                }
+                function(body.substr(start, i - start));
+                skip = true;
+                continue;
+            }
+
+            ++i;
+        }
+    }
+
+    SR_NODISCARD constexpr size_t CountEnumerators(std::string_view body) {
+        size_t count = 0;
+        ForEachEnumeratorName(body, [&count](std::string_view) { ++count; });
+        return count;
+    }
+
+    template<size_t N> SR_NODISCARD constexpr NamesTable<N> ParseNames(std::string_view body) {
+        NamesTable<N> table = { };
+        size_t index = 0;
+
+        ForEachEnumeratorName(body, [&](std::string_view name) {
+            table.names[index] = name;
+            table.byHash[index] = { ComputeHash(name), static_cast<uint32_t>(index) };
+            table.byLowerHash[index] = { ComputeLowerHash(name), static_cast<uint32_t>(index) };
+            ++index;
+        });
+
+        std::sort(table.byHash.begin(), table.byHash.end());
+        std::sort(table.byLowerHash.begin(), table.byLowerHash.end());
+
+        return table;
+    }
+}
+
 namespace SR_UTILS_NS {
     class EnumReflector;
 
@@ -72,7 +173,7 @@ namespace SR_UTILS_NS {
         };
 
     public:
-        template<typename Integral> EnumReflector(const Integral* values, size_t count, const char* name, const char* body);
+        template<typename Integral, size_t N> EnumReflector(const Integral* values, const EnumReflectorDetails::NamesTable<N>& table, const char* name);
         ~EnumReflector() override;
 
     public:
@@ -102,9 +203,11 @@ namespace SR_UTILS_NS {
         SR_NODISCARD SR_MAYBE_UNUSED uint64_t GetHashNameInternal() const { return m_data->hashName; }
 
     private:
-        static bool IsIdentChar(char c);
         static void ErrorInternal(const std::string& msg);
 
+        void BuildValueIndex();
+        SR_NODISCARD std::optional<uint32_t> FindByValue(int64_t value) const;
+
     private:
         struct Data
         {
@@ -112,84 +215,40 @@ namespace SR_UTILS_NS {
             std::vector<SR_UTILS_NS::StringAtom> names;
             SR_UTILS_NS::StringAtom enumName;
             uint64_t hashName;
+
+            /// таблицы из NamesTable, живут в статической памяти
+            std::span<const EnumReflectorDetails::HashIndex> byHash;
+            std::span<const EnumReflectorDetails::HashIndex> byLowerHash;
+
+            /// непрерывный диапазон значений индексируется напрямую (value - minValue),
+            /// иначе бинарный поиск по отсортированным парам (значение, индекс)
+            int64_t minValue = 0;
+            std::vector<uint32_t> denseIndices;
+            std::vector<std::pair<int64_t, uint32_t>> sortedValues;
         }* m_data;
     };
 }
 
 namespace SR_UTILS_NS {
-    template<typename Integral> EnumReflector::EnumReflector(const Integral *values, size_t count, const char *name, const char *body)
+    template<typename Integral, size_t N> EnumReflector::EnumReflector(const Integral* values, const EnumReflectorDetails::NamesTable<N>& table, const char* name)
         : m_data(new Data())
     {
         m_data->enumName = name;
         m_data->hashName = SR_HASH_STR_REGISTER(name);
-        m_data->values.resize(count);
-        m_data->names.resize(count);
+        m_data->values.resize(N);
+        m_data->names.resize(N);
+        m_data->byHash = table.byHash;
+        m_data->byLowerHash = table.byLowerHash;
 
-        enum states
-        {
-            state_start, // Before identifier
-            state_ident, // In identifier
-            state_skip, // Looking for separator comma
-        } state = state_start;
-
-        assert(*body == '(');
-        ++body;
-        const char* ident_start = nullptr;
-        int value_index = 0;
-        int level = 0;
-        for (;;)
-        {
-            assert(*body);
-            switch (state)
-            {
-                case state_start:
-                    if (IsIdentChar(*body))
-                    {
-                        state = state_ident;
-                        ident_start = body;
-                    }
-                    ++body;
-                    break;
-                case state_ident:
-                    if (!IsIdentChar(*body))
-                    {
-                        state = state_skip;
-                        assert(value_index < count);
-
-                        m_data->values[value_index].name = std::string(ident_start, body - ident_start);
-                        m_data->values[value_index].value = static_cast<int64_t>(values[value_index]);
-                        m_data->values[value_index].hashName = m_data->values[value_index].name.GetHash();
-
-                        m_data->names[value_index] = m_data->values[value_index].name;
-
-                        ++value_index;
-                    }
-                    else
-                    {
-                        ++body;
-                    }
-                    break;
-                case state_skip:
-                    if (*body == '(')
-                    {
-                        ++level;
-                    }
-                    else if (*body == ')')
-                    {
-                        if (level == 0)
-                        {
-                            assert(value_index == count);
-                            return;
-                        }
-                        --level;
-                    }
-                    else if (level == 0 && *body == ',')
-                    {
-                        state = state_start;
-                    }
-                    ++body;
-            }
+        for (size_t i = 0; i < N; ++i) {
+            m_data->names[i] = table.names[i];
+
+            m_data->values[i].name = m_data->names[i];
+            m_data->values[i].hashName = m_data->names[i].GetHash();
+            m_data->values[i].value = static_cast<int64_t>(values[i]);
         }
+
+        BuildValueIndex();
     }
 
     template<typename EnumType> SR_UTILS_NS::StringAtom EnumReflector::ToStringAtom(EnumType value) {
@@ -236,7 +295,7 @@ namespace SR_UTILS_NS {
         auto&& data = GetReflector<EnumType>()->m_data;
 
         for (uint64_t i = 0; i < Count<EnumType>(); ++i) {
-            if (filter(data->values[i])) {
+            if (filter(static_cast<EnumType>(data->values[i].value))) {
                 names.emplace_back(data->names[i]);
             }
         }
@@ -338,8 +397,11 @@ namespace SR_UTILS_NS {
                 integral _val;                                                                                          \
             } __VA_ARGS__;                                                                                              \
             const integral _detail_vals[] = { __VA_ARGS__ };                                                            \
-            return SR_UTILS_NS::EnumReflector( _detail_vals, sizeof(_detail_vals) / sizeof(integral),                   \
-                    enumNameStr, SR_ENUM_DETAIL_STR((__VA_ARGS__)));                                                    \
+            static constexpr std::string_view _detail_body = SR_ENUM_DETAIL_STR((__VA_ARGS__));                         \
+            static constexpr auto _detail_table = SR_UTILS_NS::EnumReflectorDetails::ParseNames<                        \
+                SR_UTILS_NS::EnumReflectorDetails::CountEnumerators(_detail_body)>(_detail_body);                       \
+            static_assert(sizeof(_detail_vals) / sizeof(integral) == _detail_table.names.size());                       \
+            return SR_UTILS_NS::EnumReflector(_detail_vals, _detail_table, enumNameStr);                                \
         }());                                                                                                           \
         return _reflector;                                                                                              \
     }                                                                                                                   \
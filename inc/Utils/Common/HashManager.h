@@ -8,6 +8,7 @@
 #include <Utils/Common/Hashes.h>
 #include <Utils/Common/Singleton.h>
 #include <Utils/Types/Map.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 namespace SR_UTILS_NS {
     struct StringHashInfo {
@@ -15,11 +16,14 @@ namespace SR_UTILS_NS {
         std::string_view view;
         uint64_t hash = SR_ID_INVALID;
         uint64_t size = 0; /// TODO: remove
+
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Strings)
     };
 
     /// Не можем наследоваться от Singleton
     class HashManager : SR_UTILS_NS::NonCopyable {
         using Hash = uint64_t;
+        using StringsAllocator = TaggedAllocator<std::pair<Hash, StringHashInfo*>, MemoryTag::Strings>;
     private:
         HashManager() = default;
         ~HashManager() override = default;
@@ -31,6 +35,7 @@ namespace SR_UTILS_NS {
         SR_NODISCARD const std::string_view& HashToString(Hash hash) const;
         SR_NODISCARD StringAtom HashToStringAtom(Hash hash) const;
         SR_NODISCARD bool Exists(Hash hash) const;
+        SR_NODISCARD uint64_t GetCount() const;
 
         SR_NODISCARD StringHashInfo* GetOrAddInfo(const std::string& str);
         SR_NODISCARD StringHashInfo* GetOrAddInfo(const std::string_view& str);
@@ -44,7 +49,7 @@ namespace SR_UTILS_NS {
         SR_NODISCARD StringHashInfo* Register(std::string str, Hash hash);
 
     private:
-        ska::flat_hash_map<Hash, StringHashInfo*> m_strings; /// NOLINT
+        ska::flat_hash_map<Hash, StringHashInfo*, std::hash<Hash>, std::equal_to<Hash>, StringsAllocator> m_strings; /// NOLINT
         mutable std::recursive_mutex m_mutex;
 
     };
@@ -43,6 +43,15 @@ namespace SR_UTILS_NS {
         return HexToByte(str.data());
     }
 
+    /// Ошибку разбора превращаем в исключение, чтобы LexicalCast обработал ее как раньше для std::stoi
+    template<typename T> SR_NODISCARD T LexicalCastNumber(std::string_view str) {
+        T value;
+        if (!SR_UTILS_NS::StringUtils::TryParseNumber(str, value)) {
+            throw std::invalid_argument("LexicalCastNumber");
+        }
+        return value;
+    }
+
     template<typename T> SR_NODISCARD T LexicalCast(std::string_view str) {
         try {
             if constexpr (std::is_same<T, bool>()) {
@@ -56,28 +65,28 @@ namespace SR_UTILS_NS {
                 return static_cast<uint8_t>(str.front());
             }
             else if constexpr (std::is_same<T, int16_t>()) {
-                return std::stoi(str.data());
+                return LexicalCastNumber<int32_t>(str);
             }
             else if constexpr (std::is_same<T, uint16_t>()) {
-                return static_cast<uint16_t>(std::stoi(str.data()));
+                return static_cast<uint16_t>(LexicalCastNumber<int32_t>(str));
             }
             else if constexpr (std::is_same<T, int32_t>()) {
-                return std::stoi(str.data());
+                return LexicalCastNumber<int32_t>(str);
             }
             else if constexpr (std::is_same<T, int64_t>()) {
-                return std::stoll(str.data());
+                return LexicalCastNumber<int64_t>(str);
             }
             else if constexpr (std::is_same<T, uint32_t>()) {
-                return static_cast<uint32_t>(std::stoi(str.data()));
+                return static_cast<uint32_t>(LexicalCastNumber<int32_t>(str));
             }
             else if constexpr (std::is_same<T, uint64_t>()) {
-                return static_cast<uint64_t>(std::stoll(str.data()));
+                return static_cast<uint64_t>(LexicalCastNumber<int64_t>(str));
             }
             else if constexpr (std::is_same<T, float_t>() || std::is_same<T, float>()) {
-                return std::stof(str.data());
+                return LexicalCastNumber<float>(str);
             }
             else if constexpr (std::is_same<T, double_t>() || std::is_same<T, double>() || std::is_same<T, Math::Unit>()) {
-                return std::stod(str.data());
+                return LexicalCastNumber<double>(str);
             }
             else if constexpr (std::is_same<T, SR_MATH_NS::FColor>()) {
                 if (str.empty()) {
@@ -94,9 +103,7 @@ namespace SR_UTILS_NS {
                     uint8_t offset = r + g + b + a; // max 4
 
                     if (str[offset] == '(' && str.back() == ')') {
-                        std::vector<std::string> values;
-
-                        values = SR_UTILS_NS::StringUtils::Split(std::string(str.substr(offset + 1, str.size() - (offset + 1) - 1)), ",");
+                        auto&& values = SR_UTILS_NS::StringUtils::SplitView(str.substr(offset + 1, str.size() - (offset + 1) - 1), ",");
 
                         uint8_t index = 0;
                         SR_MATH_NS::FColor color = SR_MATH_NS::FColor::Alpha();
@@ -0,0 +1,163 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_UTILS_STRING_TOKENIZER_H
+#define SR_ENGINE_UTILS_STRING_TOKENIZER_H
+
+#include <Utils/Common/StringUtils.h>
+
+namespace SR_UTILS_NS {
+    /**
+     * Ленивый разбор строки на токены по разделителю (символу или подстроке).
+     * Токены - представления исходной строки, память не выделяется, состояние только свое,
+     * поэтому разбор можно вести из любого потока. Исходная строка должна пережить токенизатор.
+     *
+     * for (auto&& token : StringTokenizer(line, ' ')) { ... }
+    */
+    class StringTokenizer {
+    public:
+        class Iterator;
+
+    public:
+        StringTokenizer(std::string_view source, std::string_view delimiter, bool skipEmpty = true) noexcept
+            : m_source(source)
+            , m_delimiter(delimiter)
+            , m_symbol(delimiter.size() == 1 ? delimiter.front() : '\0')
+            , m_skipEmpty(skipEmpty)
+        { }
+
+        StringTokenizer(std::string_view source, char delimiter, bool skipEmpty = true) noexcept
+            : m_source(source)
+            , m_symbol(delimiter)
+            , m_single(true)
+            , m_skipEmpty(skipEmpty)
+        { }
+
+    public:
+        /// false, когда токены закончились
+        bool Next(std::string_view& token) noexcept {
+            while (!m_finished) {
+                const uint64_t begin = m_position;
+                uint64_t end;
+
+                if (m_single || m_delimiter.size() == 1) {
+                    end = StringUtils::Find(m_source, m_symbol, begin);
+                }
+                else if (m_delimiter.empty()) {
+                    end = std::string_view::npos;
+                }
+                else {
+                    end = StringUtils::Find(m_source, m_delimiter, begin);
+                }
+
+                if (end == std::string_view::npos) {
+                    end = m_source.size();
+                    m_position = end;
+                    m_finished = true;
+                }
+                else {
+                    m_position = end + GetDelimiterSize();
+                }
+
+                token = m_source.substr(begin, end - begin);
+
+                if (!m_skipEmpty || !token.empty()) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// Еще не разобранная часть строки
+        SR_NODISCARD std::string_view GetRest() const noexcept {
+            return m_finished ? std::string_view() : m_source.substr(m_position);
+        }
+
+        SR_NODISCARD std::string_view GetSource() const noexcept { return m_source; }
+
+        void Reset() noexcept {
+            m_position = 0;
+            m_finished = false;
+        }
+
+        SR_NODISCARD Iterator begin() const noexcept;
+        SR_NODISCARD Iterator end() const noexcept;
+
+    private:
+        SR_NODISCARD uint64_t GetDelimiterSize() const noexcept {
+            return m_single ? 1 : m_delimiter.size();
+        }
+
+    private:
+        std::string_view m_source;
+        std::string_view m_delimiter;
+        uint64_t m_position = 0;
+        char m_symbol = '\0';
+        bool m_single = false;
+        bool m_skipEmpty = true;
+        bool m_finished = false;
+
+    };
+
+    class StringTokenizer::Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+    public:
+        Iterator() = default;
+
+        explicit Iterator(const StringTokenizer& tokenizer) noexcept
+            : m_tokenizer(tokenizer)
+        {
+            m_valid = m_tokenizer.Next(m_token);
+        }
+
+    public:
+        SR_NODISCARD reference operator*() const noexcept { return m_token; }
+        SR_NODISCARD pointer operator->() const noexcept { return &m_token; }
+
+        Iterator& operator++() noexcept {
+            m_valid = m_tokenizer.Next(m_token);
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        SR_NODISCARD bool operator==(const Iterator& other) const noexcept {
+            if (!m_valid || !other.m_valid) {
+                return m_valid == other.m_valid;
+            }
+            return m_token.data() == other.m_token.data() && m_token.size() == other.m_token.size();
+        }
+
+        SR_NODISCARD bool operator!=(const Iterator& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        StringTokenizer m_tokenizer = StringTokenizer(std::string_view(), std::string_view());
+        std::string_view m_token;
+        bool m_valid = false;
+
+    };
+
+    inline StringTokenizer::Iterator StringTokenizer::begin() const noexcept {
+        return Iterator(*this);
+    }
+
+    inline StringTokenizer::Iterator StringTokenizer::end() const noexcept {
+        return Iterator();
+    }
+}
+
+#endif //SR_ENGINE_UTILS_STRING_TOKENIZER_H
@@ -7,6 +7,8 @@
 
 #include <Utils/Math/Mathematics.h>
 
+#include <charconv>
+
 namespace SR_UTILS_NS {
     SR_MAYBE_UNUSED static std::wstring s2ws(const std::string& str)
     {
@@ -273,105 +275,71 @@ namespace SR_UTILS_NS {
             return result;
         }
 
+        /// Пустые токены пропускаются. Для разбора без выделения памяти - StringTokenizer
         SR_NODISCARD static std::vector<std::string_view> SplitView(std::string_view source, std::string_view delimiter);
         SR_NODISCARD static std::vector<std::string> Split(std::string source, const std::string& delimiter);
 
-        SR_NODISCARD inline static char** Split(const char* source, char chr, unsigned short start, unsigned short count_strs) {
-            char** strs = new char*[count_strs];
-            unsigned char   found_floats = 0;
-
-            unsigned short	count = 0;
-            unsigned short	found = start;
-
-            static short t = 0;
-            static short len = 0;
-
-            len = FastStrLen(source);
-
-            for (t = start; t < len; t++) {
-                count++;
-
-                if (t + 1 == len) {
-                    if (found_floats == count_strs)
-                        return strs;
-
-                    char* temp = new char[count + 1]; strcpy(temp, "");
-
-                    strncat(temp, source + found, count);
-
-                    strs[found_floats] = temp;
-
-                    return strs;
-                }
-                else if (source[t] == chr) {
-                    if (found_floats + 1 == count_strs)
-                        return strs;
-
-                    char* temp = new char[count + 1]; strcpy(temp, "");
-
-                    strncat(temp, source + found, count - 1);
-
-                    strs[found_floats] = temp;
-                    found_floats++;
-
-                    found = t + 1;
-                    count = 0;
-                }
-            }
-            return nullptr;
-        }
+        /// Строки и массив выделяются через new[] и освобождаются вызывающим. nullptr, если start за концом строки
+        SR_NODISCARD static char** Split(const char* source, char chr, unsigned short start, unsigned short count_strs);
 
         SR_NODISCARD inline static bool Contains(const std::string& str, const std::string& word) noexcept {
             return str.find(word) != std::string::npos;
         }
 
-        SR_NODISCARD inline static float* SplitFloats(const char* source, char chr, unsigned short start, unsigned short count_floats) {
-            auto*			floats			= new float[count_floats];
-            unsigned char   found_floats	= 0;
-
-            unsigned short	count			= 0;
-            unsigned short	found			= start;
-
-            static short t = 0;
-            static short len = 0;
-
-            len = (short)FastStrLen(source);
-
-            for (t = start; t < len; t++) {
-                count++;
+        /// Массив выделяется через new[], недостающие значения равны нулю. nullptr, если start за концом строки
+        SR_NODISCARD static float* SplitFloats(const char* source, char chr, unsigned short start, unsigned short count_floats);
 
-                if (t + 1 == len) {
+        /// Векторный поиск, std::string_view::npos если не найдено
+        SR_NODISCARD static uint64_t Find(std::string_view str, char symbol, uint64_t offset = 0) noexcept;
+        SR_NODISCARD static uint64_t Find(std::string_view str, std::string_view subStr, uint64_t offset = 0) noexcept;
 
-                    if (found_floats == count_floats)
-                        return floats;
+        /**
+         * Разбор чисел через std::from_chars: без локали, исключений и выделения памяти.
+         * Пробелы в начале и знак '+' пропускаются, разбор останавливается на первом неподходящем символе.
+        */
+        template<typename T> static bool TryParseNumber(std::string_view str, T& value) noexcept {
+            static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "Unsupported type!");
 
-                    char* temp = new char[count + 1]; strcpy(temp, "");
-
-                    strncat(temp, source + found, count);
-
-                    floats[found_floats] = (float)atof(temp);
-
-                    delete[] temp;
-
-                    return floats;
-                } else if (source[t] == chr) {
-                    if (found_floats + 1 == count_floats)
-                        return floats;
-
-                    char* temp = new char[count + 1]; strcpy(temp, "");
-
-                    strncat(temp, source + found, count - 1);
+            while (!str.empty() && (str.front() == ' ' || str.front() == '\t' || str.front() == '\r' || str.front() == '\n')) {
+                str.remove_prefix(1);
+            }
 
-                    floats[found_floats] = (float)atof(temp);
-                    found_floats++;
+            if (!str.empty() && str.front() == '+') {
+                str.remove_prefix(1);
+            }
 
-                    delete[] temp;
+            if (str.empty()) {
+                return false;
+            }
 
-                    found = t + 1;
-                    count = 0;
+        #if !defined(__cpp_lib_to_chars)
+            /// стандартная библиотека без from_chars для чисел с плавающей точкой
+            if constexpr (std::is_floating_point_v<T>) {
+                char buffer[64];
+                const uint64_t size = SR_MIN(str.size(), sizeof(buffer) - 1);
+                memcpy(buffer, str.data(), size);
+                buffer[size] = '\0';
+
+                char* pEnd = nullptr;
+                const auto result = std::strtod(buffer, &pEnd);
+                if (pEnd == buffer) {
+                    return false;
                 }
+
+                value = static_cast<T>(result);
+                return true;
             }
-            return nullptr;
+            else
+        #endif
+            {
+                const auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+                return result.ec == std::errc();
+            }
+        }
+
+        template<typename T> SR_NODISCARD static T ParseNumber(std::string_view str, T defaultValue = T()) noexcept {
+            T value;
+            return TryParseNumber(str, value) ? value : defaultValue;
         }
 
         SR_NODISCARD inline static unsigned char MathCount(const char* str, char symb) noexcept {
@@ -416,23 +384,26 @@ namespace SR_UTILS_NS {
             return results;
         }
 
+        /// Векторная смена регистра ASCII, остальные байты (в том числе UTF-8) не меняются
+        static void ToLowerInPlace(char* pData, uint64_t size) noexcept;
+        static void ToUpperInPlace(char* pData, uint64_t size) noexcept;
+
         SR_NODISCARD SR_INLINE_STATIC std::string ToLower(std::string str) noexcept {
-            for (char& t : str) {
-                t = static_cast<char>(tolower(static_cast<char>(t)));
-            }
+            ToLowerInPlace(str.data(), str.size());
+            return str;
+        }
+
+        SR_NODISCARD SR_INLINE_STATIC std::string ToUpper(std::string str) noexcept {
+            ToUpperInPlace(str.data(), str.size());
             return str;
         }
 
         SR_INLINE_STATIC void ToLowerRef(std::string_view str) noexcept {
-            for (auto t = const_cast<char*>(str.data()); *t != '\0'; t++) {
-                *t = static_cast<char>(tolower(static_cast<char>(*t)));
-            }
+            ToLowerInPlace(const_cast<char*>(str.data()), str.size());
         }
 
         SR_INLINE_STATIC void ToUpperRef(std::string_view str) noexcept {
-            for (auto t = const_cast<char*>(str.data()); *t != '\0'; t++) {
-                *t = static_cast<char>(toupper(static_cast<char>(*t)));
-            }
+            ToUpperInPlace(const_cast<char*>(str.data()), str.size());
         }
 
         SR_NODISCARD inline static std::string MakePath(const std::string& str, bool toLower = false) noexcept {
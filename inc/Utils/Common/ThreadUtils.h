@@ -7,6 +7,10 @@
 
 #include <Utils/Common/Enumerations.h>
 
+namespace SR_HTYPES_NS {
+    class Thread;
+}
+
 namespace SR_UTILS_NS {
     SR_ENUM_NS_T(ThreadPriority, int8_t,
           SR_THREAD_PRIORITY_ABOVE_NORMAL,
@@ -29,10 +33,28 @@ namespace SR_UTILS_NS {
         return stream.str();
     }
 
+    /// Сведения о текущем потоке, собираются один раз при первом обращении из потока.
+    /// pThread заполняет фабрика потоков при старте потока, дальше запросы не берут блокировок.
+    struct ThreadIdentity {
+        /// порядковый номер потока в процессе, начиная с 1
+        uint64_t number = 0;
+        /// системный идентификатор (tid на Linux), см. Platform::GetCurrentThreadNativeId
+        uint64_t nativeId = 0;
+        SR_UTILS_NS::StringAtom id;
+        SR_HTYPES_NS::Thread* pThread = nullptr;
+    };
+
+    SR_DLL_EXPORT ThreadIdentity& GetThisThreadIdentity();
+
+    /// имя потока, если оно задано через Thread::SetName, иначе его идентификатор
+    SR_DLL_EXPORT SR_NODISCARD SR_UTILS_NS::StringAtom GetThisThreadName();
+
     SR_INLINE SR_UTILS_NS::StringAtom GetThisThreadId() {
-        std::stringstream stream;
-        stream << std::this_thread::get_id();
-        return stream.str();
+        return GetThisThreadIdentity().id;
+    }
+
+    SR_INLINE uint64_t GetThisThreadNumber() {
+        return GetThisThreadIdentity().number;
     }
 }
 
@@ -57,8 +57,32 @@ namespace SR_UTILS_NS {
             Vertex(1, 1, -1),
     };
 
+    /// Выпуклая оболочка (quickhull), возвращает треугольники без индексов
     std::vector<Vertex> ComputeConvexHull(const std::vector<Vertex>& vertices);
 
+    /// Треугольники оболочки в виде индексов исходных точек, нормали граней смотрят наружу (CCW).
+    /// maxVertices ограничивает число вершин оболочки (0 - без ограничения, минимум 4):
+    /// точки добавляются от самой удаленной, поэтому урезанная оболочка остается хорошим приближением.
+    /// Для вырожденного (плоского) набора точек возвращает false.
+    bool ComputeConvexHull(std::span<const Vec3> positions, std::vector<uint32_t>& indices, uint32_t maxVertices = 0);
+
+    /// Сливает вершины с совпадающими атрибутами и позициями в пределах epsilon,
+    /// переписывает индексы и возвращает новое число вершин
+    uint32_t WeldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, float_t epsilon);
+
+    /// Переупорядочивает треугольники под кэш пост-трансформации (Forsyth)
+    void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t verticesCount);
+
+    /// Переупорядочивает кластеры треугольников, сохраненные OptimizeVertexCache, так,
+    /// чтобы внешние грани рисовались раньше (меньше перерисовки). Вызывать после OptimizeVertexCache.
+    void OptimizeOverdraw(std::vector<uint32_t>& indices, std::span<const Vertex> vertices);
+
+    /// Переставляет вершины в порядке первого использования, неиспользуемые удаляются
+    uint32_t OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    /// Среднее число промахов FIFO-кэша вершин на треугольник
+    SR_NODISCARD float_t CalculateACMR(std::span<const uint32_t> indices, uint32_t verticesCount, uint32_t cacheSize = 16);
+
     template<typename T> static std::vector<T> IndexedVerticesToNonIndexed(
             const std::vector<T>& vertices,
             const std::vector<uint32_t>& indices)
@@ -51,6 +51,7 @@ namespace SR_UTILS_NS {
         friend class IComponentable;
         friend class ComponentManager;
     public:
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Components)
         using Ptr = SR_HTYPES_NS::SharedPtr<Component>;
         using OriginType = Component;
         using ScenePtr = SR_WORLD_NS::Scene*;
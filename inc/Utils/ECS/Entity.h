@@ -7,10 +7,12 @@
 
 #include <Utils/Serialization/Serializable.h>
 #include <Utils/ECS/EntityRef.h>
+#include <Utils/ECS/EntityHandle.h>
 #include <Utils/Common/Numeric.h>
 #include <Utils/Types/SharedPtr.h>
 #include <Utils/TypeTraits/Properties.h>
 #include <Utils/TypeTraits/SRClass.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 #define SR_ENTITY_SET_VERSION(version)                                                       \
     public:                                                                                  \
@@ -91,6 +93,7 @@ namespace SR_UTILS_NS {
         SR_CLASS()
         using Super = Serializable;
     public:
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::ECS)
         using Ptr = SR_HTYPES_NS::SharedPtr<Entity>;
         using OriginType = Entity;
 
@@ -102,6 +105,7 @@ namespace SR_UTILS_NS {
         SR_NODISCARD const SR_UTILS_NS::PropertyContainer& GetEntityMessages() const { return m_entityMessages; }
 
         SR_NODISCARD EntityId GetEntityId() const { return m_entityId; }
+        SR_NODISCARD EntityHandle GetEntityHandle() const noexcept { return m_entityHandle; }
         SR_NODISCARD EntityPath GetEntityPath() const { return m_entityPath; }
 
         SR_NODISCARD EntityBranch GetEntityTree() const { return EntityBranch(m_entityId, GetEntityBranches()); }
@@ -139,6 +143,7 @@ namespace SR_UTILS_NS {
     private:
         /// @property
         EntityId m_entityId;
+        EntityHandle m_entityHandle;
 
         EntityPath m_entityPath;
 
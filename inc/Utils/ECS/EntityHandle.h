@@ -0,0 +1,33 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_UTILS_ENTITY_HANDLE_H
+#define SR_ENGINE_UTILS_ENTITY_HANDLE_H
+
+#include <Utils/stdInclude.h>
+
+namespace SR_UTILS_NS {
+    /// Слот сущности в таблице EntityManager + поколение слота.
+    /// При удалении сущности поколение слота увеличивается, поэтому старые хендлы
+    /// проверяются за O(1) без поиска по пути и без захвата мьютекса.
+    struct EntityHandle {
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        uint32_t index = INVALID_INDEX;
+        uint32_t generation = 0;
+
+        SR_NODISCARD bool Valid() const noexcept { return index != INVALID_INDEX; }
+        void Reset() noexcept { index = INVALID_INDEX; generation = 0; }
+
+        bool operator==(const EntityHandle& other) const noexcept {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const EntityHandle& other) const noexcept {
+            return !(*this == other);
+        }
+    };
+}
+
+#endif //SR_ENGINE_UTILS_ENTITY_HANDLE_H
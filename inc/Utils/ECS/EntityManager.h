@@ -6,6 +6,7 @@
 #define SR_ENGINE_ENTITY_MANAGER_H
 
 #include <Utils/ECS/Entity.h>
+#include <Utils/ECS/EntityHandle.h>
 #include <Utils/Common/Singleton.h>
 
 namespace SR_UTILS_NS {
@@ -13,9 +14,18 @@ namespace SR_UTILS_NS {
 
     class SR_DLL_EXPORT EntityManager : public Singleton<EntityManager> {
         SR_REGISTER_SINGLETON(EntityManager)
+        static constexpr uint32_t HANDLE_PAGE_SHIFT = 12;
+        static constexpr uint32_t HANDLE_PAGE_SIZE = 1u << HANDLE_PAGE_SHIFT;
+        static constexpr uint32_t HANDLE_MAX_PAGES = 4096;
+
+        struct HandleSlot {
+            std::atomic<uint32_t> generation = 0;
+            Entity* pEntity = nullptr;
+        };
+
     public:
         EntityManager();
-        ~EntityManager() override = default;
+        ~EntityManager() override;
 
     public:
         EntityId Register(const Entity::Ptr& entity);
@@ -26,10 +36,24 @@ namespace SR_UTILS_NS {
         Entity::Ptr GetReserved(const EntityId& id, const EntityAllocator& allocator);
         Entity::Ptr FindById(const EntityId& id) const;
 
+        EntityHandle AcquireHandle(Entity* pEntity);
+        void ReleaseHandle(const EntityHandle& handle);
+
+        /// lock-free, может вызываться из любого потока
+        SR_NODISCARD bool IsAlive(const EntityHandle& handle) const noexcept;
+        SR_NODISCARD Entity* GetByHandle(const EntityHandle& handle) const noexcept;
+
     private:
         void OnSingletonDestroy() override;
 
     private:
+        SR_NODISCARD HandleSlot* GetHandleSlot(uint32_t index) const noexcept;
+
+    private:
+        std::array<std::atomic<HandleSlot*>, HANDLE_MAX_PAGES> m_handlePages = { };
+        std::atomic<uint32_t> m_handleSlotsCount = 0;
+        std::vector<uint32_t> m_freeHandles;
+
         std::unordered_map<EntityId, Entity::Ptr> m_entities;
         std::unordered_set<EntityId> m_reserved;
         EntityId m_nextId;
@@ -6,6 +6,7 @@
 #define SR_ENGINE_UTILS_ENTITY_REF_H
 
 #include <Utils/ECS/EntityRefUtils.h>
+#include <Utils/ECS/EntityHandle.h>
 #include <Utils/TypeTraits/Property.h>
 
 namespace SR_UTILS_NS {
@@ -14,9 +15,11 @@ namespace SR_UTILS_NS {
     class Component;
 
     class EntityRef final : public SR_UTILS_NS::NonCopyable {
+        friend class EntityRefUtils::RemapTable;
     public:
         EntityRef() = default;
         explicit EntityRef(const EntityRefUtils::OwnerRef& owner);
+        ~EntityRef() override;
 
         EntityRef(EntityRef&& other) noexcept;
 
@@ -26,6 +29,7 @@ namespace SR_UTILS_NS {
         SR_NODISCARD SR_HTYPES_NS::Marshal::Ptr Save(SR_HTYPES_NS::Marshal::Ptr pMarshal) const;
         SR_NODISCARD EntityRef Copy(const EntityRefUtils::OwnerRef& owner) const;
         SR_NODISCARD const SR_HTYPES_NS::SharedPtr<Entity>& GetTarget() const { return m_target; }
+        SR_NODISCARD EntityId GetTargetId() const;
 
         void Save(SR_HTYPES_NS::Marshal& marshal) const;
         void Load(SR_HTYPES_NS::Marshal& marshal);
@@ -46,19 +50,28 @@ namespace SR_UTILS_NS {
         void SetRelative(bool relative);
         EntityRef& SetPathTo(const SR_HTYPES_NS::SharedPtr<Entity>& pEntity);
         void SetOwner(const EntityRefUtils::OwnerRef& owner);
+        void SetTargetId(EntityId id) { m_targetId = id; }
 
         void UpdateTarget() const;
 
     private:
         void UpdatePath() const;
+        void ResolveTarget(const EntityRefUtils::RemapTable* pTable, bool allowGlobalLookup) const;
+        void SetTarget(const SR_HTYPES_NS::SharedPtr<Entity>& pEntity) const;
+        void ValidateTarget() const;
 
     private:
+        /// путь вычисляется лениво, только при сохранении или копировании ссылки
         mutable SR_UTILS_NS::EntityRefUtils::RefPath m_path;
+        mutable bool m_pathDirty = false;
 
         bool m_relative = true;
+        EntityRefUtils::RemapTable* m_remapTable = nullptr;
 
         EntityRefUtils::OwnerRef m_owner;
         mutable SR_HTYPES_NS::SharedPtr<Entity> m_target;
+        mutable EntityHandle m_targetHandle;
+        mutable EntityId m_targetId = UINT64_MAX;
 
     };
 
@@ -15,6 +15,9 @@ namespace SR_WORLD_NS {
 
 namespace SR_UTILS_NS {
     class Entity;
+    class EntityRef;
+
+    typedef uint64_t EntityId;
 }
 
 namespace SR_UTILS_NS::EntityRefUtils {
@@ -78,6 +81,47 @@ namespace SR_UTILS_NS::EntityRefUtils {
 
     SR_MAYBE_UNUSED bool IsOwnerValid(const OwnerRef& owner);
     SR_MAYBE_UNUSED bool IsTargetInitialized(const OwnerRef& owner);
+
+    /**
+     * Таблица переназначения ссылок на уровне сцены.
+     * Пока активен Scope, копирование объектов (инстанциирование префабов) записывает пары
+     * "исходный id -> копия", а загружаемые и копируемые EntityRef регистрируются в таблице.
+     * Resolve() разрешает все накопленные ссылки за один проход: сначала по таблице, затем по
+     * EntityManager::FindById, и только если это не помогло - обходом RefPath.
+    */
+    class SR_DLL_EXPORT RemapTable : public SR_UTILS_NS::NonCopyable {
+    public:
+        class Scope : public SR_UTILS_NS::NonCopyable {
+        public:
+            explicit Scope(RemapTable& table);
+            ~Scope() override;
+
+        private:
+            RemapTable* m_previous = nullptr;
+
+        };
+
+    public:
+        ~RemapTable() override;
+
+    public:
+        SR_NODISCARD static RemapTable* GetCurrent() noexcept;
+
+        void AddEntity(EntityId from, const SR_HTYPES_NS::SharedPtr<Entity>& pTo);
+        SR_NODISCARD SR_HTYPES_NS::SharedPtr<Entity> FindEntity(EntityId from) const;
+
+        void AddRef(EntityRef* pRef, bool allowGlobalLookup);
+        void MoveRef(EntityRef* pFrom, EntityRef* pTo);
+        void RemoveRef(EntityRef* pRef);
+
+        void Resolve();
+        void Clear();
+
+    private:
+        std::unordered_map<EntityId, SR_HTYPES_NS::SharedPtr<Entity>> m_entities;
+        std::unordered_map<EntityRef*, bool> m_refs;
+
+    };
 }
 
 #endif //SR_ENGINE_UTILS_ENTITY_REF_UTILS_H
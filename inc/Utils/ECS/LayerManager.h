@@ -6,6 +6,8 @@
 #define SR_ENGINE_LAYER_MANAGER_H
 
 #include <Utils/Settings.h>
+#include <Utils/Types/Map.h>
+#include <Utils/ECS/ObjectMask.h>
 
 namespace SR_UTILS_NS {
     class LayerManager : public GlobalSettings<LayerManager> {
@@ -18,6 +20,10 @@ namespace SR_UTILS_NS {
         SR_NODISCARD uint16_t GetLayerIndex(StringAtom layer) const;
         SR_NODISCARD std::vector<StringAtom> GetLayers() const { return m_layers; }
 
+        /// бит слоя по его индексу, слой по умолчанию всегда имеет бит. Неизвестный слой - пустая маска
+        SR_NODISCARD ObjectMask GetLayerMask(StringAtom layer) const;
+        SR_NODISCARD ObjectMask GetLayersMask(std::initializer_list<StringAtom> layers) const;
+
         SR_NODISCARD static StringAtom GetDefaultLayer();
 
         SR_NODISCARD uint64_t GetHashState() const { return m_hashState; }
@@ -30,6 +36,9 @@ namespace SR_UTILS_NS {
 
     private:
         std::vector<StringAtom> m_layers;
+        ska::flat_hash_map<StringAtom, uint16_t> m_indices;
+        /// если слоя по умолчанию нет в списке, его бит идет следом за остальными
+        uint16_t m_defaultLayerIndex = 0;
         std::atomic<StringAtom> m_defaultLayer;
         uint64_t m_hashState = 0;
 
@@ -10,22 +10,78 @@
 #include <Utils/Types/Marshal.h>
 
 namespace SR_UTILS_NS {
+    /**
+     * Миграции сериализованных данных между версиями.
+     * Цепочка шагов from -> to ищется один раз (кратчайший путь по зарегистрированным шагам) и кэшируется.
+     * Migrator меняет данные прямо в маршале с текущей позиции и возвращает позицию на начало тела.
+     * BufferMigrator читает старое тело из input и пишет новое в output, между шагами используются
+     * два переиспользуемых буфера, а результат вписывается на место старого тела без копирования остального маршала.
+     * При неудаче любого шага маршал вызывающего возвращается к исходному виду и позиции:
+     * перед первым шагом Migrator остаток маршала копируется в снимок и при ошибке пишется обратно.
+    */
     class Migration : public Singleton<Migration> {
         SR_REGISTER_SINGLETON(Migration)
+    public:
         using Version = uint16_t;
         using Migrator = SR_HTYPES_NS::Function<bool(SR_HTYPES_NS::Marshal&)>;
+        using BufferMigrator = SR_HTYPES_NS::Function<bool(SR_HTYPES_NS::Marshal& input, SR_HTYPES_NS::Marshal& output)>;
+
+    private:
         struct MigrationInfo {
             Version from;
             Version to;
             Migrator migrator;
+            BufferMigrator bufferMigrator;
         };
+
+        struct PlanKey {
+            uint64_t hashName;
+            Version from;
+            Version to;
+
+            SR_NODISCARD bool operator==(const PlanKey& other) const noexcept {
+                return hashName == other.hashName && from == other.from && to == other.to;
+            }
+        };
+
+        struct PlanKeyHash {
+            SR_NODISCARD size_t operator()(const PlanKey& key) const noexcept {
+                return SR_COMBINE_HASHES(key.hashName, (static_cast<uint64_t>(key.from) << 16U) | key.to);
+            }
+        };
+
+        /// пустой план - пути нет
+        using Plan = std::vector<const MigrationInfo*>;
+
     public:
-        bool Migrate(uint64_t hashName, SR_HTYPES_NS::Marshal& pMarshal, Version from, Version to) const;
+        /**
+         * Тело читается с текущей позиции маршала, после успеха позиция указывает на начало нового тела.
+         * Если новое тело короче старого, оно пишется вплотную к концу старого, чтобы не сдвигать хвост,
+         * и байты между прежней и новой позицией остаются мусором. Такой маршал дочитывается с позиции,
+         * а сохранять его целиком нельзя - для этого нужна сериализация заново.
+        */
+        bool Migrate(uint64_t hashName, SR_HTYPES_NS::Marshal& marshal, Version from, Version to) const;
+
+        /// мигрирует пачку однотипных данных одним планом и одной парой буферов, возвращает число успешных
+        uint64_t MigrateBatch(uint64_t hashName, const std::vector<SR_HTYPES_NS::Marshal*>& marshals, Version from, Version to) const;
 
         bool RegisterMigrator(uint64_t hashName, Version from, Version to, Migrator&& migrator);
+        bool RegisterBufferMigrator(uint64_t hashName, Version from, Version to, BufferMigrator&& migrator);
+
+        SR_NODISCARD bool CanMigrate(uint64_t hashName, Version from, Version to) const;
+        /// число шагов цепочки, 0 - пути нет
+        SR_NODISCARD uint32_t GetChainLength(uint64_t hashName, Version from, Version to) const;
+
+    private:
+        SR_NODISCARD Plan GetPlan(uint64_t hashName, Version from, Version to) const;
+        SR_NODISCARD Plan BuildPlan(uint64_t hashName, Version from, Version to) const;
+
+        static bool ApplyPlan(const Plan& plan, SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal* pBuffers);
 
     private:
-        std::map<uint64_t, std::vector<MigrationInfo>> m_migrators;
+        /// deque не переносит шаги при регистрации новых, планы хранят на них указатели
+        std::map<uint64_t, std::deque<MigrationInfo>> m_migrators;
+        mutable std::unordered_map<PlanKey, Plan, PlanKeyHash> m_plans;
 
     };
 }
@@ -0,0 +1,47 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_UTILS_OBJECT_MASK_H
+#define SR_ENGINE_UTILS_OBJECT_MASK_H
+
+#include <Utils/stdInclude.h>
+
+namespace SR_UTILS_NS {
+    /// Бит тега или слоя по плотному индексу, который назначается при загрузке настроек
+    using ObjectMask = uint64_t;
+
+    static constexpr uint16_t SR_OBJECT_MASK_BITS = 64;
+    static constexpr ObjectMask SR_OBJECT_MASK_NONE = 0;
+    static constexpr ObjectMask SR_OBJECT_MASK_ALL = ~static_cast<ObjectMask>(0);
+
+    SR_NODISCARD constexpr ObjectMask MakeObjectMask(uint16_t index) noexcept {
+        return index < SR_OBJECT_MASK_BITS ? (static_cast<ObjectMask>(1) << index) : SR_OBJECT_MASK_NONE;
+    }
+
+    /**
+     * Фильтр вида "объекты с тегами A|B не в слое C".
+     * Пустой слот сцены имеет маску слоя 0 и не проходит ни один фильтр.
+    */
+    struct ObjectMaskQuery {
+        /// хотя бы один из тегов, SR_OBJECT_MASK_ALL - теги не проверяются
+        ObjectMask anyTags = SR_OBJECT_MASK_ALL;
+        /// хотя бы один из слоев
+        ObjectMask includeLayers = SR_OBJECT_MASK_ALL;
+        /// ни одного из слоев
+        ObjectMask excludeLayers = SR_OBJECT_MASK_NONE;
+
+        SR_NODISCARD SR_FORCE_INLINE bool Test(ObjectMask tags, ObjectMask layers) const noexcept {
+            return (anyTags == SR_OBJECT_MASK_ALL || (tags & anyTags) != 0)
+                && (layers & includeLayers) != 0
+                && (layers & excludeLayers) == 0;
+        }
+    };
+
+    /// Записывает в pIndices индексы прошедших фильтр элементов по возрастанию, возвращает их количество.
+    /// pIndices должен вмещать count элементов.
+    SR_DLL_EXPORT uint32_t FilterObjectMasks(const ObjectMask* pTags, const ObjectMask* pLayers, uint32_t count,
+        const ObjectMaskQuery& query, uint32_t* pIndices) noexcept;
+}
+
+#endif //SR_ENGINE_UTILS_OBJECT_MASK_H
@@ -25,6 +25,7 @@ namespace SR_UTILS_NS {
         SR_CLASS()
         using Super = IComponentable;
     public:
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::SceneObjects)
         using Ptr = SR_HTYPES_NS::SharedPtr<SceneObject>;
         using ScenePtr = SR_WORLD_NS::Scene*;
         using ObjectNameT = SR_UTILS_NS::StringAtom;
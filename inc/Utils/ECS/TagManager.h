@@ -7,6 +7,7 @@
 
 #include <Utils/Settings.h>
 #include <Utils/Types/Map.h>
+#include <Utils/ECS/ObjectMask.h>
 
 namespace SR_UTILS_NS {
     class TagManager : public GlobalSettings<TagManager> {
@@ -23,6 +24,13 @@ namespace SR_UTILS_NS {
         SR_NODISCARD uint16_t GetTagIndex(StringAtom tag) const;
         SR_NODISCARD const std::vector<StringAtom>& GetTags() const { return m_tags; }
 
+        /// бит тега по его индексу, первые SR_OBJECT_MASK_BITS тегов. Неизвестный тег - пустая маска
+        SR_NODISCARD ObjectMask GetTagMask(StringAtom tag) const;
+        SR_NODISCARD ObjectMask GetTagsMask(std::initializer_list<StringAtom> tags) const;
+
+        /// меняется при каждой загрузке настроек, индексы тегов могли измениться
+        SR_NODISCARD uint64_t GetHashState() const { return m_hashState; }
+
     protected:
         SR_NODISCARD SR_UTILS_NS::Path InitializeResourcePath() const override;
 
@@ -32,8 +40,9 @@ namespace SR_UTILS_NS {
         void RegisterTag(StringAtom tag);
 
     private:
-        std::map<StringAtom, uint16_t> m_indices;
+        ska::flat_hash_map<StringAtom, uint16_t> m_indices;
         std::vector<StringAtom> m_tags;
+        uint64_t m_hashState = 0;
 
     };
 }
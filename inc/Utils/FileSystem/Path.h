@@ -11,73 +11,52 @@
 #include <Utils/Common/Breakpoint.h>
 
 namespace SR_UTILS_NS {
+    /**
+     * Путь хранится в пуле в нормализованном виде вместе с именем, расширением и хешем,
+     * сам Path - указатель на запись пула со счетчиком ссылок, копирование ничего не разбирает и не выделяет.
+     * Запись общая для всех копий, поэтому Path неизменяемый: изменяемых operator[] и ToStringPtr() больше нет,
+     * новый путь собирается из ToString() и конструируется заново.
+     * Тип (файл/папка) может кешироваться в записи (SetMetadataLifetime, по умолчанию кеш выключен):
+     * кеш сбрасывается после изменений через FileSystem и Platform, наблюдателями файлов и по истечению времени жизни.
+     * Запись через std::ofstream и изменения других процессов кеш не сбрасывают, поэтому включать его стоит
+     * только там, где файлы отслеживаются наблюдателями.
+    */
     class SR_DLL_EXPORT Path {
     public:
         enum class Type {
             Undefined, File, Folder
         };
 
+        struct Data;
+
+        struct MetadataStats {
+            uint64_t queries = 0;
+            uint64_t syscalls = 0;
+        };
+
     public:
         Path();
-        Path(const Path& path);
+        Path(const Path& path) noexcept;
+        Path(Path&& path) noexcept;
         Path(const char* path);
         Path(SR_UTILS_NS::StringAtom stringAtom);
         Path(std::string path);
         Path(std::string_view path);
         Path(std::wstring path);
 
-        Path(Path&& path) noexcept
-            : m_path(SR_UTILS_NS::Exchange(path.m_path, {}))
-            , m_name(std::exchange(path.m_name, {}))
-            , m_ext(std::exchange(path.m_ext, {}))
-            , m_hash(std::exchange(path.m_hash, {}))
-            , m_type(std::exchange(path.m_type, {}))
-        { }
-
-        Path& operator=(Path&& path) noexcept {
-            m_path = std::exchange(path.m_path, {});
-            m_name = std::exchange(path.m_name, {});
-            m_ext = std::exchange(path.m_ext, {});
-            m_hash = std::exchange(path.m_hash, {});
-            m_type = std::exchange(path.m_type, {});
-            return *this;
-        }
-
-        operator const std::string&() { return m_path; } /** NOLINT */
-
-        Path& operator=(const Path& path) {
-            m_path = path.m_path;
+        ~Path();
 
-            ExtractNameAndExt();
+        Path& operator=(const Path& path) noexcept;
+        Path& operator=(Path&& path) noexcept;
 
-            m_hash = path.m_hash;
-            m_type = path.m_type;
-
-            return *this;
-        }
+        operator const std::string&() const noexcept; /** NOLINT */
 
+        /// пути интернированы, одинаковые после нормализации пути указывают на одну запись
         bool operator==(const Path& path) const noexcept {
-            return m_path == path.ToStringRef();
+            return m_data == path.m_data;
         }
 
-        char operator[](size_t index) const noexcept {
-            if (index >= m_path.size()) {
-                 std::cerr << "Path::operator[] : index is out of range!\n";
-                 SR_MAKE_BREAKPOINT;
-                 return char();
-            }
-            return m_path[index];
-        }
-
-        char& operator[](size_t index) noexcept {
-            if (index >= m_path.size()) {
-                std::cerr << "Path::operator[] : index is out of range!\n";
-                SR_MAKE_BREAKPOINT;
-                static char def = char();
-                return def;
-            }
-            return m_path[index];
-        }
+        char operator[](size_t index) const noexcept;
 
     public:
         SR_DEPRECATED bool Make(Type type = Type::Undefined) const;
@@ -89,7 +68,6 @@ namespace SR_UTILS_NS {
         SR_NODISCARD std::string ToString() const;
         SR_NODISCARD std::string ConvertToFileName() const;
         SR_NODISCARD const std::string& ToStringRef() const;
-        SR_NODISCARD std::string* ToStringPtr() { return &m_path; }
         SR_NODISCARD std::string_view ToStringView() const;
         SR_NODISCARD std::wstring ToWinApiPath() const;
         SR_NODISCARD std::wstring ToUnicodeString() const;
@@ -107,6 +85,7 @@ namespace SR_UTILS_NS {
         SR_NODISCARD Path RemoveSubPath(const Path& subPath) const;
         SR_NODISCARD Path SelfRemoveSubPath(const Path& subPath) const;
 
+        /// путь существует по закешированному типу (см. GetType), а не на момент создания Path, как было раньше
         SR_NODISCARD bool Valid() const;
         SR_NODISCARD bool empty() const { return IsEmpty(); }
         SR_NODISCARD bool IsSubPath(const Path& subPath) const;
@@ -115,7 +94,10 @@ namespace SR_UTILS_NS {
         SR_NODISCARD bool Exists() const;
         SR_NODISCARD bool Exists(Type type) const;
 
+        /// тип из кеша, если он актуален
         SR_NODISCARD Type GetType() const;
+        /// всегда обращается к файловой системе и обновляет кеш
+        SR_NODISCARD Type QueryType() const;
         SR_NODISCARD bool IsDir() const;
         SR_NODISCARD bool IsFile() const;
         SR_NODISCARD bool IsAbs() const;
@@ -134,19 +116,23 @@ namespace SR_UTILS_NS {
         SR_NODISCARD std::string GetBaseName() const;
         SR_NODISCARD std::string GetBaseNameAndExt() const;
 
-    private:
-        void Update();
+        /// сбросить закешированный тип этого пути
+        void InvalidateMetadata() const noexcept;
 
-        Path Normalize();
-        void NormalizeSelf();
-        void ExtractNameAndExt();
+    public:
+        /// сбросить закешированные типы всех путей
+        static void InvalidateAllMetadata() noexcept;
+        /// 0 - кеш типов отключен
+        static void SetMetadataLifetime(uint32_t milliseconds) noexcept;
+        SR_NODISCARD static MetadataStats GetMetadataStats() noexcept;
+        /// число различных путей, на которые сейчас есть ссылки
+        SR_NODISCARD static uint64_t GetPoolSize();
+
+    private:
+        SR_NODISCARD static const Data* GetEmptyData() noexcept;
 
     private:
-        std::string m_path;
-        std::string_view m_name;
-        std::string_view m_ext;
-        uint64_t    m_hash;
-        Type        m_type;
+        const Data* m_data;
 
     };
 }
@@ -7,6 +7,7 @@
 
 #include <Utils/Localization/Convert.h>
 #include <Utils/Localization/UTF.h>
+#include <Utils/Localization/Transcode.h>
 
 namespace SR_UTILS_NS::Localization {
     SR_MAYBE_UNUSED static void SetLocale() {
@@ -15,26 +16,38 @@ namespace SR_UTILS_NS::Localization {
     }
 
     template<typename CharOut,typename CharIn> std::basic_string<CharOut> UtfToUtf(CharIn const *begin, CharIn const *end, EncMethodType how = EncMethodType::Default) {
+        const auto size = static_cast<uint64_t>(end - begin);
+
         std::basic_string<CharOut> result;
-        result.reserve(end - begin);
+        result.resize(GetMaxTranscodedLength<CharOut, CharIn>(size));
+
+        uint64_t read = 0;
+        uint64_t written = 0;
 
-        typedef std::back_insert_iterator<std::basic_string<CharOut>> inserter_type;
-        inserter_type inserter(result);
+        while (true) {
+            const TranscodeResult transcoded = Transcode<CharOut, CharIn>(
+                begin + read, size - read, result.data() + written, result.size() - written
+            );
 
-        Utf::CodePoint c;
+            read += transcoded.read;
+            written += transcoded.written;
 
-        while (begin != end) {
-            c = Utf::UtfTraits<CharIn>::template Decode<CharIn const *>(begin, end);
-            if (c == Utf::Illegal || c == Utf::Incomplete) {
-                if (how == EncMethodType::Stop) {
-                    SRHalt("Conversion error!");
-                    return std::basic_string<CharOut>();
-                }
+            if (transcoded.Ok()) {
+                break;
             }
-            else {
-                Utf::UtfTraits<CharOut>::template Encode<inserter_type>(c, inserter);
+
+            if (how == EncMethodType::Stop || transcoded.error == TranscodeError::OutOfSpace) {
+                SRHalt("Conversion error!");
+                return std::basic_string<CharOut>();
             }
+
+            /// пропускаем некорректную последовательность так же, как это делает скалярный декодер
+            CharIn const* pIllegal = begin + read;
+            Utf::UtfTraits<CharIn>::template Decode<CharIn const *>(pIllegal, end);
+            read = static_cast<uint64_t>(pIllegal - begin);
         }
+
+        result.resize(written);
         return result;
     }
 
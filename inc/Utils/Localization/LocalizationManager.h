@@ -6,6 +6,7 @@
 
 ///#include <Graphics/Font/ITextComponent.h>
 #include <Utils/Types/UnicodeString.h>
+#include <Utils/Localization/LocalizationTable.h>
 
 namespace SR_CORE_NS {
     class Engine;
@@ -32,14 +33,20 @@ namespace SR_UTILS_NS::Localization {
         LocalizationFile() = default;
         ~LocalizationFile();
         LocalizationFile(const std::unordered_map<Locale, Path>& localePaths, const Locale& languageToLoad);
+        LocalizationFile(LocalizationFile&& other) noexcept = default;
+        LocalizationFile& operator=(LocalizationFile&& other) noexcept = default;
         void SwitchFileByLocale(const Locale& newLocale);
         void LoadLocalizationStrings(const Path& filePath);
         SR_HTYPES_NS::UnicodeString GetStringById(const StringAtom& id);
+        /// UTF-8 строка прямо из отображенной таблицы, живет до смены локали
+        SR_NODISCARD std::string_view GetStringViewById(const StringAtom& id) const;
+
+        /// путь скомпилированной таблицы для YAML-файла локализации
+        SR_NODISCARD static Path GetTablePath(const Path& filePath);
     private:
         std::unordered_map<Locale, Path> m_localePaths = { };
         FileWatcher::Ptr m_watchedFile = nullptr;
-        std::unordered_map<StringAtom, SR_HTYPES_NS::UnicodeString> m_locStrings = { }; ///first - id, second - UnicodeString for string itself
-        ///TODO: Использование UnicodeString(u32string) является избыточным, можно продумать смену локали с UTF8
+        LocalizationTable m_table;
     };
 
     /*class LocalizationGroup {
@@ -0,0 +1,90 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_LOCALIZATION_TABLE_H
+#define SR_ENGINE_LOCALIZATION_TABLE_H
+
+#include <Utils/Types/MappedFile.h>
+
+namespace SR_UTILS_NS::Localization {
+    /**
+     * Скомпилированная таблица строк одного языка. Исходником остается YAML, таблица собирается из него
+     * заранее (или при первой загрузке) и открывается через отображение файла в память без разбора и копирования.
+     * Формат: заголовок, смещения корзин идеальной хеш-функции, слоты по ключам, пул UTF-8 строк.
+     * Поиск - одно хеширование ключа и одно сравнение, результат - представление строки из пула.
+    */
+    class SR_DLL_EXPORT LocalizationTable : public SR_UTILS_NS::NonCopyable {
+    public:
+        static constexpr uint32_t TABLE_MAGIC = 0x544C5253; /// "SRLT"
+        static constexpr uint32_t TABLE_VERSION = 1;
+
+#pragma pack(push, 1)
+        struct Header {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t count;
+            uint32_t bucketCount;
+            /// хеш исходного YAML, по нему проверяется актуальность таблицы
+            uint64_t sourceHash;
+            uint64_t slotsOffset;
+            uint64_t poolOffset;
+            uint64_t poolSize;
+        };
+
+        struct Slot {
+            uint64_t keyHash;
+            uint32_t keyOffset;
+            uint32_t keySize;
+            uint32_t valueOffset;
+            uint32_t valueSize;
+        };
+#pragma pack(pop)
+
+        using Entries = std::vector<std::pair<std::string, std::string>>;
+
+    public:
+        LocalizationTable() = default;
+        LocalizationTable(LocalizationTable&& other) noexcept;
+        ~LocalizationTable() override = default;
+
+        LocalizationTable& operator=(LocalizationTable&& other) noexcept;
+
+    public:
+        /// при повторяющихся ключах остается последнее значение
+        SR_NODISCARD static std::string Compile(const Entries& entries, uint64_t sourceHash = 0);
+        static bool CompileYaml(const Path& yamlPath, const Path& tablePath);
+        SR_NODISCARD static uint64_t ReadSourceHash(const Path& tablePath);
+
+        bool Load(const Path& tablePath);
+        /// данные не копируются и должны пережить таблицу
+        bool LoadFromMemory(const char* pData, uint64_t size);
+        void Clear();
+
+        /// пустое представление, если ключа нет. Значения в пуле завершаются нулем
+        SR_NODISCARD std::string_view Find(std::string_view key) const noexcept;
+        SR_NODISCARD bool Contains(std::string_view key) const noexcept;
+
+        SR_NODISCARD bool Valid() const noexcept { return m_slots; }
+        SR_NODISCARD uint32_t GetCount() const noexcept { return m_count; }
+        SR_NODISCARD uint64_t GetSourceHash() const noexcept { return m_sourceHash; }
+
+    private:
+        SR_NODISCARD const Slot* FindSlot(std::string_view key) const noexcept;
+
+    private:
+        SR_HTYPES_NS::MappedFile m_file;
+
+        const int32_t* m_displacements = nullptr;
+        const Slot* m_slots = nullptr;
+        const char* m_pool = nullptr;
+        uint64_t m_poolSize = 0;
+
+        uint32_t m_count = 0;
+        uint32_t m_bucketCount = 0;
+        uint64_t m_sourceHash = 0;
+
+    };
+}
+
+#endif //SR_ENGINE_LOCALIZATION_TABLE_H
@@ -0,0 +1,105 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_TRANSCODE_H
+#define SR_ENGINE_TRANSCODE_H
+
+#include <Utils/stdInclude.h>
+
+namespace SR_UTILS_NS::Localization {
+    /**
+     * Проверка и преобразование UTF-8/16/32 в буферы вызывающего без выделения памяти.
+     * Вход проверяется векторно (SSSE3 - полная проверка UTF-8, SSE2 - ASCII и BMP блоки),
+     * корректный текст конвертируется блоками, остальное - скалярным декодером из UTF.h.
+     * ICU нужен только для преобразований между кодировками, зависящими от локали (Convert.h).
+    */
+    enum class TranscodeError : uint8_t {
+        None, Illegal, Incomplete, OutOfSpace
+    };
+
+    struct TranscodeResult {
+        TranscodeError error = TranscodeError::None;
+        /// при ошибке - позиция первой некорректной (или не поместившейся) последовательности во входе
+        uint64_t read = 0;
+        /// записано единиц в выходной буфер, при ошибке - до позиции read
+        uint64_t written = 0;
+
+        SR_NODISCARD bool Ok() const noexcept { return error == TranscodeError::None; }
+    };
+
+    SR_DLL_EXPORT SR_NODISCARD bool ValidateUtf8(const char* pData, uint64_t size) noexcept;
+    SR_DLL_EXPORT SR_NODISCARD bool ValidateUtf16(const char16_t* pData, uint64_t size) noexcept;
+    SR_DLL_EXPORT SR_NODISCARD bool ValidateUtf32(const char32_t* pData, uint64_t size) noexcept;
+
+    /// Точный размер результата в единицах выходной кодировки, вход должен быть корректным
+    SR_DLL_EXPORT SR_NODISCARD uint64_t Utf16LengthFromUtf8(const char* pData, uint64_t size) noexcept;
+    SR_DLL_EXPORT SR_NODISCARD uint64_t Utf32LengthFromUtf8(const char* pData, uint64_t size) noexcept;
+    SR_DLL_EXPORT SR_NODISCARD uint64_t Utf8LengthFromUtf16(const char16_t* pData, uint64_t size) noexcept;
+    SR_DLL_EXPORT SR_NODISCARD uint64_t Utf32LengthFromUtf16(const char16_t* pData, uint64_t size) noexcept;
+    SR_DLL_EXPORT SR_NODISCARD uint64_t Utf8LengthFromUtf32(const char32_t* pData, uint64_t size) noexcept;
+    SR_DLL_EXPORT SR_NODISCARD uint64_t Utf16LengthFromUtf32(const char32_t* pData, uint64_t size) noexcept;
+
+    /// Преобразования с проверкой. Выходной буфер достаточен, если он не меньше
+    /// GetMaxTranscodedLength или точного размера из функций выше.
+    SR_DLL_EXPORT TranscodeResult Utf8ToUtf16(const char* pIn, uint64_t size, char16_t* pOut, uint64_t capacity) noexcept;
+    SR_DLL_EXPORT TranscodeResult Utf8ToUtf32(const char* pIn, uint64_t size, char32_t* pOut, uint64_t capacity) noexcept;
+    SR_DLL_EXPORT TranscodeResult Utf16ToUtf8(const char16_t* pIn, uint64_t size, char* pOut, uint64_t capacity) noexcept;
+    SR_DLL_EXPORT TranscodeResult Utf16ToUtf32(const char16_t* pIn, uint64_t size, char32_t* pOut, uint64_t capacity) noexcept;
+    SR_DLL_EXPORT TranscodeResult Utf32ToUtf8(const char32_t* pIn, uint64_t size, char* pOut, uint64_t capacity) noexcept;
+    SR_DLL_EXPORT TranscodeResult Utf32ToUtf16(const char32_t* pIn, uint64_t size, char16_t* pOut, uint64_t capacity) noexcept;
+
+    /// Копирование с проверкой, для единообразия шаблона Transcode
+    SR_DLL_EXPORT TranscodeResult Utf8ToUtf8(const char* pIn, uint64_t size, char* pOut, uint64_t capacity) noexcept;
+    SR_DLL_EXPORT TranscodeResult Utf16ToUtf16(const char16_t* pIn, uint64_t size, char16_t* pOut, uint64_t capacity) noexcept;
+    SR_DLL_EXPORT TranscodeResult Utf32ToUtf32(const char32_t* pIn, uint64_t size, char32_t* pOut, uint64_t capacity) noexcept;
+
+    /// "SSSE3", "SSE2" или "Scalar" - с каким набором инструкций собран модуль
+    SR_DLL_EXPORT SR_NODISCARD const char* GetTranscodeInstructionSet() noexcept;
+
+    template<typename CharOut, typename CharIn> SR_NODISCARD constexpr uint64_t GetMaxTranscodedLength(uint64_t size) noexcept {
+        if constexpr (sizeof(CharOut) == 1) {
+            return size * (sizeof(CharIn) == 1 ? 1 : (sizeof(CharIn) == 2 ? 3 : 4));
+        }
+        else if constexpr (sizeof(CharOut) == 2) {
+            return size * (sizeof(CharIn) == 4 ? 2 : 1);
+        }
+        else {
+            return size;
+        }
+    }
+
+    namespace Detail {
+        template<uint64_t Size> struct TranscodeUnit;
+        template<> struct TranscodeUnit<1> { using Type = char; };
+        template<> struct TranscodeUnit<2> { using Type = char16_t; };
+        template<> struct TranscodeUnit<4> { using Type = char32_t; };
+    }
+
+    /// Выбор функции по размерам символов, подходит для wchar_t и char8_t
+    template<typename CharOut, typename CharIn> TranscodeResult Transcode(const CharIn* pIn, uint64_t size, CharOut* pOut, uint64_t capacity) noexcept {
+        using In = typename Detail::TranscodeUnit<sizeof(CharIn)>::Type;
+        using Out = typename Detail::TranscodeUnit<sizeof(CharOut)>::Type;
+
+        auto&& pSource = reinterpret_cast<const In*>(pIn);
+        auto&& pDestination = reinterpret_cast<Out*>(pOut);
+
+        if constexpr (sizeof(CharIn) == 1) {
+            if constexpr (sizeof(CharOut) == 1) { return Utf8ToUtf8(pSource, size, pDestination, capacity); }
+            else if constexpr (sizeof(CharOut) == 2) { return Utf8ToUtf16(pSource, size, pDestination, capacity); }
+            else { return Utf8ToUtf32(pSource, size, pDestination, capacity); }
+        }
+        else if constexpr (sizeof(CharIn) == 2) {
+            if constexpr (sizeof(CharOut) == 1) { return Utf16ToUtf8(pSource, size, pDestination, capacity); }
+            else if constexpr (sizeof(CharOut) == 2) { return Utf16ToUtf16(pSource, size, pDestination, capacity); }
+            else { return Utf16ToUtf32(pSource, size, pDestination, capacity); }
+        }
+        else {
+            if constexpr (sizeof(CharOut) == 1) { return Utf32ToUtf8(pSource, size, pDestination, capacity); }
+            else if constexpr (sizeof(CharOut) == 2) { return Utf32ToUtf16(pSource, size, pDestination, capacity); }
+            else { return Utf32ToUtf32(pSource, size, pDestination, capacity); }
+        }
+    }
+}
+
+#endif //SR_ENGINE_TRANSCODE_H
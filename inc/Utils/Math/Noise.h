@@ -11,6 +11,23 @@
 /// (must be length of the tables - 1)
 #define SR_NOISE_TABLE_MASK 0xff
 
+/// Ядра шума собираются без сжатия a * b + c в FMA (-mfma, -march=native): оно дает разное округление
+/// в векторном и скалярном путях, и пакетные сетки перестают совпадать с SNoise.
+/// Остальной код единицы сборки флаги не затрагивают. MSVC с /fp:precise выражения не сжимает.
+#if defined(__clang__)
+    #define SR_NOISE_FP_CONTRACT_OFF_BEGIN _Pragma("float_control(push)") _Pragma("clang fp contract(off)")
+    #define SR_NOISE_FP_CONTRACT_OFF_END _Pragma("float_control(pop)")
+#elif defined(__GNUC__)
+    #define SR_NOISE_FP_CONTRACT_OFF_BEGIN _Pragma("GCC push_options") _Pragma("GCC optimize(\"fp-contract=off\")")
+    #define SR_NOISE_FP_CONTRACT_OFF_END _Pragma("GCC pop_options")
+#else
+    #define SR_NOISE_FP_CONTRACT_OFF_BEGIN
+    #define SR_NOISE_FP_CONTRACT_OFF_END
+#endif
+
+/// объявления тоже внутри: опции шаблона GCC берет из первого объявления
+SR_NOISE_FP_CONTRACT_OFF_BEGIN
+
 namespace SR_MATH_NS {
     SR_FORCE_INLINE uint8_t TableIndex2D(int32_t ix, int32_t iy) {
         return NoiseTable::perm[(ix + NoiseTable::perm[iy & SR_NOISE_TABLE_MASK]) & SR_NOISE_TABLE_MASK];
@@ -31,6 +48,43 @@ namespace SR_MATH_NS {
     double_t SNoise(double_t x, double_t y);
     double_t SNoise(double_t x, double_t y, double_t z);
     double_t SNoise(double_t x, double_t y, double_t z, double_t t);
+
+    /// Пакетное заполнение сеток, результат совпадает с поэлементным вызовом SNoise.
+    /// Внутри строки пересчитывается только ось X, остальное вычисляется один раз на строку.
+    /// Совпадение бит в бит держится на SR_NOISE_FP_CONTRACT_OFF_BEGIN вокруг ядер.
+    /// 2D: pOut[y * width + x] = SNoise(originX + x * stepX, originY + y * stepY)
+    void SNoiseGrid2D(double_t* pOut, uint32_t width, uint32_t height, double_t originX, double_t originY, double_t stepX, double_t stepY);
+    void SNoiseGrid2D(float_t* pOut, uint32_t width, uint32_t height, double_t originX, double_t originY, double_t stepX, double_t stepY);
+
+    /// 3D: pOut[(z * height + y) * width + x] = SNoise(originX + x * stepX, originY + y * stepY, originZ + z * stepZ)
+    void SNoiseGrid3D(double_t* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ);
+    void SNoiseGrid3D(float_t* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ);
+
+    struct FBmSettings {
+        uint32_t octaves = 4;
+        double_t frequency = 1.0;
+        double_t amplitude = 1.0;
+        double_t lacunarity = 2.0;
+        double_t gain = 0.5;
+    };
+
+    /// Сумма октав: amplitude * gain^i * SNoise(p * frequency * lacunarity^i)
+    double_t FBm(double_t x, double_t y, const FBmSettings& settings);
+    double_t FBm(double_t x, double_t y, double_t z, const FBmSettings& settings);
+
+    void FBmGrid2D(double_t* pOut, uint32_t width, uint32_t height,
+        double_t originX, double_t originY, double_t stepX, double_t stepY, const FBmSettings& settings);
+    void FBmGrid2D(float_t* pOut, uint32_t width, uint32_t height,
+        double_t originX, double_t originY, double_t stepX, double_t stepY, const FBmSettings& settings);
+    void FBmGrid3D(double_t* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ, const FBmSettings& settings);
+    void FBmGrid3D(float_t* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ, const FBmSettings& settings);
+
+    /// Набор инструкций, с которым собраны пакетные функции: "AVX2", "SSE2" или "Scalar"
+    SR_NODISCARD const char* GetNoiseInstructionSet();
 }
 
 namespace SR_MATH_NS {
@@ -212,4 +266,6 @@ namespace SR_MATH_NS {
     }
 }
 
+SR_NOISE_FP_CONTRACT_OFF_END
+
 #endif //SR_ENGINE_NOISE_H
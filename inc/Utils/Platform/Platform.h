@@ -20,6 +20,51 @@ namespace SR_UTILS_NS::Platform {
         uint64_t lastWriteTime = SR_UINT64_MAX;
     };
 
+    /// отображение файла в память только для чтения
+    struct FileMapping {
+        const char* pData = nullptr;
+        uint64_t size = 0;
+        void* pHandle = nullptr;
+    };
+
+    /// Логический процессор и его место в топологии
+    struct CPUInfo {
+        uint32_t cpu = 0;
+        /// сквозной номер физического ядра, SMT-соседи делят его
+        uint32_t core = 0;
+        uint32_t package = 0;
+        /// номер группы логических процессоров с общим кешем последнего уровня
+        uint32_t cacheGroup = 0;
+    };
+
+    struct CPUTopology {
+        /// только доступные (online) процессоры, по возрастанию номера
+        std::vector<CPUInfo> cpus;
+        uint32_t coreCount = 0;
+        uint32_t packageCount = 0;
+        uint32_t cacheGroupCount = 0;
+
+        SR_NODISCARD std::vector<uint32_t> GetCoreCPUs(uint32_t core) const {
+            std::vector<uint32_t> result;
+            for (auto&& info : cpus) {
+                if (info.core == core) {
+                    result.emplace_back(info.cpu);
+                }
+            }
+            return result;
+        }
+
+        SR_NODISCARD std::vector<uint32_t> GetCacheGroupCPUs(uint32_t cacheGroup) const {
+            std::vector<uint32_t> result;
+            for (auto&& info : cpus) {
+                if (info.cacheGroup == cacheGroup) {
+                    result.emplace_back(info.cpu);
+                }
+            }
+            return result;
+        }
+    };
+
     struct MouseState {
         SR_MATH_NS::FVector2 position;
         /**
@@ -41,6 +86,8 @@ namespace SR_UTILS_NS::Platform {
     SR_DLL_EXPORT extern PlatformType GetType();
 
     SR_DLL_EXPORT extern std::optional<std::string> ReadFile(const Path& path);
+    SR_DLL_EXPORT extern bool MapFile(const Path& path, FileMapping& mapping);
+    SR_DLL_EXPORT extern void UnmapFile(FileMapping& mapping);
     SR_DLL_EXPORT extern void TextToClipboard(const std::string& text);
     SR_DLL_EXPORT extern void CopyFilesToClipboard(std::list<SR_UTILS_NS::Path> paths);
     SR_DLL_EXPORT extern void SetCurrentProcessDirectory(const SR_UTILS_NS::Path& directory);
@@ -83,7 +130,24 @@ namespace SR_UTILS_NS::Platform {
 
     SR_DLL_EXPORT extern void SetMousePos(const SR_MATH_NS::IVector2& pos);
     SR_DLL_EXPORT extern void SetCursorVisible(bool isVisible);
-    SR_DLL_EXPORT extern void SetThreadPriority(void* nativeHandle, ThreadPriority priority);
+
+    /// Потоки адресуются системным идентификатором: tid на Linux, идентификатор потока на Windows
+    SR_DLL_EXPORT extern uint64_t GetCurrentThreadNativeId();
+    /**
+     * false, если приоритет не выставлен или выставлен ближайший разрешенный.
+     * На Linux TIME_CRITICAL при CAP_SYS_NICE означает SCHED_FIFO: такой поток вытесняет все обычные
+     * и не должен крутиться без ожидания, иначе остальные потоки на его ядре не получат времени.
+     * Без CAP_SYS_NICE повышение приоритета (TIME_CRITICAL, HIGHEST, ABOVE_NORMAL) ограничено RLIMIT_NICE.
+    */
+    SR_DLL_EXPORT extern bool SetThreadPriority(uint64_t nativeId, ThreadPriority priority);
+    SR_DLL_EXPORT extern std::optional<ThreadPriority> GetThreadPriority(uint64_t nativeId);
+    /// пустой список снимает привязку (все доступные процессоры)
+    SR_DLL_EXPORT extern bool SetThreadAffinity(uint64_t nativeId, const std::vector<uint32_t>& cpus);
+    SR_DLL_EXPORT extern std::vector<uint32_t> GetThreadAffinity(uint64_t nativeId);
+    SR_DLL_EXPORT extern bool SetThreadName(uint64_t nativeId, const std::string& name);
+    SR_DLL_EXPORT extern std::string GetThreadName(uint64_t nativeId);
+    /// определяется один раз при первом обращении
+    SR_DLL_EXPORT extern const CPUTopology& GetCPUTopology();
     SR_DLL_EXPORT extern void CopyPermissions(const SR_UTILS_NS::Path& source, const SR_UTILS_NS::Path& destination);
 
 }
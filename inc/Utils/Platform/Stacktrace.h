@@ -8,9 +8,32 @@
 #include <Utils/stdInclude.h>
 
 namespace SR_UTILS_NS {
+    static constexpr uint32_t SR_STACKTRACE_MAX_FRAMES = 48;
+
+    /// Идентификатор стека в реестре, 0 - стек не захвачен
+    using StacktraceId = uint64_t;
+
     extern SR_DLL_EXPORT void DisableStacktrace();
-    extern SR_DLL_EXPORT std::string GetStacktrace();
+    extern SR_DLL_EXPORT SR_NODISCARD bool IsStacktraceEnabled();
     extern SR_DLL_EXPORT void StacktraceInit();
+
+    /// Захват и символизация сразу, для падений и ассертов
+    extern SR_DLL_EXPORT std::string GetStacktrace();
+
+    /// Только адреса возврата в буфер вызывающего, без выделения памяти и символизации.
+    /// skip - сколько кадров пропустить помимо самой функции
+    extern SR_DLL_EXPORT uint32_t CaptureStacktrace(void** pFrames, uint32_t maxFrames, uint32_t skip = 0);
+    extern SR_DLL_EXPORT std::string SymbolizeStacktrace(void* const* pFrames, uint32_t count);
+
+    /**
+     * Дешевая запись стека для профилирования: адреса хешируются, одинаковые стеки хранятся
+     * в реестре один раз и не выделяют память при повторе. Строки строятся только в ResolveStacktrace()
+     * и кэшируются, поэтому стоимость символизации платится один раз на уникальный стек и только при отчете.
+    */
+    extern SR_DLL_EXPORT StacktraceId CaptureStacktraceId(uint32_t skip = 0);
+    extern SR_DLL_EXPORT SR_NODISCARD std::string ResolveStacktrace(StacktraceId id);
+    extern SR_DLL_EXPORT SR_NODISCARD uint32_t GetStacktraceFrames(StacktraceId id, void** pFrames, uint32_t maxFrames);
+    extern SR_DLL_EXPORT SR_NODISCARD uint64_t GetUniqueStacktraceCount();
 }
 
 #endif //SR_ENGINE_UTILS_STACKTRACE_H
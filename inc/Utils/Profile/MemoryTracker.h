@@ -0,0 +1,124 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_UTILS_MEMORY_TRACKER_H
+#define SR_ENGINE_UTILS_MEMORY_TRACKER_H
+
+#include <Utils/Common/NonCopyable.h>
+
+namespace SR_UTILS_NS {
+    class Metrics;
+
+    /// Не через SR_ENUM: заголовок подключается из HashManager, на котором стоит EnumReflector
+    enum class MemoryTag : uint8_t {
+        Common,
+        Strings,
+        Resources,
+        ECS,
+        Components,
+        Scene,
+        SceneObjects,
+        SRLM,
+        Serialization,
+        Network,
+
+        MemoryTagMAX
+    };
+
+    struct MemoryTagStats {
+        MemoryTag tag = MemoryTag::Common;
+        int64_t liveBytes = 0;
+        int64_t peakBytes = 0;
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t allocatedBytes = 0;
+    };
+
+    /**
+     * Учет памяти по подсистемам. Освобождение всегда с размером (sized delete),
+     * поэтому к блоку не добавляется заголовок, а учет - несколько relaxed атомарных операций на тег.
+     * Без SR_MEMORY_TRACKING_ENABLE Allocate/Free сводятся к глобальным operator new/delete.
+     * Не синглтон: счетчики инициализируются константно и доступны во время статической инициализации.
+    */
+    class SR_DLL_EXPORT MemoryTracker : public NonCopyable {
+    public:
+        SR_NODISCARD static void* Allocate(size_t size, MemoryTag tag);
+        SR_NODISCARD static void* Allocate(size_t size, MemoryTag tag, std::align_val_t alignment);
+        static void Free(void* pMemory, size_t size, MemoryTag tag) noexcept;
+        static void Free(void* pMemory, size_t size, MemoryTag tag, std::align_val_t alignment) noexcept;
+
+        SR_NODISCARD static std::string_view GetTagName(MemoryTag tag) noexcept;
+
+        SR_NODISCARD static MemoryTagStats GetStats(MemoryTag tag) noexcept;
+        SR_NODISCARD static std::vector<MemoryTagStats> GetStats();
+
+        /// таблица по тегам, темп выделений считается от предыдущего вызова Dump
+        SR_NODISCARD static std::string Dump();
+
+        /// пишет в std::cerr теги с неосвобожденной памятью, вызывается при завершении (SingletonManager::DestroyAll)
+        static bool ReportLeaks();
+
+        /// публикует живые/пиковые байты и число выделений каждого тега в Metrics
+        static void RegisterMetrics(Metrics& metrics);
+
+    };
+
+    /// Аллокатор для контейнеров, относящий их память к тегу
+    template<typename T, MemoryTag Tag> class TaggedAllocator {
+    public:
+        using value_type = T;
+
+        template<typename U> struct rebind {
+            using other = TaggedAllocator<U, Tag>;
+        };
+
+    public:
+        TaggedAllocator() noexcept = default;
+        template<typename U> TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept { } /// NOLINT
+
+    public:
+        SR_NODISCARD T* allocate(size_t count) {
+            if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return static_cast<T*>(MemoryTracker::Allocate(count * sizeof(T), Tag, std::align_val_t(alignof(T))));
+            }
+            else {
+                return static_cast<T*>(MemoryTracker::Allocate(count * sizeof(T), Tag));
+            }
+        }
+
+        void deallocate(T* pMemory, size_t count) noexcept {
+            if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                MemoryTracker::Free(pMemory, count * sizeof(T), Tag, std::align_val_t(alignof(T)));
+            }
+            else {
+                MemoryTracker::Free(pMemory, count * sizeof(T), Tag);
+            }
+        }
+
+        template<typename U> SR_NODISCARD bool operator==(const TaggedAllocator<U, Tag>&) const noexcept { return true; }
+        template<typename U> SR_NODISCARD bool operator!=(const TaggedAllocator<U, Tag>&) const noexcept { return false; }
+
+    };
+}
+
+/// Относит все объекты класса (и наследников, если они не объявили свой тег) к тегу.
+/// Требует виртуального деструктора у иерархии, иначе delete через базу освободит неверный размер.
+/// Уровень доступа не меняет, ставится в public-секции класса
+#define SR_MEMORY_TAG(tag)                                                                                              \
+        static void* operator new(std::size_t size) {                                                                   \
+            return SR_UTILS_NS::MemoryTracker::Allocate(size, tag);                                                     \
+        }                                                                                                               \
+        static void* operator new(std::size_t size, std::align_val_t alignment) {                                       \
+            return SR_UTILS_NS::MemoryTracker::Allocate(size, tag, alignment);                                          \
+        }                                                                                                               \
+        static void* operator new(std::size_t, void* pPlace) noexcept { return pPlace; }                                \
+        static void operator delete(void* pMemory, std::size_t size) noexcept {                                         \
+            SR_UTILS_NS::MemoryTracker::Free(pMemory, size, tag);                                                       \
+        }                                                                                                               \
+        static void operator delete(void* pMemory, std::size_t size, std::align_val_t alignment) noexcept {             \
+            SR_UTILS_NS::MemoryTracker::Free(pMemory, size, tag, alignment);                                            \
+        }                                                                                                               \
+        static void operator delete(void*, void*) noexcept { }                                                          \
+
+#endif //SR_ENGINE_UTILS_MEMORY_TRACKER_H
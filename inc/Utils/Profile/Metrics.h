@@ -0,0 +1,243 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_UTILS_METRICS_H
+#define SR_ENGINE_UTILS_METRICS_H
+
+#include <Utils/Common/Singleton.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/Types/Function.h>
+
+#include <bit>
+
+namespace SR_UTILS_NS {
+    namespace MetricsDetail {
+        /// номер потока для выбора шарда, выдается один раз при первой записи из потока
+        SR_DLL_EXPORT uint32_t AcquireThreadSlot() noexcept;
+
+        inline uint32_t GetThreadSlot() noexcept {
+            static thread_local const uint32_t slot = AcquireThreadSlot();
+            return slot;
+        }
+    }
+
+    /**
+     * Монотонный счетчик. Значение разбито на шарды по потокам (каждый в своей кэш-линии),
+     * поэтому запись - один relaxed fetch_add без разделяемой между ядрами линии.
+     * Сумма собирается только при чтении.
+    */
+    class SR_DLL_EXPORT MetricCounter : public NonCopyable {
+        static constexpr uint32_t SHARDS_COUNT = 16;
+
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> value = 0;
+        };
+
+    public:
+        void Add(uint64_t value = 1) noexcept {
+            m_shards[MetricsDetail::GetThreadSlot() % SHARDS_COUNT].value.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        SR_NODISCARD uint64_t Get() const noexcept;
+        void Reset() noexcept;
+
+    private:
+        std::array<Shard, SHARDS_COUNT> m_shards;
+
+    };
+
+    /// Мгновенное значение: глубина очереди, число объектов и т.п.
+    class SR_DLL_EXPORT MetricGauge : public NonCopyable {
+    public:
+        void Set(int64_t value) noexcept { m_value.store(value, std::memory_order_relaxed); }
+        void Add(int64_t value) noexcept { m_value.fetch_add(value, std::memory_order_relaxed); }
+        void Sub(int64_t value) noexcept { m_value.fetch_sub(value, std::memory_order_relaxed); }
+
+        SR_NODISCARD int64_t Get() const noexcept { return m_value.load(std::memory_order_relaxed); }
+
+    private:
+        alignas(64) std::atomic<int64_t> m_value = 0;
+
+    };
+
+    /**
+     * Гистограмма в стиле HDR: на каждую степень двойки SUB_BUCKETS линейных корзин,
+     * относительная погрешность перцентиля не больше 1/SUB_BUCKETS при любом диапазоне значений.
+     * Значения до SUB_BUCKETS хранятся точно. Запись - несколько relaxed атомарных операций без блокировок.
+    */
+    class SR_DLL_EXPORT MetricHistogram : public NonCopyable {
+    public:
+        static constexpr uint32_t SUB_BUCKETS_BITS = 4;
+        static constexpr uint32_t SUB_BUCKETS = 1U << SUB_BUCKETS_BITS;
+        static constexpr uint32_t BUCKETS_COUNT = (64 - SUB_BUCKETS_BITS + 1) * SUB_BUCKETS;
+
+    public:
+        MetricHistogram();
+
+    public:
+        void Record(uint64_t value) noexcept {
+            m_buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(value, std::memory_order_relaxed);
+
+            uint64_t current = m_min.load(std::memory_order_relaxed);
+            while (value < current && !m_min.compare_exchange_weak(current, value, std::memory_order_relaxed)) { }
+
+            current = m_max.load(std::memory_order_relaxed);
+            while (value > current && !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed)) { }
+        }
+
+        SR_NODISCARD uint64_t GetCount() const noexcept { return m_count.load(std::memory_order_relaxed); }
+        SR_NODISCARD uint64_t GetSum() const noexcept { return m_sum.load(std::memory_order_relaxed); }
+        SR_NODISCARD uint64_t GetMin() const noexcept;
+        SR_NODISCARD uint64_t GetMax() const noexcept { return m_max.load(std::memory_order_relaxed); }
+
+        /// верхняя граница корзины, в которую попал перцентиль, percentile в [0, 100]
+        SR_NODISCARD uint64_t GetPercentile(double_t percentile) const noexcept;
+
+        void Reset() noexcept;
+
+        SR_NODISCARD static uint32_t GetBucketIndex(uint64_t value) noexcept {
+            if (value < SUB_BUCKETS) {
+                return static_cast<uint32_t>(value);
+            }
+
+            const uint32_t exponent = static_cast<uint32_t>(std::bit_width(value)) - 1;
+            const uint32_t shift = exponent - SUB_BUCKETS_BITS;
+            const auto subBucket = static_cast<uint32_t>((value >> shift) & (SUB_BUCKETS - 1));
+
+            return (shift + 1) * SUB_BUCKETS + subBucket;
+        }
+
+        SR_NODISCARD static uint64_t GetBucketLowerBound(uint32_t index) noexcept;
+        SR_NODISCARD static uint64_t GetBucketUpperBound(uint32_t index) noexcept;
+
+    private:
+        std::unique_ptr<std::atomic<uint64_t>[]> m_buckets;
+        std::atomic<uint64_t> m_count = 0;
+        std::atomic<uint64_t> m_sum = 0;
+        std::atomic<uint64_t> m_min = UINT64_MAX;
+        std::atomic<uint64_t> m_max = 0;
+
+    };
+
+    /// Записывает время жизни объекта в гистограмму, в наносекундах
+    class MetricScopedTimer : public NonCopyable {
+        using Clock = std::chrono::steady_clock;
+    public:
+        explicit MetricScopedTimer(MetricHistogram& histogram) noexcept
+            : m_histogram(histogram)
+            , m_start(Clock::now())
+        { }
+
+        ~MetricScopedTimer() override {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start).count();
+            m_histogram.Record(static_cast<uint64_t>(elapsed));
+        }
+
+    private:
+        MetricHistogram& m_histogram;
+        Clock::time_point m_start;
+
+    };
+
+    SR_ENUM_NS_CLASS_T(MetricType, uint8_t,
+        Counter,
+        Gauge,
+        Histogram
+    );
+
+    struct MetricSnapshot {
+        std::string name;
+        MetricType type = MetricType::Counter;
+        /// значение счетчика или датчика
+        int64_t value = 0;
+
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t min = 0;
+        uint64_t max = 0;
+        uint64_t p50 = 0;
+        uint64_t p90 = 0;
+        uint64_t p99 = 0;
+        uint64_t p999 = 0;
+    };
+
+    /**
+     * Реестр метрик процесса. Метрика создается при первом обращении по имени и живет до конца процесса,
+     * так что ссылку можно закэшировать (макросы SR_METRIC_* делают это в статической переменной)
+     * и дальше писать без обращения к реестру.
+     * Датчики-опросчики (RegisterSampler) вычисляются только при снимке и ничего не стоят в горячем пути.
+    */
+    class SR_DLL_EXPORT Metrics : public Singleton<Metrics> {
+        SR_REGISTER_SINGLETON(Metrics)
+    public:
+        using Sampler = SR_HTYPES_NS::Function<int64_t()>;
+
+    public:
+        SR_NODISCARD MetricCounter& GetCounter(std::string_view name);
+        SR_NODISCARD MetricGauge& GetGauge(std::string_view name);
+        SR_NODISCARD MetricHistogram& GetHistogram(std::string_view name);
+
+        void RegisterSampler(std::string_view name, Sampler&& sampler);
+
+        /// все метрики, отсортированные по имени
+        SR_NODISCARD std::vector<MetricSnapshot> Snapshot() const;
+        /// текстовый дамп снимка, одна метрика на строку
+        SR_NODISCARD std::string Dump() const;
+
+        /// обнуляет счетчики и гистограммы, датчики не трогает
+        void Reset();
+
+    protected:
+        void InitSingleton() override;
+        SR_NODISCARD bool IsSingletonCanBeDestroyed() const override { return false; }
+
+    private:
+        std::map<std::string, std::unique_ptr<MetricCounter>, std::less<>> m_counters;
+        std::map<std::string, std::unique_ptr<MetricGauge>, std::less<>> m_gauges;
+        std::map<std::string, std::unique_ptr<MetricHistogram>, std::less<>> m_histograms;
+        std::map<std::string, Sampler, std::less<>> m_samplers;
+
+    };
+}
+
+#ifdef SR_METRICS_ENABLE
+    #define SR_METRIC_COUNTER_ADD(name, value)                                                                          \
+        do {                                                                                                            \
+            static SR_UTILS_NS::MetricCounter& srMetric = SR_UTILS_NS::Metrics::Instance().GetCounter(name);          \
+            srMetric.Add(value);                                                                                        \
+        } while (false)
+
+    #define SR_METRIC_GAUGE_SET(name, value)                                                                            \
+        do {                                                                                                            \
+            static SR_UTILS_NS::MetricGauge& srMetric = SR_UTILS_NS::Metrics::Instance().GetGauge(name);              \
+            srMetric.Set(static_cast<int64_t>(value));                                                                  \
+        } while (false)
+
+    #define SR_METRIC_GAUGE_ADD(name, value)                                                                            \
+        do {                                                                                                            \
+            static SR_UTILS_NS::MetricGauge& srMetric = SR_UTILS_NS::Metrics::Instance().GetGauge(name);              \
+            srMetric.Add(static_cast<int64_t>(value));                                                                  \
+        } while (false)
+
+    #define SR_METRIC_HISTOGRAM_RECORD(name, value)                                                                     \
+        do {                                                                                                            \
+            static SR_UTILS_NS::MetricHistogram& srMetric = SR_UTILS_NS::Metrics::Instance().GetHistogram(name);      \
+            srMetric.Record(static_cast<uint64_t>(value));                                                              \
+        } while (false)
+
+    #define SR_METRIC_SCOPED_TIMER(name)                                                                                \
+        static SR_UTILS_NS::MetricHistogram& SR_MACRO_CONCAT(srMetricHistogram, SR_LINE) =                              \
+            SR_UTILS_NS::Metrics::Instance().GetHistogram(name);                                                        \
+        SR_UTILS_NS::MetricScopedTimer SR_MACRO_CONCAT(srMetricTimer, SR_LINE)(SR_MACRO_CONCAT(srMetricHistogram, SR_LINE))
+#else
+    #define SR_METRIC_COUNTER_ADD(name, value) SR_NOOP
+    #define SR_METRIC_GAUGE_SET(name, value) SR_NOOP
+    #define SR_METRIC_GAUGE_ADD(name, value) SR_NOOP
+    #define SR_METRIC_HISTOGRAM_RECORD(name, value) SR_NOOP
+    #define SR_METRIC_SCOPED_TIMER(name) SR_NOOP
+#endif
+
+#endif //SR_ENGINE_UTILS_METRICS_H
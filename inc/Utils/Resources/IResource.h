@@ -14,6 +14,7 @@
 #include <Utils/Types/SharedPtr.h>
 #include <Utils/Resources/ResourceContainer.h>
 #include <Utils/Resources/FileWatcher.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 namespace SR_UTILS_NS {
     class ResourceManager;
@@ -27,6 +28,7 @@ namespace SR_UTILS_NS {
         using Super = ResourceContainer;
         using ResourceInfoWeakPtr = std::weak_ptr<ResourceInfo>;
     public:
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Resources)
         SR_INLINE_STATIC const StringAtom RELOAD_DONE_EVENT = "ReloadDone";
 
         using Ptr = IResource*;
@@ -73,6 +75,8 @@ namespace SR_UTILS_NS {
         SR_NODISCARD std::string_view GetResourceName() const;
         SR_NODISCARD StringAtom GetResourcePath() const;
         SR_NODISCARD uint16_t GetCountUses() const noexcept;
+        /// уникальные стеки AddUsePoint/RemoveUsePoint с числом повторов, пусто без профилирования точек использования
+        SR_NODISCARD std::string GetUsePointsReport() const;
 
         SR_NODISCARD virtual IResource* CopyResource(IResource* destination) const;
 
@@ -133,8 +137,9 @@ namespace SR_UTILS_NS {
 
         std::list<SR_HTYPES_NS::SharedPtr<FileWatcher>> m_watchers;
 
-        std::list<SR_UTILS_NS::StringAtom> m_debugUseStackTraces;
-        std::list<SR_UTILS_NS::StringAtom> m_debugUnUseStackTraces;
+        /// идентификаторы из реестра стеков, символизируются только в GetUsePointsReport()
+        std::vector<SR_UTILS_NS::StacktraceId> m_debugUseStackTraces;
+        std::vector<SR_UTILS_NS::StacktraceId> m_debugUnUseStackTraces;
 
     private:
         ResourceInfoWeakPtr m_resourceInfo;
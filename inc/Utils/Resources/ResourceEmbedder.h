@@ -8,6 +8,7 @@
 #include <Utils/stdInclude.h>
 #include <Utils/FileSystem/Path.h>
 #include <Utils/Types/Map.h>
+#include <Utils/Types/Stream.h>
 
 namespace SR_UTILS_NS {
     struct EmbedResourceStructure {
@@ -16,7 +17,41 @@ namespace SR_UTILS_NS {
         uint64_t size;
     };
 
-    class ResourceEmbedder {
+    /**
+     * Пакет встроенных ресурсов, собранный py/ResourceEmbedder.py.
+     * Формат: заголовок, индекс отсортированный по хешу пути, таблица путей, данные (zlib или без сжатия).
+     * Пакет лежит в памяти исполняемого файла и регистрируется без копирования,
+     * ресурсы распаковываются только при первом обращении.
+    */
+    class SR_DLL_EXPORT ResourceEmbedder {
+    public:
+        static constexpr uint32_t PACK_MAGIC = 0x4B505253; /// "SRPK"
+        static constexpr uint32_t PACK_VERSION = 1;
+
+        enum class PackCompression : uint32_t {
+            None = 0, Zlib = 1
+        };
+
+#pragma pack(push, 1)
+        struct PackHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t count;
+            uint32_t reserved;
+        };
+
+        struct PackEntry {
+            uint64_t pathHash;
+            uint32_t pathOffset;
+            uint32_t pathSize;
+            uint64_t dataOffset;
+            uint64_t packedSize;
+            uint64_t size;
+            PackCompression compression;
+            uint32_t reserved;
+        };
+#pragma pack(pop)
+
     public:
         static ResourceEmbedder& Instance() {
             static ResourceEmbedder instance;
@@ -24,14 +59,19 @@ namespace SR_UTILS_NS {
         }
 
     public:
-        template<class T> bool RegisterResource() {
-            const char* pData = reinterpret_cast<const char*>(&T::data[0]);
-            uint64_t dataSize = T::size;
+        /// вызывается из сгенерированного EmbedResources.cxx, pData должен жить до конца программы
+        bool RegisterPack(const char* pData, uint64_t size);
 
-            m_resources[T::path] = std::make_pair(dataSize, pData);
+        SR_NODISCARD bool Contains(const SR_UTILS_NS::Path& path) const;
+        SR_NODISCARD uint64_t GetCount() const noexcept { return m_count; }
+        SR_NODISCARD std::vector<std::string_view> GetPaths() const;
 
-            return true;
-        }
+        /// Несжатые ресурсы отдаются представлением памяти пакета, сжатые распаковываются один раз и кэшируются.
+        /// Невалидный поток, если ресурса нет.
+        SR_NODISCARD SR_HTYPES_NS::Stream Open(const SR_UTILS_NS::Path& path);
+
+        /// освобождает распакованные копии, открытые ранее потоки становятся невалидными
+        void ClearCache();
 
         bool ExportAllResources();
         bool ExportAllResources(SR_UTILS_NS::Path newDirectory);
@@ -39,10 +79,21 @@ namespace SR_UTILS_NS {
         static bool ExportToFile(const EmbedResourceStructure& resource, const SR_UTILS_NS::Path& newDirectory);
         bool ExportToFile(const SR_UTILS_NS::Path& path);
 
-        static bool ExportToMemory(const EmbedResourceStructure& resource);
+    private:
+        SR_NODISCARD const PackEntry* FindEntry(std::string_view path) const;
+        SR_NODISCARD std::string_view GetEntryPath(const PackEntry& entry) const;
+        bool Unpack(const PackEntry& entry, char* pDestination) const;
 
     private:
-        ska::flat_hash_map<std::string, std::pair<uint64_t, const char*>> m_resources;
+        mutable std::mutex m_mutex;
+
+        const char* m_pack = nullptr;
+        uint64_t m_packSize = 0;
+        uint32_t m_count = 0;
+        const PackEntry* m_entries = nullptr;
+
+        ska::flat_hash_map<uint64_t, std::unique_ptr<char[]>> m_unpacked;
+
     };
 }
 
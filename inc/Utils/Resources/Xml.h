@@ -20,6 +20,8 @@ namespace SR_UTILS_NS::Xml {
 
     class Attribute;
     class Document;
+    class NodeRange;
+    class AttributeRange;
 
     static int32_t g_xml_last_error = 0;
 
@@ -40,12 +42,13 @@ namespace SR_UTILS_NS::Xml {
         bool m_valid;
 
     private:
-        SR_NODISCARD bool CheckError(const std::string &msg) const {
+        /// сообщение собирается только при ошибке, успешное чтение ничего не форматирует
+        SR_NODISCARD bool CheckError(const char* method) const {
             if (m_valid) {
                 return true;
             }
             else {
-                SRAssert2(false, msg);
+                SRAssert2(false, SR_FORMAT("{} : attribute isn't valid! Name: {}", method, m_attribute.name()));
                 g_xml_last_error = -1;
                 return false;
             }
@@ -58,6 +61,13 @@ namespace SR_UTILS_NS::Xml {
 
         SR_NODISCARD bool Valid() const { return m_valid; }
 
+        SR_NODISCARD std::string_view Name() const { return m_valid ? m_attribute.name() : std::string_view(); }
+        SR_NODISCARD Attribute Next() const { return m_valid ? Attribute(m_attribute.next_attribute()) : Attribute(); }
+
+        /// представление строки документа, живет пока жив документ и атрибут не изменен
+        SR_NODISCARD std::string_view ToStringView() const;
+        SR_NODISCARD std::string_view ToStringView(std::string_view def) const;
+
         SR_NODISCARD std::string ToString() const;
         SR_NODISCARD int32_t ToInt() const;
         SR_NODISCARD uint32_t ToUInt() const;
@@ -124,17 +134,25 @@ namespace SR_UTILS_NS::Xml {
 
         SR_NODISCARD Document ToDocument() const;
         SR_NODISCARD Attribute GetAttribute(const std::string &name) const {
+            return GetAttribute(name.c_str());
+        }
+
+        SR_NODISCARD Attribute GetAttribute(const char* name) const {
             if (!m_valid) {
                 SRAssert2(false, "Node::GetAttribute() : node is not valid!");
                 g_xml_last_error = -4;
                 return Attribute();
             }
 
-            return Attribute(m_node.attribute(name.c_str()));
+            return Attribute(m_node.attribute(name));
         }
 
         SR_NODISCARD Attribute TryGetAttribute(const std::string &name) const {
-            return m_valid ? Attribute(m_node.attribute(name.c_str())) : Attribute();
+            return TryGetAttribute(name.c_str());
+        }
+
+        SR_NODISCARD Attribute TryGetAttribute(const char* name) const {
+            return m_valid ? Attribute(m_node.attribute(name)) : Attribute();
         }
 
         template<typename T> SR_NODISCARD T TryGetAttribute(const T& def) const {
@@ -142,9 +160,24 @@ namespace SR_UTILS_NS::Xml {
         }
 
         SR_NODISCARD bool HasAttribute(const std::string &name) const {
-            return m_valid ? !m_node.attribute(name.c_str()).empty() : false;
+            return HasAttribute(name.c_str());
+        }
+
+        SR_NODISCARD bool HasAttribute(const char* name) const {
+            return m_valid ? !m_node.attribute(name).empty() : false;
+        }
+
+        /// текст узла без копирования
+        SR_NODISCARD std::string_view ValueView() const {
+            return m_valid ? m_node.child_value() : std::string_view();
         }
 
+        /// Ленивые диапазоны без выделения памяти, невалидный узел дает пустой диапазон.
+        /// Имя не копируется и должно жить, пока идет обход
+        SR_NODISCARD NodeRange Children() const;
+        SR_NODISCARD NodeRange Children(const char* name) const;
+        SR_NODISCARD AttributeRange Attributes() const;
+
         SR_NODISCARD std::vector<Node> TryGetNodes() const;
         SR_NODISCARD std::vector<Node> TryGetNodes(const std::string &name) const;
         SR_NODISCARD std::vector<Node> GetNodes(const std::string &name) const;
@@ -459,17 +492,25 @@ namespace SR_UTILS_NS::Xml {
         Node AppendNode(const Node &node) { return AppendChild(node); }
 
         SR_NODISCARD Node TryGetNode(const std::string &name) const {
-            return m_valid ? Node(m_node.child(name.c_str())) : Node();
+            return TryGetNode(name.c_str());
+        }
+
+        SR_NODISCARD Node TryGetNode(const char* name) const {
+            return m_valid ? Node(m_node.child(name)) : Node();
         }
 
         SR_NODISCARD Node GetNode(const std::string &name) const {
+            return GetNode(name.c_str());
+        }
+
+        SR_NODISCARD Node GetNode(const char* name) const {
             if (!m_valid) {
                 SRAssert2(false, "Node::GetNode() : node is not valid!");
                 g_xml_last_error = -2;
                 return Node();
             }
 
-            return Node(m_node.child(name.c_str()));
+            return Node(m_node.child(name));
         }
 
     private:
@@ -478,6 +519,131 @@ namespace SR_UTILS_NS::Xml {
 
     };
 
+    class NodeIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Node;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Node*;
+        using reference = Node;
+
+    public:
+        NodeIterator() = default;
+        NodeIterator(pugi::xml_node node, const char* name)
+            : m_node(node)
+            , m_name(name)
+        { }
+
+    public:
+        SR_NODISCARD Node operator*() const { return Node(m_node); }
+
+        NodeIterator& operator++() {
+            m_node = m_name ? m_node.next_sibling(m_name) : m_node.next_sibling();
+            return *this;
+        }
+
+        NodeIterator operator++(int) {
+            NodeIterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        SR_NODISCARD bool operator==(const NodeIterator& other) const { return m_node == other.m_node; }
+        SR_NODISCARD bool operator!=(const NodeIterator& other) const { return m_node != other.m_node; }
+
+    private:
+        pugi::xml_node m_node;
+        const char* m_name = nullptr;
+
+    };
+
+    class NodeRange {
+    public:
+        NodeRange() = default;
+        NodeRange(pugi::xml_node first, const char* name)
+            : m_first(first)
+            , m_name(name)
+        { }
+
+    public:
+        SR_NODISCARD NodeIterator begin() const { return NodeIterator(m_first, m_name); }
+        SR_NODISCARD NodeIterator end() const { return NodeIterator(pugi::xml_node(), m_name); }
+
+        SR_NODISCARD bool Empty() const { return m_first.empty(); }
+        SR_NODISCARD Node Front() const { return Node(m_first); }
+
+    private:
+        pugi::xml_node m_first;
+        const char* m_name = nullptr;
+
+    };
+
+    class AttributeIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Attribute;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Attribute*;
+        using reference = Attribute;
+
+    public:
+        AttributeIterator() = default;
+        explicit AttributeIterator(pugi::xml_attribute attribute)
+            : m_attribute(attribute)
+        { }
+
+    public:
+        SR_NODISCARD Attribute operator*() const { return Attribute(m_attribute); }
+
+        AttributeIterator& operator++() {
+            m_attribute = m_attribute.next_attribute();
+            return *this;
+        }
+
+        AttributeIterator operator++(int) {
+            AttributeIterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        SR_NODISCARD bool operator==(const AttributeIterator& other) const { return m_attribute == other.m_attribute; }
+        SR_NODISCARD bool operator!=(const AttributeIterator& other) const { return m_attribute != other.m_attribute; }
+
+    private:
+        pugi::xml_attribute m_attribute;
+
+    };
+
+    class AttributeRange {
+    public:
+        AttributeRange() = default;
+        explicit AttributeRange(pugi::xml_attribute first)
+            : m_first(first)
+        { }
+
+    public:
+        SR_NODISCARD AttributeIterator begin() const { return AttributeIterator(m_first); }
+        SR_NODISCARD AttributeIterator end() const { return AttributeIterator(); }
+
+        SR_NODISCARD bool Empty() const { return m_first.empty(); }
+
+    private:
+        pugi::xml_attribute m_first;
+
+    };
+
+    inline NodeRange Node::Children() const {
+        return m_valid ? NodeRange(m_node.first_child(), nullptr) : NodeRange();
+    }
+
+    inline NodeRange Node::Children(const char* name) const {
+        return m_valid ? NodeRange(m_node.child(name), name) : NodeRange();
+    }
+
+    inline AttributeRange Node::Attributes() const {
+        return m_valid ? AttributeRange(m_node.first_attribute()) : AttributeRange();
+    }
+
     class SR_DLL_EXPORT Document : public NonCopyable {
     public:
         Document() {
@@ -520,7 +686,10 @@ namespace SR_UTILS_NS::Xml {
             return xml;
         }
 
+        /// файл отображается в память и копируется один раз прямо в буфер парсера
         static Document Load(const SR_UTILS_NS::Path &path);
+        /// разбор прямо в буфере вызывающего без копирования, буфер меняется и должен пережить документ
+        static Document LoadInPlace(char* pData, uint64_t size);
 
         static int32_t GetLastError() {
             auto last = Xml::g_xml_last_error;
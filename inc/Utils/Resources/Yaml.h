@@ -8,6 +8,8 @@
 #include <rapidyaml/src/ryml.hpp>
 
 namespace SR_UTILS_NS::Yaml {
+    class NodeRange;
+
     class SR_DLL_EXPORT Node {
         friend class Document;
 
@@ -26,15 +28,81 @@ namespace SR_UTILS_NS::Yaml {
 
         SR_NODISCARD std::string GetValue() const;
         SR_NODISCARD std::string GetKey() const;
+
+        /// представления строк дерева, живут пока жив документ
+        SR_NODISCARD std::string_view GetValueView() const;
+        SR_NODISCARD std::string_view GetKeyView() const;
+
         SR_NODISCARD std::vector<Node> GetChildren() const;
+        /// ленивый обход детей без выделения памяти
+        SR_NODISCARD NodeRange Children() const;
+
         SR_NODISCARD uint16_t GetId() const { return m_node.m_id; }
-        SR_NODISCARD Node GetChild(const std::string& name) const;
+        SR_NODISCARD Node GetChild(std::string_view name) const;
 
     private:
         ryml::ConstNodeRef m_node;
         bool m_isValid = false;
     };
 
+    class NodeIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Node;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Node*;
+        using reference = Node;
+
+    public:
+        NodeIterator() = default;
+        NodeIterator(const ryml::Tree* pTree, size_t id)
+            : m_tree(pTree)
+            , m_id(id)
+        { }
+
+    public:
+        SR_NODISCARD Node operator*() const { return Node(m_tree->cref(m_id)); }
+
+        NodeIterator& operator++() {
+            m_id = m_tree->next_sibling(m_id);
+            return *this;
+        }
+
+        NodeIterator operator++(int) {
+            NodeIterator copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        SR_NODISCARD bool operator==(const NodeIterator& other) const { return m_id == other.m_id; }
+        SR_NODISCARD bool operator!=(const NodeIterator& other) const { return m_id != other.m_id; }
+
+    private:
+        const ryml::Tree* m_tree = nullptr;
+        size_t m_id = ryml::NONE;
+
+    };
+
+    class NodeRange {
+    public:
+        NodeRange() = default;
+        NodeRange(const ryml::Tree* pTree, size_t firstId)
+            : m_tree(pTree)
+            , m_first(firstId)
+        { }
+
+    public:
+        SR_NODISCARD NodeIterator begin() const { return NodeIterator(m_tree, m_first); }
+        SR_NODISCARD NodeIterator end() const { return NodeIterator(m_tree, ryml::NONE); }
+
+        SR_NODISCARD bool Empty() const { return m_first == ryml::NONE; }
+
+    private:
+        const ryml::Tree* m_tree = nullptr;
+        size_t m_first = ryml::NONE;
+
+    };
+
     class SR_DLL_EXPORT Document final : public NonCopyable {
     public:
         Document();
@@ -47,7 +115,10 @@ namespace SR_UTILS_NS::Yaml {
         static Document Empty() { return { }; }
 
         static Document New();
+        /// файл отображается в память и копируется один раз в арену дерева
         static Document Load(const SR_UTILS_NS::Path &path);
+        /// разбор прямо в буфере вызывающего, буфер меняется и должен пережить документ
+        static Document LoadInPlace(char* pData, uint64_t size);
 
     public:
         Node AppendChild(const std::string& name);
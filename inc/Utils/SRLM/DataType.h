@@ -7,6 +7,7 @@
 
 #include <Utils/SRLM/Utils.h>
 #include <Utils/Resources/Xml.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 namespace SR_UTILS_NS {
     class EnumReflector;
@@ -49,6 +50,7 @@ namespace SR_SRLM_NS {
 
     class DataType : SR_UTILS_NS::NonCopyable {
     public:
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::SRLM)
         using Meta = uint64_t;
         using Hash = uint64_t;
 
@@ -23,6 +23,11 @@ namespace SR_UTILS_NS {
         Success, Working, Repeat, Break
     );
 
+    /// PhysicalCore - каждому потоку свое физическое ядро, SharedCache - потоки одной группы на процессорах с общим кешем
+    SR_ENUM_NS_CLASS_T(ThreadPlacement, uint8_t,
+        None, PhysicalCore, SharedCache
+    );
+
     class ThreadsWorker;
     class ThreadWorker;
 
@@ -69,12 +74,18 @@ namespace SR_UTILS_NS {
         void AddState(ThreadWorkerStateBase::Ptr pState);
 
         void SetThreadsWorker(ThreadsWorker* pThreadsWorker) { m_threadsWorker = pThreadsWorker; }
+        void SetPlacement(ThreadPlacement placement, uint32_t cacheGroup = 0) { m_placement = placement; m_cacheGroup = cacheGroup; }
+        void SetPriority(ThreadPriority priority) { m_priority = priority; }
 
-        void Start();
+        /// cpus - привязка, выбранная ThreadsWorker по размещению, пустая - без привязки
+        void Start(const std::vector<uint32_t>& cpus = { });
         void Stop();
 
         SR_NODISCARD ThreadsWorker* GetThreadsWorker() const { return m_threadsWorker; }
         SR_NODISCARD const std::vector<ThreadWorkerStateBase::Ptr>& GetStates() const { return m_states; }
+        SR_NODISCARD ThreadPlacement GetPlacement() const { return m_placement; }
+        SR_NODISCARD uint32_t GetCacheGroup() const { return m_cacheGroup; }
+        SR_NODISCARD SR_HTYPES_NS::Thread::Ptr GetThread() const { return m_thread; }
 
     private:
         void Work();
@@ -87,6 +98,9 @@ namespace SR_UTILS_NS {
         uint32_t m_currentState = 0;
         std::string m_name;
         std::atomic<bool> m_isActive = false;
+        ThreadPlacement m_placement = ThreadPlacement::None;
+        uint32_t m_cacheGroup = 0;
+        std::optional<ThreadPriority> m_priority;
 
     };
 
@@ -0,0 +1,536 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_ASSIMP_CACHE_AUTO_TESTS_H
+#define SR_ENGINE_ASSIMP_CACHE_AUTO_TESTS_H
+
+#include <Utils/FileSystem/AssimpCache.h>
+#include <Utils/Platform/Platform.h>
+
+#ifdef SR_UTILS_ASSIMP
+#include <assimp/scene.h>
+
+#include <filesystem>
+#include <fstream>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        /// раскладка заголовка кэша: magic(4) headerSize(4) version sourceHash layoutHash structureSize structureHash dataOffset dataSize
+        constexpr uint64_t ASSIMP_CACHE_TEST_VERSION_OFFSET = 8;
+        constexpr uint64_t ASSIMP_CACHE_TEST_STRUCTURE_HASH_OFFSET = 40;
+        constexpr uint64_t ASSIMP_CACHE_TEST_DATA_SIZE_OFFSET = 56;
+        constexpr uint64_t ASSIMP_CACHE_TEST_HEADER_SIZE = 64;
+
+        static void SetAssimpTestMatrix(aiMatrix4x4& matrix, float_t seed) {
+            auto&& pValues = reinterpret_cast<ai_real*>(&matrix);
+            for (uint32_t i = 0; i < 16; ++i) {
+                pValues[i] = seed + static_cast<ai_real>(i);
+            }
+        }
+
+        template<typename T> static T* CopyAssimpTestArray(std::initializer_list<T> values) {
+            auto&& pArray = new T[values.size()];
+            std::copy(values.begin(), values.end(), pArray);
+            return pArray;
+        }
+
+        static aiNode* CreateAssimpTestNode(const char* name, aiNode* pParent, std::initializer_list<uint32_t> meshes = { }) {
+            auto&& pNode = new aiNode();
+            pNode->mName = std::string(name);
+            pNode->mParent = pParent;
+            SetAssimpTestMatrix(pNode->mTransformation, static_cast<float_t>(strlen(name)));
+
+            pNode->mNumMeshes = meshes.size();
+            pNode->mMeshes = meshes.size() > 0 ? CopyAssimpTestArray<uint32_t>(meshes) : nullptr;
+
+            return pNode;
+        }
+
+        static void SetAssimpTestChildren(aiNode* pNode, std::initializer_list<aiNode*> children) {
+            pNode->mNumChildren = children.size();
+            pNode->mChildren = CopyAssimpTestArray<aiNode*>(children);
+        }
+
+        /// Сцена со всем, что пишет кэш: иерархия узлов, меш с костями и треугольниками,
+        /// меш с гранями разного размера и морф-целью, скелет и анимации по узлам, мешам и морфам
+        static aiScene* CreateAssimpTestScene() {
+            auto&& pScene = new aiScene();
+            pScene->mName = std::string("AutoTestScene");
+            pScene->mFlags = 4;
+
+            auto&& pRoot = CreateAssimpTestNode("Root", nullptr);
+            auto&& pBody = CreateAssimpTestNode("Body", pRoot, { 0, 1 });
+            auto&& pArmature = CreateAssimpTestNode("Armature", pRoot);
+            auto&& pBone0 = CreateAssimpTestNode("Bone0", pArmature);
+            auto&& pBone1 = CreateAssimpTestNode("Bone1", pBone0);
+
+            SetAssimpTestChildren(pRoot, { pBody, pArmature });
+            SetAssimpTestChildren(pArmature, { pBone0 });
+            SetAssimpTestChildren(pBone0, { pBone1 });
+            pScene->mRootNode = pRoot;
+
+            pScene->mNumMeshes = 2;
+            pScene->mMeshes = new aiMesh*[2]();
+
+            auto&& pSkinned = pScene->mMeshes[0] = new aiMesh();
+            pSkinned->mName = std::string("Skinned");
+            pSkinned->mPrimitiveTypes = 4;
+            pSkinned->mMaterialIndex = 1;
+            pSkinned->mAABB.mMin = aiVector3D(0.f, 0.f, 0.f);
+            pSkinned->mAABB.mMax = aiVector3D(1.f, 1.f, 0.f);
+            pSkinned->mNumVertices = 4;
+            pSkinned->mVertices = CopyAssimpTestArray<aiVector3D>({ { 0.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 1.f, 1.f, 0.f } });
+            pSkinned->mNormals = CopyAssimpTestArray<aiVector3D>({ { 0.f, 0.f, 1.f }, { 0.f, 0.f, 1.f }, { 0.f, 0.f, 1.f }, { 0.f, 0.f, 1.f } });
+            pSkinned->mTextureCoords[0] = CopyAssimpTestArray<aiVector3D>({ { 0.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 1.f, 1.f, 0.f } });
+            pSkinned->mNumUVComponents[0] = 2;
+            pSkinned->mColors[0] = CopyAssimpTestArray<aiColor4D>({ { 1.f, 0.f, 0.f, 1.f }, { 0.f, 1.f, 0.f, 1.f }, { 0.f, 0.f, 1.f, 1.f }, { 1.f, 1.f, 1.f, 1.f } });
+
+            pSkinned->mNumFaces = 2;
+            pSkinned->mFaces = new aiFace[2];
+            pSkinned->mFaces[0].mNumIndices = 3;
+            pSkinned->mFaces[0].mIndices = CopyAssimpTestArray<uint32_t>({ 0, 1, 2 });
+            pSkinned->mFaces[1].mNumIndices = 3;
+            pSkinned->mFaces[1].mIndices = CopyAssimpTestArray<uint32_t>({ 1, 3, 2 });
+
+            pSkinned->mNumBones = 2;
+            pSkinned->mBones = new aiBone*[2]();
+            for (uint32_t boneId = 0; boneId < 2; ++boneId) {
+                auto&& pBone = pSkinned->mBones[boneId] = new aiBone();
+                pBone->mName = std::string(boneId == 0 ? "Bone0" : "Bone1");
+                pBone->mArmature = pArmature;
+                pBone->mNode = boneId == 0 ? pBone0 : pBone1;
+                pBone->mNumWeights = 2;
+                pBone->mWeights = CopyAssimpTestArray<aiVertexWeight>({ { boneId, 0.75f }, { boneId + 2, 0.25f } });
+                SetAssimpTestMatrix(pBone->mOffsetMatrix, 10.f * static_cast<float_t>(boneId + 1));
+            }
+
+            auto&& pMixed = pScene->mMeshes[1] = new aiMesh();
+            pMixed->mName = std::string("Mixed");
+            pMixed->mPrimitiveTypes = 12;
+            pMixed->mNumVertices = 5;
+            pMixed->mVertices = CopyAssimpTestArray<aiVector3D>({ { 0.f, 0.f, 0.f }, { 2.f, 0.f, 0.f }, { 2.f, 2.f, 0.f }, { 0.f, 2.f, 0.f }, { 1.f, 3.f, 0.f } });
+            pMixed->mNumFaces = 2;
+            pMixed->mFaces = new aiFace[2];
+            pMixed->mFaces[0].mNumIndices = 4;
+            pMixed->mFaces[0].mIndices = CopyAssimpTestArray<uint32_t>({ 0, 1, 2, 3 });
+            pMixed->mFaces[1].mNumIndices = 3;
+            pMixed->mFaces[1].mIndices = CopyAssimpTestArray<uint32_t>({ 3, 2, 4 });
+
+            pMixed->mNumAnimMeshes = 1;
+            pMixed->mAnimMeshes = new aiAnimMesh*[1]();
+            auto&& pMorph = pMixed->mAnimMeshes[0] = new aiAnimMesh();
+            pMorph->mName = std::string("Raised");
+            pMorph->mWeight = 0.5f;
+            pMorph->mNumVertices = 5;
+            pMorph->mVertices = CopyAssimpTestArray<aiVector3D>({ { 0.f, 0.f, 1.f }, { 2.f, 0.f, 1.f }, { 2.f, 2.f, 1.f }, { 0.f, 2.f, 1.f }, { 1.f, 3.f, 1.f } });
+
+            pScene->mNumSkeletons = 1;
+            pScene->mSkeletons = new aiSkeleton*[1]();
+            auto&& pSkeleton = pScene->mSkeletons[0] = new aiSkeleton();
+            pSkeleton->mName = std::string("Skeleton");
+            pSkeleton->mNumBones = 1;
+            pSkeleton->mBones = new aiSkeletonBone*[1]();
+            auto&& pSkeletonBone = pSkeleton->mBones[0] = new aiSkeletonBone();
+            pSkeletonBone->mParent = -1;
+            pSkeletonBone->mArmature = pArmature;
+            pSkeletonBone->mNode = pBone1;
+            pSkeletonBone->mMeshId = pSkinned;
+            pSkeletonBone->mNumnWeights = 1;
+            pSkeletonBone->mWeights = CopyAssimpTestArray<aiVertexWeight>({ { 3, 1.f } });
+            SetAssimpTestMatrix(pSkeletonBone->mOffsetMatrix, 30.f);
+            SetAssimpTestMatrix(pSkeletonBone->mLocalMatrix, 40.f);
+
+            pScene->mNumAnimations = 1;
+            pScene->mAnimations = new aiAnimation*[1]();
+            auto&& pAnimation = pScene->mAnimations[0] = new aiAnimation();
+            pAnimation->mName = std::string("Walk");
+            pAnimation->mDuration = 2.0;
+            pAnimation->mTicksPerSecond = 24.0;
+
+            pAnimation->mNumChannels = 1;
+            pAnimation->mChannels = new aiNodeAnim*[1]();
+            auto&& pChannel = pAnimation->mChannels[0] = new aiNodeAnim();
+            pChannel->mNodeName = std::string("Bone1");
+            pChannel->mNumPositionKeys = 2;
+            pChannel->mPositionKeys = CopyAssimpTestArray<aiVectorKey>({ { 0.0, { 0.f, 0.f, 0.f } }, { 2.0, { 0.f, 1.f, 0.f } } });
+            pChannel->mNumRotationKeys = 1;
+            pChannel->mRotationKeys = CopyAssimpTestArray<aiQuatKey>({ { 1.0, { 0.7071f, 0.f, 0.7071f, 0.f } } });
+            pChannel->mNumScalingKeys = 1;
+            pChannel->mScalingKeys = CopyAssimpTestArray<aiVectorKey>({ { 0.0, { 1.f, 1.f, 1.f } } });
+
+            pAnimation->mNumMeshChannels = 1;
+            pAnimation->mMeshChannels = new aiMeshAnim*[1]();
+            auto&& pMeshChannel = pAnimation->mMeshChannels[0] = new aiMeshAnim();
+            pMeshChannel->mName = std::string("Mixed");
+            pMeshChannel->mNumKeys = 2;
+            pMeshChannel->mKeys = CopyAssimpTestArray<aiMeshKey>({ { 0.0, 0 }, { 1.0, 1 } });
+
+            pAnimation->mNumMorphMeshChannels = 1;
+            pAnimation->mMorphMeshChannels = new aiMeshMorphAnim*[1]();
+            auto&& pMorphChannel = pAnimation->mMorphMeshChannels[0] = new aiMeshMorphAnim();
+            pMorphChannel->mName = std::string("Mixed");
+            pMorphChannel->mNumKeys = 1;
+            pMorphChannel->mKeys = new aiMeshMorphKey[1];
+            pMorphChannel->mKeys[0].mTime = 0.5;
+            pMorphChannel->mKeys[0].mNumValuesAndWeights = 1;
+            pMorphChannel->mKeys[0].mValues = CopyAssimpTestArray<uint32_t>({ 0 });
+            pMorphChannel->mKeys[0].mWeights = CopyAssimpTestArray<double_t>({ 0.5 });
+
+            return pScene;
+        }
+
+        /// сравнение идет до первого расхождения, его путь печатается
+        struct AssimpCacheComparator {
+            bool Fail(const std::string& what) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("AssimpCache: {} differs after load\n", what));
+                return false;
+            }
+
+            bool Names(const aiString& expected, const aiString& actual, const std::string& what) {
+                return strcmp(expected.C_Str(), actual.C_Str()) == 0 || Fail(what);
+            }
+
+            template<typename T> bool Values(const T& expected, const T& actual, const std::string& what) {
+                return memcmp(&expected, &actual, sizeof(T)) == 0 || Fail(what);
+            }
+
+            template<typename T> bool Arrays(const T* pExpected, const T* pActual, uint64_t count, const std::string& what) {
+                if (!pExpected || !pActual || count == 0) {
+                    return (!pExpected || count == 0) == (!pActual || count == 0) || Fail(what);
+                }
+                return memcmp(pExpected, pActual, count * sizeof(T)) == 0 || Fail(what);
+            }
+
+            bool Nodes(const aiNode* pExpected, const aiNode* pActual, const aiNode* pParent) {
+                const std::string what = SR_FORMAT("node \"{}\"", pExpected->mName.C_Str());
+
+                if (!Names(pExpected->mName, pActual->mName, what) || !Values(pExpected->mTransformation, pActual->mTransformation, what + " transform")) {
+                    return false;
+                }
+
+                if (pActual->mParent != pParent || pExpected->mNumChildren != pActual->mNumChildren || pExpected->mNumMeshes != pActual->mNumMeshes) {
+                    return Fail(what + " hierarchy");
+                }
+
+                if (!Arrays(pExpected->mMeshes, pActual->mMeshes, pExpected->mNumMeshes, what + " meshes")) {
+                    return false;
+                }
+
+                for (uint32_t i = 0; i < pExpected->mNumChildren; ++i) {
+                    if (!Nodes(pExpected->mChildren[i], pActual->mChildren[i], pActual)) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            template<typename T> bool Streams(const T* pExpected, const T* pActual, const std::string& what) {
+                const uint64_t count = pExpected->mNumVertices;
+
+                if (!Names(pExpected->mName, pActual->mName, what) || count != pActual->mNumVertices) {
+                    return Fail(what + " vertices count");
+                }
+
+                bool result = Arrays(pExpected->mVertices, pActual->mVertices, count, what + " positions")
+                    && Arrays(pExpected->mNormals, pActual->mNormals, count, what + " normals")
+                    && Arrays(pExpected->mTangents, pActual->mTangents, count, what + " tangents")
+                    && Arrays(pExpected->mBitangents, pActual->mBitangents, count, what + " bitangents");
+
+                for (uint32_t i = 0; result && i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+                    result = Arrays(pExpected->mColors[i], pActual->mColors[i], count, SR_FORMAT("{} colors {}", what, i));
+                }
+
+                for (uint32_t i = 0; result && i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+                    result = Arrays(pExpected->mTextureCoords[i], pActual->mTextureCoords[i], count, SR_FORMAT("{} uv {}", what, i));
+                }
+
+                return result;
+            }
+
+            bool Meshes(const aiScene* pExpected, const aiScene* pActual) {
+                if (pExpected->mNumMeshes != pActual->mNumMeshes) {
+                    return Fail("meshes count");
+                }
+
+                for (uint32_t meshId = 0; meshId < pExpected->mNumMeshes; ++meshId) {
+                    auto&& pMesh = pExpected->mMeshes[meshId];
+                    auto&& pLoaded = pActual->mMeshes[meshId];
+                    const std::string what = SR_FORMAT("mesh \"{}\"", pMesh->mName.C_Str());
+
+                    if (pMesh->mPrimitiveTypes != pLoaded->mPrimitiveTypes || pMesh->mMaterialIndex != pLoaded->mMaterialIndex) {
+                        return Fail(what + " header");
+                    }
+
+                    if (!Values(pMesh->mAABB, pLoaded->mAABB, what + " bounds") || !Streams(pMesh, pLoaded, what)) {
+                        return false;
+                    }
+
+                    if (!Arrays(pMesh->mNumUVComponents, pLoaded->mNumUVComponents, AI_MAX_NUMBER_OF_TEXTURECOORDS, what + " uv components")) {
+                        return false;
+                    }
+
+                    if (pMesh->mNumFaces != pLoaded->mNumFaces) {
+                        return Fail(what + " faces count");
+                    }
+
+                    for (uint32_t faceId = 0; faceId < pMesh->mNumFaces; ++faceId) {
+                        auto&& face = pMesh->mFaces[faceId];
+                        auto&& loadedFace = pLoaded->mFaces[faceId];
+
+                        if (face.mNumIndices != loadedFace.mNumIndices || !Arrays(face.mIndices, loadedFace.mIndices, face.mNumIndices, what + " face")) {
+                            return Fail(SR_FORMAT("{} face {}", what, faceId));
+                        }
+                    }
+
+                    if (pMesh->mNumBones != pLoaded->mNumBones) {
+                        return Fail(what + " bones count");
+                    }
+
+                    for (uint32_t boneId = 0; boneId < pMesh->mNumBones; ++boneId) {
+                        auto&& pBone = pMesh->mBones[boneId];
+                        auto&& pLoadedBone = pLoaded->mBones[boneId];
+                        const std::string boneWhat = SR_FORMAT("{} bone \"{}\"", what, pBone->mName.C_Str());
+
+                        const bool sameBone = Names(pBone->mName, pLoadedBone->mName, boneWhat)
+                            && Names(pBone->mNode->mName, pLoadedBone->mNode->mName, boneWhat + " node")
+                            && Names(pBone->mArmature->mName, pLoadedBone->mArmature->mName, boneWhat + " armature")
+                            && pBone->mNumWeights == pLoadedBone->mNumWeights
+                            && Arrays(pBone->mWeights, pLoadedBone->mWeights, pBone->mNumWeights, boneWhat + " weights")
+                            && Values(pBone->mOffsetMatrix, pLoadedBone->mOffsetMatrix, boneWhat + " offset");
+
+                        if (!sameBone) {
+                            return Fail(boneWhat);
+                        }
+                    }
+
+                    if (pMesh->mNumAnimMeshes != pLoaded->mNumAnimMeshes) {
+                        return Fail(what + " morph targets count");
+                    }
+
+                    for (uint32_t morphId = 0; morphId < pMesh->mNumAnimMeshes; ++morphId) {
+                        auto&& pMorph = pMesh->mAnimMeshes[morphId];
+                        auto&& pLoadedMorph = pLoaded->mAnimMeshes[morphId];
+
+                        if (pMorph->mWeight != pLoadedMorph->mWeight || !Streams(pMorph, pLoadedMorph, what + " morph target")) {
+                            return Fail(what + " morph target");
+                        }
+                    }
+                }
+
+                return true;
+            }
+
+            bool Skeletons(const aiScene* pExpected, const aiScene* pActual) {
+                if (pExpected->mNumSkeletons != pActual->mNumSkeletons) {
+                    return Fail("skeletons count");
+                }
+
+                for (uint32_t skeletonId = 0; skeletonId < pExpected->mNumSkeletons; ++skeletonId) {
+                    auto&& pSkeleton = pExpected->mSkeletons[skeletonId];
+                    auto&& pLoaded = pActual->mSkeletons[skeletonId];
+
+                    if (!Names(pSkeleton->mName, pLoaded->mName, "skeleton") || pSkeleton->mNumBones != pLoaded->mNumBones) {
+                        return Fail("skeleton");
+                    }
+
+                    for (uint32_t boneId = 0; boneId < pSkeleton->mNumBones; ++boneId) {
+                        auto&& pBone = pSkeleton->mBones[boneId];
+                        auto&& pLoadedBone = pLoaded->mBones[boneId];
+
+                        const bool sameBone = pBone->mParent == pLoadedBone->mParent
+                            && pLoadedBone->mMeshId == pActual->mMeshes[0]
+                            && Names(pBone->mNode->mName, pLoadedBone->mNode->mName, "skeleton bone node")
+                            && Names(pBone->mArmature->mName, pLoadedBone->mArmature->mName, "skeleton bone armature")
+                            && pBone->mNumnWeights == pLoadedBone->mNumnWeights
+                            && Arrays(pBone->mWeights, pLoadedBone->mWeights, pBone->mNumnWeights, "skeleton bone weights")
+                            && Values(pBone->mOffsetMatrix, pLoadedBone->mOffsetMatrix, "skeleton bone offset")
+                            && Values(pBone->mLocalMatrix, pLoadedBone->mLocalMatrix, "skeleton bone local matrix");
+
+                        if (!sameBone) {
+                            return Fail(SR_FORMAT("skeleton bone {}", boneId));
+                        }
+                    }
+                }
+
+                return true;
+            }
+
+            bool Animations(const aiScene* pExpected, const aiScene* pActual) {
+                if (pExpected->mNumAnimations != pActual->mNumAnimations) {
+                    return Fail("animations count");
+                }
+
+                for (uint32_t animationId = 0; animationId < pExpected->mNumAnimations; ++animationId) {
+                    auto&& pAnimation = pExpected->mAnimations[animationId];
+                    auto&& pLoaded = pActual->mAnimations[animationId];
+                    const std::string what = SR_FORMAT("animation \"{}\"", pAnimation->mName.C_Str());
+
+                    if (!Names(pAnimation->mName, pLoaded->mName, what) || pAnimation->mDuration != pLoaded->mDuration || pAnimation->mTicksPerSecond != pLoaded->mTicksPerSecond) {
+                        return Fail(what + " header");
+                    }
+
+                    if (pAnimation->mNumChannels != pLoaded->mNumChannels || pAnimation->mNumMeshChannels != pLoaded->mNumMeshChannels
+                        || pAnimation->mNumMorphMeshChannels != pLoaded->mNumMorphMeshChannels) {
+                        return Fail(what + " channels count");
+                    }
+
+                    for (uint32_t channelId = 0; channelId < pAnimation->mNumChannels; ++channelId) {
+                        auto&& pChannel = pAnimation->mChannels[channelId];
+                        auto&& pLoadedChannel = pLoaded->mChannels[channelId];
+
+                        const bool sameChannel = Names(pChannel->mNodeName, pLoadedChannel->mNodeName, what + " channel")
+                            && pChannel->mNumPositionKeys == pLoadedChannel->mNumPositionKeys
+                            && pChannel->mNumRotationKeys == pLoadedChannel->mNumRotationKeys
+                            && pChannel->mNumScalingKeys == pLoadedChannel->mNumScalingKeys
+                            && Arrays(pChannel->mPositionKeys, pLoadedChannel->mPositionKeys, pChannel->mNumPositionKeys, what + " position keys")
+                            && Arrays(pChannel->mRotationKeys, pLoadedChannel->mRotationKeys, pChannel->mNumRotationKeys, what + " rotation keys")
+                            && Arrays(pChannel->mScalingKeys, pLoadedChannel->mScalingKeys, pChannel->mNumScalingKeys, what + " scaling keys");
+
+                        if (!sameChannel) {
+                            return Fail(SR_FORMAT("{} channel {}", what, channelId));
+                        }
+                    }
+
+                    for (uint32_t channelId = 0; channelId < pAnimation->mNumMeshChannels; ++channelId) {
+                        auto&& pChannel = pAnimation->mMeshChannels[channelId];
+                        auto&& pLoadedChannel = pLoaded->mMeshChannels[channelId];
+
+                        if (!Names(pChannel->mName, pLoadedChannel->mName, what + " mesh channel") || pChannel->mNumKeys != pLoadedChannel->mNumKeys
+                            || !Arrays(pChannel->mKeys, pLoadedChannel->mKeys, pChannel->mNumKeys, what + " mesh keys")) {
+                            return Fail(SR_FORMAT("{} mesh channel {}", what, channelId));
+                        }
+                    }
+
+                    for (uint32_t channelId = 0; channelId < pAnimation->mNumMorphMeshChannels; ++channelId) {
+                        auto&& pChannel = pAnimation->mMorphMeshChannels[channelId];
+                        auto&& pLoadedChannel = pLoaded->mMorphMeshChannels[channelId];
+
+                        if (!Names(pChannel->mName, pLoadedChannel->mName, what + " morph channel") || pChannel->mNumKeys != pLoadedChannel->mNumKeys) {
+                            return Fail(SR_FORMAT("{} morph channel {}", what, channelId));
+                        }
+
+                        for (uint32_t keyId = 0; keyId < pChannel->mNumKeys; ++keyId) {
+                            auto&& key = pChannel->mKeys[keyId];
+                            auto&& loadedKey = pLoadedChannel->mKeys[keyId];
+
+                            const bool sameKey = key.mTime == loadedKey.mTime && key.mNumValuesAndWeights == loadedKey.mNumValuesAndWeights
+                                && Arrays(key.mValues, loadedKey.mValues, key.mNumValuesAndWeights, what + " morph values")
+                                && Arrays(key.mWeights, loadedKey.mWeights, key.mNumValuesAndWeights, what + " morph weights");
+
+                            if (!sameKey) {
+                                return Fail(SR_FORMAT("{} morph key {}", what, keyId));
+                            }
+                        }
+                    }
+                }
+
+                return true;
+            }
+
+            bool Scenes(const aiScene* pExpected, const aiScene* pActual) {
+                if (!Names(pExpected->mName, pActual->mName, "scene name") || pExpected->mFlags != pActual->mFlags) {
+                    return Fail("scene header");
+                }
+
+                return Nodes(pExpected->mRootNode, pActual->mRootNode, nullptr)
+                    && Meshes(pExpected, pActual)
+                    && Skeletons(pExpected, pActual)
+                    && Animations(pExpected, pActual);
+            }
+        };
+
+        static std::string ReadAssimpTestFile(const Path& path) {
+            std::ifstream file(path.ToStringRef(), std::ios::binary);
+            return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        }
+
+        static void WriteAssimpTestFile(const Path& path, const std::string& data) {
+            std::ofstream(path.ToStringRef(), std::ios::binary | std::ios::trunc).write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+
+        /// испорченный кэш должен отвергаться, а не отдавать сцену с мусором
+        static bool CheckAssimpCacheRejected(const Path& path, const std::string& data, uint64_t sourceHash, std::string_view what) {
+            WriteAssimpTestFile(path, data);
+
+            if (AssimpCache::Instance().Load(path, sourceHash)) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("AssimpCache: {} cache was accepted\n", what));
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    static bool RunTestAssimpCache() {
+        std::error_code error;
+        auto&& root = std::filesystem::temp_directory_path(error) / "SRAssimpCacheAutoTests";
+        std::filesystem::remove_all(root, error);
+        std::filesystem::create_directories(root, error);
+
+        const Path directory = Path(root.string());
+        const Path cachePath = directory.Concat("scene.cache");
+        const Path brokenPath = directory.Concat("broken.cache");
+        constexpr uint64_t sourceHash = 0x5eed;
+
+        std::unique_ptr<aiScene> pScene(AutoTests::CreateAssimpTestScene());
+
+        if (!AssimpCache::Instance().Save(cachePath, pScene.get(), sourceHash)) {
+            SR_PLATFORM_NS::WriteConsoleError("AssimpCache: failed to save the scene\n");
+            return false;
+        }
+
+        auto&& pCached = AssimpCache::Instance().Load(cachePath, sourceHash);
+        if (!pCached) {
+            SR_PLATFORM_NS::WriteConsoleError("AssimpCache: failed to load the saved scene\n");
+            return false;
+        }
+
+        if (!AutoTests::AssimpCacheComparator().Scenes(pScene.get(), pCached->GetScene())) {
+            return false;
+        }
+
+        /// пересохранение подменяет файл, уже отображенная сцена остается целой
+        const std::string data = AutoTests::ReadAssimpTestFile(cachePath);
+        if (!AssimpCache::Instance().Save(cachePath, pScene.get(), sourceHash) || !AutoTests::AssimpCacheComparator().Scenes(pScene.get(), pCached->GetScene())) {
+            SR_PLATFORM_NS::WriteConsoleError("AssimpCache: mapped scene changed after the cache was saved again\n");
+            return false;
+        }
+
+        if (AssimpCache::Instance().Load(cachePath, sourceHash + 1)) {
+            SR_PLATFORM_NS::WriteConsoleError("AssimpCache: cache of another source was accepted\n");
+            return false;
+        }
+
+        auto&& corrupt = [&data](uint64_t offset) {
+            std::string broken = data;
+            broken[offset] = static_cast<char>(~broken[offset]);
+            return broken;
+        };
+
+        /// структура обрезана вместе с данными, но заголовок поправлен под новый размер: ссылки на массивы выходят за границы
+        std::string truncated = data.substr(0, data.size() - 16);
+        uint64_t dataSize = 0;
+        memcpy(&dataSize, data.data() + AutoTests::ASSIMP_CACHE_TEST_DATA_SIZE_OFFSET, sizeof(uint64_t));
+        dataSize -= 16;
+        memcpy(truncated.data() + AutoTests::ASSIMP_CACHE_TEST_DATA_SIZE_OFFSET, &dataSize, sizeof(uint64_t));
+
+        const bool rejected = AutoTests::CheckAssimpCacheRejected(brokenPath, corrupt(0), sourceHash, "foreign magic")
+            && AutoTests::CheckAssimpCacheRejected(brokenPath, corrupt(AutoTests::ASSIMP_CACHE_TEST_VERSION_OFFSET), sourceHash, "stale version")
+            && AutoTests::CheckAssimpCacheRejected(brokenPath, corrupt(AutoTests::ASSIMP_CACHE_TEST_STRUCTURE_HASH_OFFSET), sourceHash, "wrong structure hash")
+            && AutoTests::CheckAssimpCacheRejected(brokenPath, corrupt(AutoTests::ASSIMP_CACHE_TEST_HEADER_SIZE + 8), sourceHash, "corrupted structure")
+            && AutoTests::CheckAssimpCacheRejected(brokenPath, data.substr(0, data.size() - 1), sourceHash, "truncated")
+            && AutoTests::CheckAssimpCacheRejected(brokenPath, data + '\0', sourceHash, "extended")
+            && AutoTests::CheckAssimpCacheRejected(brokenPath, data.substr(0, AutoTests::ASSIMP_CACHE_TEST_HEADER_SIZE / 2), sourceHash, "header only")
+            && AutoTests::CheckAssimpCacheRejected(brokenPath, truncated, sourceHash, "out of range");
+
+        pCached.reset();
+        std::filesystem::remove_all(root, error);
+
+        return rejected;
+    }
+}
+#endif
+
+#endif //SR_ENGINE_ASSIMP_CACHE_AUTO_TESTS_H
@@ -0,0 +1,158 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_CSS_AUTO_TESTS_H
+#define SR_ENGINE_CSS_AUTO_TESTS_H
+
+#include <Utils/Web/CSS/CSS.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        /// ширина в пикселях, -1 если не задана
+        static int32_t GetCSSWidth(const Web::CSSStyle& style) {
+            if (style.width.IsDefault()) {
+                return -1;
+            }
+            const Web::CSSSizeValue value = style.width;
+            return value.GetUnit() == Web::CSSSizeValue::Unit::Px ? value.GetPx() : -1;
+        }
+
+        static void SetCSSWidth(Web::CSS& css, std::string_view selector, std::string_view width) {
+            css.GetOrCreateStyle(selector)->ParseProperty("width", width);
+        }
+
+        static bool CheckCSSWidth(const Web::CSS& css, const Web::CSSElement& element, int32_t expected, std::string_view step) {
+            const int32_t width = GetCSSWidth(css.ComputeStyle(element));
+            if (width != expected) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("CSS {}: expected width {}, got {}\n", step, expected, width));
+                return false;
+            }
+            return true;
+        }
+
+        static bool CheckCSSMatches(const Web::CSS& css, const Web::CSSElement& element, uint64_t candidates, uint64_t expected, std::string_view step) {
+            if (css.CountCandidates(element) != candidates) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("CSS {}: expected {} candidate rules, got {}\n", step, candidates, css.CountCandidates(element)));
+                return false;
+            }
+
+            std::vector<const Web::CSSRule*> rules;
+            css.MatchRules(element, rules);
+
+            if (rules.size() != expected) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("CSS {}: expected {} matched rules, got {}\n", step, expected, rules.size()));
+                return false;
+            }
+
+            for (uint64_t i = 1; i < rules.size(); ++i) {
+                if (rules[i - 1] == rules[i]) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("CSS {}: rule \"{}\" matched twice\n", step, rules[i]->selector.text));
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// id побеждает классы, классы побеждают теги, независимо от порядка объявления
+        static bool RunTestCSSSpecificity() {
+            auto&& pCSS = Web::CSS::MakeShared();
+            Web::CSS& css = *pCSS;
+            SetCSSWidth(css, "#main", "1px");
+            SetCSSWidth(css, "div.item", "2px");
+            SetCSSWidth(css, ".item", "3px");
+            SetCSSWidth(css, "div", "4px");
+
+            return CheckCSSWidth(css, Web::CSSElement("div", "main", "item"), 1, "id over class")
+                && CheckCSSWidth(css, Web::CSSElement("div", "", "item"), 2, "tag and class over class")
+                && CheckCSSWidth(css, Web::CSSElement("span", "", "item"), 3, "class over global")
+                && CheckCSSWidth(css, Web::CSSElement("div", "", ""), 4, "tag")
+                && CheckCSSWidth(css, Web::CSSElement("span", "", ""), -1, "no rules");
+        }
+
+        /// при равной специфичности побеждает правило, объявленное позже
+        static bool RunTestCSSDeclarationOrder() {
+            auto&& pCSS = Web::CSS::MakeShared();
+            Web::CSS& css = *pCSS;
+            SetCSSWidth(css, ".a", "5px");
+            SetCSSWidth(css, ".b", "6px");
+
+            /// повторное объявление меняет стиль, но не порядок правила
+            SetCSSWidth(css, ".a", "9px");
+
+            return CheckCSSWidth(css, Web::CSSElement("p", "", "a b"), 6, "later class")
+                && CheckCSSWidth(css, Web::CSSElement("p", "", "b a"), 6, "class list order")
+                && CheckCSSWidth(css, Web::CSSElement("p", "", "a"), 9, "redeclared class");
+        }
+
+        /// правило лежит в корзине id, иначе первого класса, иначе тега: элемент проверяет только свои корзины,
+        /// и каждое правило находится ровно один раз
+        static bool RunTestCSSBuckets() {
+            auto&& pCSS = Web::CSS::MakeShared();
+            Web::CSS& css = *pCSS;
+            SetCSSWidth(css, "div#main.item.wide", "1px");
+            SetCSSWidth(css, ".item.wide", "2px");
+            SetCSSWidth(css, ".wide.item", "3px");
+            SetCSSWidth(css, "span.wide", "4px");
+            SetCSSWidth(css, "div", "5px");
+            SetCSSWidth(css, "*", "6px");
+            SetCSSWidth(css, "div > p", "7px");
+
+            return CheckCSSMatches(css, Web::CSSElement("div", "main", "item wide"), 5, 4, "all buckets")
+                && CheckCSSMatches(css, Web::CSSElement("div", "other", "item wide"), 4, 3, "other id")
+                && CheckCSSMatches(css, Web::CSSElement("span", "main", "wide item"), 4, 3, "id without tag")
+                && CheckCSSMatches(css, Web::CSSElement("div", "", "plain"), 1, 1, "tag bucket only")
+                && CheckCSSMatches(css, Web::CSSElement("div", "main", ""), 2, 1, "id bucket")
+                && CheckCSSMatches(css, Web::CSSElement("p", "", ""), 0, 0, "combinator")
+                && CheckCSSWidth(css, Web::CSSElement("p", "", ""), 6, "global style");
+        }
+
+        /// изменение правил сбрасывает вычисленные стили
+        static bool RunTestCSSInvalidation() {
+            auto&& pCSS = Web::CSS::MakeShared();
+            Web::CSS& css = *pCSS;
+            SetCSSWidth(css, ".item", "2px");
+
+            const Web::CSSElement element("div", "", "item");
+            if (!CheckCSSWidth(css, element, 2, "before change")) {
+                return false;
+            }
+
+            const uint64_t generation = css.GetGeneration();
+            SetCSSWidth(css, ".item", "3px");
+
+            if (css.GetGeneration() == generation) {
+                SR_PLATFORM_NS::WriteConsoleError("CSS: generation was not changed after a rule mutation\n");
+                return false;
+            }
+
+            if (!CheckCSSWidth(css, element, 3, "after change")) {
+                return false;
+            }
+
+            SetCSSWidth(css, "div", "4px");
+            SetCSSWidth(css, "#main", "5px");
+
+            /// AddClassStyle не перезаписывает существующее правило
+            Web::CSSStyle style;
+            style.ParseProperty("width", "6px");
+            css.AddClassStyle("item", style);
+            css.AddClassStyle("fresh", style);
+
+            return CheckCSSWidth(css, element, 3, "after new tag rule")
+                && CheckCSSWidth(css, Web::CSSElement("div", "main", "item"), 5, "after new id rule")
+                && CheckCSSWidth(css, Web::CSSElement("div", "", "fresh"), 6, "added class");
+        }
+    }
+
+    static bool RunTestCSS() {
+        return AutoTests::RunTestCSSSpecificity()
+            && AutoTests::RunTestCSSDeclarationOrder()
+            && AutoTests::RunTestCSSBuckets()
+            && AutoTests::RunTestCSSInvalidation();
+    }
+}
+
+#endif //SR_ENGINE_CSS_AUTO_TESTS_H
@@ -0,0 +1,342 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_CMD_MANAGER_AUTO_TESTS_H
+#define SR_ENGINE_CMD_MANAGER_AUTO_TESTS_H
+
+#include <Utils/CommandManager/CmdManager.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        /// дописывает символ в документ, не склеивается
+        class CmdTestAppend : public ReversibleCommand {
+        public:
+            CmdTestAppend(std::string& document, char symbol, uint64_t memory = 0)
+                : m_document(document)
+                , m_symbol(symbol)
+                , m_memory(memory)
+            { }
+
+            bool Redo() override {
+                m_document.push_back(m_symbol);
+                return true;
+            }
+
+            bool Undo() override {
+                if (m_document.empty() || m_document.back() != m_symbol) {
+                    return false;
+                }
+                m_document.pop_back();
+                return true;
+            }
+
+            std::string GetName() override { return "CmdTestAppend"; }
+
+            SR_NODISCARD uint64_t GetMemorySize() const override {
+                return m_memory > 0 ? m_memory : ReversibleCommand::GetMemorySize();
+            }
+
+        private:
+            std::string& m_document;
+            char m_symbol;
+            uint64_t m_memory;
+
+        };
+
+        /// заменяет текст документа целиком, последовательные правки одного документа склеиваются
+        class CmdTestSetText : public StateDeltaCommand {
+        public:
+            CmdTestSetText(std::string& document, uint64_t target, std::string_view text)
+                : StateDeltaCommand(target, document, text)
+                , m_document(document)
+            { }
+
+            std::string GetName() override { return "CmdTestSetText"; }
+
+        protected:
+            SR_NODISCARD std::string GetState() const override { return m_document; }
+
+            /// "!" в тексте - отказ применить правку, документ не меняется
+            bool SetState(std::string_view state) override {
+                if (state.find('!') != std::string_view::npos) {
+                    return false;
+                }
+                m_document = state;
+                return true;
+            }
+
+        private:
+            std::string& m_document;
+
+        };
+
+        static bool CheckCmdState(const char* step, const std::string& document, std::string_view expected) {
+            if (document == expected) {
+                return true;
+            }
+
+            SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("CmdManager: {}: expected \"{}\", got \"{}\"\n", step, expected, document));
+            return false;
+        }
+
+        static bool CheckCmdValue(const char* step, uint64_t value, uint64_t expected) {
+            if (value == expected) {
+                return true;
+            }
+
+            SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("CmdManager: {}: expected {}, got {}\n", step, expected, value));
+            return false;
+        }
+
+        static void CmdTestUndo(CmdManager& manager, uint32_t count = 1) {
+            for (uint32_t i = 0; i < count; ++i) {
+                manager.Cancel();
+            }
+            manager.Update();
+        }
+
+        static void CmdTestRedo(CmdManager& manager, uint32_t count = 1) {
+            for (uint32_t i = 0; i < count; ++i) {
+                manager.Redo();
+            }
+            manager.Update();
+        }
+    }
+
+    static bool RunTestCmdManager() {
+        using namespace AutoTests;
+
+        /// обрезка по числу команд: отменить можно только последние 4 правки
+        {
+            std::string document;
+            CmdManager manager;
+            manager.SetMaxHistorySize(4);
+
+            for (const char symbol : std::string_view("abcdefghij")) {
+                manager.Execute(new CmdTestAppend(document, symbol), SyncType::Sync);
+            }
+
+            if (!CheckCmdValue("count trim, history size", manager.GetHistorySize(), 4)) {
+                return false;
+            }
+
+            CmdTestUndo(manager, 10);
+            if (!CheckCmdState("count trim, undo all", document, "abcdef") || manager.CanUndo() || !manager.CanRedo()) {
+                return false;
+            }
+
+            CmdTestRedo(manager, 10);
+            if (!CheckCmdState("count trim, redo all", document, "abcdefghij") || manager.CanRedo()) {
+                return false;
+            }
+
+            /// новая правка после отмены стирает отмененные команды
+            CmdTestUndo(manager, 2);
+            manager.Execute(new CmdTestAppend(document, 'x'), SyncType::Sync);
+            if (!CheckCmdState("count trim, edit after undo", document, "abcdefghx") || manager.CanRedo()) {
+                return false;
+            }
+
+            if (!CheckCmdValue("count trim, history after edit", manager.GetHistorySize(), 3)) {
+                return false;
+            }
+
+            CmdTestUndo(manager, 3);
+            if (!CheckCmdState("count trim, undo after edit", document, "abcdef")) {
+                return false;
+            }
+
+            /// уменьшение лимита на лету удаляет самые старые команды
+            CmdTestRedo(manager, 3);
+            manager.SetMaxHistorySize(1);
+            CmdTestUndo(manager, 3);
+            if (!CheckCmdState("count trim, shrink", document, "abcdefgh")) {
+                return false;
+            }
+        }
+
+        /// обрезка по памяти: из пяти команд по 300 байт в бюджет 1000 влезают три
+        {
+            std::string document;
+            CmdManager manager;
+            manager.SetMaxHistoryMemory(1000);
+
+            for (const char symbol : std::string_view("abcde")) {
+                manager.Execute(new CmdTestAppend(document, symbol, 300), SyncType::Sync);
+            }
+
+            if (!CheckCmdValue("memory trim, history size", manager.GetHistorySize(), 3) ||
+                !CheckCmdValue("memory trim, history memory", manager.GetHistoryMemory(), 900)
+            ) {
+                return false;
+            }
+
+            CmdTestUndo(manager, 5);
+            if (!CheckCmdState("memory trim, undo all", document, "ab")) {
+                return false;
+            }
+
+            /// команда больше бюджета остается единственной записью, чтобы ее можно было отменить
+            CmdTestRedo(manager, 3);
+            manager.Execute(new CmdTestAppend(document, 'f', 5000), SyncType::Sync);
+            if (!CheckCmdValue("memory trim, oversized command", manager.GetHistorySize(), 1)) {
+                return false;
+            }
+
+            CmdTestUndo(manager, 2);
+            if (!CheckCmdState("memory trim, undo oversized", document, "abcde")) {
+                return false;
+            }
+        }
+
+        /// склейка: правки одной цели подряд - одна запись, через Undo/Redo склейки нет
+        {
+            std::string document;
+            std::string other;
+            CmdManager manager;
+
+            manager.Execute(new CmdTestSetText(document, 1, "a"), SyncType::Sync);
+            manager.Execute(new CmdTestSetText(document, 1, "ab"), SyncType::Sync);
+            manager.Execute(new CmdTestSetText(document, 1, "abc"), SyncType::Sync);
+            if (!CheckCmdValue("merge, consecutive edits", manager.GetHistorySize(), 1)) {
+                return false;
+            }
+
+            CmdTestUndo(manager);
+            if (!CheckCmdState("merge, undo merged", document, "")) {
+                return false;
+            }
+
+            CmdTestRedo(manager);
+            if (!CheckCmdState("merge, redo merged", document, "abc")) {
+                return false;
+            }
+
+            /// после Redo новая правка не должна попасть в уже отмененную и возвращенную запись
+            manager.Execute(new CmdTestSetText(document, 1, "abcd"), SyncType::Sync);
+            if (!CheckCmdValue("merge, edit after redo", manager.GetHistorySize(), 2)) {
+                return false;
+            }
+
+            CmdTestUndo(manager);
+            if (!CheckCmdState("merge, undo edit after redo", document, "abc")) {
+                return false;
+            }
+
+            /// другая цель не склеивается, а правка после Undo не склеивается с командой до отмены
+            CmdTestRedo(manager);
+            manager.Execute(new CmdTestSetText(other, 2, "x"), SyncType::Sync);
+            CmdTestUndo(manager);
+            manager.Execute(new CmdTestSetText(document, 1, "abcde"), SyncType::Sync);
+
+            if (!CheckCmdValue("merge, edit after undo", manager.GetHistorySize(), 3) || manager.CanRedo()) {
+                return false;
+            }
+
+            CmdTestUndo(manager);
+            if (!CheckCmdState("merge, undo edit after undo", document, "abcd")) {
+                return false;
+            }
+
+            CmdTestUndo(manager, 2);
+            if (!CheckCmdState("merge, undo all", document, "") || !CheckCmdState("merge, other target", other, "")) {
+                return false;
+            }
+        }
+
+        /// неудачная правка не попадает в историю и не склеивается ни с предыдущей, ни со следующей
+        {
+            std::string document;
+            CmdManager manager;
+
+            manager.Execute(new CmdTestSetText(document, 1, "a"), SyncType::Sync);
+            if (manager.Execute(new CmdTestSetText(document, 1, "a!"), SyncType::Sync)) {
+                SR_PLATFORM_NS::WriteConsoleError("CmdManager: failed edit reported success\n");
+                return false;
+            }
+
+            if (!CheckCmdState("failed edit, document", document, "a") || !CheckCmdValue("failed edit, history size", manager.GetHistorySize(), 1)) {
+                return false;
+            }
+
+            manager.Execute(new CmdTestSetText(document, 1, "ab"), SyncType::Sync);
+            if (!CheckCmdValue("failed edit, edit after failure", manager.GetHistorySize(), 2)) {
+                return false;
+            }
+
+            CmdTestUndo(manager);
+            if (!CheckCmdState("failed edit, undo edit after failure", document, "a")) {
+                return false;
+            }
+
+            CmdTestUndo(manager);
+            if (!CheckCmdState("failed edit, undo all", document, "")) {
+                return false;
+            }
+        }
+
+        /// разница снимков хранит только середину и восстанавливает оба снимка
+        {
+            const std::string before = "header:[position=1,2,3;rotation=0,0,0]:footer";
+            const std::string after = "header:[position=10,2,3;rotation=0,0,0]:footer";
+
+            const StateDelta delta(before, after);
+            if (delta.ApplyForward(before) != after || delta.ApplyBackward(after) != before) {
+                SR_PLATFORM_NS::WriteConsoleError("StateDelta: failed to restore snapshots\n");
+                return false;
+            }
+
+            if (delta.GetMemorySize() >= sizeof(StateDelta) + before.size() + after.size()) {
+                SR_PLATFORM_NS::WriteConsoleError("StateDelta: delta is not smaller than the snapshots\n");
+                return false;
+            }
+
+            if (!StateDelta(before, before).Empty() || StateDelta("", "abc").ApplyForward("") != "abc" || StateDelta("abc", "").ApplyBackward("") != "abc") {
+                SR_PLATFORM_NS::WriteConsoleError("StateDelta: edge cases failed\n");
+                return false;
+            }
+        }
+
+        /// асинхронная отправка с нескольких потоков: все команды выполнятся в Update по одному разу
+        {
+            constexpr uint32_t THREADS = 4;
+            constexpr uint32_t COMMANDS = 250;
+
+            std::string document;
+            CmdManager manager;
+            manager.SetMaxHistorySize(THREADS * COMMANDS);
+
+            std::vector<std::thread> threads;
+            for (uint32_t i = 0; i < THREADS; ++i) {
+                threads.emplace_back([&manager, &document, i]() {
+                    for (uint32_t j = 0; j < COMMANDS; ++j) {
+                        manager.Execute(new CmdTestAppend(document, static_cast<char>('a' + i)), SyncType::Async);
+                    }
+                });
+            }
+
+            for (auto&& thread : threads) {
+                thread.join();
+            }
+
+            manager.Update();
+
+            if (!CheckCmdValue("async, executed", document.size(), THREADS * COMMANDS) ||
+                !CheckCmdValue("async, history size", manager.GetHistorySize(), THREADS * COMMANDS)
+            ) {
+                return false;
+            }
+
+            CmdTestUndo(manager, THREADS * COMMANDS);
+            if (!CheckCmdState("async, undo all", document, "")) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif //SR_ENGINE_CMD_MANAGER_AUTO_TESTS_H
@@ -0,0 +1,314 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_MESH_AUTO_TESTS_H
+#define SR_ENGINE_MESH_AUTO_TESTS_H
+
+#include <Utils/Common/Vertices.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        using MeshTestTriangle = std::array<uint32_t, 3>;
+
+        /// поворачивает треугольник так, чтобы первым шел наименьший индекс, обход при этом сохраняется
+        static MeshTestTriangle CanonicalTriangle(uint32_t a, uint32_t b, uint32_t c) {
+            if (b < a && b < c) {
+                return { b, c, a };
+            }
+            if (c < a && c < b) {
+                return { c, a, b };
+            }
+            return { a, b, c };
+        }
+
+        static std::vector<MeshTestTriangle> SortedTriangles(const std::vector<uint32_t>& indices) {
+            std::vector<MeshTestTriangle> triangles;
+            for (uint64_t i = 0; i + 2 < indices.size(); i += 3) {
+                triangles.emplace_back(CanonicalTriangle(indices[i], indices[i + 1], indices[i + 2]));
+            }
+            std::sort(triangles.begin(), triangles.end());
+            return triangles;
+        }
+
+        /// плоская сетка size x size квадратов, 2 треугольника на квадрат
+        static void MakeGridMesh(uint32_t size, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+            vertices.clear();
+            indices.clear();
+
+            for (uint32_t y = 0; y <= size; ++y) {
+                for (uint32_t x = 0; x <= size; ++x) {
+                    Vertex vertex;
+                    vertex.position = Vec3 { static_cast<float_t>(x), 0.f, static_cast<float_t>(y) };
+                    vertex.uv = Vec2 { static_cast<float_t>(x) / size, static_cast<float_t>(y) / size };
+                    vertex.normal = Vec3 { 0.f, 1.f, 0.f };
+                    vertices.emplace_back(vertex);
+                }
+            }
+
+            for (uint32_t y = 0; y < size; ++y) {
+                for (uint32_t x = 0; x < size; ++x) {
+                    const uint32_t i0 = y * (size + 1) + x;
+                    const uint32_t i1 = i0 + 1;
+                    const uint32_t i2 = i0 + size + 1;
+                    const uint32_t i3 = i2 + 1;
+                    indices.insert(indices.end(), { i0, i2, i1, i1, i2, i3 });
+                }
+            }
+        }
+
+        static bool CheckHull(std::span<const Vec3> points, const std::vector<uint32_t>& indices, const char* name) {
+            if (indices.empty() || indices.size() % 3 != 0) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("{}: invalid hull index count {}\n", name, indices.size()));
+                return false;
+            }
+
+            /// замкнутая оболочка: каждое ребро встречается ровно по разу в каждом направлении
+            std::map<std::pair<uint32_t, uint32_t>, int32_t> edges;
+            for (uint64_t i = 0; i < indices.size(); i += 3) {
+                for (uint32_t j = 0; j < 3; ++j) {
+                    ++edges[{ indices[i + j], indices[i + (j + 1) % 3] }];
+                }
+            }
+
+            for (auto&& [edge, count] : edges) {
+                auto&& pIt = edges.find({ edge.second, edge.first });
+                if (count != 1 || pIt == edges.end() || pIt->second != 1) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("{}: hull is not closed at edge {}-{}\n", name, edge.first, edge.second));
+                    return false;
+                }
+            }
+
+            /// все точки лежат за каждой гранью (нормаль наружу), с допуском на float
+            for (uint64_t i = 0; i < indices.size(); i += 3) {
+                const Vec3& a = points[indices[i]];
+                const Vec3& b = points[indices[i + 1]];
+                const Vec3& c = points[indices[i + 2]];
+
+                const double_t abx = b.x - a.x, aby = b.y - a.y, abz = b.z - a.z;
+                const double_t acx = c.x - a.x, acy = c.y - a.y, acz = c.z - a.z;
+                const double_t nx = aby * acz - abz * acy;
+                const double_t ny = abz * acx - abx * acz;
+                const double_t nz = abx * acy - aby * acx;
+                const double_t length = std::sqrt(nx * nx + ny * ny + nz * nz);
+
+                for (auto&& point : points) {
+                    const double_t distance = (nx * (point.x - a.x) + ny * (point.y - a.y) + nz * (point.z - a.z)) / length;
+                    if (distance > 1e-3) {
+                        SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("{}: point is {} in front of face {}\n", name, distance, i / 3));
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+
+    static bool RunTestMesh() {
+        std::mt19937 random(30);
+        std::uniform_real_distribution<float_t> distribution(-0.99f, 0.99f);
+
+        /// куб с точками внутри: оболочка - ровно 8 углов и 12 треугольников
+        {
+            std::vector<Vec3> points;
+            for (uint32_t i = 0; i < 500; ++i) {
+                points.emplace_back(Vec3 { distribution(random), distribution(random), distribution(random) });
+            }
+            for (auto&& corner : SKYBOX_INDEXED_VERTICES) {
+                points.emplace_back(corner.position);
+            }
+
+            std::vector<uint32_t> indices;
+            if (!ComputeConvexHull(points, indices) || !AutoTests::CheckHull(points, indices, "ComputeConvexHull(cube)")) {
+                return false;
+            }
+
+            const std::set<uint32_t> used(indices.begin(), indices.end());
+            if (used.size() != 8 || indices.size() != 36 || *used.begin() < 500) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("ComputeConvexHull(cube): expected 8 corners and 12 triangles, got {} and {}\n",
+                    used.size(), indices.size() / 3));
+                return false;
+            }
+        }
+
+        /// точки на сфере: ограничение числа вершин соблюдается, оболочка остается замкнутой и выпуклой
+        {
+            std::vector<Vec3> points;
+            for (uint32_t i = 0; i < 400; ++i) {
+                Vec3 point = { distribution(random), distribution(random), distribution(random) };
+                const float_t length = std::sqrt(point.x * point.x + point.y * point.y + point.z * point.z);
+                points.emplace_back(Vec3 { point.x / length, point.y / length, point.z / length });
+            }
+
+            std::vector<uint32_t> full;
+            std::vector<uint32_t> limited;
+            if (!ComputeConvexHull(points, full) || !ComputeConvexHull(points, limited, 16)) {
+                SR_PLATFORM_NS::WriteConsoleError("ComputeConvexHull(sphere): failed to build a hull\n");
+                return false;
+            }
+
+            if (!AutoTests::CheckHull(points, full, "ComputeConvexHull(sphere)")) {
+                return false;
+            }
+
+            const std::set<uint32_t> used(limited.begin(), limited.end());
+            if (used.size() > 16 || used.size() < 4) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("ComputeConvexHull(sphere, 16): hull has {} vertices\n", used.size()));
+                return false;
+            }
+
+            /// урезанная оболочка выпукла относительно своих же вершин
+            std::vector<Vec3> limitedPoints;
+            std::vector<uint32_t> remapped;
+            std::map<uint32_t, uint32_t> remap;
+            for (const uint32_t index : limited) {
+                auto&& [pIt, inserted] = remap.try_emplace(index, static_cast<uint32_t>(limitedPoints.size()));
+                if (inserted) {
+                    limitedPoints.emplace_back(points[index]);
+                }
+                remapped.emplace_back(pIt->second);
+            }
+
+            if (!AutoTests::CheckHull(limitedPoints, remapped, "ComputeConvexHull(sphere, 16)")) {
+                return false;
+            }
+        }
+
+        /// плоский набор точек - оболочки нет
+        {
+            std::vector<Vec3> points;
+            for (uint32_t i = 0; i < 50; ++i) {
+                points.emplace_back(Vec3 { distribution(random), 0.5f, distribution(random) });
+            }
+
+            std::vector<uint32_t> indices;
+            if (ComputeConvexHull(points, indices)) {
+                SR_PLATFORM_NS::WriteConsoleError("ComputeConvexHull(plane): expected failure for planar points\n");
+                return false;
+            }
+        }
+
+        /// сварка: каждая вершина сетки продублирована со сдвигом меньше epsilon
+        {
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+            AutoTests::MakeGridMesh(8, vertices, indices);
+
+            const auto originalVertices = vertices;
+            const auto originalCount = static_cast<uint32_t>(vertices.size());
+
+            for (uint32_t i = 0; i < originalCount; ++i) {
+                Vertex copy = vertices[i];
+                copy.position.x += 1e-5f;
+                vertices.emplace_back(copy);
+            }
+
+            /// вторая половина треугольников ссылается на дубликаты
+            for (uint64_t i = indices.size() / 2; i < indices.size(); ++i) {
+                indices[i] += originalCount;
+            }
+
+            const auto before = indices;
+            const auto beforeVertices = vertices;
+
+            if (WeldVertices(vertices, indices, 1e-4f) != originalCount) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("WeldVertices: expected {} vertices, got {}\n", originalCount, vertices.size()));
+                return false;
+            }
+
+            for (uint64_t i = 0; i < indices.size(); ++i) {
+                const Vec3& expected = beforeVertices[before[i]].position;
+                const Vec3& actual = vertices[indices[i]].position;
+                if (std::abs(expected.x - actual.x) > 1e-4f || expected.y != actual.y || expected.z != actual.z) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("WeldVertices: index {} moved to another position\n", i));
+                    return false;
+                }
+            }
+
+            /// с другим uv вершины не сливаются
+            std::vector<Vertex> different = { originalVertices[0], originalVertices[0] };
+            different[1].uv.x += 0.5f;
+            std::vector<uint32_t> differentIndices = { 0, 1 };
+            if (WeldVertices(different, differentIndices, 1e-4f) != 2) {
+                SR_PLATFORM_NS::WriteConsoleError("WeldVertices: vertices with different uv were merged\n");
+                return false;
+            }
+        }
+
+        /// оптимизации порядка не теряют и не меняют треугольники, а ACMR не ухудшается
+        {
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+            AutoTests::MakeGridMesh(32, vertices, indices);
+
+            /// перемешанный порядок треугольников - худший случай для кэша
+            std::vector<uint32_t> shuffled;
+            std::vector<uint32_t> order(indices.size() / 3);
+            std::iota(order.begin(), order.end(), 0);
+            std::shuffle(order.begin(), order.end(), random);
+            for (const uint32_t triangle : order) {
+                shuffled.insert(shuffled.end(), indices.begin() + triangle * 3, indices.begin() + triangle * 3 + 3);
+            }
+
+            const auto verticesCount = static_cast<uint32_t>(vertices.size());
+            const auto reference = AutoTests::SortedTriangles(shuffled);
+            const float_t acmrBefore = CalculateACMR(shuffled, verticesCount);
+
+            OptimizeVertexCache(shuffled, verticesCount);
+            if (AutoTests::SortedTriangles(shuffled) != reference) {
+                SR_PLATFORM_NS::WriteConsoleError("OptimizeVertexCache: triangle set changed\n");
+                return false;
+            }
+
+            const float_t acmrAfter = CalculateACMR(shuffled, verticesCount);
+            if (acmrAfter >= acmrBefore || acmrAfter > 1.f) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("OptimizeVertexCache: ACMR {} -> {}\n", acmrBefore, acmrAfter));
+                return false;
+            }
+
+            OptimizeOverdraw(shuffled, vertices);
+            if (AutoTests::SortedTriangles(shuffled) != reference) {
+                SR_PLATFORM_NS::WriteConsoleError("OptimizeOverdraw: triangle set changed\n");
+                return false;
+            }
+
+            /// после перестановки вершин треугольники указывают на те же позиции, а индексы идут по первому использованию
+            const auto beforeFetch = shuffled;
+            const auto verticesBeforeFetch = vertices;
+
+            if (OptimizeVertexFetch(vertices, shuffled) != verticesCount) {
+                SR_PLATFORM_NS::WriteConsoleError("OptimizeVertexFetch: vertex count changed\n");
+                return false;
+            }
+
+            uint32_t next = 0;
+            for (uint64_t i = 0; i < shuffled.size(); ++i) {
+                const Vec3& expected = verticesBeforeFetch[beforeFetch[i]].position;
+                const Vec3& actual = vertices[shuffled[i]].position;
+                if (expected.x != actual.x || expected.y != actual.y || expected.z != actual.z) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("OptimizeVertexFetch: index {} points to another vertex\n", i));
+                    return false;
+                }
+
+                if (shuffled[i] > next) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("OptimizeVertexFetch: index {} is not in first-use order\n", i));
+                    return false;
+                }
+                next = std::max(next, shuffled[i] + 1);
+            }
+
+            /// неиспользуемая вершина удаляется
+            vertices.emplace_back(vertices.front());
+            if (OptimizeVertexFetch(vertices, shuffled) != verticesCount) {
+                SR_PLATFORM_NS::WriteConsoleError("OptimizeVertexFetch: unused vertex was not removed\n");
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif //SR_ENGINE_MESH_AUTO_TESTS_H
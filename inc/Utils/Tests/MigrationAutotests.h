@@ -0,0 +1,208 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_MIGRATION_AUTO_TESTS_H
+#define SR_ENGINE_MIGRATION_AUTO_TESTS_H
+
+#include <Utils/ECS/Migration.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        static constexpr uint64_t MIGRATION_TEST_CHAIN = SR_COMPILE_TIME_CRC32_STR("MigrationAutotestChain");
+        static constexpr uint64_t MIGRATION_TEST_FAILURE = SR_COMPILE_TIME_CRC32_STR("MigrationAutotestFailure");
+
+        static constexpr uint32_t MIGRATION_TEST_HEAD = 0xAABBCCDD;
+        static constexpr uint32_t MIGRATION_TEST_TAIL = 0x11223344;
+
+        /**
+         * v1: int32 + строка
+         * v2: то же, число удвоено на месте (Migrator, отрицательное число - ошибка после записи)
+         * v3: int64 + строка с суффиксом, тело растет (BufferMigrator)
+         * v4: только int64, тело короче исходного (BufferMigrator)
+        */
+        static void RegisterMigrationTestChain() {
+            static bool registered = false;
+            if (registered) {
+                return;
+            }
+            registered = true;
+
+            auto&& migration = Migration::Instance();
+
+            const auto&& doubleInPlace = [](SR_HTYPES_NS::Marshal& marshal) -> bool {
+                const uint64_t position = marshal.GetPosition();
+                const int32_t value = marshal.Read<int32_t>() * 2;
+                marshal.Replace(position, sizeof(int32_t), &value, sizeof(int32_t));
+                /// ошибка уже после изменения маршала - ее тоже нужно откатить
+                return value >= 0;
+            };
+
+            migration.RegisterMigrator(MIGRATION_TEST_CHAIN, 1, 2, doubleInPlace);
+
+            migration.RegisterBufferMigrator(MIGRATION_TEST_CHAIN, 2, 3, [](SR_HTYPES_NS::Marshal& input, SR_HTYPES_NS::Marshal& output) -> bool {
+                output.Write<int64_t>(input.Read<int32_t>());
+                output.Write<std::string>(input.Read<std::string>() + "-migrated-to-version-3");
+                return true;
+            });
+
+            migration.RegisterBufferMigrator(MIGRATION_TEST_CHAIN, 3, 4, [](SR_HTYPES_NS::Marshal& input, SR_HTYPES_NS::Marshal& output) -> bool {
+                output.Write<int64_t>(input.Read<int64_t>());
+                SR_UNUSED_VARIABLE(input.Read<std::string>());
+                return true;
+            });
+
+            /// на втором шаге уже частично записанный результат бросается
+            migration.RegisterMigrator(MIGRATION_TEST_FAILURE, 1, 2, doubleInPlace);
+            migration.RegisterBufferMigrator(MIGRATION_TEST_FAILURE, 2, 3, [](SR_HTYPES_NS::Marshal& input, SR_HTYPES_NS::Marshal& output) -> bool {
+                output.Write<int64_t>(input.Read<int32_t>());
+                return false;
+            });
+        }
+
+        static SR_HTYPES_NS::Marshal MakeMigrationTestMarshal(int32_t value, const std::string& name) {
+            SR_HTYPES_NS::Marshal marshal;
+            marshal.Write<uint32_t>(MIGRATION_TEST_HEAD);
+            marshal.Write<int32_t>(value);
+            marshal.Write<std::string>(name);
+            marshal.Write<uint32_t>(MIGRATION_TEST_TAIL);
+            marshal.SetPosition(sizeof(uint32_t));
+            return marshal;
+        }
+
+        /// неудачная миграция возвращает маршал байт в байт и позицию на начало тела (копия маршала позицию не хранит)
+        static bool CheckMigrationUnchanged(const char* step, const SR_HTYPES_NS::Marshal& marshal, const SR_HTYPES_NS::Marshal& original) {
+            if (marshal.ToStringView() == original.ToStringView() && marshal.GetPosition() == sizeof(uint32_t)) {
+                return true;
+            }
+
+            SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Migration: {}: marshal changed after a failed migration ({} -> {} bytes, position {})\n",
+                step, original.Size(), marshal.Size(), marshal.GetPosition()));
+            return false;
+        }
+
+        static bool CheckMigrationTail(const char* step, SR_HTYPES_NS::Marshal& marshal) {
+            if (marshal.Read<uint32_t>() == MIGRATION_TEST_TAIL && marshal.GetPosition() == marshal.Size()) {
+                return true;
+            }
+
+            SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Migration: {}: data after the body is broken\n", step));
+            return false;
+        }
+    }
+
+    /// цепочки из шагов на месте и через буферы, рост и уменьшение тела, откат при ошибке
+    static bool RunTestMigration() {
+        using namespace AutoTests;
+
+        RegisterMigrationTestChain();
+
+        auto&& migration = Migration::Instance();
+
+        if (migration.GetChainLength(MIGRATION_TEST_CHAIN, 1, 4) != 3 || migration.GetChainLength(MIGRATION_TEST_CHAIN, 2, 4) != 2 ||
+            migration.CanMigrate(MIGRATION_TEST_CHAIN, 4, 1) || migration.GetChainLength(MIGRATION_TEST_CHAIN, 4, 1) != 0
+        ) {
+            SR_PLATFORM_NS::WriteConsoleError("Migration: wrong chain lengths\n");
+            return false;
+        }
+
+        /// тело растет: новое пишется на место старого со сдвигом хвоста
+        {
+            auto&& marshal = MakeMigrationTestMarshal(21, "v1");
+            if (!migration.Migrate(MIGRATION_TEST_CHAIN, marshal, 1, 3) || marshal.GetPosition() != sizeof(uint32_t)) {
+                SR_PLATFORM_NS::WriteConsoleError("Migration: growing chain failed\n");
+                return false;
+            }
+
+            const auto value = marshal.Read<int64_t>();
+            const auto name = marshal.Read<std::string>();
+            if (value != 42 || name != "v1-migrated-to-version-3") {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Migration: growing chain produced {} \"{}\"\n", value, name));
+                return false;
+            }
+
+            if (!CheckMigrationTail("growing chain", marshal)) {
+                return false;
+            }
+        }
+
+        /// тело уменьшается: новое пишется вплотную к хвосту, позиция указывает на его начало
+        {
+            auto&& marshal = MakeMigrationTestMarshal(100, "a long name of the first version");
+
+            if (!migration.Migrate(MIGRATION_TEST_CHAIN, marshal, 1, 4) || marshal.GetPosition() <= sizeof(uint32_t)) {
+                SR_PLATFORM_NS::WriteConsoleError("Migration: shrinking chain failed\n");
+                return false;
+            }
+
+            const auto value = marshal.Read<int64_t>();
+            if (value != 200) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Migration: shrinking chain produced {}\n", value));
+                return false;
+            }
+
+            if (!CheckMigrationTail("shrinking chain", marshal)) {
+                return false;
+            }
+
+            marshal.SetPosition(0);
+            if (marshal.Read<uint32_t>() != MIGRATION_TEST_HEAD) {
+                SR_PLATFORM_NS::WriteConsoleError("Migration: data before the body is broken\n");
+                return false;
+            }
+        }
+
+        /// ошибка шага на месте уже после записи в маршал
+        {
+            auto&& marshal = MakeMigrationTestMarshal(-5, "broken");
+            const auto&& original = marshal.Copy();
+
+            if (migration.Migrate(MIGRATION_TEST_CHAIN, marshal, 1, 4) || !CheckMigrationUnchanged("failed in-place step", marshal, original)) {
+                return false;
+            }
+        }
+
+        /// ошибка шага через буфер после успешного шага на месте
+        {
+            auto&& marshal = MakeMigrationTestMarshal(7, "failure");
+            const auto&& original = marshal.Copy();
+
+            if (migration.Migrate(MIGRATION_TEST_FAILURE, marshal, 1, 3) || !CheckMigrationUnchanged("failed buffer step", marshal, original)) {
+                return false;
+            }
+        }
+
+        /// пачка: неудачный элемент не мешает остальным и остается нетронутым
+        {
+            std::vector<SR_HTYPES_NS::Marshal> marshals;
+            marshals.emplace_back(MakeMigrationTestMarshal(1, "first"));
+            marshals.emplace_back(MakeMigrationTestMarshal(-1, "broken"));
+            marshals.emplace_back(MakeMigrationTestMarshal(3, "third with a longer name"));
+
+            const auto&& broken = marshals[1].Copy();
+
+            std::vector<SR_HTYPES_NS::Marshal*> pointers;
+            for (auto&& marshal : marshals) {
+                pointers.emplace_back(&marshal);
+            }
+
+            if (migration.MigrateBatch(MIGRATION_TEST_CHAIN, pointers, 1, 4) != 2 || !CheckMigrationUnchanged("batch", marshals[1], broken)) {
+                SR_PLATFORM_NS::WriteConsoleError("Migration: batch migrated a wrong number of marshals\n");
+                return false;
+            }
+
+            for (const uint64_t index : { 0, 2 }) {
+                const auto value = marshals[index].Read<int64_t>();
+                if (value != static_cast<int64_t>(index + 1) * 2 || !CheckMigrationTail("batch", marshals[index])) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Migration: batch item {} produced {}\n", index, value));
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif //SR_ENGINE_MIGRATION_AUTO_TESTS_H
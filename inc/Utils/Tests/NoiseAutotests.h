@@ -0,0 +1,116 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_NOISE_AUTO_TESTS_H
+#define SR_ENGINE_NOISE_AUTO_TESTS_H
+
+#include <Utils/Math/Noise.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        struct NoiseTestGrid {
+            uint32_t width;
+            uint32_t height;
+            uint32_t depth;
+            double_t originX, originY, originZ;
+            double_t step;
+        };
+
+        /// ширины не кратны 4 и 2, чтобы проверить и векторную часть строки, и скалярный хвост.
+        /// Начала и шаги - короткие двоичные дроби, тогда координаты точные и не зависят от сжатия в FMA на стороне теста
+        static constexpr NoiseTestGrid NOISE_TEST_GRIDS[] = {
+            { 1, 1, 1, 0.0, 0.0, 0.0, 0.125 },
+            { 7, 5, 3, 0.25, -3.5, 1.75, 0.140625 },
+            { 33, 9, 4, -100.3125, 42.9375, -7.0078125, 0.0625 },
+            { 64, 3, 2, 1e5 + 0.5, -1e5 - 0.5, 0.001953125, 0.734375 },
+        };
+
+        static bool CheckNoiseValue(const char* name, uint64_t index, double_t expected, double_t actual) {
+            if (std::memcmp(&expected, &actual, sizeof(double_t)) == 0) {
+                return true;
+            }
+
+            SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("{}: sample {} differs, expected {:.17g}, got {:.17g} ({})\n",
+                name, index, expected, actual, SR_MATH_NS::GetNoiseInstructionSet()));
+            return false;
+        }
+    }
+
+    /// пакетные сетки должны совпадать с поэлементным SNoise бит в бит на любом наборе инструкций
+    static bool RunTestNoise() {
+        for (auto&& grid : AutoTests::NOISE_TEST_GRIDS) {
+            const uint64_t count2D = static_cast<uint64_t>(grid.width) * grid.height;
+            const uint64_t count3D = count2D * grid.depth;
+
+            std::vector<double_t> grid2D(count2D);
+            std::vector<float_t> grid2DFloat(count2D);
+            SR_MATH_NS::SNoiseGrid2D(grid2D.data(), grid.width, grid.height, grid.originX, grid.originY, grid.step, grid.step);
+            SR_MATH_NS::SNoiseGrid2D(grid2DFloat.data(), grid.width, grid.height, grid.originX, grid.originY, grid.step, grid.step);
+
+            for (uint32_t y = 0; y < grid.height; ++y) {
+                for (uint32_t x = 0; x < grid.width; ++x) {
+                    const uint64_t index = static_cast<uint64_t>(y) * grid.width + x;
+                    const double_t expected = SR_MATH_NS::SNoise(grid.originX + x * grid.step, grid.originY + y * grid.step);
+
+                    if (!AutoTests::CheckNoiseValue("SNoiseGrid2D", index, expected, grid2D[index])) {
+                        return false;
+                    }
+
+                    if (!AutoTests::CheckNoiseValue("SNoiseGrid2D<float>", index, static_cast<float_t>(expected), grid2DFloat[index])) {
+                        return false;
+                    }
+                }
+            }
+
+            std::vector<double_t> grid3D(count3D);
+            std::vector<float_t> grid3DFloat(count3D);
+            SR_MATH_NS::SNoiseGrid3D(grid3D.data(), grid.width, grid.height, grid.depth,
+                grid.originX, grid.originY, grid.originZ, grid.step, grid.step, grid.step);
+            SR_MATH_NS::SNoiseGrid3D(grid3DFloat.data(), grid.width, grid.height, grid.depth,
+                grid.originX, grid.originY, grid.originZ, grid.step, grid.step, grid.step);
+
+            for (uint32_t z = 0; z < grid.depth; ++z) {
+                for (uint32_t y = 0; y < grid.height; ++y) {
+                    for (uint32_t x = 0; x < grid.width; ++x) {
+                        const uint64_t index = (static_cast<uint64_t>(z) * grid.height + y) * grid.width + x;
+                        const double_t expected = SR_MATH_NS::SNoise(grid.originX + x * grid.step, grid.originY + y * grid.step, grid.originZ + z * grid.step);
+
+                        if (!AutoTests::CheckNoiseValue("SNoiseGrid3D", index, expected, grid3D[index])) {
+                            return false;
+                        }
+
+                        if (!AutoTests::CheckNoiseValue("SNoiseGrid3D<float>", index, static_cast<float_t>(expected), grid3DFloat[index])) {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            /// в FBmGrid частота умножается на начало и шаг сетки, а не на координату, поэтому сравнение с допуском
+            SR_MATH_NS::FBmSettings settings;
+            settings.octaves = 5;
+            settings.frequency = 0.37;
+
+            std::vector<double_t> fbm(count2D);
+            SR_MATH_NS::FBmGrid2D(fbm.data(), grid.width, grid.height, grid.originX, grid.originY, grid.step, grid.step, settings);
+
+            for (uint32_t y = 0; y < grid.height; ++y) {
+                for (uint32_t x = 0; x < grid.width; ++x) {
+                    const uint64_t index = static_cast<uint64_t>(y) * grid.width + x;
+                    const double_t expected = SR_MATH_NS::FBm(grid.originX + x * grid.step, grid.originY + y * grid.step, settings);
+
+                    if (std::abs(expected - fbm[index]) > 1e-9) {
+                        SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("FBmGrid2D: sample {} differs, expected {:.17g}, got {:.17g}\n", index, expected, fbm[index]));
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif //SR_ENGINE_NOISE_AUTO_TESTS_H
@@ -0,0 +1,63 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_PATH_AUTO_TESTS_H
+#define SR_ENGINE_PATH_AUTO_TESTS_H
+
+#include <Utils/FileSystem/Path.h>
+#include <Utils/FileSystem/FileSystem.h>
+#include <Utils/Platform/Platform.h>
+
+#include <filesystem>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        static bool CheckPathType(const Path& path, bool isFile, bool isDir, std::string_view step) {
+            if (path.IsFile() != isFile || path.IsDir() != isDir) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Path after {}: \"{}\" expected file={} dir={}, got file={} dir={}\n",
+                    step, path.ToStringRef(), isFile, isDir, path.IsFile(), path.IsDir()));
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    /// с включенным кешем типов изменения через FileSystem и Platform должны быть видны сразу,
+    /// даже если тип пути был запрошен (и закеширован) до изменения
+    static bool RunTestPathMetadata() {
+        std::error_code error;
+        auto&& root = std::filesystem::temp_directory_path(error) / "SRPathAutoTests";
+        std::filesystem::remove_all(root, error);
+
+        const Path directory = Path(root.string());
+        const Path file = directory.Concat("file.txt");
+        const Path copy = directory.Concat("copy.txt");
+
+        Path::SetMetadataLifetime(60'000);
+
+        bool result = AutoTests::CheckPathType(directory, false, false, "start")
+            && AutoTests::CheckPathType(file, false, false, "start")
+            && SR_PLATFORM_NS::CreateFolder(directory.ToStringRef())
+            && AutoTests::CheckPathType(directory, false, true, "CreateFolder")
+            && FileSystem::WriteToFile(file.ToStringRef(), "data")
+            && AutoTests::CheckPathType(file, true, false, "WriteToFile")
+            && AutoTests::CheckPathType(copy, false, false, "WriteToFile")
+            && SR_PLATFORM_NS::Copy(file, copy)
+            && AutoTests::CheckPathType(copy, true, false, "Copy")
+            && SR_PLATFORM_NS::Delete(file)
+            && AutoTests::CheckPathType(file, false, false, "Delete")
+            && AutoTests::CheckPathType(copy, true, false, "Delete")
+            && SR_PLATFORM_NS::Delete(directory)
+            && AutoTests::CheckPathType(copy, false, false, "Delete folder")
+            && AutoTests::CheckPathType(directory, false, false, "Delete folder");
+
+        Path::SetMetadataLifetime(0);
+        std::filesystem::remove_all(root, error);
+
+        return result;
+    }
+}
+
+#endif //SR_ENGINE_PATH_AUTO_TESTS_H
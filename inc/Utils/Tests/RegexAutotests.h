@@ -0,0 +1,109 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_REGEX_AUTO_TESTS_H
+#define SR_ENGINE_REGEX_AUTO_TESTS_H
+
+#include <Utils/Types/Regex.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        struct RegexTestCase {
+            const char* pattern;
+            const char* input;
+        };
+
+        /// шаблоны без повторяемых групп с пустыми итерациями: там ECMAScript сбрасывает группы, а автомат нет
+        static constexpr RegexTestCase REGEX_TEST_CASES[] = {
+            { "([a-z]+)_([0-9]+)\\.png", "[17] load textures/grass_42.png from disk" },
+            { "([a-z]+)_([0-9]+)\\.png", "[17] load textures/grass_42.jpg from disk" },
+            { "textures/[a-z]+_[0-9]+\\.png", "textures/grass_42.png" },
+            { "textures/[a-z]+_[0-9]+\\.png", "textures/grass_42.pngx" },
+            { "textures/[a-z]+_[0-9]+\\.png", "textures/_42.png" },
+            { "(a|ab)(c|bcd)(d*)", "abcd" },
+            { "(a|aa)*c", "aaaaaaaaaaaaaaaaaaaa" },
+            { "(a|aa)*c", "aaaaaaac" },
+            { "a*?(b+)", "aaabbb" },
+            { "(\\w+)@(\\w+)\\.com", "mail: user@host.com;" },
+            { "^(\\d{2,4})-(\\d+)$", "2026-10" },
+            { "^(\\d{2,4})-(\\d+)$", "12345-10" },
+            { "\\bcat\\b", "concat cat category" },
+            { "\\Bcat", "cat concat" },
+            { "x(y?)z", "xz" },
+            { "(?:ab)+c", "ababababc" },
+            { "[^,]*,([^,]*)", "first,second,third" },
+            { "a.c", "a\nc abc" },
+            { "", "abc" },
+            { "(b)?c", "ac" },
+        };
+
+        static bool CheckRegex(const std::string& pattern, const std::string& input, bool fullMatch) {
+            SR_HTYPES_NS::Regex regex(pattern);
+            const std::regex stdRegex(pattern);
+
+            std::smatch expected;
+            const bool expectedMatched = fullMatch ? std::regex_match(input, expected, stdRegex) : std::regex_search(input, expected, stdRegex);
+            const bool matched = fullMatch ? regex.Match(input) : regex.Search(input);
+
+            const char* mode = fullMatch ? "Match" : "Search";
+
+            if (matched != expectedMatched) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("{}(\"{}\") on {} chars: expected {}, got {}\n",
+                    mode, pattern, input.size(), expectedMatched, matched));
+                return false;
+            }
+
+            if (!matched) {
+                return true;
+            }
+
+            if (regex.Size() != expected.size()) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("{}(\"{}\"): expected {} groups, got {}\n", mode, pattern, expected.size(), regex.Size()));
+                return false;
+            }
+
+            for (uint64_t i = 0; i < expected.size(); ++i) {
+                const std::string_view group = regex.GetGroup(i);
+
+                const bool same = expected[i].matched
+                    ? group.data() == input.data() + expected.position(i) && group.size() == static_cast<size_t>(expected.length(i))
+                    : group.data() == nullptr;
+
+                if (!same) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("{}(\"{}\"): group {} expected \"{}\", got \"{}\"\n",
+                        mode, pattern, i, expected[i].str(), group));
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+
+    /// поиск и полное совпадение сравниваются с std::regex: короткие входы проходят через однопроходный исполнитель
+    /// и перебор с возвратом, удлиненные - через Pike VM
+    static bool RunTestRegex() {
+        for (auto&& testCase : AutoTests::REGEX_TEST_CASES) {
+            for (const bool fullMatch : { false, true }) {
+                if (!AutoTests::CheckRegex(testCase.pattern, testCase.input, fullMatch)) {
+                    return false;
+                }
+            }
+        }
+
+        /// префикс без букв и цифр, чтобы перебор std::regex не уходил вглубь на каждой позиции
+        const std::string padding(20000, '-');
+
+        for (auto&& testCase : AutoTests::REGEX_TEST_CASES) {
+            if (!AutoTests::CheckRegex(testCase.pattern, padding + testCase.input, false)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif //SR_ENGINE_REGEX_AUTO_TESTS_H
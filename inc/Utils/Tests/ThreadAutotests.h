@@ -0,0 +1,126 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_THREAD_AUTO_TESTS_H
+#define SR_ENGINE_THREAD_AUTO_TESTS_H
+
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        /// настройки меняются у отдельного потока, чтобы не трогать поток, запустивший тесты
+        static bool RunInTestThread(const std::function<bool(uint64_t)>& function) {
+            bool result = false;
+
+            std::thread thread([&result, &function]() {
+                result = function(SR_PLATFORM_NS::GetCurrentThreadNativeId());
+            });
+            thread.join();
+
+            return result;
+        }
+
+        static bool CheckThreadPriority(uint64_t nativeId, ThreadPriority priority, bool mustApply) {
+            const bool applied = SR_PLATFORM_NS::SetThreadPriority(nativeId, priority);
+
+            if (!applied) {
+                if (mustApply) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Thread: failed to lower priority to {}\n", SR_UTILS_NS::EnumReflector::ToStringAtom(priority).ToStringRef()));
+                    return false;
+                }
+
+                return true;
+            }
+
+            /// успешная установка должна читаться обратно тем же значением
+            const auto&& actual = SR_PLATFORM_NS::GetThreadPriority(nativeId);
+            if (actual != priority) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Thread: priority {} was applied, but read back as {}\n",
+                    SR_UTILS_NS::EnumReflector::ToStringAtom(priority).ToStringRef(),
+                    actual ? SR_UTILS_NS::EnumReflector::ToStringAtom(*actual).ToStringRef() : std::string("nothing")));
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    /// выставленные приоритет, привязка к процессорам и имя потока должны читаться обратно
+    static bool RunTestThreadSettings() {
+        using namespace AutoTests;
+
+        /// понижать приоритет можно без прав, повышать - только если позволяет система
+        const bool lowering = RunInTestThread([](uint64_t nativeId) {
+            const bool isNormal = SR_PLATFORM_NS::GetThreadPriority(nativeId) == ThreadPriority::SR_THREAD_PRIORITY_NORMAL;
+
+            return CheckThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_NORMAL, false) &&
+                CheckThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_BELOW_NORMAL, isNormal) &&
+                CheckThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_LOWEST, isNormal) &&
+                CheckThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_IDLE, isNormal);
+        });
+
+        if (!lowering) {
+            return false;
+        }
+
+        const bool raising = RunInTestThread([](uint64_t nativeId) {
+            return CheckThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_ABOVE_NORMAL, false) &&
+                CheckThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_HIGHEST, false) &&
+                CheckThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_TIME_CRITICAL, false) &&
+                CheckThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_NORMAL, false);
+        });
+
+        if (!raising) {
+            return false;
+        }
+
+        const bool affinity = RunInTestThread([](uint64_t nativeId) {
+            const auto&& original = SR_PLATFORM_NS::GetThreadAffinity(nativeId);
+            if (original.empty()) {
+                SR_PLATFORM_NS::WriteConsoleError("Thread: affinity is empty\n");
+                return false;
+            }
+
+            const std::vector<uint32_t> single = { original.back() };
+            if (!SR_PLATFORM_NS::SetThreadAffinity(nativeId, single) || SR_PLATFORM_NS::GetThreadAffinity(nativeId) != single) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Thread: failed to pin the thread to cpu {}\n", single.front()));
+                return false;
+            }
+
+            /// пустой список снимает привязку: доступны как минимум исходные процессоры
+            if (!SR_PLATFORM_NS::SetThreadAffinity(nativeId, { })) {
+                SR_PLATFORM_NS::WriteConsoleError("Thread: failed to reset affinity\n");
+                return false;
+            }
+
+            const auto&& restored = SR_PLATFORM_NS::GetThreadAffinity(nativeId);
+            for (const uint32_t cpu : original) {
+                if (std::find(restored.begin(), restored.end(), cpu) == restored.end()) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Thread: cpu {} is missing after affinity reset\n", cpu));
+                    return false;
+                }
+            }
+
+            return true;
+        });
+
+        if (!affinity) {
+            return false;
+        }
+
+        return RunInTestThread([](uint64_t nativeId) {
+            /// короче 16 символов, чтобы влезть в ограничение Linux
+            const std::string name = "SRThreadTest";
+
+            if (!SR_PLATFORM_NS::SetThreadName(nativeId, name) || SR_PLATFORM_NS::GetThreadName(nativeId) != name) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Thread: name read back as \"{}\"\n", SR_PLATFORM_NS::GetThreadName(nativeId)));
+                return false;
+            }
+
+            return true;
+        });
+    }
+}
+
+#endif //SR_ENGINE_THREAD_AUTO_TESTS_H
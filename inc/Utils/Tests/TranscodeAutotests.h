@@ -0,0 +1,295 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_TRANSCODE_AUTO_TESTS_H
+#define SR_ENGINE_TRANSCODE_AUTO_TESTS_H
+
+#include <Utils/Localization/Transcode.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        /// эталон намеренно не использует UTF.h: кодирование по таблице из RFC 3629 и RFC 2781
+        static void TranscodeTestEncode(char32_t codePoint, std::string& utf8, std::u16string& utf16) {
+            if (codePoint < 0x80) {
+                utf8.push_back(static_cast<char>(codePoint));
+            }
+            else if (codePoint < 0x800) {
+                utf8.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+                utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else if (codePoint < 0x10000) {
+                utf8.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+                utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+            else {
+                utf8.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+                utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+                utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+                utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+            }
+
+            if (codePoint < 0x10000) {
+                utf16.push_back(static_cast<char16_t>(codePoint));
+            }
+            else {
+                utf16.push_back(static_cast<char16_t>(0xD800 + ((codePoint - 0x10000) >> 10)));
+                utf16.push_back(static_cast<char16_t>(0xDC00 + ((codePoint - 0x10000) & 0x3FF)));
+            }
+        }
+
+        struct TranscodeTestText {
+            std::string utf8;
+            std::u16string utf16;
+            std::u32string utf32;
+        };
+
+        /// asciiPercent - доля ASCII, остальное поровну 2, 3 и 4 байтные последовательности
+        static TranscodeTestText TranscodeTestGenerate(std::mt19937& random, uint32_t count, uint32_t asciiPercent, bool bmpOnly) {
+            TranscodeTestText text;
+
+            for (uint32_t i = 0; i < count; ++i) {
+                char32_t codePoint = 0;
+
+                if (random() % 100 < asciiPercent) {
+                    codePoint = random() % 0x80;
+                }
+                else {
+                    switch (random() % (bmpOnly ? 2 : 3)) {
+                        case 0: codePoint = 0x80 + random() % (0x800 - 0x80); break;
+                        case 1:
+                            codePoint = 0x800 + random() % (0x10000 - 0x800 - 0x800);
+                            /// пропускаем суррогатный диапазон
+                            if (codePoint >= 0xD800) {
+                                codePoint += 0x800;
+                            }
+                            break;
+                        default: codePoint = 0x10000 + random() % (0x110000 - 0x10000); break;
+                    }
+                }
+
+                text.utf32.push_back(codePoint);
+                TranscodeTestEncode(codePoint, text.utf8, text.utf16);
+            }
+
+            return text;
+        }
+
+        /// длина последней последовательности строки в единицах ее кодировки
+        template<typename Char> static uint64_t TranscodeTestLastSequence(const std::basic_string<Char>& text) {
+            uint64_t width = 1;
+
+            if constexpr (sizeof(Char) == 1) {
+                while ((static_cast<unsigned char>(text[text.size() - width]) & 0xC0) == 0x80) {
+                    ++width;
+                }
+            }
+            else if constexpr (sizeof(Char) == 2) {
+                if (text.back() >= 0xDC00 && text.back() <= 0xDFFF) {
+                    ++width;
+                }
+            }
+
+            return width;
+        }
+
+        static bool CheckTranscodeResult(const char* name, const Localization::TranscodeResult& result, Localization::TranscodeError error, uint64_t read, uint64_t written) {
+            if (result.error == error && result.read == read && result.written == written) {
+                return true;
+            }
+
+            SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Transcode: {}: expected error {} at {} with {} written, got error {} at {} with {} written ({})\n",
+                name, static_cast<uint32_t>(error), read, written,
+                static_cast<uint32_t>(result.error), result.read, result.written,
+                Localization::GetTranscodeInstructionSet()));
+            return false;
+        }
+
+        /// полное преобразование в буфер худшего случая и в буфер точного размера
+        template<typename Out, typename In> static bool CheckTranscode(const char* name, const std::basic_string<In>& input, const std::basic_string<Out>& expected, uint64_t length) {
+            if (length != expected.size()) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Transcode: {}: length expected {}, got {}\n", name, expected.size(), length));
+                return false;
+            }
+
+            for (const uint64_t capacity : { Localization::GetMaxTranscodedLength<Out, In>(input.size()), static_cast<uint64_t>(expected.size()) }) {
+                std::basic_string<Out> output(capacity, Out());
+                const auto&& result = Localization::Transcode(input.data(), input.size(), output.data(), output.size());
+
+                if (!CheckTranscodeResult(name, result, Localization::TranscodeError::None, input.size(), expected.size())) {
+                    return false;
+                }
+
+                if (std::char_traits<Out>::compare(output.data(), expected.data(), expected.size()) != 0) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Transcode: {}: output differs from the reference\n", name));
+                    return false;
+                }
+            }
+
+            /// места на одну последовательность меньше: записано все до последней, она не поместилась
+            if (!expected.empty()) {
+                /// ширина последней последовательности на выходе и ее начало во входе
+                const uint64_t width = TranscodeTestLastSequence(expected);
+                const uint64_t lastRead = input.size() - TranscodeTestLastSequence(input);
+
+                std::basic_string<Out> output(expected.size() - 1, Out());
+                const auto&& result = Localization::Transcode(input.data(), input.size(), output.data(), output.size());
+
+                if (!CheckTranscodeResult(name, result, Localization::TranscodeError::OutOfSpace, lastRead, expected.size() - width)) {
+                    return false;
+                }
+
+                if (std::char_traits<Out>::compare(output.data(), expected.data(), result.written) != 0) {
+                    SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Transcode: {}: partial output differs from the reference\n", name));
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// ошибка во входе: результат до ошибки совпадает с эталоном, позиция - начало плохой последовательности
+        template<typename Out, typename In> static bool CheckTranscodeError(const char* name, const std::basic_string<In>& input, Localization::TranscodeError error,
+            uint64_t position, const std::basic_string<Out>& expectedPrefix
+        ) {
+            bool valid = true;
+            if constexpr (sizeof(In) == 1) { valid = Localization::ValidateUtf8(input.data(), input.size()); }
+            else if constexpr (sizeof(In) == 2) { valid = Localization::ValidateUtf16(input.data(), input.size()); }
+            else { valid = Localization::ValidateUtf32(input.data(), input.size()); }
+
+            if (valid) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Transcode: {}: broken input passed validation\n", name));
+                return false;
+            }
+
+            std::basic_string<Out> output(Localization::GetMaxTranscodedLength<Out, In>(input.size()), Out());
+            const auto&& result = Localization::Transcode(input.data(), input.size(), output.data(), output.size());
+
+            if (!CheckTranscodeResult(name, result, error, position, expectedPrefix.size())) {
+                return false;
+            }
+
+            if (std::char_traits<Out>::compare(output.data(), expectedPrefix.data(), expectedPrefix.size()) != 0) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Transcode: {}: output before the error differs from the reference\n", name));
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+    /// векторные пути преобразования должны совпадать с эталонным кодировщиком и находить те же ошибки
+    static bool RunTestTranscode() {
+        using namespace AutoTests;
+        using Localization::TranscodeError;
+
+        std::mt19937 random(20261019);
+
+        struct Profile {
+            uint32_t count;
+            uint32_t asciiPercent;
+            bool bmpOnly;
+        };
+
+        /// длины захватывают пустую строку, хвосты короче блока и несколько блоков по 16/32 байта
+        static constexpr Profile PROFILES[] = {
+            { 0, 100, false }, { 1, 0, false }, { 15, 100, false }, { 17, 50, false },
+            { 100, 100, false }, { 100, 95, false }, { 257, 0, true }, { 257, 0, false },
+            { 1000, 70, true }, { 1000, 30, false }, { 4099, 90, false }, { 4099, 0, false },
+        };
+
+        for (auto&& profile : PROFILES) {
+            const auto&& text = TranscodeTestGenerate(random, profile.count, profile.asciiPercent, profile.bmpOnly);
+
+            if (!Localization::ValidateUtf8(text.utf8.data(), text.utf8.size()) ||
+                !Localization::ValidateUtf16(text.utf16.data(), text.utf16.size()) ||
+                !Localization::ValidateUtf32(text.utf32.data(), text.utf32.size())
+            ) {
+                SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("Transcode: valid text of {} code points failed validation\n", profile.count));
+                return false;
+            }
+
+            if (!CheckTranscode("utf8 -> utf16", text.utf8, text.utf16, Localization::Utf16LengthFromUtf8(text.utf8.data(), text.utf8.size())) ||
+                !CheckTranscode("utf8 -> utf32", text.utf8, text.utf32, Localization::Utf32LengthFromUtf8(text.utf8.data(), text.utf8.size())) ||
+                !CheckTranscode("utf16 -> utf8", text.utf16, text.utf8, Localization::Utf8LengthFromUtf16(text.utf16.data(), text.utf16.size())) ||
+                !CheckTranscode("utf16 -> utf32", text.utf16, text.utf32, Localization::Utf32LengthFromUtf16(text.utf16.data(), text.utf16.size())) ||
+                !CheckTranscode("utf32 -> utf8", text.utf32, text.utf8, Localization::Utf8LengthFromUtf32(text.utf32.data(), text.utf32.size())) ||
+                !CheckTranscode("utf32 -> utf16", text.utf32, text.utf16, Localization::Utf16LengthFromUtf32(text.utf32.data(), text.utf32.size())) ||
+                !CheckTranscode("utf8 -> utf8", text.utf8, text.utf8, text.utf8.size()) ||
+                !CheckTranscode("utf16 -> utf16", text.utf16, text.utf16, text.utf16.size()) ||
+                !CheckTranscode("utf32 -> utf32", text.utf32, text.utf32, text.utf32.size())
+            ) {
+                return false;
+            }
+        }
+
+        /// некорректный UTF-8 вставляется после корректного префикса длиннее векторного блока
+        {
+            const auto&& prefix = TranscodeTestGenerate(random, 40, 60, false);
+            const auto&& suffix = TranscodeTestGenerate(random, 40, 60, false);
+
+            static const std::string_view ILLEGAL_UTF8[] = {
+                "\xFF", "\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xED\xBF\xBF",
+                "\xF0\x80\x80\x80", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\x80", "\xBF",
+                "\xC3" "a", "\xE2\x82" "a", "\xF0\x9F\x98" "a",
+            };
+
+            for (auto&& sequence : ILLEGAL_UTF8) {
+                const std::string input = prefix.utf8 + std::string(sequence) + suffix.utf8;
+
+                if (!CheckTranscodeError("broken utf8 -> utf16", input, TranscodeError::Illegal, prefix.utf8.size(), prefix.utf16) ||
+                    !CheckTranscodeError("broken utf8 -> utf32", input, TranscodeError::Illegal, prefix.utf8.size(), prefix.utf32) ||
+                    !CheckTranscodeError("broken utf8 -> utf8", input, TranscodeError::Illegal, prefix.utf8.size(), prefix.utf8)
+                ) {
+                    return false;
+                }
+            }
+
+            /// обрезанная в конце последовательность - Incomplete, а не Illegal
+            static const std::string_view INCOMPLETE_UTF8[] = { "\xC3", "\xE2\x82", "\xF0\x9F\x98", "\xF0" };
+
+            for (auto&& sequence : INCOMPLETE_UTF8) {
+                const std::string input = prefix.utf8 + std::string(sequence);
+
+                if (!CheckTranscodeError("truncated utf8 -> utf16", input, TranscodeError::Incomplete, prefix.utf8.size(), prefix.utf16) ||
+                    !CheckTranscodeError("truncated utf8 -> utf32", input, TranscodeError::Incomplete, prefix.utf8.size(), prefix.utf32)
+                ) {
+                    return false;
+                }
+            }
+
+            /// одиночные суррогаты в UTF-16 и недопустимые значения в UTF-32
+            static const char16_t ILLEGAL_UTF16[][2] = { { 0xDC00, u'a' }, { 0xDFFF, u'a' }, { 0xD800, u'a' }, { 0xDBFF, 0xD800 } };
+
+            for (auto&& sequence : ILLEGAL_UTF16) {
+                const std::u16string input = prefix.utf16 + std::u16string(sequence, 2) + suffix.utf16;
+
+                if (!CheckTranscodeError("broken utf16 -> utf8", input, TranscodeError::Illegal, prefix.utf16.size(), prefix.utf8) ||
+                    !CheckTranscodeError("broken utf16 -> utf32", input, TranscodeError::Illegal, prefix.utf16.size(), prefix.utf32)
+                ) {
+                    return false;
+                }
+            }
+
+            if (!CheckTranscodeError("truncated utf16 -> utf8", prefix.utf16 + static_cast<char16_t>(0xD83D), TranscodeError::Incomplete, prefix.utf16.size(), prefix.utf8)) {
+                return false;
+            }
+
+            for (const char32_t codePoint : { 0xD800u, 0xDFFFu, 0x110000u, 0xFFFFFFFFu }) {
+                const std::u32string input = prefix.utf32 + codePoint + suffix.utf32;
+
+                if (!CheckTranscodeError("broken utf32 -> utf8", input, TranscodeError::Illegal, prefix.utf32.size(), prefix.utf8) ||
+                    !CheckTranscodeError("broken utf32 -> utf16", input, TranscodeError::Illegal, prefix.utf32.size(), prefix.utf16)
+                ) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif //SR_ENGINE_TRANSCODE_AUTO_TESTS_H
@@ -0,0 +1,149 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_WORLD_GEN_AUTO_TESTS_H
+#define SR_ENGINE_WORLD_GEN_AUTO_TESTS_H
+
+#include <Utils/World/WorldGen.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_UTILS_NS {
+    namespace AutoTests {
+        static constexpr uint32_t WORLD_GEN_TEST_REGION_WIDTH = 4;
+
+        /// шаг сетки 16 / (17 - 1) точный, поэтому края соседних чанков сравниваются бит в бит
+        static SR_WORLD_NS::WorldGen::Settings GetWorldGenTestSettings(uint64_t seed) {
+            SR_WORLD_NS::WorldGen::Settings settings;
+            settings.seed = seed;
+            settings.resolution = 17;
+            settings.heightScale = 3.f;
+            settings.fbm.octaves = 5;
+            settings.fbm.frequency = 0.05;
+            return settings;
+        }
+
+        /// полоса чанков через границы регионов, в том числе через отрицательные регионы (нулевого региона нет)
+        static std::vector<SR_WORLD_NS::WorldGen::ChunkKey> GetWorldGenTestChunks() {
+            std::vector<SR_WORLD_NS::WorldGen::ChunkKey> chunks;
+
+            for (const int32_t region : { -2, -1, 1, 2 }) {
+                for (int32_t chunk = 1; chunk <= static_cast<int32_t>(WORLD_GEN_TEST_REGION_WIDTH); ++chunk) {
+                    chunks.emplace_back(SR_MATH_NS::IVector3(region, 1, 1), SR_MATH_NS::IVector3(chunk, 1, 1));
+                }
+            }
+
+            return chunks;
+        }
+
+        static bool CheckWorldGenHash(const char* step, uint64_t index, uint64_t expected, uint64_t actual) {
+            if (expected == actual) {
+                return true;
+            }
+
+            SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("WorldGen: {}: chunk {} hash expected {:#x}, got {:#x}\n", step, index, expected, actual));
+            return false;
+        }
+    }
+
+    /// одно зерно - одни и те же хеши чанков при любом числе потоков, порядке и повторах
+    static bool RunTestWorldGen() {
+        using namespace AutoTests;
+        using WorldGen = SR_WORLD_NS::WorldGen;
+
+        const SR_MATH_NS::IVector2 chunkSize(16, 16);
+        const auto&& settings = GetWorldGenTestSettings(20261019);
+        const auto&& chunks = GetWorldGenTestChunks();
+
+        std::vector<WorldGen::GeneratedChunk> reference;
+        for (auto&& [region, chunk] : chunks) {
+            reference.emplace_back(WorldGen::Generate(settings, chunkSize, WORLD_GEN_TEST_REGION_WIDTH, region, chunk));
+        }
+
+        for (uint64_t i = 0; i < chunks.size(); ++i) {
+            const auto&& repeated = WorldGen::Generate(settings, chunkSize, WORLD_GEN_TEST_REGION_WIDTH, chunks[i].first, chunks[i].second);
+
+            if (!CheckWorldGenHash("repeat", i, reference[i].hash, repeated.hash) ||
+                !CheckWorldGenHash("stored hash", i, WorldGen::CalculateHash(repeated), repeated.hash)
+            ) {
+                return false;
+            }
+
+            /// правый край чанка - левый край следующего, и через границу регионов тоже
+            if (i + 1 < chunks.size()) {
+                const uint32_t resolution = reference[i].resolution;
+
+                for (uint32_t z = 0; z < resolution; ++z) {
+                    const float_t right = reference[i].heights[z * resolution + resolution - 1];
+                    const float_t left = reference[i + 1].heights[z * resolution];
+
+                    if (right != left) {
+                        SR_PLATFORM_NS::WriteConsoleError(SR_FORMAT("WorldGen: seam between chunks {} and {} at row {}: {} != {}\n", i, i + 1, z, right, left));
+                        return false;
+                    }
+                }
+            }
+        }
+
+        /// другое зерно дает другой мир
+        {
+            const auto&& other = WorldGen::Generate(GetWorldGenTestSettings(20261020), chunkSize, WORLD_GEN_TEST_REGION_WIDTH, chunks.front().first, chunks.front().second);
+            if (other.hash == reference.front().hash) {
+                SR_PLATFORM_NS::WriteConsoleError("WorldGen: different seeds produced the same chunk\n");
+                return false;
+            }
+        }
+
+        /// без потоков Get и TryGet генерируют сразу
+        {
+            WorldGen worldGen(settings, chunkSize, WORLD_GEN_TEST_REGION_WIDTH);
+
+            for (uint64_t i = 0; i < chunks.size(); ++i) {
+                auto&& pGenerated = worldGen.TryGet(chunks[i].first, chunks[i].second);
+                if (!pGenerated || !CheckWorldGenHash("synchronous", i, reference[i].hash, pGenerated->hash)) {
+                    return false;
+                }
+            }
+        }
+
+        /// фоновые потоки, пачка в обратном порядке и опрос TryGet
+        for (const uint32_t threadsCount : { 1u, 4u }) {
+            WorldGen worldGen(settings, chunkSize, WORLD_GEN_TEST_REGION_WIDTH);
+            worldGen.Start(threadsCount);
+
+            std::vector<WorldGen::ChunkKey> reversed(chunks.rbegin(), chunks.rend());
+            auto&& batch = worldGen.GenerateBatch(reversed);
+
+            for (uint64_t i = 0; i < batch.size(); ++i) {
+                const uint64_t index = chunks.size() - 1 - i;
+                if (!batch[i] || !CheckWorldGenHash("batch", index, reference[index].hash, batch[i]->hash)) {
+                    worldGen.Stop();
+                    return false;
+                }
+            }
+
+            worldGen.ClearCache();
+
+            for (uint64_t i = 0; i < chunks.size(); ++i) {
+                WorldGen::GeneratedChunk::Ptr pGenerated;
+
+                for (uint32_t attempt = 0; !pGenerated && attempt < 5000; ++attempt) {
+                    if (!(pGenerated = worldGen.TryGet(chunks[i].first, chunks[i].second))) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+
+                if (!pGenerated || !CheckWorldGenHash("background", i, reference[i].hash, pGenerated->hash)) {
+                    worldGen.Stop();
+                    return false;
+                }
+            }
+
+            worldGen.Stop();
+        }
+
+        return true;
+    }
+}
+
+#endif //SR_ENGINE_WORLD_GEN_AUTO_TESTS_H
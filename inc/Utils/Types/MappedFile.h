@@ -0,0 +1,38 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_MAPPED_FILE_H
+#define SR_ENGINE_MAPPED_FILE_H
+
+#include <Utils/Platform/Platform.h>
+
+namespace SR_HTYPES_NS {
+    /**
+     * Файл, отображенный в память только для чтения. Страницы подгружаются системой по мере обращения,
+     * поэтому открытие большого файла не читает его целиком.
+    */
+    class SR_DLL_EXPORT MappedFile : public SR_UTILS_NS::NonCopyable {
+    public:
+        MappedFile() = default;
+        MappedFile(MappedFile&& other) noexcept;
+        ~MappedFile() override;
+
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+    public:
+        bool Open(const SR_UTILS_NS::Path& path);
+        void Close();
+
+        SR_NODISCARD bool Valid() const noexcept { return m_mapping.pData; }
+        SR_NODISCARD const char* Data() const noexcept { return m_mapping.pData; }
+        SR_NODISCARD uint64_t Size() const noexcept { return m_mapping.size; }
+        SR_NODISCARD std::string_view View() const noexcept { return std::string_view(m_mapping.pData, m_mapping.size); }
+
+    private:
+        SR_PLATFORM_NS::FileMapping m_mapping;
+
+    };
+}
+
+#endif //SR_ENGINE_MAPPED_FILE_H
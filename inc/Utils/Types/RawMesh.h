@@ -10,6 +10,7 @@
 #include <Utils/Types/Map.h>
 #include <Utils/Common/Vertices.h>
 #include <Utils/Math/Matrix4x4.h>
+#include <Utils/FileSystem/AssimpCache.h>
 
 #ifdef SR_UTILS_ASSIMP
 namespace Assimp {
@@ -29,9 +30,11 @@ namespace SR_HTYPES_NS {
     struct RawMeshParams {
         bool animation = false;
         bool convexHull = false;
+        /// ограничение числа вершин оболочки, 0 - без ограничения
+        uint32_t convexHullVertexLimit = 0;
 
         bool operator==(const RawMeshParams& rhs) const {
-            return animation == rhs.animation && convexHull == rhs.convexHull;
+            return animation == rhs.animation && convexHull == rhs.convexHull && convexHullVertexLimit == rhs.convexHullVertexLimit;
         }
     };
 
@@ -55,6 +58,19 @@ namespace SR_HTYPES_NS {
 
         SR_NODISCARD std::vector<SR_UTILS_NS::Vertex> GetVertices(uint32_t id) const;
         SR_NODISCARD const std::vector<uint32_t>& GetIndices(uint32_t id) const;
+
+        /// Представления без копирования, живут до выгрузки ресурса.
+        /// Вершины и индексы собираются один раз при первом обращении под m_viewsMutex,
+        /// так что звать можно из нескольких потоков. Позиции берутся из сцены без копии.
+        SR_NODISCARD std::span<const SR_UTILS_NS::Vec3> GetPositions(uint32_t id) const;
+        SR_NODISCARD std::span<const SR_UTILS_NS::Vertex> GetVerticesView(uint32_t id) const;
+        SR_NODISCARD std::span<const uint32_t> GetIndicesView(uint32_t id) const;
+
+        /// индексы исходных вершин меша, образующие треугольники выпуклой оболочки (если convexHull)
+        SR_NODISCARD std::span<const uint32_t> GetConvexHullIndices(uint32_t id) const;
+
+        /// имена костей меша в порядке локальных индексов (как в Vertex::weights::boneId)
+        SR_NODISCARD std::span<const SR_UTILS_NS::StringAtom> GetBoneNames(uint32_t id) const;
         SR_NODISCARD const ska::flat_hash_map<SR_UTILS_NS::StringAtom, uint32_t>& GetBones(uint32_t id) const;
         SR_NODISCARD const ska::flat_hash_map<SR_UTILS_NS::StringAtom, uint16_t>& GetOptimizedBones() const { return m_optimizedBones; }
         SR_NODISCARD const SR_MATH_NS::Matrix4x4& GetBoneOffset(SR_UTILS_NS::StringAtom name) const;
@@ -97,6 +113,9 @@ namespace SR_HTYPES_NS {
 
     private:
         std::vector<ska::flat_hash_map<SR_UTILS_NS::StringAtom, uint32_t>> m_bones;
+        /// для каждого меша: номер aiBone -> локальный индекс кости, и обратная таблица имен
+        std::vector<std::vector<uint32_t>> m_boneTables;
+        std::vector<std::vector<SR_UTILS_NS::StringAtom>> m_boneNames;
         ska::flat_hash_map<SR_UTILS_NS::StringAtom, uint16_t> m_optimizedBones;
 
         ska::flat_hash_map<SR_UTILS_NS::StringAtom, SR_MATH_NS::Matrix4x4> m_boneOffsetsMap;
@@ -105,7 +124,11 @@ namespace SR_HTYPES_NS {
         std::vector<SR_MATH_NS::Matrix4x4> m_boneOffsets;
         std::vector<SR_MATH_NS::Matrix4x4> m_boneTransforms;
 
+        /// заполняются лениво из const-методов
+        mutable std::mutex m_viewsMutex;
         mutable std::vector<std::vector<uint32_t>> m_indices;
+        mutable std::vector<std::vector<SR_UTILS_NS::Vertex>> m_vertices;
+        std::vector<std::vector<uint32_t>> m_convexHulls;
 
         RawMeshParams m_params;
 
@@ -114,6 +137,7 @@ namespace SR_HTYPES_NS {
     #ifdef SR_UTILS_ASSIMP
         ska::flat_hash_map<Hash, aiAnimation*> m_animations;
         const aiScene* m_scene = nullptr;
+        SR_UTILS_NS::AssimpCache::CachedScene::Ptr m_cachedScene;
         Assimp::Importer* m_importer = nullptr;
     #endif
 
@@ -128,6 +152,7 @@ template<> struct SR_UTILS_NS::SRHash<SR_HTYPES_NS::RawMeshParams> {
 
         res ^= hBool(params.animation) + 0x9e3779b9 + (res << 6u) + (res >> 2u);
         res ^= hBool(params.convexHull) + 0x9e3779b9 + (res << 6u) + (res >> 2u);
+        res ^= std::hash<uint32_t>()(params.convexHullVertexLimit) + 0x9e3779b9 + (res << 6u) + (res >> 2u);
 
         return res;
     }
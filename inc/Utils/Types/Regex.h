@@ -8,26 +8,61 @@
 #include <Utils/stdInclude.h>
 
 namespace SR_HTYPES_NS {
+    namespace RegexDetails {
+        struct Program;
+        struct Context;
+    }
+
+    /**
+     * Шаблон компилируется один раз в автомат, поиск линеен по длине входа. Вход без обязательной цепочки символов
+     * шаблона отбрасывается поиском подстроки. Полное совпадение однозначных шаблонов проверяется за один проход,
+     * короткие входы идут через перебор с возвратом с отметкой посещенных состояний, длинные - через Pike VM.
+     * Буферы исполнителей живут в объекте и переиспользуются между вызовами.
+     * Группы возвращаются как представления входной строки, поэтому вход должен жить, пока читаются результаты.
+     * Неподдерживаемый синтаксис (обратные ссылки, просмотр вперед, POSIX-классы) уходит в std::regex.
+    */
     class Regex {
     public:
-        Regex() = default;
+        Regex();
         Regex(const std::string& regex); /** NOLINT */
         Regex(Regex&& other) noexcept;
+        ~Regex();
 
         Regex& operator=(Regex&& other) noexcept;
 
     public:
-        bool Search(const std::string& input);
+        /// поиск первого (самого левого) вхождения
+        bool Search(std::string_view input);
+        /// совпадение со всей строкой целиком
+        bool Match(std::string_view input);
+
+        SR_NODISCARD bool IsCompiled() const noexcept { return m_program != nullptr; }
 
         SR_NODISCARD uint64_t Size() const noexcept;
         SR_NODISCARD std::string Prefix() const noexcept;
         SR_NODISCARD std::string Suffix() const noexcept;
 
+        SR_NODISCARD std::string_view PrefixView() const noexcept;
+        SR_NODISCARD std::string_view SuffixView() const noexcept;
+        SR_NODISCARD std::string_view GetGroup(uint64_t index) const noexcept;
+
         SR_NODISCARD std::string operator[](int64_t index) const noexcept;
 
     private:
-        std::regex m_regex;
-        std::smatch m_match;
+        bool Execute(std::string_view input, bool fullMatch);
+        bool ExecuteFallback(std::string_view input, bool fullMatch);
+
+    private:
+        std::unique_ptr<RegexDetails::Program> m_program;
+        std::unique_ptr<RegexDetails::Context> m_context;
+
+        std::unique_ptr<std::regex> m_fallback;
+        std::match_results<std::string_view::const_iterator> m_fallbackMatch;
+
+        std::string_view m_input;
+        /// начало и конец каждой группы, SR_UINT32_MAX - группа не участвовала
+        std::vector<uint32_t> m_groups;
+        bool m_matched = false;
 
     };
 }
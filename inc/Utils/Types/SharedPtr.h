@@ -63,7 +63,7 @@ namespace SR_HTYPES_NS {
         {
             SharedPtrDynamicDataCounter::Instance().Increment(this);
         #ifdef SR_SHARED_PTR_TRACE
-            debugTrace = SR_UTILS_NS::GetStacktrace();
+            debugTrace = SR_UTILS_NS::CaptureStacktraceId();
         #endif
         }
 
@@ -73,7 +73,7 @@ namespace SR_HTYPES_NS {
 
         SR_NODISCARD SR_UTILS_NS::StringAtom GetDebugTrace() const {
             #ifdef SR_SHARED_PTR_TRACE
-                return debugTrace;
+                return SR_UTILS_NS::ResolveStacktrace(debugTrace);
             #else
                 return SR_UTILS_NS::StringAtom();
             #endif
@@ -98,7 +98,7 @@ namespace SR_HTYPES_NS {
         SR_UTILS_NS::SharedPtrPolicy policy = SR_UTILS_NS::SharedPtrPolicy::Automatic;
 
     #ifdef SR_SHARED_PTR_TRACE
-        SR_UTILS_NS::StringAtom debugTrace;
+        SR_UTILS_NS::StacktraceId debugTrace = 0;
     #endif
 
     };
@@ -20,6 +20,10 @@ namespace SR_HTYPES_NS {
 
         ~Stream();
 
+        /// Поток поверх чужой памяти без копирования, данные должны пережить поток.
+        /// Первая запись копирует данные в собственный буфер.
+        SR_NODISCARD static Stream View(const char* pData, uint64_t size) noexcept;
+
     public:
         Stream& SR_FASTCALL operator=(const Stream& other) noexcept;
         Stream& SR_FASTCALL operator=(Stream&& other) noexcept;
@@ -28,6 +32,7 @@ namespace SR_HTYPES_NS {
 
     public:
         SR_NODISCARD bool Valid() const noexcept { return m_data; }
+        SR_NODISCARD bool IsView() const noexcept { return m_isView; }
 
         SR_NODISCARD std::string ToString() const noexcept;
         SR_NODISCARD std::string_view ToStringView() const noexcept;
@@ -53,6 +58,12 @@ namespace SR_HTYPES_NS {
 
         void Skip(uint64_t count);
 
+        /// Размер и позиция в ноль, собственный буфер остается для повторного использования
+        void Clear() noexcept;
+
+        /// Заменяет count байт с offset на size байт из pSrc, хвост сдвигается только если размеры различаются
+        void Replace(uint64_t offset, uint64_t count, const void* pSrc, uint64_t size);
+
     private:
         static char* Allocate(uint64_t size);
         static void Free(char* pData);
@@ -64,6 +75,8 @@ namespace SR_HTYPES_NS {
 
         char* m_data = nullptr;
 
+        bool m_isView = false;
+
     };
 }
 
@@ -12,7 +12,7 @@
 
 #define SR_THREAD_SAFE_CHECKS 1
 
-/** Warning: этот метод очень медленный! */
+/** Для потоков, созданных фабрикой, - чтение thread_local без блокировок */
 #define SR_THIS_THREAD (SR_HTYPES_NS::Thread::Factory::Instance().GetThisThread())
 
 #define SR_LOCK_GUARD std::lock_guard<std::recursive_mutex> codegen_lock(m_mutex)
@@ -64,6 +64,8 @@ namespace SR_HTYPES_NS {
                 pThread = new Thread();
 
                 std::thread thread([fn = std::forward<Functor>(fn), pThread, argsTuple = std::make_tuple(args...)]() mutable {
+                    pThread->OnStarted();
+
                     while (!pThread->m_isCreated || !pThread->HasId()) {
                         pThread->m_id = SR_UTILS_NS::GetThreadId(pThread->m_thread);
                     }
@@ -81,6 +83,11 @@ namespace SR_HTYPES_NS {
                 pThread->m_isRan = true;
                 pThread->m_isCreated = true;
 
+                /// дожидаемся старта, чтобы приоритет и привязку можно было задать сразу после создания
+                while (!pThread->m_nativeId) {
+                    SR_NOOP;
+                }
+
                 SR_LOG("Thread::Factory::Create() : creating new \"{}\" thread...", pThread->m_id.c_str());
 
                 return true;
@@ -111,6 +118,7 @@ namespace SR_HTYPES_NS {
         SR_NODISCARD DataStorage* GetContext() { return m_context; }
 
         void SetName(const std::string& name);
+        SR_NODISCARD SR_UTILS_NS::StringAtom GetName() const noexcept { return m_name.load(std::memory_order_acquire); }
 
         void Synchronize();
 
@@ -123,6 +131,7 @@ namespace SR_HTYPES_NS {
             Factory::LockSingleton();
 
             auto&& thread = std::thread([function = std::forward<Functor>(fn), this]() {
+                OnStarted();
                 while (!m_isCreated || m_id == "0" || m_id.empty()) {
                     m_id = SR_UTILS_NS::GetThreadId(m_thread);
                 }
@@ -142,13 +151,17 @@ namespace SR_HTYPES_NS {
 
             m_isRan = true;
 
+            while (!m_nativeId) {
+                SR_NOOP;
+            }
+
             return true;
         }
 
         bool Execute(const SR_HTYPES_NS::Function<bool()>& function) const;
 
         void Join() {
-            SR_LOG("Thead::Join() : join thread \"{}\" with id \"{}\"...", m_name, m_id.c_str());
+            SR_LOG("Thead::Join() : join thread \"{}\" with id \"{}\"...", GetName().c_str(), m_id.c_str());
             m_thread.join();
         }
 
@@ -174,14 +187,25 @@ namespace SR_HTYPES_NS {
 
         void Detach() { m_thread.detach(); }
 
-        void SetPriority(ThreadPriority priority);
+        bool SetPriority(ThreadPriority priority);
+        SR_NODISCARD std::optional<ThreadPriority> GetPriority() const;
+        /// номера логических процессоров, см. Platform::GetCPUTopology
+        bool SetAffinity(const std::vector<uint32_t>& cpus);
+        SR_NODISCARD std::vector<uint32_t> GetAffinity() const;
+        SR_NODISCARD uint64_t GetNativeId() const noexcept { return m_nativeId; }
 
         static void Sleep(uint64_t milliseconds);
 
+    private:
+        /// вызывается первым делом из самого потока
+        void OnStarted();
+
     private:
         std::thread m_thread;
         ThreadId m_id;
-        std::string m_name;
+        std::atomic<uint64_t> m_nativeId = 0;
+        /// атомарно, чтобы GetThisThreadName читал имя без блокировки
+        std::atomic<SR_UTILS_NS::StringAtom> m_name;
         DataStorage* m_context = nullptr;
 
         std::atomic<bool> m_isCreated = false;
@@ -19,6 +19,7 @@ namespace SR_HTYPES_NS {
         UnicodeString(const UnicodeString& other);
         UnicodeString(UnicodeString&& other) noexcept;
 
+        /// строки декодируются из UTF-8 и UTF-16, некорректные последовательности пропускаются
         UnicodeString(const std::string& str); /// NOLINT(google-explicit-constructor)
         UnicodeString(const std::u16string& str); /// NOLINT(google-explicit-constructor)
         UnicodeString(const std::u32string& str); /// NOLINT(google-explicit-constructor)
@@ -40,6 +41,9 @@ namespace SR_HTYPES_NS {
         SR_NODISCARD operator std::u32string() const noexcept { return m_internal; } /// NOLINT(google-explicit-constructor)
 
     public:
+        SR_NODISCARD std::string ToUtf8() const;
+        SR_NODISCARD std::u16string ToUtf16() const;
+
         void resize(size_t size);
 
         SR_NODISCARD bool empty() const noexcept { return m_internal.empty(); }
@@ -9,6 +9,7 @@
 #include <Utils/Web/CSS/CSSColor.h>
 #include <Utils/Web/CSS/CSSEnums.h>
 #include <Utils/Types/SharedPtr.h>
+#include <Utils/Types/Map.h>
 #include <Utils/Profile/TracyContext.h>
 #include <Utils/Debug.h>
 
@@ -59,8 +60,67 @@ namespace SR_UTILS_NS::Web {
         CSSBoxSizing boxSizing = CSSBoxSizing::ContentBox;
     };
 
+    /// Признаки HTML-элемента, по которым подбираются стили. Имена приводятся к нижнему регистру, как и селекторы
+    class CSSElement {
+    public:
+        CSSElement() = default;
+        CSSElement(std::string_view tag, std::string_view id, std::string_view classList);
+
+    public:
+        void SetTag(std::string_view tag);
+        void SetId(std::string_view id);
+        void AddClass(std::string_view name);
+        /// список классов через пробел, как в атрибуте class
+        void SetClassList(std::string_view classList);
+
+        SR_NODISCARD SRHashType GetTag() const noexcept { return m_tag; }
+        SR_NODISCARD SRHashType GetId() const noexcept { return m_id; }
+        SR_NODISCARD const std::vector<SRHashType>& GetClasses() const noexcept { return m_classes; }
+
+        /// элементы с одинаковой сигнатурой получают одинаковый вычисленный стиль
+        SR_NODISCARD uint64_t GetSignature() const noexcept;
+
+    private:
+        SRHashType m_tag = 0;
+        SRHashType m_id = 0;
+        std::vector<SRHashType> m_classes;
+
+    };
+
+    /**
+     * Составной селектор вида tag#id.class1.class2, специфичность считается при разборе.
+     * Селекторы с комбинаторами, псевдоклассами и атрибутами сохраняются, но ни с чем не сопоставляются.
+    */
+    struct CSSSelector {
+        SR_NODISCARD static CSSSelector Parse(std::string_view text);
+
+        SR_NODISCARD bool Matches(const CSSElement& element) const noexcept;
+
+        std::string text;
+        SRHashType tag = 0;
+        SRHashType id = 0;
+        std::vector<SRHashType> classes;
+        /// id << 16 | классы << 8 | теги
+        uint32_t specificity = 0;
+        bool supported = true;
+    };
+
+    struct CSSRule {
+        CSSSelector selector;
+        CSSStyle style;
+        /// порядок объявления, при равной специфичности побеждает более поздний
+        uint32_t order = 0;
+    };
+
+    /**
+     * Правила разложены по корзинам как в браузерных движках: по id, иначе по первому классу, иначе по тегу.
+     * Для элемента проверяются только корзины его id, классов и тега, кандидаты сортируются по специфичности
+     * и порядку и сливаются в каскад. Результат кешируется по сигнатуре элемента до изменения правил.
+     * Кеш не потокобезопасен, как и сама таблица стилей.
+    */
     class CSS : public SR_HTYPES_NS::SharedPtr<CSS> {
         using Super = SR_HTYPES_NS::SharedPtr<CSS>;
+        using RuleIndices = std::vector<uint32_t>;
     public:
         using Ptr = SR_HTYPES_NS::SharedPtr<CSS>;
 
@@ -70,47 +130,53 @@ namespace SR_UTILS_NS::Web {
     public:
         SR_NODISCARD std::string ToString(uint16_t depth = 0) const;
 
-        SR_NODISCARD const CSSStyle* GetClassStyle(const std::string& token) const {
-            SR_TRACY_ZONE;
-            const auto it = m_styles.find(std::make_pair(token, true));
-            return it != m_styles.end() ? &it->second : nullptr;
-        }
+        SR_NODISCARD const CSSStyle* GetClassStyle(std::string_view token) const;
+        SR_NODISCARD const CSSStyle* GetTagStyle(std::string_view token) const;
+        SR_NODISCARD const CSSStyle* GetStyle(std::string_view selector) const;
 
-        SR_NODISCARD const CSSStyle* GetTagStyle(const std::string& token) const {
-            SR_TRACY_ZONE;
-            const auto it = m_styles.find(std::make_pair(token, false));
-            return it != m_styles.end() ? &it->second : nullptr;
-        }
-
-        void AddClassStyle(std::string&& token, const CSSStyle& style) {
-            SRAssert2(!token.empty(), "Token is empty!");
-            m_styles.emplace(std::make_pair(std::move(token), true), style);
-        }
-
-        void AddTagStyle(std::string&& token, const CSSStyle& style) {
-            SRAssert2(!token.empty(), "Token is empty!");
-            m_styles.emplace(std::make_pair(std::move(token), false), style);
-        }
+        /// уже объявленное правило не перезаписывается, для изменения есть GetOrCreateStyle
+        void AddClassStyle(std::string&& token, const CSSStyle& style);
+        void AddTagStyle(std::string&& token, const CSSStyle& style);
 
         SR_NODISCARD const CSSStyle* GetGlobalStyle() const {
             return &m_globalStyle;
         }
 
-        SR_NODISCARD CSSStyle* GetOrCreateStyle(std::string_view token, bool isClass) {
-            SRAssert2(!token.empty(), "Token is empty!");
-            if (token == "*") { return &m_globalStyle; }
-            const auto pIt = std::ranges::find_if(m_styles, [token, isClass](const auto& pair) {
-                return pair.first.first == token && pair.first.second == isClass;
-            });
-            if (pIt != m_styles.end()) {
-                return &pIt->second;
-            }
-            return &m_styles.emplace(std::make_pair(token, isClass), m_globalStyle).first->second;
-        }
+        SR_NODISCARD CSSStyle* GetOrCreateStyle(std::string_view token, bool isClass);
+        SR_NODISCARD CSSStyle* GetOrCreateStyle(std::string_view selector);
+
+        /// каскад всех подходящих правил поверх глобального стиля, ссылка действительна до изменения правил
+        SR_NODISCARD const CSSStyle& ComputeStyle(const CSSElement& element) const;
+        void MatchRules(const CSSElement& element, std::vector<const CSSRule*>& rules) const;
+        /// сколько правил из корзин элемента проверяется при сопоставлении, до фильтрации по селектору
+        SR_NODISCARD uint64_t CountCandidates(const CSSElement& element) const;
+
+        SR_NODISCARD const std::deque<CSSRule>& GetRules() const noexcept { return m_rules; }
+        /// растет при каждом изменении правил, по нему можно пропускать перерасчет стилей целиком
+        SR_NODISCARD uint64_t GetGeneration() const noexcept { return m_generation; }
+
+    private:
+        SR_NODISCARD static SRHashType HashSelector(std::string_view selector);
+        SR_NODISCARD const CSSRule* FindRule(std::string_view selector) const;
+        template<typename Function> void ForEachCandidate(const CSSElement& element, const Function& function) const;
+
+        void Invalidate();
 
     private:
         CSSStyle m_globalStyle;
-        std::map<std::pair<std::string, bool /** is class */>, CSSStyle> m_styles;
+
+        std::deque<CSSRule> m_rules;
+        ska::flat_hash_map<SRHashType, uint32_t> m_selectors;
+
+        ska::flat_hash_map<SRHashType, RuleIndices> m_idRules;
+        ska::flat_hash_map<SRHashType, RuleIndices> m_classRules;
+        ska::flat_hash_map<SRHashType, RuleIndices> m_tagRules;
+        RuleIndices m_universalRules;
+
+        /// узловой контейнер, чтобы выданные ссылки не инвалидировались при вставке
+        mutable std::unordered_map<uint64_t, CSSStyle> m_computed;
+        mutable std::vector<const CSSRule*> m_matched;
+        uint64_t m_generation = 0;
 
     };
 }
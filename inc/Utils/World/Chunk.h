@@ -11,6 +11,7 @@
 #include <Utils/Types/DataStorage.h>
 #include <Utils/Types/Marshal.h>
 #include <Utils/World/Observer.h>
+#include <Utils/World/WorldGen.h>
 
 namespace SR_UTILS_NS {
     class GameObject;
@@ -52,6 +53,7 @@ namespace SR_WORLD_NS {
         SR_NODISCARD SR_MATH_NS::IVector3 GetPosition() const { return m_position; }
         SR_NODISCARD SR_MATH_NS::FVector3 GetWorldPosition(SR_MATH_NS::AxisFlag center = SR_MATH_NS::Axis::None) const;
         SR_NODISCARD ScenePtr GetScene() const;
+        SR_NODISCARD const WorldGen::GeneratedChunk::Ptr& GetGenerated() const { return m_generated; }
 
         SR_NODISCARD SR_HTYPES_NS::Marshal::Ptr Save(SR_HTYPES_NS::DataStorage* pContext) const;
 
@@ -63,6 +65,9 @@ namespace SR_WORLD_NS {
         virtual bool Access(float_t dt);
         virtual bool Belongs(const Math::FVector3& point);
         virtual bool Unload();
+        /// вызывается, если у сцены есть генератор: до PreLoad(), если рельеф уже готов, иначе позже из Region::Update(),
+        /// когда его построят потоки генератора. Сгенерированное не сохраняется в Save()
+        virtual bool Generate(const WorldGen::GeneratedChunk::Ptr& pGenerated);
         virtual bool PreLoad(SR_HTYPES_NS::Marshal* pMarshal);
         virtual bool Load();
 
@@ -83,7 +88,8 @@ namespace SR_WORLD_NS {
         SR_MATH_NS::IVector3 m_regionPosition;
         SR_MATH_NS::IVector3 m_position;
 
-        std::list<SR_HTYPES_NS::SharedPtr<GameObject>> m_preloaded;
+        std::vector<SR_HTYPES_NS::SharedPtr<GameObject>> m_preloaded;
+        WorldGen::GeneratedChunk::Ptr m_generated;
 
     };
 }
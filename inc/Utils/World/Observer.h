@@ -71,6 +71,12 @@ namespace SR_WORLD_NS {
         Offset MathNeighbour(const Math::IVector3& offset) const;
         Math::IVector3 WorldPosToChunkPos(const Math::FVector3& position);
 
+        void UpdateVelocity(float_t dt);
+        void ResetVelocity();
+
+        SR_NODISCARD SR_MATH_NS::FVector3 GetVelocity() const noexcept { return m_velocity; }
+        SR_NODISCARD SR_MATH_NS::FVector3 PredictPosition(float_t seconds) const;
+
         SR_NODISCARD int32_t GetScope() const noexcept { return m_scope; }
         SR_NODISCARD bool HasTarget() const noexcept { return m_target; }
 
@@ -98,6 +104,11 @@ namespace SR_WORLD_NS {
 
         SR_MATH_NS::FVector3 m_targetPosition;
         GameObjectPtr m_target;
+
+        /// сглаженная скорость наблюдателя, используется для предзагрузки регионов
+        SR_MATH_NS::FVector3 m_velocity;
+        SR_MATH_NS::FVector3 m_lastTargetPosition;
+        bool m_hasLastTargetPosition = false;
     };
 
     SR_DLL_EXPORT Math::IVector3 MakeChunk(const Math::IVector3& rawChunkPos, int32_t width);
@@ -76,6 +76,15 @@ namespace SR_WORLD_NS {
         static void SetAllocator(const Allocator& allocator);
         static Region* Allocate(SRRegionAllocArgs);
 
+        /// разбирает файл региона на блоки чанков, не обращается к сцене и может вызываться из любого потока
+        static bool ReadCache(SR_HTYPES_NS::Marshal& marshal, CachedChunks& chunks);
+        /// версия формата файла региона, для инструментов, пишущих кэш без сцены
+        SR_NODISCARD static uint16_t GetCacheVersion() noexcept { return VERSION; }
+
+    private:
+        /// подставляет чанкам рельеф, который фоновые потоки генератора уже успели построить
+        void UpdateGeneration();
+
     private:
         static Allocator g_allocator;
         static const uint16_t VERSION;
@@ -85,6 +94,8 @@ namespace SR_WORLD_NS {
 
         Chunks m_loadedChunks;
         CachedChunks m_cached;
+        /// загруженные чанки, рельеф которых еще генерируется в фоне
+        std::vector<Math::IVector3> m_awaitingGeneration;
         uint32_t m_width;
         Math::IVector2 m_chunkSize;
         Math::IVector3 m_position;
@@ -0,0 +1,100 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_REGION_STREAMER_H
+#define SR_ENGINE_REGION_STREAMER_H
+
+#include <Utils/World/Region.h>
+#include <Utils/Types/Thread.h>
+
+namespace SR_WORLD_NS {
+    /**
+     * Фоновая подгрузка и сохранение регионов.
+     * Потоки читают файлы регионов и разбирают их на блоки чанков, не трогая сцену.
+     * Готовые регионы лежат в LRU-кэше, ограниченном по памяти, пока основной поток не заберет их через Take().
+     * Сохранение пишет файл в фоне, а Take() дожидается записи того же региона, чтобы не прочитать старые данные.
+    */
+    class SR_DLL_EXPORT RegionStreamer : public NonCopyable {
+        struct Entry {
+            enum class State : uint8_t {
+                Queued, Loading, Ready
+            };
+
+            State state = State::Queued;
+            bool stale = false;
+            bool failed = false;
+            float_t priority = 0.f;
+            uint64_t lastUse = 0;
+            uint64_t bytes = 0;
+            SR_UTILS_NS::Path path;
+            CachedChunks chunks;
+        };
+
+        struct SaveJob {
+            SR_MATH_NS::IVector3 position;
+            SR_UTILS_NS::Path path;
+            SR_HTYPES_NS::Marshal::Ptr pMarshal = nullptr;
+        };
+
+    public:
+        RegionStreamer(uint32_t threadsCount, uint64_t memoryBudget);
+        ~RegionStreamer() override;
+
+    public:
+        void Start();
+        /// дописывает сохранения и ждет потоки, деструктор вызывает его сам, если загрузчик не остановлен
+        void Stop();
+
+        /// меньший приоритет загружается раньше
+        void Prefetch(const SR_MATH_NS::IVector3& region, const SR_UTILS_NS::Path& path, float_t priority);
+
+        /// забирает владение pMarshal, nullptr или невалидный маршал удаляют файл региона
+        void Save(const SR_MATH_NS::IVector3& region, const SR_UTILS_NS::Path& path, SR_HTYPES_NS::Marshal::Ptr pMarshal);
+
+        /// блокирует, если регион сейчас читается или сохраняется, иначе читает синхронно
+        bool Take(const SR_MATH_NS::IVector3& region, const SR_UTILS_NS::Path& path, CachedChunks& chunks);
+
+        /// отменяет ещё не начатую предзагрузку, вызывается перед новой порцией Prefetch()
+        void CancelQueued();
+        void Flush();
+
+        SR_NODISCARD bool IsActive() const noexcept { return m_isActive; }
+        SR_NODISCARD bool IsQueued(const SR_MATH_NS::IVector3& region) const;
+        SR_NODISCARD uint64_t GetUsedMemory() const noexcept { return m_usedMemory; }
+        SR_NODISCARD uint64_t GetMemoryBudget() const noexcept { return m_memoryBudget; }
+
+    private:
+        void Work();
+
+        bool ProcessSave(std::unique_lock<std::mutex>& lock);
+        bool ProcessLoad(std::unique_lock<std::mutex>& lock);
+
+        void EvictLocked();
+        void FreeEntry(Entry& entry);
+
+        static bool ReadRegion(const SR_UTILS_NS::Path& path, CachedChunks& chunks, uint64_t& bytes);
+        static void WriteRegion(const SR_UTILS_NS::Path& path, SR_HTYPES_NS::Marshal::Ptr pMarshal);
+
+    private:
+        mutable std::mutex m_mutex;
+        std::condition_variable m_workCondition;
+        std::condition_variable m_doneCondition;
+
+        std::unordered_map<SR_MATH_NS::IVector3, Entry> m_entries;
+        std::deque<SaveJob> m_saves;
+        std::unordered_map<SR_MATH_NS::IVector3, uint32_t> m_pendingSaves;
+
+        std::vector<SR_HTYPES_NS::Thread::Ptr> m_threads;
+
+        uint32_t m_threadsCount = 1;
+        uint64_t m_memoryBudget = 0;
+        std::atomic<uint64_t> m_usedMemory = 0;
+        uint64_t m_useCounter = 0;
+
+        std::atomic<bool> m_isActive = false;
+
+    };
+}
+
+#endif //SR_ENGINE_REGION_STREAMER_H
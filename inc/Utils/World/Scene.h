@@ -14,6 +14,7 @@
 #include <Utils/World/CameraData.h>
 #include <Utils/Types/DataStorage.h>
 #include <Utils/World/TensorKey.h>
+#include <Utils/ECS/ObjectMask.h>
 
 namespace SR_UTILS_NS {
     class SceneObject;
@@ -31,6 +32,7 @@ namespace SR_WORLD_NS {
         SR_CLASS()
         SR_ENTITY_SET_VERSION(1000)
     public:
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Scene)
         using Ptr = SR_HTYPES_NS::SharedPtr<Scene>;
         using SceneLogicPtr = SR_HTYPES_NS::SharedPtr<SceneLogic>;
         using Super = SR_UTILS_NS::IComponentable;
@@ -87,6 +89,14 @@ namespace SR_WORLD_NS {
 
         void RegisterSceneObject(const SceneObjectPtr& ptr);
 
+        /// Идентификаторы объектов (GetIdInScene), прошедших фильтр по маскам тегов и слоев.
+        /// Результат живет до следующего запроса, объекты из очереди на добавление не учитываются до Prepare.
+        SR_NODISCARD std::span<const uint32_t> QueryObjectIds(const SR_UTILS_NS::ObjectMaskQuery& query);
+        void QueryObjects(const SR_UTILS_NS::ObjectMaskQuery& query, SceneObjects& objects);
+
+        /// вызывается объектом при смене тега или слоя
+        void UpdateObjectMask(const SceneObject* pObject);
+
         virtual SceneObjectPtr InstanceFromFile(const std::string& path);
         virtual SceneObjectPtr Instance(const Types::RawMesh* rawMesh);
         virtual SceneObjectPtr Instance(SR_HTYPES_NS::Marshal& marshal);
@@ -104,6 +114,10 @@ namespace SR_WORLD_NS {
 
         bool Reload();
 
+    private:
+        void SetObjectMask(uint64_t idInScene, const SceneObject* pObject);
+        void RebuildObjectMasks();
+
     private:
         SceneUpdater* m_sceneUpdater = nullptr;
 
@@ -123,6 +137,13 @@ namespace SR_WORLD_NS {
         SceneObjects m_sceneObjects;
         SceneObjects m_root;
 
+        /// маски параллельны m_sceneObjects, у пустого слота обе маски нулевые
+        std::vector<SR_UTILS_NS::ObjectMask> m_tagMasks;
+        std::vector<SR_UTILS_NS::ObjectMask> m_layerMasks;
+        std::vector<uint32_t> m_queryIds;
+        uint64_t m_tagsHashState = 0;
+        uint64_t m_layersHashState = 0;
+
         Path m_path;
         Path m_absPath;
 
@@ -6,7 +6,9 @@
 #define SR_ENGINE_SCENECUBECHUNKLOGIC_H
 
 #include <Utils/World/SceneLogic.h>
-#include <Utils/World/TensorKey.h>
+#include <Utils/World/Tensor.h>
+#include <Utils/World/RegionStreamer.h>
+#include <Utils/World/WorldGen.h>
 
 namespace SR_WORLD_NS {
     class SceneCubeChunkLogic : public SceneLogic {
@@ -35,6 +37,8 @@ namespace SR_WORLD_NS {
         SR_NODISCARD const SceneObjects& GetGameObjectsAtChunk(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk) const;
         SR_NODISCARD Chunk* GetCurrentChunk() const;
         SR_NODISCARD Observer* GetObserver() const { return m_observer; }
+        SR_NODISCARD RegionStreamer* GetRegionStreamer() const { return m_streamer; }
+        SR_NODISCARD WorldGen* GetWorldGen() const { return m_worldGen; }
         SR_NODISCARD SR_MATH_NS::FVector3 GetWorldPosition(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk) const;
         SR_NODISCARD Region* GetRegion(const SR_MATH_NS::IVector3& region) const;
         SR_NODISCARD Region* GetOrLoadRegion(const SR_MATH_NS::IVector3& region);
@@ -45,6 +49,8 @@ namespace SR_WORLD_NS {
 
     private:
         SR_NODISCARD SR_MATH_NS::IVector3 CalculateCurrentChunk() const;
+        SR_NODISCARD SR_MATH_NS::IVector3 CalculateRegion(const SR_MATH_NS::FVector3& position) const;
+        SR_NODISCARD Path GetRegionPath(const SR_MATH_NS::IVector3& region) const;
 
         bool ReloadConfig();
 
@@ -55,6 +61,8 @@ namespace SR_WORLD_NS {
         void CheckShift(const SR_MATH_NS::IVector3& chunk);
         void UpdateContainers();
         void UpdateScope(float_t dt);
+        void UpdatePrefetch();
+        void UpdateScopeOffsets();
         void SaveRegion(const SR_UTILS_NS::Path& path, Region* pRegion, SR_HTYPES_NS::DataStorage* pContext) const;
 
     private:
@@ -73,9 +81,30 @@ namespace SR_WORLD_NS {
         Observer* m_observer = nullptr;
         Chunk* m_currentChunk = nullptr;
 
+        RegionStreamer* m_streamer = nullptr;
+        uint32_t m_streamingThreads = 1;
+        uint64_t m_streamingMemoryBudget = 0;
+        float_t m_prefetchLookahead = 0.f;
+        int32_t m_prefetchRadius = 0;
+        SR_MATH_NS::IVector3 m_lastPrefetchRegion;
+        SR_MATH_NS::IVector3 m_lastPredictedRegion;
+
+        WorldGen* m_worldGen = nullptr;
+        WorldGen::Settings m_worldGenSettings;
+        uint32_t m_worldGenThreads = 0;
+        uint32_t m_worldGenCacheCapacity = 0;
+        bool m_worldGenEnabled = false;
+
+        /// смещения чанков в области видимости, отсортированные от ближних к дальним
+        std::vector<SR_MATH_NS::IVector3> m_scopeOffsets;
+        int32_t m_scopeOffsetsScope = -1;
+        uint32_t m_maxChunkLoadsPerFrame = 0;
+        uint32_t m_chunkLoadsThisFrame = 0;
+
         bool m_updateContainer = false;
         bool m_shiftEnabled = false;
         bool m_scopeEnabled = false;
+        bool m_streamingEnabled = false;
 
     };
 }
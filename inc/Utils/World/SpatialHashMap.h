@@ -0,0 +1,310 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_SPATIAL_HASH_MAP_H
+#define SR_ENGINE_SPATIAL_HASH_MAP_H
+
+#include <Utils/Math/Vector3.h>
+#include <Utils/Debug.h>
+
+namespace SR_WORLD_NS {
+    namespace MortonDetails {
+        static constexpr uint32_t BITS_PER_AXIS = 21;
+        static constexpr int32_t BIAS = 1 << (BITS_PER_AXIS - 1);
+        static constexpr uint64_t AXIS_MASK = (1ull << BITS_PER_AXIS) - 1;
+
+        SR_NODISCARD SR_FORCE_INLINE constexpr uint64_t Spread(uint64_t value) noexcept {
+            value &= AXIS_MASK;
+            value = (value | (value << 32u)) & 0x1f00000000ffffull;
+            value = (value | (value << 16u)) & 0x1f0000ff0000ffull;
+            value = (value | (value << 8u)) & 0x100f00f00f00f00full;
+            value = (value | (value << 4u)) & 0x10c30c30c30c30c3ull;
+            value = (value | (value << 2u)) & 0x1249249249249249ull;
+            return value;
+        }
+
+        SR_NODISCARD SR_FORCE_INLINE constexpr uint64_t Compact(uint64_t value) noexcept {
+            value &= 0x1249249249249249ull;
+            value = (value ^ (value >> 2u)) & 0x10c30c30c30c30c3ull;
+            value = (value ^ (value >> 4u)) & 0x100f00f00f00f00full;
+            value = (value ^ (value >> 8u)) & 0x1f0000ff0000ffull;
+            value = (value ^ (value >> 16u)) & 0x1f00000000ffffull;
+            value = (value ^ (value >> 32u)) & AXIS_MASK;
+            return value;
+        }
+    }
+
+    /// Z-order код знаковой позиции, по 21 биту на ось (диапазон [-2^20, 2^20)).
+    /// Соседние в пространстве ячейки получают близкие коды.
+    SR_NODISCARD SR_FORCE_INLINE constexpr uint64_t MortonEncode(const SR_MATH_NS::IVector3& position) noexcept {
+        using namespace MortonDetails;
+        return Spread(static_cast<uint64_t>(position.x + BIAS))
+            | (Spread(static_cast<uint64_t>(position.y + BIAS)) << 1u)
+            | (Spread(static_cast<uint64_t>(position.z + BIAS)) << 2u);
+    }
+
+    SR_NODISCARD SR_FORCE_INLINE SR_MATH_NS::IVector3 MortonDecode(uint64_t code) noexcept {
+        using namespace MortonDetails;
+        return SR_MATH_NS::IVector3(
+            static_cast<int32_t>(Compact(code)) - BIAS,
+            static_cast<int32_t>(Compact(code >> 1u)) - BIAS,
+            static_cast<int32_t>(Compact(code >> 2u)) - BIAS
+        );
+    }
+
+    /**
+     * Плоская хеш-таблица с ключом-позицией.
+     * Значения лежат непрерывно в одном массиве (удаление через swap с последним),
+     * индекс — открытая адресация с линейным пробированием по перемешанному Morton-коду.
+     * Порядок обхода не сохраняется при удалении.
+    */
+    template<typename T> class SpatialHashMap {
+    public:
+        using Key = SR_MATH_NS::IVector3;
+        using Iterator = typename std::vector<T>::iterator;
+        using ConstIterator = typename std::vector<T>::const_iterator;
+
+    private:
+        static constexpr uint32_t EMPTY_SLOT = 0;
+        static constexpr uint32_t MIN_CAPACITY = 16;
+
+    public:
+        SR_NODISCARD uint32_t size() const noexcept { return static_cast<uint32_t>(m_values.size()); }
+        SR_NODISCARD bool empty() const noexcept { return m_values.empty(); }
+
+        Iterator begin() noexcept { return m_values.begin(); }
+        Iterator end() noexcept { return m_values.end(); }
+        ConstIterator begin() const noexcept { return m_values.begin(); }
+        ConstIterator end() const noexcept { return m_values.end(); }
+
+        SR_NODISCARD const std::vector<Key>& GetKeys() const noexcept { return m_keys; }
+        SR_NODISCARD const Key& GetKey(uint32_t index) const noexcept { return m_keys[index]; }
+        SR_NODISCARD T& GetValue(uint32_t index) noexcept { return m_values[index]; }
+        SR_NODISCARD const T& GetValue(uint32_t index) const noexcept { return m_values[index]; }
+
+        SR_NODISCARD bool Contains(const Key& key) const noexcept { return FindIndex(key) != SR_UINT32_MAX; }
+
+        SR_NODISCARD T* Find(const Key& key) noexcept {
+            const uint32_t index = FindIndex(key);
+            return index == SR_UINT32_MAX ? nullptr : &m_values[index];
+        }
+
+        SR_NODISCARD const T* Find(const Key& key) const noexcept {
+            const uint32_t index = FindIndex(key);
+            return index == SR_UINT32_MAX ? nullptr : &m_values[index];
+        }
+
+        SR_NODISCARD uint32_t FindIndex(const Key& key) const noexcept {
+            if (m_slots.empty()) {
+                return SR_UINT32_MAX;
+            }
+
+            const uint32_t mask = static_cast<uint32_t>(m_slots.size()) - 1;
+            for (uint32_t slot = Home(key, mask); ; slot = (slot + 1) & mask) {
+                const uint32_t value = m_slots[slot];
+                if (value == EMPTY_SLOT) {
+                    return SR_UINT32_MAX;
+                }
+                if (m_keys[value - 1] == key) {
+                    return value - 1;
+                }
+            }
+        }
+
+        T& operator[](const Key& key) {
+            if (auto&& pValue = Find(key)) {
+                return *pValue;
+            }
+            return Insert(key, T());
+        }
+
+        /// ключ не должен присутствовать в таблице
+        T& Insert(const Key& key, T value) {
+            SRAssert(!Contains(key));
+
+            if ((m_values.size() + 1) * 2 > m_slots.size()) {
+                Rehash(std::max<uint32_t>(MIN_CAPACITY, static_cast<uint32_t>(m_slots.size()) * 2));
+            }
+
+            m_keys.emplace_back(key);
+            m_values.emplace_back(std::move(value));
+
+            InsertSlot(key, static_cast<uint32_t>(m_values.size()));
+
+            return m_values.back();
+        }
+
+        bool Erase(const Key& key) {
+            const uint32_t index = FindIndex(key);
+            if (index == SR_UINT32_MAX) {
+                return false;
+            }
+            EraseAt(index);
+            return true;
+        }
+
+        /// на место удаленного элемента переезжает последний, индексы после него не меняются
+        void EraseAt(uint32_t index) {
+            const uint32_t last = size() - 1;
+
+            RemoveSlot(m_keys[index]);
+
+            if (index != last) {
+                m_slots[FindSlot(m_keys[last])] = index + 1;
+                m_keys[index] = m_keys[last];
+                m_values[index] = std::move(m_values[last]);
+            }
+
+            m_keys.pop_back();
+            m_values.pop_back();
+        }
+
+        void Reserve(uint32_t count) {
+            m_keys.reserve(count);
+            m_values.reserve(count);
+
+            uint32_t capacity = MIN_CAPACITY;
+            while (capacity < count * 2) {
+                capacity *= 2;
+            }
+
+            if (capacity > m_slots.size()) {
+                Rehash(capacity);
+            }
+        }
+
+        void Clear() {
+            m_keys.clear();
+            m_values.clear();
+            std::fill(m_slots.begin(), m_slots.end(), EMPTY_SLOT);
+        }
+
+        /// обход всех ключей в прямоугольной области [min, max] (включительно)
+        template<typename Fn> void ForEachInBox(const Key& min, const Key& max, const Fn& function) {
+            ForEachInBoxImpl(*this, min, max, function);
+        }
+
+        template<typename Fn> void ForEachInBox(const Key& min, const Key& max, const Fn& function) const {
+            ForEachInBoxImpl(*this, min, max, function);
+        }
+
+        /// обход всех ключей в сфере радиуса radius (в ячейках) вокруг center
+        template<typename Fn> void ForEachInRadius(const Key& center, int32_t radius, const Fn& function) {
+            ForEachInRadiusImpl(*this, center, radius, function);
+        }
+
+        template<typename Fn> void ForEachInRadius(const Key& center, int32_t radius, const Fn& function) const {
+            ForEachInRadiusImpl(*this, center, radius, function);
+        }
+
+    private:
+        template<typename Self, typename Fn> static void ForEachInBoxImpl(Self& self, const Key& min, const Key& max, const Fn& function) {
+            if (self.empty() || min.x > max.x || min.y > max.y || min.z > max.z) {
+                return;
+            }
+
+            const uint64_t volume = static_cast<uint64_t>(max.x - min.x + 1)
+                * static_cast<uint64_t>(max.y - min.y + 1)
+                * static_cast<uint64_t>(max.z - min.z + 1);
+
+            /// маленькую область дешевле пробить поиском, большую — линейным проходом по плотному массиву
+            if (volume <= self.size()) {
+                for (int32_t x = min.x; x <= max.x; ++x) {
+                    for (int32_t y = min.y; y <= max.y; ++y) {
+                        for (int32_t z = min.z; z <= max.z; ++z) {
+                            const Key key(x, y, z);
+                            if (const uint32_t index = self.FindIndex(key); index != SR_UINT32_MAX) {
+                                function(self.m_keys[index], self.m_values[index]);
+                            }
+                        }
+                    }
+                }
+                return;
+            }
+
+            for (uint32_t i = 0; i < self.size(); ++i) {
+                const Key& key = self.m_keys[i];
+                if (key.x >= min.x && key.y >= min.y && key.z >= min.z && key.x <= max.x && key.y <= max.y && key.z <= max.z) {
+                    function(key, self.m_values[i]);
+                }
+            }
+        }
+
+        template<typename Self, typename Fn> static void ForEachInRadiusImpl(Self& self, const Key& center, int32_t radius, const Fn& function) {
+            const int64_t radius2 = static_cast<int64_t>(radius) * radius;
+
+            ForEachInBoxImpl(self, center - Key(radius), center + Key(radius), [&](const Key& key, auto&& value) {
+                const int64_t dx = key.x - center.x;
+                const int64_t dy = key.y - center.y;
+                const int64_t dz = key.z - center.z;
+
+                if (dx * dx + dy * dy + dz * dz <= radius2) {
+                    function(key, value);
+                }
+            });
+        }
+
+        SR_NODISCARD static uint32_t Home(const Key& key, uint32_t mask) noexcept {
+            /// перемешиваем биты Morton-кода, иначе соседние ячейки кучкуются в таблице
+            uint64_t hash = MortonEncode(key);
+            hash ^= hash >> 33u;
+            hash *= 0xff51afd7ed558ccdull;
+            hash ^= hash >> 33u;
+            return static_cast<uint32_t>(hash) & mask;
+        }
+
+        SR_NODISCARD uint32_t FindSlot(const Key& key) const noexcept {
+            const uint32_t mask = static_cast<uint32_t>(m_slots.size()) - 1;
+            for (uint32_t slot = Home(key, mask); ; slot = (slot + 1) & mask) {
+                if (m_keys[m_slots[slot] - 1] == key) {
+                    return slot;
+                }
+            }
+        }
+
+        void InsertSlot(const Key& key, uint32_t value) noexcept {
+            const uint32_t mask = static_cast<uint32_t>(m_slots.size()) - 1;
+            uint32_t slot = Home(key, mask);
+            while (m_slots[slot] != EMPTY_SLOT) {
+                slot = (slot + 1) & mask;
+            }
+            m_slots[slot] = value;
+        }
+
+        /// удаление со сдвигом следующих элементов цепочки назад, без "надгробий"
+        void RemoveSlot(const Key& key) noexcept {
+            const uint32_t mask = static_cast<uint32_t>(m_slots.size()) - 1;
+            uint32_t hole = FindSlot(key);
+
+            for (uint32_t slot = (hole + 1) & mask; m_slots[slot] != EMPTY_SLOT; slot = (slot + 1) & mask) {
+                const uint32_t home = Home(m_keys[m_slots[slot] - 1], mask);
+
+                const bool inRange = hole <= slot ? (hole < home && home <= slot) : (hole < home || home <= slot);
+                if (inRange) {
+                    continue;
+                }
+
+                m_slots[hole] = m_slots[slot];
+                hole = slot;
+            }
+
+            m_slots[hole] = EMPTY_SLOT;
+        }
+
+        void Rehash(uint32_t capacity) {
+            m_slots.assign(capacity, EMPTY_SLOT);
+            for (uint32_t i = 0; i < size(); ++i) {
+                InsertSlot(m_keys[i], i + 1);
+            }
+        }
+
+    private:
+        std::vector<uint32_t> m_slots;
+        std::vector<Key> m_keys;
+        std::vector<T> m_values;
+
+    };
+}
+
+#endif //SR_ENGINE_SPATIAL_HASH_MAP_H
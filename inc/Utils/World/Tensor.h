@@ -0,0 +1,69 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_TENSOR_H
+#define SR_ENGINE_TENSOR_H
+
+#include <Utils/World/TensorKey.h>
+
+namespace SR_WORLD_NS {
+    /**
+     * Распределение объектов сцены по чанкам.
+     * Ключ (регион, чанк) переводится в сквозную координату чанка, поэтому запросы по области
+     * и радиусу работают через границы регионов. Объекты одного чанка лежат в одном массиве,
+     * а сами массивы переиспользуются между перестроениями, чтобы не аллоцировать память каждый кадр.
+    */
+    class SR_DLL_EXPORT Tensor {
+    public:
+        using SceneObjectPtr = SR_HTYPES_NS::SharedPtr<SceneObject>;
+        using SceneObjects = std::vector<SceneObjectPtr>;
+        using Cells = SpatialHashMap<SceneObjects>;
+
+    public:
+        /// смена ширины региона меняет отображение ключей, поэтому тензор очищается
+        void SetRegionWidth(int32_t width);
+
+        SR_NODISCARD int32_t GetRegionWidth() const noexcept { return m_regionWidth; }
+        SR_NODISCARD uint32_t GetCellsCount() const noexcept { return m_cells.size(); }
+        SR_NODISCARD uint64_t GetObjectsCount() const noexcept { return m_objectsCount; }
+        SR_NODISCARD const Cells& GetCells() const noexcept { return m_cells; }
+
+        SR_NODISCARD SR_MATH_NS::IVector3 ToCell(const TensorKey& key) const noexcept;
+        SR_NODISCARD TensorKey ToKey(const SR_MATH_NS::IVector3& cell) const noexcept;
+
+        SR_NODISCARD const SceneObjects* Find(const TensorKey& key) const;
+
+        void Add(const TensorKey& key, SceneObjectPtr pObject);
+        bool Remove(const TensorKey& key, const SceneObjectPtr& pObject);
+        bool Move(const SceneObjectPtr& pObject, const TensorKey& from, const TensorKey& to);
+
+        /// очищает содержимое, удаляя только чанки, которые оставались пустыми с прошлой очистки
+        void Clear();
+
+        template<typename Fn> void ForEachInBox(const TensorKey& min, const TensorKey& max, const Fn& function) const {
+            m_cells.ForEachInBox(ToCell(min), ToCell(max), [&](const SR_MATH_NS::IVector3& cell, const SceneObjects& objects) {
+                if (!objects.empty()) {
+                    function(ToKey(cell), objects);
+                }
+            });
+        }
+
+        /// radius задается в чанках
+        template<typename Fn> void ForEachInRadius(const TensorKey& center, int32_t radius, const Fn& function) const {
+            m_cells.ForEachInRadius(ToCell(center), radius, [&](const SR_MATH_NS::IVector3& cell, const SceneObjects& objects) {
+                if (!objects.empty()) {
+                    function(ToKey(cell), objects);
+                }
+            });
+        }
+
+    private:
+        Cells m_cells;
+        int32_t m_regionWidth = 1;
+        uint64_t m_objectsCount = 0;
+
+    };
+}
+
+#endif //SR_ENGINE_TENSOR_H
@@ -8,6 +8,7 @@
 #include <Utils/Math/Vector2.h>
 #include <Utils/Math/Vector3.h>
 #include <Utils/Types/SharedPtr.h>
+#include <Utils/World/SpatialHashMap.h>
 
 namespace SR_WORLD_NS {
     struct SR_DLL_EXPORT TensorKey {
@@ -52,8 +53,7 @@ namespace SR_WORLD_NS {
     class Region;
     class Chunk;
 
-    typedef std::unordered_map<TensorKey, std::vector<SR_HTYPES_NS::SharedPtr<SceneObject>>> Tensor;
-    typedef std::list<Region*> Regions;
+    typedef SpatialHashMap<Region*> Regions;
 }
 
 #endif //SR_ENGINE_TENSORKEY_H
@@ -5,11 +5,122 @@
 #ifndef SR_ENGINE_WORLDGEN_H
 #define SR_ENGINE_WORLDGEN_H
 
+#include <Utils/Math/Vector3.h>
+#include <Utils/Math/Vector2.h>
+#include <Utils/Math/Noise.h>
+#include <Utils/Types/Thread.h>
+
 namespace SR_WORLD_NS {
     class Region;
     class Chunk;
 
-    class SR_DLL_EXPORT WorldGen {
+    /**
+     * Процедурная генерация содержимого чанков по зерну и координатам.
+     * Результат зависит только от настроек и глобальной позиции чанка, поэтому чанки генерируются
+     * в любом порядке и в любом потоке с побитово одинаковым результатом.
+     * Сгенерированные чанки не сохраняются на диск: их дешевле сгенерировать заново, чем прочитать.
+    */
+    class SR_DLL_EXPORT WorldGen : public NonCopyable {
+    public:
+        struct Settings {
+            uint64_t seed = 0;
+            /// количество отсчетов карты высот по одной стороне чанка
+            uint32_t resolution = 17;
+            float_t heightScale = 1.f;
+            SR_MATH_NS::FBmSettings fbm;
+        };
+
+        struct GeneratedChunk {
+            using Ptr = std::shared_ptr<const GeneratedChunk>;
+
+            SR_MATH_NS::IVector3 region;
+            SR_MATH_NS::IVector3 chunk;
+            uint32_t resolution = 0;
+            /// heights[z * resolution + x], края соседних чанков совпадают
+            std::vector<float_t> heights;
+            uint64_t hash = 0;
+        };
+
+        using ChunkKey = std::pair<SR_MATH_NS::IVector3, SR_MATH_NS::IVector3>;
+
+    public:
+        WorldGen(const Settings& settings, const SR_MATH_NS::IVector2& chunkSize, uint32_t regionWidth);
+        ~WorldGen() override;
+
+    public:
+        /// без потоков генерация идет синхронно в Get() и GenerateBatch()
+        void Start(uint32_t threadsCount);
+        void Stop();
+
+        /// из кэша, а если чанка там нет - генерирует в текущем потоке
+        SR_NODISCARD GeneratedChunk::Ptr Get(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk);
+
+        /// из кэша без ожидания, а если чанка там нет - ставит его в очередь потоков и возвращает nullptr.
+        /// Без потоков ждать некого, поэтому генерирует в текущем потоке, как Get()
+        SR_NODISCARD GeneratedChunk::Ptr TryGet(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk);
+
+        /// фоновая генерация, результат попадет в кэш
+        void Request(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk);
+
+        /// параллельная генерация пачки, результаты в том же порядке, что и позиции
+        SR_NODISCARD std::vector<GeneratedChunk::Ptr> GenerateBatch(const std::vector<ChunkKey>& chunks);
+
+        void SetCacheCapacity(uint32_t capacity);
+        void ClearCache();
+
+        SR_NODISCARD const Settings& GetSettings() const noexcept { return m_settings; }
+        SR_NODISCARD uint32_t GetCacheSize() const;
+        SR_NODISCARD bool IsActive() const noexcept { return m_isActive; }
+
+        /// чистая функция, ее результат одинаков на любом потоке и при любом порядке вызовов
+        SR_NODISCARD static GeneratedChunk Generate(const Settings& settings, const SR_MATH_NS::IVector2& chunkSize, uint32_t regionWidth,
+            const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk);
+
+        SR_NODISCARD static uint64_t CalculateHash(const GeneratedChunk& generated);
+
+    private:
+        struct Entry {
+            enum class State : uint8_t {
+                Queued, Generating, Ready
+            };
+
+            State state = State::Queued;
+            uint64_t lastUse = 0;
+            GeneratedChunk::Ptr pChunk;
+        };
+
+        struct ChunkKeyHash {
+            SR_NODISCARD size_t operator()(const ChunkKey& key) const noexcept {
+                return SR_UTILS_NS::CombineTwoHashes(std::hash<SR_MATH_NS::IVector3>()(key.first), std::hash<SR_MATH_NS::IVector3>()(key.second));
+            }
+        };
+
+    private:
+        void Work();
+        void EvictLocked();
+
+        SR_NODISCARD GeneratedChunk::Ptr GenerateShared(const ChunkKey& key) const;
+        SR_NODISCARD GeneratedChunk::Ptr WaitLocked(std::unique_lock<std::mutex>& lock, const ChunkKey& key);
+
+    private:
+        const Settings m_settings;
+        const SR_MATH_NS::IVector2 m_chunkSize;
+        const uint32_t m_regionWidth;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_workCondition;
+        std::condition_variable m_doneCondition;
+
+        std::unordered_map<ChunkKey, Entry, ChunkKeyHash> m_entries;
+        std::deque<ChunkKey> m_queue;
+
+        std::vector<SR_HTYPES_NS::Thread::Ptr> m_threads;
+
+        uint32_t m_cacheCapacity = 1024;
+        uint32_t m_readyCount = 0;
+        uint64_t m_useCounter = 0;
+
+        std::atomic<bool> m_isActive = false;
 
     };
 }
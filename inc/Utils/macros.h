@@ -155,6 +155,12 @@
     #define SR_FORCE_INLINE __forceinline
 #endif
 
+#if defined(SR_MSVC)
+    #define SR_NOINLINE __declspec(noinline)
+#else
+    #define SR_NOINLINE __attribute__((noinline))
+#endif
+
 #define SR_CLOCKS_PER_SEC 1000
 
 #ifdef SR_GCC
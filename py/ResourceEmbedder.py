@@ -1,146 +1,184 @@
 from Common import *
 
+import struct
+import zlib
+
 print("ResourceEmbedder.py: running...")
-def needs_update(path, export_path):
-    if not os.path.exists(path):
-        print(f"Path does not exist: {path}")
-        return
 
-    if not os.path.isfile(path):
-        print(f"Path is not a file: {path}")
-        return
+# Must match SR_UTILS_NS::ResourceEmbedder::PackHeader / PackEntry.
+PACK_MAGIC = 0x4B505253  # "SRPK"
+PACK_VERSION = 1
+PACK_HEADER_FORMAT = "<IIII"
+PACK_ENTRY_FORMAT = "<QIIQQQII"
+
+COMPRESSION_NONE = 0
+COMPRESSION_ZLIB = 1
+
+PACK_ALIGNMENT = 16
+
+FNV_OFFSET_BASIS = 14695981039346656037
+FNV_PRIME = 1099511628211
+
+
+def fnv1a(data):
+    # Same as SR_HASH_STR_VIEW on the C++ side.
+    value = FNV_OFFSET_BASIS
+    for b in data:
+        value ^= b
+        value = (value * FNV_PRIME) & 0xFFFFFFFFFFFFFFFF
+    return value
+
+
+def collect_resources(resources):
+    files = []
+    for resource_path in resources:
+        resource_path = resource_path.replace("\\", "/")
+        if os.path.isdir(resource_path):
+            for filename in sorted(os.listdir(resource_path)):
+                file_path = os.path.join(resource_path, filename).replace("\\", "/")
+                if os.path.isfile(file_path):
+                    files.append(file_path)
+        elif os.path.isfile(resource_path):
+            files.append(resource_path)
+        else:
+            print(f"ResourceEmbedder.py : path does not exist or is not a file: {resource_path}")
+    return files
+
+
+def relative_path(path):
+    parts = path.split(working_directory + '/')
+    return parts[1] if len(parts) > 1 else path
+
 
+def calculate_pack_hash(files, compression):
+    md5 = hashlib.md5()
+    md5.update(f"{PACK_VERSION}|{compression}".encode())
+    for file in files:
+        md5.update(relative_path(file).encode())
+        md5.update(open(file, "rb").read())
+    return md5.hexdigest()
 
-    filename, file_extension = os.path.splitext(os.path.basename(path))
-    file_extension = file_extension[1:]
 
-    header_name = f"{filename}{file_extension}"
-    header_path = f"{export_path}/EmbedResources/{header_name}.h"
-    if not os.path.exists(header_path):
-        print("ResourceEmbedder.py : header does not exist, creating a new one.")
+def needs_update(export_path, pack_hash):
+    cxx_path = f"{export_path}/EmbedResources/EmbedResources.cxx"
+    if not os.path.exists(cxx_path):
+        print("ResourceEmbedder.py : pack does not exist, creating a new one.")
         return True
 
-    hash_path = f"{export_path}/EmbedResources/Hashes/{header_name}.hash"
-    if os.path.exists(hash_path):
-        current_hash = hashlib.md5(open(path, "rb").read()).hexdigest()
-        previous_hash = open(hash_path, "r").read()
-        if current_hash != previous_hash:
-            print(f"ResourceEmbedder.py : hashes are not equal, creating new header: '{current_hash}' != '{previous_hash}'.")
-            return True
+    hash_path = f"{export_path}/EmbedResources/Hashes/EmbedResources.hash"
+    if not os.path.exists(hash_path):
+        return True
+
+    previous_hash = open(hash_path, "r").read()
+    if pack_hash != previous_hash:
+        print(f"ResourceEmbedder.py : hashes are not equal, creating new pack: '{pack_hash}' != '{previous_hash}'.")
+        return True
 
     return False
 
-def create_cxx(path):
-    print(f"ResourceEmbedder.py : creating cxx at '{path}'.")
-    files = [f for f in os.listdir(path) if os.path.isfile(os.path.join(path, f))]
 
-    if os.path.isfile(os.path.join(path, "EmbedResources.cxx")):
-        os.remove(f"{path}/EmbedResources.cxx")
+def align(value):
+    return (value + PACK_ALIGNMENT - 1) // PACK_ALIGNMENT * PACK_ALIGNMENT
 
-    cxx_file = open(f"{path}/EmbedResources.cxx", "w")
-    cxx_file.write("/// This file is created by ResourceEmbedder.py\n\n")
-    cxx_file.write("#include <Utils/stdInclude.h>\n\n")
+
+def create_pack(files, compression):
+    entries = []
     for file in files:
-        if file.endswith(".h"):
-            cxx_file.write(f"#include \"{file}\"\n")
-    cxx_file.close()
-
-def bytes_to_c_arr(data):
-    return [format(b, '#04x') for b in data]
-
-
-def read_file(file_name):
-    data = np.fromfile(file_name, dtype='uint8')
-    data = bytearray(data)
-    return data
-
-
-def create_array(name, data, path):
-    size = str(len(data))
-    print(f'Working directory: {working_directory}, Path: {path}')
-    path = path.split(working_directory + '/')
-    print(f'Path: {path}')
-    path = path[1]
-    static_content = (f"\t\tconstexpr static const uint64_t size = {size};"
-                      f"\n\t\tconstexpr static const char path[] = \"{path}\";"
-                      f"\n\t\tconstexpr static const unsigned char data[") + size + "] = "
-    array_content = "{\n\t\t\t"
-    byte_array = bytes_to_c_arr(data)
-    for i in range(0, len(byte_array)):
-        if i == len(byte_array) - 1:
-            array_content += f"{byte_array[i]}" + '\n\t\t};\n'
-        else:
-            array_content += f"{byte_array[i]}, "
-        if (i + 1) % 18 == 0:
-            array_content += "\n\t\t\t"
+        path = relative_path(file).encode()
+        data = open(file, "rb").read()
 
+        method = COMPRESSION_NONE
+        packed = data
+        if compression == "zlib" and len(data) > 0:
+            compressed = zlib.compress(data, 9)
+            # Small or already compressed files are cheaper to serve as is.
+            if len(compressed) < len(data) * 0.9:
+                method = COMPRESSION_ZLIB
+                packed = compressed
 
-    #array_content = '\n' + array_content
-    final_content = static_content + array_content
-    return final_content
+        entries.append({"hash": fnv1a(path), "path": path, "size": len(data), "method": method, "packed": packed})
 
+    entries.sort(key=lambda entry: (entry["hash"], entry["path"]))
 
-def create_header(path, export_path):
-    #print(f"ResourceEmbedder.py : creating header for '{path}'")
-    if not os.path.exists(path):
-        print(f"Path does not exist: {path}")
-        return
-    if not os.path.isfile(path):
-        print(f"Path is not a file: {path}")
-        return
+    header_size = struct.calcsize(PACK_HEADER_FORMAT)
+    index_size = struct.calcsize(PACK_ENTRY_FORMAT) * len(entries)
 
-    # file = open(path, "rb")
-    # binary_data = file.read()
-    # file.close()
+    offset = header_size + index_size
+    for entry in entries:
+        entry["path_offset"] = offset
+        offset += len(entry["path"])
 
-    filename, file_extension = os.path.splitext(os.path.basename(path))
-    file_extension = file_extension[1:]
+    for entry in entries:
+        offset = align(offset)
+        entry["data_offset"] = offset
+        offset += len(entry["packed"])
 
-    header_name = f"{filename}{file_extension}"
-    class_name = header_name.replace("-", "_")
-    header_include_guard = "CODEGEN_" + header_name.upper() + "_H"
-    header_include_guard = header_include_guard.replace("-", "_")
+    pack = bytearray(offset)
+    struct.pack_into(PACK_HEADER_FORMAT, pack, 0, PACK_MAGIC, PACK_VERSION, len(entries), 0)
 
-    if not os.path.exists(f"{export_path}/EmbedResources"):
-        os.mkdir(f"{export_path}/EmbedResources")
+    for i, entry in enumerate(entries):
+        struct.pack_into(PACK_ENTRY_FORMAT, pack, header_size + i * struct.calcsize(PACK_ENTRY_FORMAT),
+                         entry["hash"], entry["path_offset"], len(entry["path"]),
+                         entry["data_offset"], len(entry["packed"]), entry["size"], entry["method"], 0)
+        pack[entry["path_offset"]:entry["path_offset"] + len(entry["path"])] = entry["path"]
+        pack[entry["data_offset"]:entry["data_offset"] + len(entry["packed"])] = entry["packed"]
 
-    headerfile = open(f"{export_path}/EmbedResources/{header_name}.h", "w")
+    total_size = sum(entry["size"] for entry in entries)
+    print(f"ResourceEmbedder.py : packed {len(entries)} resources, {total_size} -> {len(pack)} bytes.")
 
-    header_contents = ""
-    header_contents += "/// This file is created by ResourceEmbedder.py\n\n"
-    header_contents += f"#ifndef {header_include_guard}\n"
-    header_contents += f"#define {header_include_guard}\n\n"
-    header_contents += "#include <Utils/Resources/ResourceEmbedder.h>\n\n"
-    header_contents += "namespace ResourceEmbedder::Resources {\n"
-    header_contents += f"\tclass {class_name} " + " {\n"
-    header_contents += "\tpublic:\n"
-    header_contents += f"\t\t{class_name}() = delete;\n"
+    return bytes(pack)
 
-    header_contents += create_array(header_name, read_file(path), path)
 
-    header_contents += "\n\tprivate:\n"
-    header_contents += (f"\t\tSR_MAYBE_UNUSED SR_INLINE static bool codegenRegister = "
-                        f"SR_UTILS_NS::ResourceEmbedder::Instance().RegisterResource<{class_name}>();\n\n")
-    header_contents += "\t};\n}\n\n"
-    header_contents += f"#endif //{header_include_guard}\n"
+def create_array_inl(path, pack):
+    # MSVC has no .incbin, so the pack is embedded as a single byte array there.
+    with open(path, "w") as inl_file:
+        inl_file.write("/// This file is created by ResourceEmbedder.py\n\n")
+        inl_file.write(f"alignas({PACK_ALIGNMENT}) static const unsigned char SR_EMBED_RESOURCES_PACK[{max(len(pack), 1)}] = {{\n")
+        for i in range(0, len(pack), 32):
+            inl_file.write("\t" + ",".join(str(b) for b in pack[i:i + 32]) + ",\n")
+        inl_file.write("};\n")
 
-    headerfile.write(header_contents)
-    headerfile.close()
 
-    hash_path = f"{export_path}/EmbedResources/Hashes/{header_name}.hash"
-    if not os.path.exists(f"{export_path}/EmbedResources/Hashes"):
-        os.mkdir(f"{export_path}/EmbedResources/Hashes")
+def create_cxx(path, pack_path):
+    print(f"ResourceEmbedder.py : creating cxx at '{path}'.")
+
+    pack_path = os.path.abspath(pack_path).replace("\\", "/")
+
+    cxx_contents = ""
+    cxx_contents += "/// This file is created by ResourceEmbedder.py\n\n"
+    cxx_contents += "#include <Utils/Resources/ResourceEmbedder.h>\n\n"
+    cxx_contents += "#if defined(SR_LINUX) && !defined(SR_ANDROID)\n"
+    cxx_contents += "__asm__(\n"
+    cxx_contents += "\t\".section .rodata\\n\"\n"
+    cxx_contents += f"\t\".balign {PACK_ALIGNMENT}\\n\"\n"
+    cxx_contents += "\t\"SR_EMBED_RESOURCES_PACK:\\n\"\n"
+    cxx_contents += f"\t\".incbin \\\"{pack_path}\\\"\\n\"\n"
+    cxx_contents += "\t\"SR_EMBED_RESOURCES_PACK_END:\\n\"\n"
+    cxx_contents += "\t\".previous\\n\"\n"
+    cxx_contents += ");\n\n"
+    cxx_contents += "extern \"C\" const char SR_EMBED_RESOURCES_PACK[];\n"
+    cxx_contents += "extern \"C\" const char SR_EMBED_RESOURCES_PACK_END[];\n\n"
+    cxx_contents += "#define SR_EMBED_RESOURCES_PACK_SIZE static_cast<uint64_t>(SR_EMBED_RESOURCES_PACK_END - SR_EMBED_RESOURCES_PACK)\n"
+    cxx_contents += "#else\n"
+    cxx_contents += "\t#include \"EmbedResourcesPack.inl\"\n"
+    cxx_contents += f"\t#define SR_EMBED_RESOURCES_PACK_SIZE static_cast<uint64_t>({os.path.getsize(pack_path)})\n"
+    cxx_contents += "#endif\n\n"
+    cxx_contents += "namespace ResourceEmbedder::Resources {\n"
+    cxx_contents += ("\tSR_MAYBE_UNUSED SR_INLINE static bool codegenRegisterPack = SR_UTILS_NS::ResourceEmbedder::Instance().RegisterPack(\n"
+                     "\t\treinterpret_cast<const char*>(SR_EMBED_RESOURCES_PACK), SR_EMBED_RESOURCES_PACK_SIZE);\n")
+    cxx_contents += "}\n"
+
+    with open(f"{path}/EmbedResources.cxx", "w") as cxx_file:
+        cxx_file.write(cxx_contents)
 
-    hash_file = open(hash_path, "w")
-    hash_file.write(hashlib.md5(open(path, "rb").read()).hexdigest())
-    hash_file.close()
 
 parser = argparse.ArgumentParser(
                     prog='ResourceEmbedder',
-                    description='This program creates a header file with the binary content of a file')
-parser.add_argument('--export-directory', help='The path where the header file will be exported')
+                    description='This program packs resources into a single compressed blob embedded into the binary')
+parser.add_argument('--export-directory', help='The path where the pack will be exported')
 parser.add_argument('--working-directory', help='The working directory')
 parser.add_argument('--resources', help='The resources to embed')
+parser.add_argument('--compression', help='Compression of the pack entries: zlib or none', default='zlib')
 
 args = parser.parse_args()
 working_directory = args.working_directory
@@ -148,20 +186,23 @@ working_directory = args.working_directory
 if working_directory == "" and args.export_directory == "":
     exit(0)
 
-resources = filter(None, args.resources.split('|'))
-cxx_needs_update = False
-for resource_path in resources:
-    resource_path = resource_path.replace("\\", "/")
-    if os.path.isdir(resource_path):
-        for filename in os.listdir(resource_path):
-            file_path = os.path.join(resource_path, filename)
-            if os.path.isfile(file_path) and needs_update(file_path, args.export_directory):
-                create_header(file_path, args.export_directory)
-                cxx_needs_update = True
-    elif needs_update(resource_path, args.export_directory):
-        create_header(resource_path, args.export_directory)
-        cxx_needs_update = True
-
-if cxx_needs_update:
-    create_cxx(f"{args.export_directory}/EmbedResources")
+resource_files = collect_resources(filter(None, args.resources.split('|')))
+current_pack_hash = calculate_pack_hash(resource_files, args.compression)
+
+if needs_update(args.export_directory, current_pack_hash):
+    embed_directory = f"{args.export_directory}/EmbedResources"
+    if not os.path.exists(f"{embed_directory}/Hashes"):
+        os.makedirs(f"{embed_directory}/Hashes")
+
+    pack_data = create_pack(resource_files, args.compression)
+    pack_file_path = f"{embed_directory}/EmbedResources.pack"
+    with open(pack_file_path, "wb") as pack_file:
+        pack_file.write(pack_data)
+
+    create_array_inl(f"{embed_directory}/EmbedResourcesPack.inl", pack_data)
+    create_cxx(embed_directory, pack_file_path)
+
+    with open(f"{embed_directory}/Hashes/EmbedResources.hash", "w") as hash_file:
+        hash_file.write(current_pack_hash)
+
 exit(0)
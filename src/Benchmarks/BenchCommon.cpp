@@ -0,0 +1,758 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include "Benchmark.h"
+
+#include <Utils/Common/HashManager.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/Common/StringTokenizer.h>
+#include <Utils/CommandManager/CmdManager.h>
+#include <Utils/CommandManager/ReversibleCommand.h>
+#include <Utils/Input/KeyCodes.h>
+#include <Utils/Localization/LocalizationTable.h>
+#include <Utils/Localization/Transcode.h>
+#include <Utils/Platform/Platform.h>
+#include <Utils/Platform/Stacktrace.h>
+#include <Utils/Profile/Metrics.h>
+#include <Utils/Profile/MemoryTracker.h>
+#include <Utils/Resources/Xml.h>
+#include <Utils/Types/Regex.h>
+#include <Utils/Types/SharedPtr.h>
+#include <Utils/Types/StringAtom.h>
+#include <Utils/Types/Thread.h>
+#include <Utils/Web/CSS/CSS.h>
+#include <Utils/Web/CSS/CSSParser.h>
+
+#include <random>
+#include <regex>
+#include <fstream>
+
+namespace SR_UTILS_NS::Benchmarks {
+    namespace {
+        class BenchmarkSharedObject : public SR_HTYPES_NS::SharedPtr<BenchmarkSharedObject> {
+        public:
+            BenchmarkSharedObject()
+                : SR_HTYPES_NS::SharedPtr<BenchmarkSharedObject>(this, SR_UTILS_NS::SharedPtrPolicy::Automatic)
+            { }
+
+            virtual ~BenchmarkSharedObject() = default;
+
+        public:
+            uint64_t value = 0;
+
+        };
+
+        class BenchmarkSharedObjectInherit : public BenchmarkSharedObject { };
+
+        /// правка одного значения, соседние правки того же индекса сливаются, как перетаскивание в редакторе
+        class BenchmarkEditCommand final : public ReversibleCommand {
+        public:
+            BenchmarkEditCommand(std::vector<int64_t>& values, uint32_t index, int64_t value)
+                : m_values(values)
+                , m_index(index)
+                , m_before(values[index])
+                , m_after(value)
+            { }
+
+        public:
+            bool Redo() override { m_values[m_index] = m_after; return true; }
+            bool Undo() override { m_values[m_index] = m_before; return true; }
+            std::string GetName() override { return "BenchmarkEdit"; }
+
+            SR_NODISCARD uint64_t GetMemorySize() const override { return sizeof(BenchmarkEditCommand); }
+
+            bool Merge(ReversibleCommand* pNext) override {
+                auto&& pEdit = dynamic_cast<BenchmarkEditCommand*>(pNext);
+                if (!pEdit || pEdit->m_index != m_index) {
+                    return false;
+                }
+                m_after = pEdit->m_after;
+                return true;
+            }
+
+        private:
+            std::vector<int64_t>& m_values;
+            uint32_t m_index;
+            int64_t m_before;
+            int64_t m_after;
+
+        };
+
+        std::string MakeRandomWord(std::mt19937_64& random, uint32_t minSize, uint32_t maxSize) {
+            std::uniform_int_distribution<uint32_t> size(minSize, maxSize);
+            std::uniform_int_distribution<uint32_t> letter(0, 25);
+
+            std::string word(size(random), 'a');
+            for (auto&& symbol : word) {
+                symbol = static_cast<char>('a' + letter(random));
+            }
+
+            return word;
+        }
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkHashManager, "common.hash_manager") {
+        std::mt19937_64 random(1);
+
+        const uint64_t count = context.Scaled(10'000);
+
+        std::vector<std::string> existing;
+        existing.reserve(count);
+        for (uint64_t i = 0; i < count; ++i) {
+            existing.emplace_back(SR_FORMAT("bench/existing/{}_{}", MakeRandomWord(random, 4, 16), i));
+            SR_HASH_STR_REGISTER(existing.back());
+        }
+
+        uint64_t index = 0;
+        context.Run("add_hash_existing", [&]() {
+            DoNotOptimize(SR_HASH_STR_REGISTER(existing[index++ % count]));
+        });
+
+        context.Run("string_atom_existing", [&]() {
+            DoNotOptimize(StringAtom(existing[index++ % count]));
+        });
+
+        const uint64_t hash = SR_HASH_STR(existing.front());
+        context.Run("hash_to_string", [&]() {
+            DoNotOptimize(SR_HASH_TO_STR(hash));
+        });
+
+        context.Run("hash_str", [&]() {
+            DoNotOptimize(SR_HASH_STR(existing[index++ % count]));
+        });
+
+        /// каждая строка новая, таблица растет на count строк за замер
+        std::vector<std::string> fresh;
+        uint64_t freshIndex = 0;
+        context.RunWithSetup("add_hash_new", 5, [&]() {
+            fresh.clear();
+            for (uint64_t i = 0; i < count; ++i) {
+                fresh.emplace_back(SR_FORMAT("bench/fresh/{}_{}", MakeRandomWord(random, 4, 16), freshIndex++));
+            }
+        }, [&]() {
+            for (auto&& string : fresh) {
+                DoNotOptimize(SR_HASH_STR_REGISTER(string));
+            }
+        }).SetItemsPerOp(count).AddCounter("table_size", static_cast<double_t>(HashManager::Instance().GetCount()));
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkSharedPtr, "common.shared_ptr") {
+        SR_HTYPES_NS::SharedPtr<BenchmarkSharedObject> pObject = BenchmarkSharedObject::MakeShared();
+
+        context.Run("copy_destroy", [&]() {
+            SR_HTYPES_NS::SharedPtr<BenchmarkSharedObject> pCopy = pObject;
+            DoNotOptimize(pCopy);
+        });
+
+        context.Run("move", [&]() {
+            SR_HTYPES_NS::SharedPtr<BenchmarkSharedObject> pCopy = pObject;
+            SR_HTYPES_NS::SharedPtr<BenchmarkSharedObject> pMoved = std::move(pCopy);
+            DoNotOptimize(pMoved);
+        });
+
+        context.Run("make_shared_intrusive", [&]() {
+            SR_HTYPES_NS::SharedPtr<BenchmarkSharedObject> pNew = BenchmarkSharedObject::MakeShared();
+            DoNotOptimize(pNew);
+        });
+
+        context.Run("make_shared_external", [&]() {
+            SR_HTYPES_NS::SharedPtr<uint64_t> pNew = new uint64_t(1);
+            DoNotOptimize(pNew);
+        });
+
+        SR_HTYPES_NS::SharedPtr<BenchmarkSharedObject> pInherit = new BenchmarkSharedObjectInherit();
+        context.Run("dynamic_cast", [&]() {
+            DoNotOptimize(pInherit.DynamicCast<BenchmarkSharedObjectInherit>());
+        });
+
+        context.Run("deref_valid", [&]() {
+            if (pObject) {
+                ++pObject->value;
+            }
+            DoNotOptimize(pObject->value);
+        });
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkEnumReflector, "common.enum_reflector") {
+        context.Run("to_string_small", [&]() {
+            DoNotOptimize(EnumReflector::ToStringAtom(BoolExt::True));
+        });
+
+        context.Run("to_string_large", [&]() {
+            DoNotOptimize(EnumReflector::ToStringAtom(KeyCode::F12));
+        });
+
+        const StringAtom smallName = "True";
+        context.Run("from_string_small", [&]() {
+            DoNotOptimize(EnumReflector::FromString<BoolExt>(smallName));
+        });
+
+        /// последний элемент, худший случай для линейного поиска
+        const StringAtom largeName = "Tilde";
+        context.Run("from_string_large", [&]() {
+            DoNotOptimize(EnumReflector::FromString<KeyCode>(largeName));
+        });
+
+        context.Run("count_large", [&]() {
+            DoNotOptimize(EnumReflector::Count<KeyCode>());
+        });
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkRegex, "common.regex") {
+        std::mt19937_64 random(2);
+
+        std::vector<std::string> lines;
+        for (uint32_t i = 0; i < 1024; ++i) {
+            lines.emplace_back(SR_FORMAT("[{}] load textures/{}_{}.png from {}", i, MakeRandomWord(random, 3, 12), i, MakeRandomWord(random, 8, 40)));
+        }
+
+        const std::string pattern = "([a-z]+)_([0-9]+)\\.png";
+
+        SR_HTYPES_NS::Regex regex(pattern);
+        std::regex stdRegex(pattern);
+
+        uint64_t index = 0;
+        context.Run("search", [&]() {
+            DoNotOptimize(regex.Search(lines[index++ % lines.size()]));
+        });
+
+        context.Run("search_std", [&]() {
+            std::smatch match;
+            DoNotOptimize(std::regex_search(lines[index++ % lines.size()], match, stdRegex));
+        });
+
+        SR_HTYPES_NS::Regex fullRegex("textures/[a-z]+_[0-9]+\\.png");
+        std::regex stdFullRegex("textures/[a-z]+_[0-9]+\\.png");
+        const std::string path = "textures/grass_42.png";
+
+        context.Run("match", [&]() {
+            DoNotOptimize(fullRegex.Match(path));
+        });
+
+        context.Run("match_std", [&]() {
+            DoNotOptimize(std::regex_match(path, stdFullRegex));
+        });
+
+        context.Run("compile", [&]() {
+            SR_HTYPES_NS::Regex compiled(pattern);
+            DoNotOptimize(compiled.IsCompiled());
+        });
+
+        /// вход без совпадения: перебор с возвратом растет экспоненциально от длины, автомат - линейно
+        SR_HTYPES_NS::Regex backtrackingRegex("(a|aa)*c");
+        std::regex stdBacktrackingRegex("(a|aa)*c");
+        const std::string backtrackingInput(20, 'a');
+
+        context.Run("search_backtracking", [&]() {
+            DoNotOptimize(backtrackingRegex.Search(backtrackingInput));
+        }).AddCounter("input_size", static_cast<double_t>(backtrackingInput.size()));
+
+        context.Run("search_backtracking_std", [&]() {
+            std::smatch match;
+            DoNotOptimize(std::regex_search(backtrackingInput, match, stdBacktrackingRegex));
+        }).AddCounter("input_size", static_cast<double_t>(backtrackingInput.size()));
+
+        /// то же, но обязательный символ во входе есть: литеральный фильтр не срабатывает, работает сам автомат
+        SR_HTYPES_NS::Regex tailRegex("(a|aa)*b");
+        std::regex stdTailRegex("(a|aa)*b");
+        const std::string tailInput = std::string(20, 'a') + "cb";
+
+        context.Run("search_backtracking_tail", [&]() {
+            DoNotOptimize(tailRegex.Search(tailInput));
+        }).AddCounter("input_size", static_cast<double_t>(tailInput.size()));
+
+        context.Run("search_backtracking_tail_std", [&]() {
+            std::smatch match;
+            DoNotOptimize(std::regex_search(tailInput, match, stdTailRegex));
+        }).AddCounter("input_size", static_cast<double_t>(tailInput.size()));
+
+        /// строки без ".png" отбрасываются поиском подстроки до запуска автомата
+        std::vector<std::string> missLines = lines;
+        for (auto&& line : missLines) {
+            line.replace(line.find(".png"), 4, ".jpg");
+        }
+
+        context.Run("search_miss", [&]() {
+            DoNotOptimize(regex.Search(missLines[index++ % missLines.size()]));
+        });
+
+        context.Run("search_miss_std", [&]() {
+            std::smatch match;
+            DoNotOptimize(std::regex_search(missLines[index++ % missLines.size()], match, stdRegex));
+        });
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkTokenizer, "common.tokenizer") {
+        std::mt19937_64 random(3);
+        std::uniform_real_distribution<float_t> coordinate(-100.f, 100.f);
+
+        const uint64_t linesCount = context.Scaled(10'000);
+
+        std::string csv;
+        for (uint64_t i = 0; i < linesCount; ++i) {
+            csv += SR_FORMAT("{},{},{:.3f},{},,{}\n", i, MakeRandomWord(random, 3, 10), coordinate(random), MakeRandomWord(random, 1, 6), i * 7);
+        }
+
+        std::string obj;
+        for (uint64_t i = 0; i < linesCount; ++i) {
+            obj += SR_FORMAT("v {:.6f} {:.6f} {:.6f}\n", coordinate(random), coordinate(random), coordinate(random));
+        }
+        for (uint64_t i = 0; i + 2 < linesCount; i += 3) {
+            obj += SR_FORMAT("f {}/{}/{} {}/{}/{} {}/{}/{}\n", i + 1, i + 1, i + 1, i + 2, i + 2, i + 2, i + 3, i + 3, i + 3);
+        }
+
+        uint64_t tokens = 0;
+
+        context.Run("csv", [&]() {
+            tokens = 0;
+            for (auto&& line : StringTokenizer(csv, '\n')) {
+                /// пустые поля в CSV значимы
+                for (auto&& field : StringTokenizer(line, ',', false)) {
+                    DoNotOptimize(field);
+                    ++tokens;
+                }
+            }
+        }).SetBytesPerOp(csv.size()).SetItemsPerOp(tokens);
+
+        context.Run("obj", [&]() {
+            tokens = 0;
+            for (auto&& line : StringTokenizer(obj, '\n')) {
+                for (auto&& token : StringTokenizer(line, ' ')) {
+                    DoNotOptimize(token);
+                    ++tokens;
+                }
+            }
+        }).SetBytesPerOp(obj.size()).SetItemsPerOp(tokens);
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkPathMetadata, "common.path_metadata") {
+        auto&& directory = context.GetTempDirectory();
+
+        std::vector<Path> files;
+        for (uint32_t i = 0; i < 256; ++i) {
+            auto&& path = directory.Concat(SR_FORMAT("file_{}.xml", i));
+            std::ofstream(path.ToStringRef()) << SR_FORMAT("<Settings><Value id=\"{}\"/></Settings>", i);
+            files.emplace_back(path);
+        }
+
+        const Path missing = directory.Concat("missing.txt");
+
+        auto&& measure = [&](std::string_view name, auto&& function) {
+            uint64_t operations = 0;
+
+            const auto before = Path::GetMetadataStats();
+            auto&& result = context.Run(name, [&]() {
+                function();
+                ++operations;
+            });
+            const auto after = Path::GetMetadataStats();
+
+            const auto queries = static_cast<double_t>(after.queries - before.queries);
+            const auto syscalls = static_cast<double_t>(after.syscalls - before.syscalls);
+
+            result.AddCounter("syscalls_per_query", queries > 0.0 ? syscalls / queries : 0.0);
+            result.AddCounter("syscalls_per_op", operations > 0 ? syscalls / static_cast<double_t>(operations) : 0.0);
+        };
+
+        /// запросы метаданных при загрузке файлового ресурса: IsFile в ResourceManager::StartWatch,
+        /// хеш в FileWatcher::Init, чтение документа в Settings::Load и Exists с хешем в IResource::GetFileHash
+        auto&& loadResource = [](const Path& path) {
+            DoNotOptimize(path.IsFile());
+            DoNotOptimize(path.GetFileHash());
+            DoNotOptimize(SR_XML_NS::Document::Load(path).Valid());
+            DoNotOptimize(path.Exists(Path::Type::File) ? path.GetFileHash() : 0);
+        };
+
+        uint64_t index = 0;
+
+        /// по умолчанию кеш выключен
+        Path::SetMetadataLifetime(0);
+
+        measure("is_file_uncached", [&]() {
+            DoNotOptimize(files[index++ % files.size()].IsFile());
+        });
+
+        measure("resource_load_uncached", [&]() {
+            loadResource(files[index++ % files.size()]);
+        });
+
+        Path::SetMetadataLifetime(500);
+
+        measure("is_file_cached", [&]() {
+            DoNotOptimize(files[index++ % files.size()].IsFile());
+        });
+
+        measure("exists_missing_cached", [&]() {
+            DoNotOptimize(missing.Exists());
+        });
+
+        measure("resource_load_cached", [&]() {
+            loadResource(files[index++ % files.size()]);
+        });
+
+        Path::SetMetadataLifetime(0);
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkCSS, "web.css") {
+        if (!context.IsAnyEnabled({ "compute_style_10k", "compute_style_10k_cold", "match_rules_10k", "match_linear_10k", "parse" })) {
+            return;
+        }
+
+        std::mt19937_64 random(4);
+
+        constexpr std::array tags = { "div", "span", "p", "a", "img", "ul", "li", "button", "input", "section" };
+        constexpr uint32_t CLASSES_COUNT = 200;
+        constexpr uint32_t IDS_COUNT = 100;
+
+        std::uniform_int_distribution<uint32_t> tagDistribution(0, tags.size() - 1);
+        std::uniform_int_distribution<uint32_t> classDistribution(0, CLASSES_COUNT - 1);
+        std::uniform_int_distribution<uint32_t> idDistribution(0, IDS_COUNT * 10 - 1);
+        std::uniform_int_distribution<uint32_t> classCountDistribution(0, 3);
+
+        /// селектор и свойства каждого правила, из них собирается и текст для парсера, и таблица стилей напрямую
+        std::vector<std::pair<std::string, std::vector<std::pair<std::string, std::string>>>> rules;
+        for (auto&& tag : tags) {
+            rules.push_back({ tag, { { "margin", "2px" }, { "padding", "1px" } } });
+        }
+        for (uint32_t i = 0; i < CLASSES_COUNT; ++i) {
+            rules.push_back({ SR_FORMAT(".c{}", i), {
+                { "width", SR_FORMAT("{}px", i + 10) }, { "height", SR_FORMAT("{}%", i % 100) }, { "color", SR_FORMAT("#{:06x}", i * 4099 % 0xFFFFFF) }
+            } });
+            rules.push_back({ SR_FORMAT("{}.c{}", tags[i % tags.size()], i), { { "padding", SR_FORMAT("{}px", i % 16) } } });
+        }
+        for (uint32_t i = 0; i < IDS_COUNT; ++i) {
+            rules.push_back({ SR_FORMAT("#id{}", i), { { "margin", SR_FORMAT("{}px", i % 32) } } });
+        }
+
+        std::string stylesheet;
+        for (auto&& [selector, properties] : rules) {
+            stylesheet += selector + " { ";
+            for (auto&& [name, value] : properties) {
+                stylesheet += SR_FORMAT("{}: {}; ", name, value);
+            }
+            stylesheet += "}\n";
+        }
+
+        /// без внешнего парсера, как его заполняет CSSParser
+        auto&& buildStyle = [&]() {
+            auto&& pCSS = Web::CSS::MakeShared();
+            for (auto&& [selector, properties] : rules) {
+                auto&& pRuleStyle = pCSS->GetOrCreateStyle(selector);
+                for (auto&& [name, value] : properties) {
+                    pRuleStyle->ParseProperty(name, value);
+                }
+            }
+            return pCSS;
+        };
+
+        const uint64_t elementsCount = context.Scaled(10'000);
+
+        std::vector<Web::CSSElement> elements;
+        elements.reserve(elementsCount);
+        for (uint64_t i = 0; i < elementsCount; ++i) {
+            std::string classList;
+            for (uint32_t j = classCountDistribution(random); j > 0; --j) {
+                classList += SR_FORMAT("c{} ", classDistribution(random));
+            }
+
+            /// большая часть элементов без id, как в обычной разметке
+            const uint32_t id = idDistribution(random);
+            elements.emplace_back(tags[tagDistribution(random)], id < IDS_COUNT ? SR_FORMAT("id{}", id) : std::string(), classList);
+        }
+
+        auto&& pStyle = buildStyle();
+
+        /// первый проход заполняет кеш стилей по сигнатурам
+        Web::CSS::Ptr pColdStyle;
+        context.RunWithSetup("compute_style_10k_cold", 10, [&]() {
+            pColdStyle = buildStyle();
+        }, [&]() {
+            for (auto&& element : elements) {
+                DoNotOptimize(pColdStyle->ComputeStyle(element));
+            }
+        }).SetItemsPerOp(elementsCount);
+
+        context.Run("compute_style_10k", [&]() {
+            for (auto&& element : elements) {
+                DoNotOptimize(pStyle->ComputeStyle(element));
+            }
+        }).SetItemsPerOp(elementsCount);
+
+        /// без кеша: только корзины элемента против перебора всех правил
+        std::vector<const Web::CSSRule*> matched;
+        context.Run("match_rules_10k", [&]() {
+            for (auto&& element : elements) {
+                pStyle->MatchRules(element, matched);
+                DoNotOptimize(matched.size());
+            }
+        }).SetItemsPerOp(elementsCount);
+
+        context.Run("match_linear_10k", [&]() {
+            for (auto&& element : elements) {
+                matched.clear();
+                for (auto&& rule : pStyle->GetRules()) {
+                    if (rule.selector.Matches(element)) {
+                        matched.emplace_back(&rule);
+                    }
+                }
+                std::ranges::sort(matched, [](const Web::CSSRule* pLeft, const Web::CSSRule* pRight) {
+                    return std::tie(pLeft->selector.specificity, pLeft->order) < std::tie(pRight->selector.specificity, pRight->order);
+                });
+                DoNotOptimize(matched.size());
+            }
+        }).SetItemsPerOp(elementsCount);
+
+        context.Run("parse", [&]() {
+            DoNotOptimize(Web::CSSParser::Instance().Parse(stylesheet));
+        }).SetBytesPerOp(stylesheet.size());
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkLocalization, "localization") {
+        std::mt19937_64 random(5);
+
+        const uint64_t count = context.Scaled(10'000);
+
+        Localization::LocalizationTable::Entries entries;
+        std::vector<std::string> keys;
+        for (uint64_t i = 0; i < count; ++i) {
+            keys.emplace_back(SR_FORMAT("ui.{}.{}_{}", MakeRandomWord(random, 3, 8), MakeRandomWord(random, 4, 12), i));
+            entries.emplace_back(keys.back(), SR_FORMAT("Значение {} — {}", i, MakeRandomWord(random, 10, 60)));
+        }
+
+        context.Run("compile_table", [&]() {
+            DoNotOptimize(Localization::LocalizationTable::Compile(entries));
+        }).SetItemsPerOp(count);
+
+        /// таблица читается без копирования и разбора строк, поэтому размер - счетчик, а не пропускная способность
+        const std::string compiled = Localization::LocalizationTable::Compile(entries);
+
+        context.Run("load_from_memory", [&]() {
+            Localization::LocalizationTable table;
+            DoNotOptimize(table.LoadFromMemory(compiled.data(), compiled.size()));
+        }).AddCounter("table_bytes", static_cast<double_t>(compiled.size()));
+
+        auto&& tablePath = context.GetTempDirectory().Concat("strings.srlt");
+        std::ofstream(tablePath.ToStringRef(), std::ios::binary).write(compiled.data(), static_cast<std::streamsize>(compiled.size()));
+
+        context.Run("load_file", [&]() {
+            Localization::LocalizationTable table;
+            DoNotOptimize(table.Load(tablePath));
+        }).AddCounter("table_bytes", static_cast<double_t>(compiled.size()));
+
+        Localization::LocalizationTable table;
+        if (!table.LoadFromMemory(compiled.data(), compiled.size())) {
+            SR_ERROR("BenchmarkLocalization() : failed to load the compiled table!");
+            return;
+        }
+
+        uint64_t index = 0;
+        context.Run("find_hit", [&]() {
+            DoNotOptimize(table.Find(keys[index++ % count]));
+        });
+
+        const std::string missing = "ui.missing.key";
+        context.Run("find_miss", [&]() {
+            DoNotOptimize(table.Find(missing));
+        });
+
+        /// смесь ASCII, кириллицы, CJK и эмодзи
+        std::string utf8;
+        while (utf8.size() < 1024 * 1024) {
+            utf8 += "The quick brown fox jumps over the lazy dog. Съешь же ещё этих мягких французских булок. 速い茶色の狐 🦊\n";
+        }
+
+        std::vector<char16_t> utf16(Localization::GetMaxTranscodedLength<char16_t, char>(utf8.size()));
+        const auto utf16Result = Localization::Utf8ToUtf16(utf8.data(), utf8.size(), utf16.data(), utf16.size());
+        std::vector<char> utf8Back(Localization::GetMaxTranscodedLength<char, char16_t>(utf16Result.written));
+
+        context.Run("validate_utf8", [&]() {
+            DoNotOptimize(Localization::ValidateUtf8(utf8.data(), utf8.size()));
+        }).SetBytesPerOp(utf8.size());
+
+        context.Run("utf8_to_utf16", [&]() {
+            DoNotOptimize(Localization::Utf8ToUtf16(utf8.data(), utf8.size(), utf16.data(), utf16.size()));
+        }).SetBytesPerOp(utf8.size());
+
+        context.Run("utf16_to_utf8", [&]() {
+            DoNotOptimize(Localization::Utf16ToUtf8(utf16.data(), utf16Result.written, utf8Back.data(), utf8Back.size()));
+        }).SetBytesPerOp(utf16Result.written * sizeof(char16_t));
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkProfile, "profile") {
+        auto&& counter = Metrics::Instance().GetCounter("benchmarks.counter");
+        auto&& gauge = Metrics::Instance().GetGauge("benchmarks.gauge");
+        auto&& histogram = Metrics::Instance().GetHistogram("benchmarks.histogram");
+
+        context.Run("metric_counter_add", [&]() {
+            counter.Add(1);
+        });
+
+        int64_t value = 0;
+        context.Run("metric_gauge_set", [&]() {
+            gauge.Set(++value);
+        });
+
+        uint64_t sample = 1;
+        context.Run("metric_histogram_record", [&]() {
+            sample = sample * 6364136223846793005ULL + 1442695040888963407ULL;
+            histogram.Record(sample >> 40U);
+        });
+
+        context.Run("metric_macro_counter", [&]() {
+            SR_METRIC_COUNTER_ADD("benchmarks.macro_counter", 1);
+        });
+
+        context.Run("metric_scoped_timer", [&]() {
+            SR_METRIC_SCOPED_TIMER("benchmarks.scoped_timer");
+        });
+
+        context.Run("metrics_snapshot", [&]() {
+            DoNotOptimize(Metrics::Instance().Snapshot());
+        }).AddCounter("metrics", static_cast<double_t>(Metrics::Instance().Snapshot().size()));
+
+        /// разница с operator new/delete - цена учета по тегам
+        context.Run("memory_tracker_alloc_free_64", [&]() {
+            void* pMemory = MemoryTracker::Allocate(64, MemoryTag::Common);
+            DoNotOptimize(pMemory);
+            MemoryTracker::Free(pMemory, 64, MemoryTag::Common);
+        });
+
+        context.Run("operator_new_delete_64", [&]() {
+            void* pMemory = ::operator new(64);
+            DoNotOptimize(pMemory);
+            ::operator delete(pMemory, static_cast<size_t>(64));
+        });
+
+        context.Run("memory_tracker_dump", [&]() {
+            DoNotOptimize(MemoryTracker::Dump());
+        });
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkStacktrace, "platform.stacktrace") {
+        context.Run("capture_id", [&]() {
+            DoNotOptimize(CaptureStacktraceId());
+        }).AddCounter("unique_stacks", static_cast<double_t>(GetUniqueStacktraceCount()));
+
+        void* frames[SR_STACKTRACE_MAX_FRAMES];
+        context.Run("capture_frames", [&]() {
+            DoNotOptimize(CaptureStacktrace(frames, SR_STACKTRACE_MAX_FRAMES));
+        });
+
+        const StacktraceId id = CaptureStacktraceId();
+        context.Run("resolve_cached", [&]() {
+            DoNotOptimize(ResolveStacktrace(id));
+        });
+
+        /// захват с символизацией, как в ассертах
+        context.RunWithSetup("get_stacktrace", 20, []() { }, [&]() {
+            DoNotOptimize(GetStacktrace());
+        });
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkThreads, "platform.threads") {
+        context.Run("this_thread", [&]() {
+            DoNotOptimize(SR_THIS_THREAD);
+        });
+
+        context.Run("this_thread_name", [&]() {
+            DoNotOptimize(GetThisThreadName());
+        });
+
+        context.Run("native_id", [&]() {
+            DoNotOptimize(SR_PLATFORM_NS::GetCurrentThreadNativeId());
+        });
+
+        const uint64_t nativeId = SR_PLATFORM_NS::GetCurrentThreadNativeId();
+
+        context.Run("get_priority", [&]() {
+            DoNotOptimize(SR_PLATFORM_NS::GetThreadPriority(nativeId));
+        });
+
+        context.Run("set_priority", [&]() {
+            DoNotOptimize(SR_PLATFORM_NS::SetThreadPriority(nativeId, ThreadPriority::SR_THREAD_PRIORITY_NORMAL));
+        });
+
+        const std::vector<uint32_t> affinity = SR_PLATFORM_NS::GetThreadAffinity(nativeId);
+
+        context.Run("get_affinity", [&]() {
+            DoNotOptimize(SR_PLATFORM_NS::GetThreadAffinity(nativeId));
+        });
+
+        context.Run("set_affinity", [&]() {
+            DoNotOptimize(SR_PLATFORM_NS::SetThreadAffinity(nativeId, affinity));
+        });
+
+        const std::string name = SR_PLATFORM_NS::GetThreadName(nativeId);
+
+        context.Run("get_name", [&]() {
+            DoNotOptimize(SR_PLATFORM_NS::GetThreadName(nativeId));
+        });
+
+        context.Run("set_name", [&]() {
+            DoNotOptimize(SR_PLATFORM_NS::SetThreadName(nativeId, name));
+        });
+
+        auto&& topology = SR_PLATFORM_NS::GetCPUTopology();
+        context.Run("cpu_topology_cached", [&]() {
+            DoNotOptimize(SR_PLATFORM_NS::GetCPUTopology());
+        }).AddCounter("cpus", static_cast<double_t>(topology.cpus.size()))
+          .AddCounter("cores", static_cast<double_t>(topology.coreCount))
+          .AddCounter("cache_groups", static_cast<double_t>(topology.cacheGroupCount));
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkCmdManager, "common.cmd_manager") {
+        const uint64_t editsCount = context.Scaled(100'000);
+
+        std::vector<int64_t> values(1024, 0);
+        std::mt19937_64 random(6);
+        std::uniform_int_distribution<uint32_t> indexDistribution(0, static_cast<uint32_t>(values.size()) - 1);
+
+        std::vector<uint32_t> indices(editsCount);
+        for (auto&& index : indices) {
+            index = indexDistribution(random);
+        }
+
+        std::unique_ptr<CmdManager> pManager;
+
+        auto&& setup = [&]() {
+            pManager = std::make_unique<CmdManager>();
+            pManager->SetMaxHistorySize(static_cast<uint32_t>(editsCount));
+            std::fill(values.begin(), values.end(), 0);
+        };
+
+        auto&& execute = [&]() {
+            for (uint64_t i = 0; i < editsCount; ++i) {
+                pManager->Execute(new BenchmarkEditCommand(values, indices[i], static_cast<int64_t>(i)), SyncType::Sync);
+            }
+        };
+
+        context.RunWithSetup("execute_100k", 5, setup, execute)
+            .SetItemsPerOp(editsCount)
+            .AddCounter("history_size", static_cast<double_t>(pManager ? pManager->GetHistorySize() : 0))
+            .AddCounter("history_bytes", static_cast<double_t>(pManager ? pManager->GetHistoryMemory() : 0));
+
+        /// Cancel и Redo только ставят команду в очередь, выполняет их Update
+        uint32_t historySize = 0;
+        context.RunWithSetup("undo_redo_100k", 5, [&]() { setup(); execute(); historySize = pManager->GetHistorySize(); }, [&]() {
+            for (uint32_t i = 0; i < historySize; ++i) {
+                pManager->Cancel();
+            }
+            pManager->Update();
+
+            for (uint32_t i = 0; i < historySize; ++i) {
+                pManager->Redo();
+            }
+            pManager->Update();
+        }).SetItemsPerOp(static_cast<uint64_t>(historySize) * 2);
+
+        /// правки одного значения подряд сливаются в одну запись истории
+        context.RunWithSetup("execute_merged_100k", 5, setup, [&]() {
+            for (uint64_t i = 0; i < editsCount; ++i) {
+                pManager->Execute(new BenchmarkEditCommand(values, 0, static_cast<int64_t>(i)), SyncType::Sync);
+            }
+        }).SetItemsPerOp(editsCount).AddCounter("history_size", static_cast<double_t>(pManager ? pManager->GetHistorySize() : 0));
+
+        pManager.reset();
+    }
+}
@@ -0,0 +1,603 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include "Benchmark.h"
+
+#include <Utils/ECS/Migration.h>
+#include <Utils/Resources/IResource.h>
+#include <Utils/Resources/ResourceEmbedder.h>
+#include <Utils/Resources/ResourceManager.h>
+#include <Utils/Resources/Xml.h>
+#include <Utils/Resources/Yaml.h>
+#include <Utils/Serialization/SRASerialization.h>
+#include <Utils/Types/Marshal.h>
+
+#ifdef SR_UTILS_ASSIMP
+    #include <Utils/FileSystem/AssimpCache.h>
+
+    #include <assimp/scene.h>
+    #include <assimp/postprocess.h>
+    #include <assimp/Importer.hpp>
+
+    #ifdef SR_LINUX
+        #include <fcntl.h>
+        #include <unistd.h>
+    #endif
+#endif
+
+#ifdef SR_COMMON_ZLIB
+    #include <zlib/zlib.h>
+#endif
+
+#include <random>
+#include <fstream>
+
+namespace SR_UTILS_NS::Benchmarks {
+    namespace {
+        class BenchmarkResource final : public IResource {
+        public:
+            BenchmarkResource()
+                : IResource(SR_COMPILE_TIME_CRC32_TYPE_NAME(BenchmarkResource))
+            { }
+
+        public:
+            SR_NODISCARD bool IsFileResource() const noexcept override { return false; }
+
+        };
+
+        bool WriteBenchmarkFile(const Path& path, std::string_view data) {
+            std::ofstream file(path.ToStringRef(), std::ios::binary | std::ios::trunc);
+            file.write(data.data(), static_cast<std::streamsize>(data.size()));
+            return file.good();
+        }
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkMarshal, "serialization.marshal") {
+        const uint64_t count = context.Scaled(10'000);
+
+        std::vector<std::string> names;
+        for (uint64_t i = 0; i < count; ++i) {
+            names.emplace_back(SR_FORMAT("component_{}", i));
+        }
+
+        /// запись компонента: имя, версия, трансформ и флаги, как в сериализации сцены
+        auto&& writeComponents = [&](SR_HTYPES_NS::Marshal& marshal) {
+            for (uint64_t i = 0; i < count; ++i) {
+                marshal.Write<std::string>(names[i]);
+                marshal.Write<uint16_t>(1000);
+                marshal.Write<float_t>(static_cast<float_t>(i));
+                marshal.Write<float_t>(static_cast<float_t>(i) * 0.5f);
+                marshal.Write<float_t>(static_cast<float_t>(i) * 0.25f);
+                marshal.Write<uint64_t>(i);
+                marshal.Write<bool>(i % 2 == 0);
+            }
+        };
+
+        SR_HTYPES_NS::Marshal source;
+        writeComponents(source);
+        const uint64_t bytes = source.Size();
+
+        context.Run("write_components", [&]() {
+            SR_HTYPES_NS::Marshal marshal;
+            writeComponents(marshal);
+            DoNotOptimize(marshal.Size());
+        }).SetItemsPerOp(count).SetBytesPerOp(bytes);
+
+        context.Run("read_components", [&]() {
+            source.SetPosition(0);
+            for (uint64_t i = 0; i < count; ++i) {
+                DoNotOptimize(source.Read<std::string>());
+                DoNotOptimize(source.Read<uint16_t>());
+                DoNotOptimize(source.Read<float_t>());
+                DoNotOptimize(source.Read<float_t>());
+                DoNotOptimize(source.Read<float_t>());
+                DoNotOptimize(source.Read<uint64_t>());
+                DoNotOptimize(source.Read<bool>());
+            }
+        }).SetItemsPerOp(count).SetBytesPerOp(bytes);
+
+        context.Run("copy", [&]() {
+            DoNotOptimize(source.Copy());
+        }).SetBytesPerOp(bytes);
+
+        std::vector<char> block(64 * 1024, 'x');
+        context.Run("write_block_64k", [&]() {
+            SR_HTYPES_NS::Marshal marshal;
+            marshal.WriteBlock(block.data(), block.size());
+            DoNotOptimize(marshal.Size());
+        }).SetBytesPerOp(block.size());
+
+        const Path path = context.GetTempDirectory().Concat("components.bin");
+
+        context.Run("save", [&]() {
+            DoNotOptimize(source.Save(path));
+        }).SetBytesPerOp(bytes);
+
+        context.Run("load", [&]() {
+            DoNotOptimize(SR_HTYPES_NS::Marshal::Load(path));
+        }).SetBytesPerOp(bytes);
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkSRASerialization, "serialization.sra") {
+        const uint64_t count = context.Scaled(2'000);
+
+        static constexpr auto OBJECTS_ID = SerializationId::Create("Objects");
+        static constexpr auto NAME_ID = SerializationId::Create("Name");
+        static constexpr auto INDEX_ID = SerializationId::Create("Index");
+        static constexpr auto WEIGHT_ID = SerializationId::Create("Weight");
+        static constexpr auto TRANSFORM_ID = SerializationId::Create("Transform");
+        static constexpr auto X_ID = SerializationId::Create("X");
+        static constexpr auto Y_ID = SerializationId::Create("Y");
+        static constexpr auto Z_ID = SerializationId::Create("Z");
+        static constexpr auto ITEM_ID = SerializationId::Create("Item");
+
+        auto&& serialize = [&](SRASerializer& serializer) {
+            serializer.BeginArray(count, OBJECTS_ID);
+            for (uint64_t i = 0; i < count; ++i) {
+                serializer.BeginItem(ITEM_ID);
+                serializer.WriteString(SR_FORMAT("object_{}", i), NAME_ID);
+                serializer.WriteInt(static_cast<int64_t>(i), INDEX_ID);
+                serializer.WriteDouble(static_cast<double_t>(i) * 0.125, WEIGHT_ID);
+                serializer.BeginObject(TRANSFORM_ID);
+                serializer.WriteDouble(1.0, X_ID);
+                serializer.WriteDouble(2.0, Y_ID);
+                serializer.WriteDouble(3.0, Z_ID);
+                serializer.EndObject();
+                serializer.EndItem();
+            }
+            serializer.EndArray();
+        };
+
+        context.Run("serialize", [&]() {
+            SRASerializer serializer;
+            serialize(serializer);
+            DoNotOptimize(serializer);
+        }).SetItemsPerOp(count);
+
+        SRASerializer serializer;
+        serialize(serializer);
+
+        context.Run("to_string", [&]() {
+            DoNotOptimize(serializer.ToString());
+        }).SetItemsPerOp(count);
+
+        const Path path = context.GetTempDirectory().Concat("objects.sra");
+        if (!serializer.SaveToFile(path)) {
+            SR_ERROR("BenchmarkSRASerialization() : failed to save \"{}\"", path.ToStringRef());
+            return;
+        }
+
+        context.Run("load_file", [&]() {
+            SRADeserializer deserializer;
+            DoNotOptimize(deserializer.LoadFromFile(path));
+        }).SetItemsPerOp(count);
+
+        SRADeserializer deserializer;
+        if (!deserializer.LoadFromFile(path)) {
+            SR_ERROR("BenchmarkSRASerialization() : failed to load \"{}\"", path.ToStringRef());
+            return;
+        }
+
+        /// поля ищутся по хешу идентификатора среди детей узла
+        context.Run("read_fields", [&]() {
+            const uint64_t size = deserializer.BeginArray(OBJECTS_ID);
+            for (uint32_t i = 0; i < size; ++i) {
+                if (!deserializer.BeginItem(ITEM_ID, i)) {
+                    continue;
+                }
+
+                int64_t index = 0;
+                double_t weight = 0.0;
+                deserializer.ReadInt(index, INDEX_ID);
+                deserializer.ReadDouble(weight, WEIGHT_ID);
+                DoNotOptimize(index);
+                DoNotOptimize(weight);
+
+                deserializer.EndItem();
+            }
+            deserializer.EndArray();
+        }).SetItemsPerOp(count);
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkMigration, "serialization.migration") {
+        static constexpr uint64_t HASH_NAME = SR_COMPILE_TIME_CRC32_STR("BenchmarkMigrationComponent");
+        static constexpr Migration::Version VERSION_FIRST = 1;
+        static constexpr Migration::Version VERSION_LAST = 4;
+
+        auto&& migration = Migration::Instance();
+
+        /// v1 -> v2: int32 расширяется до int64 и добавляется вес
+        migration.RegisterBufferMigrator(HASH_NAME, 1, 2, [](SR_HTYPES_NS::Marshal& input, SR_HTYPES_NS::Marshal& output) -> bool {
+            output.Write<int64_t>(input.Read<int32_t>());
+            output.Write<float_t>(1.f);
+            output.Write<std::string>(input.Read<std::string>());
+            return true;
+        });
+
+        /// v2 -> v3: только проверка тела без перезаписи
+        migration.RegisterMigrator(HASH_NAME, 2, 3, [](SR_HTYPES_NS::Marshal& marshal) -> bool {
+            return marshal.Read<int64_t>() >= 0;
+        });
+
+        /// v3 -> v4: добавляется флаг в конец
+        migration.RegisterBufferMigrator(HASH_NAME, 3, 4, [](SR_HTYPES_NS::Marshal& input, SR_HTYPES_NS::Marshal& output) -> bool {
+            output.Write<int64_t>(input.Read<int64_t>());
+            output.Write<float_t>(input.Read<float_t>());
+            output.Write<std::string>(input.Read<std::string>());
+            output.Write<bool>(true);
+            return true;
+        });
+
+        const uint64_t count = context.Scaled(100'000);
+
+        SR_HTYPES_NS::Marshal original;
+        original.Write<int32_t>(42);
+        original.Write<std::string>("BenchmarkMigrationComponent");
+
+        std::vector<SR_HTYPES_NS::Marshal> marshals(count);
+        std::vector<SR_HTYPES_NS::Marshal*> pointers(count);
+
+        /// миграция меняет тело на месте, поэтому перед каждым замером копии пересоздаются
+        auto&& setup = [&]() {
+            for (uint64_t i = 0; i < count; ++i) {
+                marshals[i] = original.Copy();
+                marshals[i].SetPosition(0);
+                pointers[i] = &marshals[i];
+            }
+        };
+
+        uint64_t migrated = 0;
+
+        context.RunWithSetup("migrate_single_100k", 5, setup, [&]() {
+            migrated = 0;
+            for (auto&& marshal : marshals) {
+                migrated += migration.Migrate(HASH_NAME, marshal, VERSION_FIRST, VERSION_LAST) ? 1 : 0;
+            }
+        }).SetItemsPerOp(count).AddCounter("migrated", static_cast<double_t>(migrated));
+
+        context.RunWithSetup("migrate_batch_100k", 5, setup, [&]() {
+            migrated = migration.MigrateBatch(HASH_NAME, pointers, VERSION_FIRST, VERSION_LAST);
+        }).SetItemsPerOp(count).AddCounter("migrated", static_cast<double_t>(migrated));
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkXmlYaml, "serialization.xml_yaml") {
+        const uint64_t count = context.Scaled(5'000);
+
+        std::string xml = "<?xml version=\"1.0\"?>\n<Scene>\n";
+        std::string yaml = "Objects:\n";
+        for (uint64_t i = 0; i < count; ++i) {
+            xml += SR_FORMAT("  <Object Name=\"object_{}\" Index=\"{}\" Enabled=\"true\"><Position X=\"{}\" Y=\"1.5\" Z=\"-2\"/></Object>\n", i, i, i);
+            yaml += SR_FORMAT("  - Name: object_{}\n    Index: {}\n    Enabled: true\n    Position: [{}, 1.5, -2]\n", i, i, i);
+        }
+        xml += "</Scene>\n";
+
+        auto&& directory = context.GetTempDirectory();
+        const Path xmlPath = directory.Concat("scene.xml");
+        const Path yamlPath = directory.Concat("scene.yml");
+
+        if (!WriteBenchmarkFile(xmlPath, xml) || !WriteBenchmarkFile(yamlPath, yaml)) {
+            SR_ERROR("BenchmarkXmlYaml() : failed to write the documents!");
+            return;
+        }
+
+        context.Run("xml_load", [&]() {
+            DoNotOptimize(Xml::Document::Load(xmlPath).Valid());
+        }).SetBytesPerOp(xml.size());
+
+        /// разбор портит буфер, копия исходника делается вне замера
+        std::vector<char> buffer;
+        context.RunWithSetup("xml_load_in_place", 50, [&]() { buffer.assign(xml.begin(), xml.end()); }, [&]() {
+            DoNotOptimize(Xml::Document::LoadInPlace(buffer.data(), buffer.size()).Valid());
+        }).SetBytesPerOp(xml.size());
+
+        auto&& document = Xml::Document::Load(xmlPath);
+        if (document.Valid()) {
+            const Xml::Node scene = document.Root().GetNode("Scene");
+
+            context.Run("xml_iterate", [&]() {
+                uint64_t attributes = 0;
+                for (auto&& node : scene.Children()) {
+                    for (auto&& attribute : node.Attributes()) {
+                        DoNotOptimize(attribute);
+                        ++attributes;
+                    }
+                }
+                DoNotOptimize(attributes);
+            }).SetItemsPerOp(count);
+
+            /// прежний способ: вектор детей и атрибуты по имени
+            context.Run("xml_iterate_vectors", [&]() {
+                uint64_t attributes = 0;
+                for (auto&& node : scene.GetNodes()) {
+                    for (auto&& name : { "Name", "Index", "Enabled" }) {
+                        DoNotOptimize(node.GetAttribute(std::string(name)));
+                        ++attributes;
+                    }
+                }
+                DoNotOptimize(attributes);
+            }).SetItemsPerOp(count);
+
+            context.Run("xml_children_named", [&]() {
+                uint64_t nodes = 0;
+                for (auto&& node : scene.Children("Object")) {
+                    DoNotOptimize(node);
+                    ++nodes;
+                }
+                DoNotOptimize(nodes);
+            }).SetItemsPerOp(count);
+
+            context.Run("xml_children_named_vectors", [&]() {
+                DoNotOptimize(scene.GetNodes("Object").size());
+            }).SetItemsPerOp(count);
+        }
+
+        context.Run("yaml_load", [&]() {
+            DoNotOptimize(Yaml::Document::Load(yamlPath).IsValid());
+        }).SetBytesPerOp(yaml.size());
+
+        context.RunWithSetup("yaml_load_in_place", 50, [&]() { buffer.assign(yaml.begin(), yaml.end()); }, [&]() {
+            DoNotOptimize(Yaml::Document::LoadInPlace(buffer.data(), buffer.size()).IsValid());
+        }).SetBytesPerOp(yaml.size());
+
+        if (!context.IsAnyEnabled({ "yaml_iterate", "yaml_iterate_vectors" })) {
+            return;
+        }
+
+        auto&& yamlDocument = Yaml::Document::Load(yamlPath);
+        if (yamlDocument.IsValid()) {
+            const Yaml::Node objects = yamlDocument.GetRoot().GetChild("Objects");
+
+            context.Run("yaml_iterate", [&]() {
+                uint64_t fields = 0;
+                for (auto&& object : objects.Children()) {
+                    for (auto&& field : object.Children()) {
+                        DoNotOptimize(field.GetKeyView());
+                        ++fields;
+                    }
+                }
+                DoNotOptimize(fields);
+            }).SetItemsPerOp(count);
+
+            context.Run("yaml_iterate_vectors", [&]() {
+                uint64_t fields = 0;
+                for (auto&& object : objects.GetChildren()) {
+                    for (auto&& field : object.GetChildren()) {
+                        DoNotOptimize(field.GetKey());
+                        ++fields;
+                    }
+                }
+                DoNotOptimize(fields);
+            }).SetItemsPerOp(count);
+        }
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkResourceEmbedder, "resources.embedder") {
+        using Embedder = ResourceEmbedder;
+
+        const uint64_t count = context.Scaled(2'000);
+
+        std::vector<std::string> paths;
+        for (uint64_t i = 0; i < count; ++i) {
+            paths.emplace_back(SR_FORMAT("Engine/Shaders/Generated/shader_{}.srsl", i));
+        }
+
+        /// синтетический пакет: заголовок, индекс по хешу пути, пути, данные
+        std::vector<uint64_t> order(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](uint64_t left, uint64_t right) {
+            return SR_HASH_STR_VIEW(paths[left]) < SR_HASH_STR_VIEW(paths[right]);
+        });
+
+        auto&& buildPack = [&](const std::string& data, const std::string& packed, Embedder::PackCompression compression) {
+            std::string pack(sizeof(Embedder::PackHeader) + count * sizeof(Embedder::PackEntry), '\0');
+
+            Embedder::PackHeader header = { };
+            header.magic = Embedder::PACK_MAGIC;
+            header.version = Embedder::PACK_VERSION;
+            header.count = static_cast<uint32_t>(count);
+            memcpy(pack.data(), &header, sizeof(header));
+
+            std::vector<Embedder::PackEntry> entries(count);
+            for (uint64_t i = 0; i < count; ++i) {
+                auto&& entry = entries[i];
+                auto&& path = paths[order[i]];
+
+                entry.pathHash = SR_HASH_STR_VIEW(path);
+                entry.pathOffset = static_cast<uint32_t>(pack.size());
+                entry.pathSize = static_cast<uint32_t>(path.size());
+                pack += path;
+
+                entry.dataOffset = pack.size();
+                entry.packedSize = packed.size();
+                entry.size = data.size();
+                entry.compression = compression;
+                pack += packed;
+            }
+            memcpy(pack.data() + sizeof(header), entries.data(), entries.size() * sizeof(Embedder::PackEntry));
+
+            return pack;
+        };
+
+        const std::string data(512, 'd');
+        const std::string pack = buildPack(data, data, Embedder::PackCompression::None);
+
+        /// регистрация пакета - вся работа на старте, индекс читается прямо из памяти
+        context.Run("register_pack", [&]() {
+            Embedder embedder;
+            DoNotOptimize(embedder.RegisterPack(pack.data(), pack.size()));
+        }).AddCounter("entries", static_cast<double_t>(count));
+
+        /// прежняя схема: статический инициализатор каждого ресурса вставлял его в таблицу путей
+        context.Run("register_each", [&]() {
+            ska::flat_hash_map<std::string, std::pair<uint64_t, const char*>> resources;
+            for (auto&& path : paths) {
+                resources[path] = std::make_pair(static_cast<uint64_t>(data.size()), data.data());
+            }
+            DoNotOptimize(resources.size());
+        }).AddCounter("entries", static_cast<double_t>(count));
+
+        Embedder embedder;
+        if (!embedder.RegisterPack(pack.data(), pack.size())) {
+            return;
+        }
+
+        /// прежняя схема при каждом запуске выгружала все ресурсы на диск
+        const Path exportDirectory = context.GetTempDirectory().Concat("Export");
+        context.RunWithSetup("export_all", 5, [](){ }, [&]() {
+            DoNotOptimize(embedder.ExportAllResources(exportDirectory));
+        }).AddCounter("entries", static_cast<double_t>(count));
+
+        std::vector<Path> resourcePaths(paths.begin(), paths.end());
+
+        uint64_t index = 0;
+        context.Run("contains", [&]() {
+            DoNotOptimize(embedder.Contains(resourcePaths[index++ % count]));
+        });
+
+        /// несжатая запись открывается представлением над пакетом, байты не копируются
+        context.Run("open", [&]() {
+            auto&& stream = embedder.Open(resourcePaths[index++ % count]);
+            DoNotOptimize(stream.Size());
+        }).AddCounter("entry_bytes", static_cast<double_t>(data.size()));
+
+    #ifdef SR_COMMON_ZLIB
+        /// сжатые записи - текст, похожий на шейдеры: распаковываются при первом Open и дальше берутся из кэша
+        std::string text;
+        for (uint32_t i = 0; text.size() < 4096; ++i) {
+            text += SR_FORMAT("layout(location = {}) in vec3 attribute_{};\n", i % 16, i);
+        }
+
+        std::string compressed(compressBound(static_cast<uLong>(text.size())), '\0');
+        auto compressedSize = static_cast<uLongf>(compressed.size());
+        if (compress2(reinterpret_cast<Bytef*>(compressed.data()), &compressedSize,
+            reinterpret_cast<const Bytef*>(text.data()), static_cast<uLong>(text.size()), Z_BEST_COMPRESSION) != Z_OK
+        ) {
+            SR_ERROR("BenchmarkResourceEmbedder() : failed to compress the entry!");
+            return;
+        }
+        compressed.resize(compressedSize);
+
+        const std::string compressedPack = buildPack(text, compressed, Embedder::PackCompression::Zlib);
+
+        Embedder compressedEmbedder;
+        if (!compressedEmbedder.RegisterPack(compressedPack.data(), compressedPack.size())) {
+            return;
+        }
+
+        /// кэш сбрасывается вне замера, каждый замер - одна распаковка
+        context.RunWithSetup("open_compressed_cold", 1000, [&]() { compressedEmbedder.ClearCache(); }, [&]() {
+            auto&& stream = compressedEmbedder.Open(resourcePaths[index++ % count]);
+            DoNotOptimize(stream.Size());
+        }).AddCounter("entry_bytes", static_cast<double_t>(text.size())).AddCounter("packed_bytes", static_cast<double_t>(compressed.size()));
+
+        for (auto&& path : resourcePaths) {
+            DoNotOptimize(compressedEmbedder.Open(path).Size());
+        }
+
+        context.Run("open_compressed_warm", [&]() {
+            auto&& stream = compressedEmbedder.Open(resourcePaths[index++ % count]);
+            DoNotOptimize(stream.Size());
+        }).AddCounter("entry_bytes", static_cast<double_t>(text.size()));
+    #endif
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkResourceManager, "resources.manager") {
+        if (!context.IsAnyEnabled({ "find_hit", "find_miss" })) {
+            return;
+        }
+
+        auto&& manager = ResourceManager::Instance();
+        manager.RegisterType<BenchmarkResource>();
+
+        const uint64_t count = context.Scaled(10'000);
+
+        std::vector<std::string> ids;
+        for (uint64_t i = 0; i < count; ++i) {
+            ids.emplace_back(SR_FORMAT("Benchmarks/resource_{}", i));
+
+            /// точка использования держит ресурс живым до конца программы
+            auto&& pResource = new BenchmarkResource();
+            pResource->SetId(ids.back());
+            pResource->AddUsePoint();
+        }
+
+        uint64_t index = 0;
+        context.Run("find_hit", [&]() {
+            DoNotOptimize(manager.Find<BenchmarkResource>(ids[index++ % count]));
+        }).AddCounter("resources", static_cast<double_t>(count));
+
+        const std::string missing = "Benchmarks/missing";
+        context.Run("find_miss", [&]() {
+            DoNotOptimize(manager.Find<BenchmarkResource>(missing));
+        });
+    }
+
+#ifdef SR_UTILS_ASSIMP
+    SR_BENCHMARK_GROUP(BenchmarkAssimpCache, "resources.assimp_cache") {
+        const uint64_t gridSize = std::max<uint64_t>(2, static_cast<uint64_t>(std::sqrt(static_cast<double_t>(context.Scaled(40'000)))));
+
+        /// плоская сетка gridSize x gridSize вершин
+        std::string obj;
+        for (uint64_t y = 0; y < gridSize; ++y) {
+            for (uint64_t x = 0; x < gridSize; ++x) {
+                obj += SR_FORMAT("v {} {} {}\nvt {} {}\nvn 0 1 0\n", x, (x * 7 + y * 13) % 5, y,
+                    static_cast<double_t>(x) / gridSize, static_cast<double_t>(y) / gridSize);
+            }
+        }
+        for (uint64_t y = 0; y + 1 < gridSize; ++y) {
+            for (uint64_t x = 0; x + 1 < gridSize; ++x) {
+                const uint64_t a = y * gridSize + x + 1;
+                const uint64_t b = a + 1;
+                const uint64_t c = a + gridSize;
+                const uint64_t d = c + 1;
+                obj += SR_FORMAT("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\nf {1}/{1}/{1} {3}/{3}/{3} {2}/{2}/{2}\n", a, b, c, d);
+            }
+        }
+
+        auto&& directory = context.GetTempDirectory();
+        const Path objPath = directory.Concat("grid.obj");
+        const Path cachePath = directory.Concat("grid.cache");
+        const uint64_t sourceHash = SR_HASH_STR(obj);
+
+        if (!WriteBenchmarkFile(objPath, obj)) {
+            SR_ERROR("BenchmarkAssimpCache() : failed to write \"{}\"", objPath.ToStringRef());
+            return;
+        }
+
+        constexpr uint32_t flags = aiProcess_Triangulate | aiProcess_JoinIdenticalVertices;
+
+        context.Run("import_obj", [&]() {
+            Assimp::Importer importer;
+            DoNotOptimize(importer.ReadFile(objPath.ToStringRef(), flags));
+        }).SetBytesPerOp(obj.size());
+
+        Assimp::Importer importer;
+        const aiScene* pScene = importer.ReadFile(objPath.ToStringRef(), flags);
+        if (!pScene || !AssimpCache::Instance().Save(cachePath, pScene, sourceHash)) {
+            SR_ERROR("BenchmarkAssimpCache() : failed to prepare the cache!");
+            return;
+        }
+
+        uint64_t mappedSize = 0;
+        context.Run("load_cache_warm", [&]() {
+            auto&& pCached = AssimpCache::Instance().Load(cachePath, sourceHash);
+            mappedSize = pCached ? pCached->GetMappedSize() : 0;
+            DoNotOptimize(pCached);
+        }).AddCounter("cache_bytes", static_cast<double_t>(mappedSize));
+
+    #ifdef SR_LINUX
+        /// страницы файла выбрасываются из page cache, поэтому замер включает чтение с диска
+        context.RunWithSetup("load_cache_cold", 20, [&]() {
+            const int fd = open(cachePath.ToStringRef().c_str(), O_RDONLY);
+            if (fd >= 0) {
+                posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+                close(fd);
+            }
+        }, [&]() {
+            DoNotOptimize(AssimpCache::Instance().Load(cachePath, sourceHash));
+        });
+    #endif
+    }
+#endif
+}
@@ -0,0 +1,483 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include "Benchmark.h"
+
+#include <Utils/Common/Vertices.h>
+#include <Utils/ECS/EntityRef.h>
+#include <Utils/ECS/GameObject.h>
+#include <Utils/ECS/ObjectMask.h>
+#include <Utils/Math/Noise.h>
+#include <Utils/World/Region.h>
+#include <Utils/World/RegionStreamer.h>
+#include <Utils/World/Scene.h>
+#include <Utils/World/SceneAllocator.h>
+#include <Utils/World/SceneUpdater.h>
+#include <Utils/World/SpatialHashMap.h>
+#include <Utils/World/WorldGen.h>
+
+#include <random>
+#include <unordered_set>
+
+namespace SR_UTILS_NS::Benchmarks {
+    namespace {
+        std::vector<SR_MATH_NS::IVector3> MakeUniqueKeys(std::mt19937_64& random, uint64_t count, int32_t extent) {
+            std::uniform_int_distribution<int32_t> distribution(-extent, extent);
+
+            std::unordered_set<SR_MATH_NS::IVector3> unique;
+            std::vector<SR_MATH_NS::IVector3> keys;
+            keys.reserve(count);
+
+            while (keys.size() < count) {
+                const SR_MATH_NS::IVector3 key(distribution(random), distribution(random), distribution(random));
+                if (unique.insert(key).second) {
+                    keys.emplace_back(key);
+                }
+            }
+
+            return keys;
+        }
+
+        void FreeChunks(SR_WORLD_NS::CachedChunks& chunks) {
+            for (auto&& [position, pMarshal] : chunks) {
+                SR_SAFE_DELETE_PTR(pMarshal);
+            }
+            chunks.clear();
+        }
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkNoise, "math.noise") {
+        constexpr uint32_t SIZE = 256;
+        constexpr uint64_t SAMPLES = SIZE * SIZE;
+        constexpr double_t STEP = 1.0 / 32.0;
+
+        std::vector<float_t> grid(SAMPLES * 16);
+
+        /// поточечный вызов против пакетного на той же сетке
+        context.Run("snoise_2d_scalar", [&]() {
+            for (uint32_t y = 0; y < SIZE; ++y) {
+                for (uint32_t x = 0; x < SIZE; ++x) {
+                    grid[y * SIZE + x] = static_cast<float_t>(SR_MATH_NS::SNoise(x * STEP, y * STEP));
+                }
+            }
+            DoNotOptimize(grid.data());
+        }).SetItemsPerOp(SAMPLES);
+
+        context.Run("snoise_grid_2d", [&]() {
+            SR_MATH_NS::SNoiseGrid2D(grid.data(), SIZE, SIZE, 0.0, 0.0, STEP, STEP);
+            DoNotOptimize(grid.data());
+        }).SetItemsPerOp(SAMPLES);
+
+        context.Run("snoise_grid_3d", [&]() {
+            SR_MATH_NS::SNoiseGrid3D(grid.data(), SIZE, SIZE, 16, 0.0, 0.0, 0.0, STEP, STEP, STEP);
+            DoNotOptimize(grid.data());
+        }).SetItemsPerOp(SAMPLES * 16);
+
+        SR_MATH_NS::FBmSettings settings;
+        settings.octaves = 6;
+        settings.frequency = 0.5;
+
+        context.Run("fbm_2d_scalar", [&]() {
+            for (uint32_t y = 0; y < SIZE; ++y) {
+                for (uint32_t x = 0; x < SIZE; ++x) {
+                    grid[y * SIZE + x] = static_cast<float_t>(SR_MATH_NS::FBm(x * STEP, y * STEP, settings));
+                }
+            }
+            DoNotOptimize(grid.data());
+        }).SetItemsPerOp(SAMPLES).AddCounter("octaves", settings.octaves);
+
+        context.Run("fbm_grid_2d", [&]() {
+            SR_MATH_NS::FBmGrid2D(grid.data(), SIZE, SIZE, 0.0, 0.0, STEP, STEP, settings);
+            DoNotOptimize(grid.data());
+        }).SetItemsPerOp(SAMPLES).AddCounter("octaves", settings.octaves);
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkSpatialHash, "world.spatial_hash") {
+        std::mt19937_64 random(7);
+
+        const uint64_t count = context.Scaled(100'000);
+        const auto extent = static_cast<int32_t>(std::cbrt(static_cast<double_t>(count)) * 2.0) + 4;
+
+        auto&& keys = MakeUniqueKeys(random, count, extent);
+
+        /// перемещение на соседнюю ячейку, как при движении объекта между чанками
+        std::vector<SR_MATH_NS::IVector3> moved(keys);
+        {
+            std::unordered_set<SR_MATH_NS::IVector3> occupied(keys.begin(), keys.end());
+            std::uniform_int_distribution<int32_t> step(-1, 1);
+
+            for (auto&& key : moved) {
+                const SR_MATH_NS::IVector3 candidate(key.x + step(random), key.y + step(random), key.z + step(random));
+                if (occupied.count(candidate) == 0) {
+                    occupied.erase(key);
+                    occupied.insert(candidate);
+                    key = candidate;
+                }
+            }
+        }
+
+        SR_WORLD_NS::SpatialHashMap<uint64_t> map;
+
+        context.RunWithSetup("insert_100k", 10, [&]() { map.Clear(); }, [&]() {
+            for (uint64_t i = 0; i < count; ++i) {
+                map.Insert(keys[i], i);
+            }
+        }).SetItemsPerOp(count);
+
+        std::unordered_map<SR_MATH_NS::IVector3, uint64_t> stdMap;
+        context.RunWithSetup("insert_100k_std", 10, [&]() { stdMap = { }; }, [&]() {
+            for (uint64_t i = 0; i < count; ++i) {
+                stdMap.emplace(keys[i], i);
+            }
+        }).SetItemsPerOp(count);
+
+        auto&& fill = [&]() {
+            map.Clear();
+            map.Reserve(static_cast<uint32_t>(count));
+            for (uint64_t i = 0; i < count; ++i) {
+                map.Insert(keys[i], i);
+            }
+        };
+
+        context.RunWithSetup("move_100k", 10, fill, [&]() {
+            for (uint64_t i = 0; i < count; ++i) {
+                if (keys[i] == moved[i]) {
+                    continue;
+                }
+                map.Erase(keys[i]);
+                map.Insert(moved[i], i);
+            }
+        }).SetItemsPerOp(count);
+
+        fill();
+
+        uint64_t index = 0;
+        context.Run("find", [&]() {
+            DoNotOptimize(map.Find(keys[index++ % count]));
+        });
+
+        uint64_t visited = 0;
+        context.Run("query_box_8", [&]() {
+            auto&& center = keys[index++ % count];
+            map.ForEachInBox(center - SR_MATH_NS::IVector3(4, 4, 4), center + SR_MATH_NS::IVector3(4, 4, 4), [&](auto&&, auto&& value) {
+                DoNotOptimize(value);
+                ++visited;
+            });
+        }).AddCounter("visited", static_cast<double_t>(visited));
+
+        context.Run("query_radius_4", [&]() {
+            map.ForEachInRadius(keys[index++ % count], 4, [&](auto&&, auto&& value) {
+                DoNotOptimize(value);
+            });
+        });
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkWorldGen, "world.worldgen") {
+        SR_WORLD_NS::WorldGen::Settings settings;
+        settings.seed = 42;
+        settings.heightScale = 32.f;
+        settings.fbm.octaves = 5;
+
+        const SR_MATH_NS::IVector2 chunkSize(16, 16);
+        constexpr uint32_t REGION_WIDTH = 8;
+
+        const auto side = static_cast<int32_t>(std::max<uint64_t>(1, static_cast<uint64_t>(std::sqrt(static_cast<double_t>(context.Scaled(256))))));
+
+        std::vector<SR_WORLD_NS::WorldGen::ChunkKey> chunks;
+        for (int32_t z = 0; z < side; ++z) {
+            for (int32_t x = 0; x < side; ++x) {
+                const SR_MATH_NS::IVector3 region(x / REGION_WIDTH, 0, z / REGION_WIDTH);
+                const SR_MATH_NS::IVector3 chunk(x % REGION_WIDTH, 0, z % REGION_WIDTH);
+                chunks.emplace_back(region, chunk);
+            }
+        }
+
+        std::vector<uint64_t> serialHashes(chunks.size());
+
+        context.RunWithSetup("generate_serial", 5, []() { }, [&]() {
+            for (uint64_t i = 0; i < chunks.size(); ++i) {
+                serialHashes[i] = SR_WORLD_NS::WorldGen::Generate(settings, chunkSize, REGION_WIDTH, chunks[i].first, chunks[i].second).hash;
+            }
+        }).SetItemsPerOp(chunks.size());
+
+        const uint32_t threadsCount = std::max(2u, std::thread::hardware_concurrency());
+
+        auto&& pWorldGen = std::make_unique<SR_WORLD_NS::WorldGen>(settings, chunkSize, REGION_WIDTH);
+        pWorldGen->SetCacheCapacity(static_cast<uint32_t>(chunks.size()));
+        pWorldGen->Start(threadsCount);
+
+        std::vector<SR_WORLD_NS::WorldGen::GeneratedChunk::Ptr> generated;
+
+        context.RunWithSetup("generate_parallel", 5, [&]() { pWorldGen->ClearCache(); }, [&]() {
+            generated = pWorldGen->GenerateBatch(chunks);
+        }).SetItemsPerOp(chunks.size()).AddCounter("threads", threadsCount);
+
+        context.Run("get_cached", [&]() {
+            DoNotOptimize(pWorldGen->Get(chunks.front().first, chunks.front().second));
+        });
+
+        pWorldGen->Stop();
+        pWorldGen.reset();
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkRegionStreamer, "world.region_streamer") {
+        if (!context.IsAnyEnabled({ "flythrough_prefetch", "flythrough_sync" })) {
+            return;
+        }
+
+        const auto regionsCount = static_cast<int32_t>(std::max<uint64_t>(8, context.Scaled(64)));
+        constexpr int32_t CHUNKS_PER_REGION = 16;
+        constexpr uint64_t CHUNK_BYTES = 4 * 1024;
+        constexpr int32_t PREFETCH_DISTANCE = 3;
+
+        auto&& directory = context.GetTempDirectory();
+
+        std::vector<Path> paths;
+        const std::vector<char> payload(CHUNK_BYTES, 'c');
+
+        /// полет камеры вдоль оси X через ряд регионов
+        for (int32_t x = 0; x < regionsCount; ++x) {
+            SR_HTYPES_NS::Marshal region;
+            region.Write<uint16_t>(SR_WORLD_NS::Region::GetCacheVersion());
+            region.Write<uint64_t>(CHUNKS_PER_REGION);
+
+            for (int32_t i = 0; i < CHUNKS_PER_REGION; ++i) {
+                SR_HTYPES_NS::Marshal chunk;
+                chunk.Write<SR_MATH_NS::IVector3>(SR_MATH_NS::IVector3(i % 4, 0, i / 4));
+                chunk.WriteBlock(const_cast<char*>(payload.data()), payload.size());
+
+                region.Write<uint64_t>(chunk.Size());
+                region.Append(std::move(chunk));
+            }
+
+            auto&& path = paths.emplace_back(directory.Concat(SR_FORMAT("region_{}.dat", x)));
+            if (!region.Save(path)) {
+                SR_ERROR("BenchmarkRegionStreamer() : failed to save \"{}\"", path.ToStringRef());
+                return;
+            }
+        }
+
+        SR_WORLD_NS::RegionStreamer streamer(2, 64ULL * 1024 * 1024);
+        streamer.Start();
+
+        SR_WORLD_NS::CachedChunks chunks;
+
+        /// один замер - вход камеры в новый регион, перцентили показывают подвисания кадра
+        int32_t current = 0;
+        context.RunWithSetup("flythrough_prefetch", static_cast<uint32_t>(regionsCount), [&]() {
+            for (int32_t i = 1; i <= PREFETCH_DISTANCE && current + i < regionsCount; ++i) {
+                streamer.Prefetch(SR_MATH_NS::IVector3(current + i, 0, 0), paths[current + i], static_cast<float_t>(i));
+            }
+
+            if (current == 0) {
+                streamer.Prefetch(SR_MATH_NS::IVector3(0, 0, 0), paths[0], 0.f);
+            }
+
+            /// время кадра, за которое потоки успевают прочитать регионы впереди
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }, [&]() {
+            streamer.Take(SR_MATH_NS::IVector3(current, 0, 0), paths[current], chunks);
+            ++current;
+        }).SetBytesPerOp(CHUNKS_PER_REGION * CHUNK_BYTES).AddCounter("chunks_per_region", CHUNKS_PER_REGION);
+
+        FreeChunks(chunks);
+        streamer.CancelQueued();
+
+        current = 0;
+        context.RunWithSetup("flythrough_sync", static_cast<uint32_t>(regionsCount), []() { }, [&]() {
+            auto&& marshal = SR_HTYPES_NS::Marshal::Load(paths[current]);
+            SR_WORLD_NS::Region::ReadCache(marshal, chunks);
+            ++current;
+        }).SetBytesPerOp(CHUNKS_PER_REGION * CHUNK_BYTES);
+
+        FreeChunks(chunks);
+
+        streamer.Stop();
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkMesh, "world.mesh") {
+        std::mt19937_64 random(8);
+
+        const auto side = static_cast<uint32_t>(std::max<uint64_t>(4, static_cast<uint64_t>(std::sqrt(static_cast<double_t>(context.Scaled(65'536))))));
+        const uint32_t verticesCount = side * side;
+
+        std::vector<Vertex> vertices;
+        vertices.reserve(verticesCount);
+        for (uint32_t y = 0; y < side; ++y) {
+            for (uint32_t x = 0; x < side; ++x) {
+                vertices.emplace_back(static_cast<int32_t>(x), static_cast<int32_t>((x * 7 + y * 3) % 5), static_cast<int32_t>(y));
+            }
+        }
+
+        /// треугольники сетки в случайном порядке - худший случай для кеша вершин
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (uint32_t y = 0; y + 1 < side; ++y) {
+            for (uint32_t x = 0; x + 1 < side; ++x) {
+                const uint32_t a = y * side + x;
+                triangles.push_back({ a, a + 1, a + side });
+                triangles.push_back({ a + 1, a + side + 1, a + side });
+            }
+        }
+        std::shuffle(triangles.begin(), triangles.end(), random);
+
+        std::vector<uint32_t> source;
+        source.reserve(triangles.size() * 3);
+        for (auto&& triangle : triangles) {
+            source.insert(source.end(), triangle.begin(), triangle.end());
+        }
+
+        std::vector<uint32_t> indices;
+
+        context.RunWithSetup("optimize_vertex_cache", 10, [&]() { indices = source; }, [&]() {
+            OptimizeVertexCache(indices, verticesCount);
+        }).SetItemsPerOp(triangles.size())
+          .AddCounter("acmr_before", SR_UTILS_NS::CalculateACMR(source, verticesCount))
+          .AddCounter("acmr_after", indices.empty() ? 0.0 : SR_UTILS_NS::CalculateACMR(indices, verticesCount));
+
+        context.RunWithSetup("optimize_overdraw", 10, [&]() { indices = source; OptimizeVertexCache(indices, verticesCount); }, [&]() {
+            OptimizeOverdraw(indices, vertices);
+        }).SetItemsPerOp(triangles.size());
+
+        context.Run("calculate_acmr", [&]() {
+            DoNotOptimize(SR_UTILS_NS::CalculateACMR(source, verticesCount));
+        }).SetItemsPerOp(triangles.size());
+
+        /// облако точек в шаре, на оболочку попадает малая часть
+        std::uniform_real_distribution<float_t> coordinate(-1.f, 1.f);
+        std::vector<Vec3> points;
+        while (points.size() < verticesCount) {
+            const Vec3 point = { coordinate(random), coordinate(random), coordinate(random) };
+            if (point.x * point.x + point.y * point.y + point.z * point.z <= 1.f) {
+                points.emplace_back(point);
+            }
+        }
+
+        std::vector<uint32_t> hull;
+        context.RunWithSetup("convex_hull", 10, []() { }, [&]() {
+            DoNotOptimize(ComputeConvexHull(points, hull));
+        }).SetItemsPerOp(points.size()).AddCounter("hull_indices", static_cast<double_t>(hull.size()));
+
+        context.RunWithSetup("convex_hull_limited_64", 10, []() { }, [&]() {
+            DoNotOptimize(ComputeConvexHull(points, hull, 64));
+        }).SetItemsPerOp(points.size());
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkObjectMask, "ecs.object_mask") {
+        std::mt19937_64 random(9);
+        std::uniform_int_distribution<uint16_t> bit(0, 63);
+
+        const uint64_t count = context.Scaled(100'000);
+
+        std::vector<ObjectMask> tags(count);
+        std::vector<ObjectMask> layers(count);
+        for (uint64_t i = 0; i < count; ++i) {
+            tags[i] = MakeObjectMask(bit(random)) | MakeObjectMask(bit(random));
+            layers[i] = MakeObjectMask(bit(random) % 8);
+        }
+
+        ObjectMaskQuery query;
+        query.anyTags = MakeObjectMask(1) | MakeObjectMask(7) | MakeObjectMask(42);
+        query.includeLayers = MakeObjectMask(0) | MakeObjectMask(1) | MakeObjectMask(2);
+        query.excludeLayers = MakeObjectMask(2);
+
+        std::vector<uint32_t> indices(count);
+        uint32_t matched = 0;
+
+        context.Run("filter_100k", [&]() {
+            matched = FilterObjectMasks(tags.data(), layers.data(), static_cast<uint32_t>(count), query, indices.data());
+            DoNotOptimize(matched);
+        }).SetItemsPerOp(count).AddCounter("matched", matched);
+
+        context.Run("filter_100k_loop", [&]() {
+            uint32_t found = 0;
+            for (uint32_t i = 0; i < count; ++i) {
+                if (query.Test(tags[i], layers[i])) {
+                    indices[found++] = i;
+                }
+            }
+            DoNotOptimize(found);
+        }).SetItemsPerOp(count);
+    }
+
+    SR_BENCHMARK_GROUP(BenchmarkScene, "world.scene") {
+        if (!context.IsAnyEnabled({ "build", "update", "query_object_ids", "find_by_name", "entity_ref_cached", "entity_ref_resolve" })) {
+            return;
+        }
+
+        SR_WORLD_NS::SceneAllocator::Instance().Init([]() -> SR_WORLD_NS::Scene::Ptr {
+            return new SR_WORLD_NS::Scene();
+        });
+
+        auto&& pScene = SR_WORLD_NS::Scene::Empty();
+        if (!pScene) {
+            SR_ERROR("BenchmarkScene() : failed to create the scene!");
+            return;
+        }
+
+        const uint64_t count = context.Scaled(10'000);
+
+        std::vector<StringAtom> names;
+        std::vector<GameObject::Ptr> gameObjects;
+
+        for (uint64_t i = 0; i < count; ++i) {
+            auto&& name = names.emplace_back(SR_FORMAT("Object_{}", i));
+            auto&& pGameObject = pScene->InstanceGameObject(name);
+
+            /// каждый десятый объект с парой детей, как в типичной иерархии
+            if (i % 10 == 0) {
+                DoNotOptimize(pGameObject->CreateChild(SR_FORMAT("Object_{}_A", i)));
+                DoNotOptimize(pGameObject->CreateChild(SR_FORMAT("Object_{}_B", i)));
+            }
+
+            gameObjects.emplace_back(pGameObject);
+        }
+
+        pScene->Prepare();
+
+        auto&& pUpdater = pScene->GetSceneUpdater();
+
+        context.Run("build", [&]() {
+            pUpdater->SetDirty();
+            pUpdater->Build(false);
+        }).SetItemsPerOp(count);
+
+        /// у объектов нет компонентов, поэтому это только постоянная цена кадра, а не обход объектов
+        context.Run("update", [&]() {
+            pUpdater->Update(1.f / 60.f, false);
+        });
+
+        const ObjectMaskQuery query;
+        context.Run("query_object_ids", [&]() {
+            DoNotOptimize(pScene->QueryObjectIds(query).size());
+        }).SetItemsPerOp(count);
+
+        uint64_t index = 0;
+        context.Run("find_by_name", [&]() {
+            DoNotOptimize(pScene->Find(names[index++ % count]));
+        });
+
+        /// ссылка на последний объект: кеш проверяется по поколению, разрешение идет через поиск по id
+        EntityRef reference(gameObjects.front().StaticCast<Entity>());
+        reference.SetPathTo(gameObjects.back().StaticCast<Entity>());
+
+        context.Run("entity_ref_cached", [&]() {
+            DoNotOptimize(reference.GetGameObject());
+        });
+
+        const EntityId targetId = gameObjects.back()->GetEntityId();
+
+        EntityRef resolving(gameObjects.front().StaticCast<Entity>());
+        context.Run("entity_ref_resolve", [&]() {
+            resolving.SetTargetId(targetId);
+            resolving.UpdateTarget();
+            DoNotOptimize(resolving.GetTarget());
+        });
+
+        reference = EntityRef();
+        resolving = EntityRef();
+        gameObjects.clear();
+
+        pScene->Destroy();
+    }
+}
@@ -0,0 +1,253 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include "Benchmark.h"
+
+#include <Utils/Math/Noise.h>
+#include <Utils/Localization/Transcode.h>
+#include <Utils/Platform/Platform.h>
+
+#include <filesystem>
+
+namespace SR_UTILS_NS::Benchmarks {
+    namespace {
+        double_t GetPercentile(const std::vector<double_t>& sorted, double_t percentile) {
+            if (sorted.empty()) {
+                return 0.0;
+            }
+
+            /// ближайший ранг, как и в MetricHistogram
+            const auto rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double_t>(sorted.size())));
+            return sorted[std::clamp<uint64_t>(rank, 1, sorted.size()) - 1];
+        }
+
+        std::string EscapeJson(std::string_view text) {
+            std::string escaped;
+            escaped.reserve(text.size());
+
+            for (const char symbol : text) {
+                switch (symbol) {
+                    case '"': escaped += "\\\""; break;
+                    case '\\': escaped += "\\\\"; break;
+                    case '\n': escaped += "\\n"; break;
+                    case '\t': escaped += "\\t"; break;
+                    default:
+                        if (static_cast<uint8_t>(symbol) < 0x20) {
+                            escaped += SR_FORMAT("\\u{:04x}", static_cast<uint32_t>(static_cast<uint8_t>(symbol)));
+                        }
+                        else {
+                            escaped += symbol;
+                        }
+                        break;
+                }
+            }
+
+            return escaped;
+        }
+
+        double_t GetPerSecond(uint64_t perOp, double_t meanNs) {
+            return meanNs > 0.0 ? static_cast<double_t>(perOp) * 1e9 / meanNs : 0.0;
+        }
+    }
+
+    BenchmarkContext::BenchmarkContext(std::string_view group, const BenchmarkOptions& options)
+        : m_group(group)
+        , m_options(options)
+    { }
+
+    bool BenchmarkContext::IsEnabled(std::string_view name) const {
+        if (m_options.filter.empty()) {
+            return true;
+        }
+
+        return GetFullName(name).find(m_options.filter) != std::string::npos;
+    }
+
+    bool BenchmarkContext::IsAnyEnabled(std::initializer_list<std::string_view> names) const {
+        return std::any_of(names.begin(), names.end(), [this](std::string_view name) {
+            return IsEnabled(name);
+        });
+    }
+
+    std::string BenchmarkContext::GetFullName(std::string_view name) const {
+        return SR_FORMAT("{}.{}", m_group, name);
+    }
+
+    uint64_t BenchmarkContext::Scaled(uint64_t count) const {
+        return std::max<uint64_t>(1, static_cast<uint64_t>(static_cast<double_t>(count) * m_options.scale));
+    }
+
+    const Path& BenchmarkContext::GetTempDirectory() {
+        if (m_tempDirectory.IsEmpty()) {
+            std::error_code error;
+
+            auto&& directory = std::filesystem::temp_directory_path(error) / "SRBenchmarks" / m_group;
+            std::filesystem::remove_all(directory, error);
+            std::filesystem::create_directories(directory, error);
+
+            if (error) {
+                SR_ERROR("BenchmarkContext::GetTempDirectory() : failed to create \"{}\": {}", directory.string(), error.message());
+            }
+
+            m_tempDirectory = Path(directory.string());
+        }
+
+        return m_tempDirectory;
+    }
+
+    BenchmarkResult& BenchmarkContext::Report(std::string_view name) {
+        if (!IsEnabled(name)) {
+            return m_skipped;
+        }
+
+        auto&& result = m_results.emplace_back();
+        result.name = GetFullName(name);
+        return result;
+    }
+
+    void BenchmarkContext::Cleanup() {
+        if (m_tempDirectory.IsEmpty()) {
+            return;
+        }
+
+        std::error_code error;
+        std::filesystem::remove_all(m_tempDirectory.ToStringRef(), error);
+        m_tempDirectory = Path();
+    }
+
+    BenchmarkResult& BenchmarkContext::AddResult(std::string_view name, std::vector<double_t>& samples, uint64_t batch) {
+        auto&& result = m_results.emplace_back();
+        result.name = GetFullName(name);
+        result.samples = samples.size();
+        result.iterations = samples.size() * batch;
+
+        if (samples.empty()) {
+            return result;
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        double_t sum = 0.0;
+        for (const double_t sample : samples) {
+            sum += sample;
+        }
+
+        result.meanNs = sum / static_cast<double_t>(samples.size());
+        result.minNs = samples.front();
+        result.maxNs = samples.back();
+        result.p50Ns = GetPercentile(samples, 50.0);
+        result.p90Ns = GetPercentile(samples, 90.0);
+        result.p99Ns = GetPercentile(samples, 99.0);
+
+        return result;
+    }
+
+    void WriteResults(std::ostream& stream, const std::vector<BenchmarkResult>& results, BenchmarkFormat format) {
+        for (auto&& result : results) {
+            const double_t opsPerSecond = result.iterations > 0 ? GetPerSecond(1, result.meanNs) : 0.0;
+            const double_t itemsPerSecond = GetPerSecond(result.itemsPerOp, result.meanNs);
+            const double_t bytesPerSecond = GetPerSecond(result.bytesPerOp, result.meanNs);
+
+            switch (format) {
+                case BenchmarkFormat::JsonLines: {
+                    std::string counters;
+                    for (auto&& [counter, value] : result.counters) {
+                        counters += SR_FORMAT("{}\"{}\":{}", counters.empty() ? "" : ",", EscapeJson(counter), value);
+                    }
+
+                    stream << SR_FORMAT("{{\"name\":\"{}\",\"iterations\":{},\"samples\":{},\"mean_ns\":{:.3f},\"min_ns\":{:.3f},"
+                        "\"p50_ns\":{:.3f},\"p90_ns\":{:.3f},\"p99_ns\":{:.3f},\"max_ns\":{:.3f},\"ops_per_sec\":{:.3f},"
+                        "\"items_per_sec\":{:.3f},\"bytes_per_sec\":{:.3f},\"counters\":{{{}}}}}\n",
+                        EscapeJson(result.name), result.iterations, result.samples, result.meanNs, result.minNs,
+                        result.p50Ns, result.p90Ns, result.p99Ns, result.maxNs, opsPerSecond,
+                        itemsPerSecond, bytesPerSecond, counters
+                    );
+                    break;
+                }
+                case BenchmarkFormat::Csv: {
+                    std::string counters;
+                    for (auto&& [counter, value] : result.counters) {
+                        counters += SR_FORMAT("{}{}={}", counters.empty() ? "" : ";", counter, value);
+                    }
+
+                    stream << SR_FORMAT("{},{},{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f},\"{}\"\n",
+                        result.name, result.iterations, result.samples, result.meanNs, result.minNs,
+                        result.p50Ns, result.p90Ns, result.p99Ns, result.maxNs, opsPerSecond,
+                        itemsPerSecond, bytesPerSecond, counters
+                    );
+                    break;
+                }
+                case BenchmarkFormat::Text: {
+                    stream << SR_FORMAT("{:<56} {:>14.1f} ns/op  p50 {:>12.1f}  p99 {:>12.1f}",
+                        result.name, result.meanNs, result.p50Ns, result.p99Ns
+                    );
+
+                    if (result.itemsPerOp > 0) {
+                        stream << SR_FORMAT("  {:.3e} items/s", itemsPerSecond);
+                    }
+
+                    if (result.bytesPerOp > 0) {
+                        stream << SR_FORMAT("  {:.3f} GB/s", bytesPerSecond / 1e9);
+                    }
+
+                    for (auto&& [counter, value] : result.counters) {
+                        stream << SR_FORMAT("  {}={}", counter, value);
+                    }
+
+                    stream << '\n';
+                    break;
+                }
+                default:
+                    SRHalt("WriteResults() : unknown format!");
+                    return;
+            }
+        }
+
+        stream.flush();
+    }
+
+    void WriteEnvironment(std::ostream& stream, BenchmarkFormat format) {
+    #ifdef SR_DEBUG
+        constexpr std::string_view build = "Debug";
+    #else
+        constexpr std::string_view build = "Release";
+    #endif
+
+    #if defined(__clang__)
+        const std::string compiler = SR_FORMAT("clang {}.{}", __clang_major__, __clang_minor__);
+    #elif defined(__GNUC__)
+        const std::string compiler = SR_FORMAT("gcc {}.{}", __GNUC__, __GNUC_MINOR__);
+    #elif defined(_MSC_VER)
+        const std::string compiler = SR_FORMAT("msvc {}", _MSC_VER);
+    #else
+        const std::string compiler = "unknown";
+    #endif
+
+        auto&& topology = SR_PLATFORM_NS::GetCPUTopology();
+
+        switch (format) {
+            case BenchmarkFormat::JsonLines:
+                stream << SR_FORMAT("{{\"environment\":{{\"build\":\"{}\",\"compiler\":\"{}\",\"cpus\":{},\"cores\":{},"
+                    "\"packages\":{},\"noise_isa\":\"{}\",\"transcode_isa\":\"{}\"}}}}\n",
+                    build, compiler, topology.cpus.size(), topology.coreCount, topology.packageCount,
+                    SR_MATH_NS::GetNoiseInstructionSet(), SR_UTILS_NS::Localization::GetTranscodeInstructionSet()
+                );
+                break;
+            case BenchmarkFormat::Csv:
+                stream << "name,iterations,samples,mean_ns,min_ns,p50_ns,p90_ns,p99_ns,max_ns,ops_per_sec,items_per_sec,bytes_per_sec,counters\n";
+                break;
+            case BenchmarkFormat::Text:
+                stream << SR_FORMAT("{} build, {}, {} cpus / {} cores, noise {}, transcode {}\n",
+                    build, compiler, topology.cpus.size(), topology.coreCount,
+                    SR_MATH_NS::GetNoiseInstructionSet(), SR_UTILS_NS::Localization::GetTranscodeInstructionSet()
+                );
+                break;
+            default:
+                SRHalt("WriteEnvironment() : unknown format!");
+                break;
+        }
+
+        stream.flush();
+    }
+}
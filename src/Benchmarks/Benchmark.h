@@ -0,0 +1,220 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_COMMON_BENCHMARKS_BENCHMARK_H
+#define SR_COMMON_BENCHMARKS_BENCHMARK_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/FileSystem/Path.h>
+
+namespace SR_UTILS_NS::Benchmarks {
+    enum class BenchmarkFormat : uint8_t {
+        JsonLines, Csv, Text
+    };
+
+    struct BenchmarkOptions {
+        /// подстрока полного имени "группа.случай", пустая - все
+        std::string filter;
+        BenchmarkFormat format = BenchmarkFormat::JsonLines;
+        /// пустой - stdout
+        std::string output;
+        /// минимальное время замера одного случая
+        double_t minTimeMs = 250.0;
+        /// множитель размеров синтетических данных, 1.0 - размеры из описаний случаев
+        double_t scale = 1.0;
+        bool list = false;
+    };
+
+    struct BenchmarkResult {
+        std::string name;
+        /// сколько раз выполнена операция
+        uint64_t iterations = 0;
+        /// число замеров, по ним считаются перцентили
+        uint64_t samples = 0;
+
+        double_t meanNs = 0.0;
+        double_t minNs = 0.0;
+        double_t p50Ns = 0.0;
+        double_t p90Ns = 0.0;
+        double_t p99Ns = 0.0;
+        double_t maxNs = 0.0;
+
+        /// для пропускной способности: элементов и байт за одну операцию
+        uint64_t itemsPerOp = 0;
+        uint64_t bytesPerOp = 0;
+
+        std::vector<std::pair<std::string, double_t>> counters;
+
+        BenchmarkResult& SetItemsPerOp(uint64_t items) { itemsPerOp = items; return *this; }
+        BenchmarkResult& SetBytesPerOp(uint64_t bytes) { bytesPerOp = bytes; return *this; }
+        BenchmarkResult& AddCounter(std::string_view counter, double_t value) {
+            counters.emplace_back(std::string(counter), value);
+            return *this;
+        }
+    };
+
+    /// Не дает компилятору выбросить вычисление, результат которого не используется
+    template<typename T> SR_FORCE_INLINE void DoNotOptimize(const T& value) {
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+    #else
+        static volatile const void* pSink = nullptr;
+        pSink = &value;
+    #endif
+    }
+
+    SR_FORCE_INLINE void ClobberMemory() {
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+    #else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    #endif
+    }
+
+    /**
+     * Контекст группы бенчмарков. Run() сам подбирает размер пачки так, чтобы замер был заметно дольше
+     * разрешения часов, и повторяет пачки до minTimeMs. Перцентили считаются по средним пачек,
+     * поэтому для коротких операций они показывают разброс пачек, а не отдельных вызовов.
+     * Для тяжелых операций, которым нужна подготовка вне замера, есть RunWithSetup(): один вызов - один замер.
+    */
+    class BenchmarkContext : public NonCopyable {
+        using Clock = std::chrono::steady_clock;
+    public:
+        BenchmarkContext(std::string_view group, const BenchmarkOptions& options);
+
+    public:
+        SR_NODISCARD bool IsEnabled(std::string_view name) const;
+        /// для общей подготовки нескольких случаев: группы запускаются всегда, фильтруются только случаи
+        SR_NODISCARD bool IsAnyEnabled(std::initializer_list<std::string_view> names) const;
+        SR_NODISCARD std::string GetFullName(std::string_view name) const;
+
+        /// размер синтетических данных с учетом --scale, не меньше 1
+        SR_NODISCARD uint64_t Scaled(uint64_t count) const;
+
+        /// временная папка группы, удаляется вместе с содержимым после группы
+        SR_NODISCARD const Path& GetTempDirectory();
+
+        template<typename Fn> BenchmarkResult& Run(std::string_view name, Fn&& function) {
+            if (!IsEnabled(name)) {
+                return m_skipped;
+            }
+
+            /// прогрев и подбор пачки: растим ее, пока она не займет хотя бы 1/64 бюджета (но не меньше 20 мкс)
+            const double_t targetBatchNs = std::max(20'000.0, m_options.minTimeMs * 1e6 / 64.0);
+
+            uint64_t batch = 1;
+            while (true) {
+                const double_t elapsed = MeasureBatch(function, batch);
+                if (elapsed >= targetBatchNs || batch >= (1ULL << 30)) {
+                    break;
+                }
+
+                batch *= elapsed > 0.0 ? std::clamp<uint64_t>(static_cast<uint64_t>(targetBatchNs / elapsed), 2, 16) : 16;
+            }
+
+            std::vector<double_t> samples;
+            double_t totalNs = 0.0;
+
+            while ((totalNs < m_options.minTimeMs * 1e6 || samples.size() < MIN_SAMPLES) && samples.size() < MAX_SAMPLES) {
+                const double_t elapsed = MeasureBatch(function, batch);
+                totalNs += elapsed;
+                samples.emplace_back(elapsed / static_cast<double_t>(batch));
+            }
+
+            return AddResult(name, samples, batch);
+        }
+
+        template<typename Setup, typename Fn> BenchmarkResult& RunWithSetup(std::string_view name, uint32_t samplesCount, Setup&& setup, Fn&& function) {
+            if (!IsEnabled(name)) {
+                return m_skipped;
+            }
+
+            std::vector<double_t> samples;
+            samples.reserve(samplesCount);
+
+            for (uint32_t i = 0; i < samplesCount; ++i) {
+                setup();
+
+                const auto start = Clock::now();
+                function();
+                ClobberMemory();
+                samples.emplace_back(std::chrono::duration<double_t, std::nano>(Clock::now() - start).count());
+            }
+
+            return AddResult(name, samples, 1);
+        }
+
+        /// результат без замера времени, только со счетчиками (детерминизм, статистика и т.п.)
+        BenchmarkResult& Report(std::string_view name);
+
+        SR_NODISCARD const std::vector<BenchmarkResult>& GetResults() const noexcept { return m_results; }
+
+        void Cleanup();
+
+    private:
+        static constexpr uint64_t MIN_SAMPLES = 10;
+        static constexpr uint64_t MAX_SAMPLES = 100'000;
+
+        template<typename Fn> double_t MeasureBatch(Fn& function, uint64_t batch) {
+            const auto start = Clock::now();
+            for (uint64_t i = 0; i < batch; ++i) {
+                function();
+            }
+            ClobberMemory();
+            return std::chrono::duration<double_t, std::nano>(Clock::now() - start).count();
+        }
+
+        BenchmarkResult& AddResult(std::string_view name, std::vector<double_t>& samples, uint64_t batch);
+
+    private:
+        std::string m_group;
+        const BenchmarkOptions& m_options;
+        std::vector<BenchmarkResult> m_results;
+        /// результат отфильтрованного случая, чтобы вызывающему не проверять IsEnabled перед SetItemsPerOp
+        BenchmarkResult m_skipped;
+        Path m_tempDirectory;
+
+    };
+
+    using BenchmarkFunction = void(*)(BenchmarkContext& context);
+
+    struct BenchmarkGroup {
+        std::string_view name;
+        BenchmarkFunction function = nullptr;
+    };
+
+    class BenchmarkRegistry : public NonCopyable {
+    public:
+        static BenchmarkRegistry& Instance() {
+            static BenchmarkRegistry registry;
+            return registry;
+        }
+
+    public:
+        bool Register(std::string_view name, BenchmarkFunction function) {
+            m_groups.emplace_back(BenchmarkGroup { name, function });
+            return true;
+        }
+
+        SR_NODISCARD const std::vector<BenchmarkGroup>& GetGroups() const noexcept { return m_groups; }
+
+    private:
+        std::vector<BenchmarkGroup> m_groups;
+
+    };
+
+    /// печатает результаты в выбранном формате, строка на случай
+    void WriteResults(std::ostream& stream, const std::vector<BenchmarkResult>& results, BenchmarkFormat format);
+    /// сведения о сборке и машине, первой строкой вывода
+    void WriteEnvironment(std::ostream& stream, BenchmarkFormat format);
+}
+
+/// Группа регистрируется при статической инициализации, имя группы - префикс имен ее случаев
+#define SR_BENCHMARK_GROUP(function, groupName)                                                                         \
+    static void function(SR_UTILS_NS::Benchmarks::BenchmarkContext& context);                                          \
+    SR_MAYBE_UNUSED static const bool SR_MACRO_CONCAT(srBenchmarkRegistered, function) =                               \
+        SR_UTILS_NS::Benchmarks::BenchmarkRegistry::Instance().Register(groupName, &function);                         \
+    static void function(SR_UTILS_NS::Benchmarks::BenchmarkContext& context)
+
+#endif //SR_COMMON_BENCHMARKS_BENCHMARK_H
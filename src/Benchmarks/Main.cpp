@@ -0,0 +1,177 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include "Benchmark.h"
+
+#include <Utils/Types/Thread.h>
+#include <Utils/Common/Singleton.h>
+#include <Utils/Settings.h>
+
+#include <fstream>
+#include <filesystem>
+
+namespace SR_UTILS_NS::Benchmarks {
+    namespace {
+        void PrintUsage() {
+            std::cout <<
+                "Usage: SR_UTILS_BENCHMARKS [options]\n"
+                "  --filter <text>     run only cases whose full name (group.case) contains the text\n"
+                "  --format <f>        jsonl (default), csv or text\n"
+                "  --out <path>        write results to a file instead of stdout (log messages always go to stdout)\n"
+                "  --min-time <ms>     minimal measuring time per case, default 250\n"
+                "  --scale <factor>    multiply synthetic data sizes, default 1.0\n"
+                "  --list              print group names and exit\n";
+        }
+
+        bool ParseOptions(int argc, char** argv, BenchmarkOptions& options) {
+            for (int i = 1; i < argc; ++i) {
+                const std::string_view argument = argv[i];
+                const bool hasValue = i + 1 < argc;
+
+                if (argument == "--filter" && hasValue) {
+                    options.filter = argv[++i];
+                }
+                else if (argument == "--format" && hasValue) {
+                    const std::string_view format = argv[++i];
+                    if (format == "jsonl" || format == "json") {
+                        options.format = BenchmarkFormat::JsonLines;
+                    }
+                    else if (format == "csv") {
+                        options.format = BenchmarkFormat::Csv;
+                    }
+                    else if (format == "text") {
+                        options.format = BenchmarkFormat::Text;
+                    }
+                    else {
+                        std::cerr << "Unknown format: " << format << '\n';
+                        return false;
+                    }
+                }
+                else if (argument == "--out" && hasValue) {
+                    options.output = argv[++i];
+                }
+                else if (argument == "--min-time" && hasValue) {
+                    options.minTimeMs = std::max(1.0, std::atof(argv[++i]));
+                }
+                else if (argument == "--scale" && hasValue) {
+                    options.scale = std::max(0.0001, std::atof(argv[++i]));
+                }
+                else if (argument == "--list") {
+                    options.list = true;
+                }
+                else {
+                    PrintUsage();
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool IsGroupSelected(std::string_view group, std::string_view filter) {
+            if (group.find(filter) != std::string_view::npos) {
+                return true;
+            }
+
+            return filter.size() > group.size() && filter.starts_with(group) && filter[group.size()] == '.';
+        }
+
+        /// объекты сцены при создании читают слои и теги из Engine/Configs, поэтому папка ресурсов
+        /// общая на весь прогон, а не временная папка группы
+        bool InitResources() {
+            std::error_code error;
+
+            auto&& folder = std::filesystem::temp_directory_path(error) / "SRBenchmarks" / "Resources";
+            auto&& configs = folder / "Engine" / "Configs";
+            std::filesystem::create_directories(configs, error);
+
+            if (error) {
+                SR_ERROR("Benchmarks::InitResources() : failed to create \"{}\": {}", configs.string(), error.message());
+                return false;
+            }
+
+            std::ofstream(configs / "Layers.xml", std::ios::trunc) << "<Settings><Default Name=\"Default\"/><Layers><Default/></Layers></Settings>\n";
+            std::ofstream(configs / "TagManagerSettings.xml", std::ios::trunc) << "<Settings><Tags/></Settings>\n";
+
+            auto&& manager = ResourceManager::Instance();
+            manager.Init(Path(folder.string()));
+            manager.RegisterType<Settings>();
+
+            return true;
+        }
+    }
+
+    int Run(int argc, char** argv) {
+        BenchmarkOptions options;
+        if (!ParseOptions(argc, argv, options)) {
+            return 1;
+        }
+
+        auto groups = BenchmarkRegistry::Instance().GetGroups();
+        std::sort(groups.begin(), groups.end(), [](const BenchmarkGroup& left, const BenchmarkGroup& right) {
+            return left.name < right.name;
+        });
+
+        if (options.list) {
+            for (auto&& group : groups) {
+                std::cout << group.name << '\n';
+            }
+            return 0;
+        }
+
+        /// группы готовят данные до первого замера, поэтому фильтр по группе отсекает их целиком,
+        /// а фильтр только по имени замера ("find_hit") по-прежнему проходит по всем группам
+        const bool isGroupFilter = !options.filter.empty() && std::any_of(groups.begin(), groups.end(), [&options](const BenchmarkGroup& group) {
+            return IsGroupSelected(group.name, options.filter);
+        });
+
+        if (isGroupFilter) {
+            groups.erase(std::remove_if(groups.begin(), groups.end(), [&options](const BenchmarkGroup& group) {
+                return !IsGroupSelected(group.name, options.filter);
+            }), groups.end());
+        }
+
+        std::error_code error;
+        auto&& logPath = std::filesystem::temp_directory_path(error) / "SRBenchmarks.log";
+
+        Debug::Instance().Init(logPath.string(), false);
+        Debug::Instance().SetLevel(Debug::Level::None);
+
+        SR_HTYPES_NS::Thread::Factory::Instance().SetMainThread();
+
+        if (!InitResources()) {
+            return 1;
+        }
+
+        std::ofstream file;
+        if (!options.output.empty()) {
+            file.open(options.output, std::ios::out | std::ios::trunc);
+            if (!file.is_open()) {
+                SR_ERROR("Benchmarks::Run() : failed to open \"{}\"", options.output);
+                return 1;
+            }
+        }
+
+        std::ostream& stream = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+
+        WriteEnvironment(stream, options.format);
+
+        for (auto&& group : groups) {
+            BenchmarkContext context(group.name, options);
+            group.function(context);
+            context.Cleanup();
+
+            /// результаты пишутся по группам, чтобы долгий прогон можно было читать по ходу
+            WriteResults(stream, context.GetResults(), options.format);
+        }
+
+        SR_UTILS_NS::GetSingletonManager()->DestroyAll();
+
+        return 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    return SR_UTILS_NS::Benchmarks::Run(argc, argv);
+}
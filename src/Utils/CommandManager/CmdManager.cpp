@@ -11,34 +11,122 @@ namespace SR_UTILS_NS {
         Close();
     }
 
-    bool CmdManager::Execute(ReversibleCommand *cmd) {
-        SR_TRACY_ZONE;
+    CmdManager::HistoryEntry& CmdManager::HistoryAt(uint32_t index) {
+        return m_history[(m_historyBegin + index) % m_history.size()];
+    }
 
-        if (m_historyPC != UINT32_MAX) {
-            /// если следущая команада будет перезаписывать историю,
-            /// например когда мы отменили действия, и пытаемся сделать что-то другое,
-            /// то нум нужно затереть все отмененные изменения,
-            /// это нельзя делать сразу, так как мы можем вернуть изменения без перезаписи
-            while(m_history.size() - 1 != m_historyPC) {
-                auto&& pIt = std::prev(m_history.end());
-                delete *pIt;
-                m_history.erase(pIt);
-            }
+    void CmdManager::PushHistory(ReversibleCommand* cmd) {
+        if (m_history.empty()) {
+            SetHistoryCapacity(m_maxHistorySize);
         }
 
-        m_history.emplace_back(cmd);
-        ++m_historyPC;
-
         /// если происходит переполнение истории,
         /// то нужно удалить самый первый элемент
-        if (m_historyPC >= m_maxHistorySize) {
-            auto&& pIt = m_history.begin();
-            delete *pIt;
-            m_history.erase(pIt);
+        if (m_historySize == m_history.size()) {
+            PopHistoryFront();
+        }
+
+        auto&& entry = HistoryAt(m_historySize);
+        entry.pCmd = cmd;
+        entry.memory = cmd->GetMemorySize();
+
+        m_historyMemory += entry.memory;
+        ++m_historySize;
+        ++m_historyPC;
+
+        TrimHistory();
+    }
+
+    void CmdManager::PopHistoryFront() {
+        auto&& entry = HistoryAt(0);
+
+        m_historyMemory -= entry.memory;
+        SR_SAFE_DELETE_PTR(entry.pCmd)
+        entry.memory = 0;
+
+        m_historyBegin = (m_historyBegin + 1) % m_history.size();
+        --m_historySize;
+
+        if (m_historyPC > 0) {
+            --m_historyPC;
+        }
+    }
+
+    void CmdManager::DropRedoHistory() {
+        /// если следущая команада будет перезаписывать историю,
+        /// например когда мы отменили действия, и пытаемся сделать что-то другое,
+        /// то нум нужно затереть все отмененные изменения,
+        /// это нельзя делать сразу, так как мы можем вернуть изменения без перезаписи
+        while (m_historySize > m_historyPC) {
+            auto&& entry = HistoryAt(m_historySize - 1);
+
+            m_historyMemory -= entry.memory;
+            SR_SAFE_DELETE_PTR(entry.pCmd)
+            entry.memory = 0;
+
+            --m_historySize;
+        }
+    }
+
+    void CmdManager::TrimHistory() {
+        /// последнюю команду оставляем всегда, даже если она одна не влезает в бюджет
+        while (m_historySize > 1 && m_historyMemory > m_maxHistoryMemory) {
+            PopHistoryFront();
+        }
+    }
+
+    void CmdManager::SetHistoryCapacity(uint32_t capacity) {
+        capacity = SR_MAX(capacity, 1u);
+
+        while (m_historySize > capacity) {
+            PopHistoryFront();
+        }
+
+        std::vector<HistoryEntry> history(capacity);
+
+        for (uint32_t i = 0; i < m_historySize; ++i) {
+            history[i] = HistoryAt(i);
         }
 
+        m_history = std::move(history);
+        m_historyBegin = 0;
+    }
+
+    bool CmdManager::Execute(ReversibleCommand *cmd) {
+        SR_TRACY_ZONE;
+
+        DropRedoHistory();
+
         m_lastCmdName = cmd->GetName();
-        return cmd->Redo();
+
+        /// неудачная правка не попадает в историю и не склеивается с предыдущей,
+        /// следующая правка тоже начинает новую запись
+        if (!cmd->Redo()) {
+            delete cmd;
+            m_canMerge = false;
+            return false;
+        }
+
+        /// непрерывные правки (например, перетаскивание) склеиваются в одну команду истории
+        if (m_canMerge && m_historySize > 0) {
+            auto&& last = HistoryAt(m_historySize - 1);
+            if (last.pCmd->Merge(cmd)) {
+                delete cmd;
+
+                m_historyMemory -= last.memory;
+                last.memory = last.pCmd->GetMemorySize();
+                m_historyMemory += last.memory;
+
+                TrimHistory();
+
+                return true;
+            }
+        }
+
+        PushHistory(cmd);
+        m_canMerge = true;
+
+        return true;
     }
 
     bool CmdManager::DoCmd(const Cmd& cmd) {
@@ -46,30 +134,32 @@ namespace SR_UTILS_NS {
 
         switch (cmd.m_type) {
             case CmdType::Redo: {
-                if ((m_historyPC >= (m_history.size() - 1) && m_historyPC != UINT32_MAX) || m_history.empty()) {
+                if (m_historyPC >= m_historySize) {
                     SR_INFO("CmdManager::DoCmd() : have no commands to redo!");
                     return true;
                 }
 
-                auto&& pNextCmp = m_history[++m_historyPC];
+                m_canMerge = false;
+
+                auto&& pNextCmp = HistoryAt(m_historyPC++).pCmd;
                 m_lastCmdName = pNextCmp->GetName();
 
                 return pNextCmp->Redo();
             }
             case CmdType::Undo: {
-                if (m_history.empty() || m_historyPC == UINT32_MAX) {
+                if (m_historyPC == 0) {
                     SR_INFO("CmdManager::DoCmd() : have no commands to undo!");
                     return true;
                 }
 
-                if (m_historyPC >= m_history.size()) {
+                if (m_historyPC > m_historySize) {
                     SRHalt("Invalid history PC!");
                     return false;
                 }
 
-                auto&& pPrevCmd = m_history[m_historyPC];
+                m_canMerge = false;
 
-                --m_historyPC;
+                auto&& pPrevCmd = HistoryAt(--m_historyPC).pCmd;
                 m_lastCmdName = pPrevCmd->GetName();
 
                 return pPrevCmd->Undo();
@@ -85,34 +175,57 @@ namespace SR_UTILS_NS {
 
     bool CmdManager::Execute(ReversibleCommand *cmd, SyncType sync) {
         SR_TRACY_ZONE;
+
+        if (sync == SyncType::Async) {
+            Push(cmd, CmdType::Execute);
+            return true;
+        }
+
         SR_LOCK_GUARD;
 
-        if (m_historyPC != UINT32_MAX) {
-            for (uint32_t PC = m_history.size() - 1; PC > m_historyPC; --PC) {
-                SR_SAFE_DELETE_PTR(m_history[PC])
-            }
+        return ExecuteImpl(cmd, sync);
+    }
 
-            m_history.resize(m_historyPC + 1);
+    void CmdManager::Push(ReversibleCommand* cmd, CmdType type) {
+        auto&& pNode = new Cmd { cmd, type, m_pending.load(std::memory_order_relaxed) };
+        while (!m_pending.compare_exchange_weak(pNode->m_next, pNode, std::memory_order_release, std::memory_order_relaxed)) {
+            /// pNode->m_next обновлен текущей вершиной
         }
-        else {
-            for (auto&& pCommand : m_history) {
-                SR_SAFE_DELETE_PTR(pCommand)
-            }
+    }
 
-            m_history.clear();
+    CmdManager::Cmd* CmdManager::TakePending() {
+        Cmd* pHead = m_pending.exchange(nullptr, std::memory_order_acquire);
+
+        /// стек хранит команды в обратном порядке
+        Cmd* pOrdered = nullptr;
+        while (pHead) {
+            Cmd* pNext = pHead->m_next;
+            pHead->m_next = pOrdered;
+            pOrdered = pHead;
+            pHead = pNext;
         }
 
-        return ExecuteImpl(cmd, sync);
+        return pOrdered;
+    }
+
+    void CmdManager::ProcessPending() {
+        /// команды могут отправлять новые команды во время выполнения
+        while (Cmd* pCmd = TakePending()) {
+            while (pCmd) {
+                SRVerifyFalse2(!DoCmd(*pCmd), "Failed to execute command!");
+
+                Cmd* pNext = pCmd->m_next;
+                delete pCmd;
+                pCmd = pNext;
+            }
+        }
     }
 
     void CmdManager::Update() {
         SR_TRACY_ZONE;
         SR_LOCK_GUARD;
 
-        while (!m_commands.empty()) {
-            SRVerifyFalse2(!DoCmd(m_commands.front()), "Failed to execute command!");
-            m_commands.pop();
-        }
+        ProcessPending();
     }
 
     bool CmdManager::Close() {
@@ -128,18 +241,13 @@ namespace SR_UTILS_NS {
 
         switch (sync) {
             case SyncType::Async: {
-                m_commands.push({cmd, CmdType::Execute});
+                Push(cmd, CmdType::Execute);
                 result = true;
                 break;
             }
             case SyncType::Sync: {
-                while (!m_commands.empty()) {
-                    // TODO: check result
-                    DoCmd(m_commands.front());
-                    m_commands.pop();
-                }
-
-                result = DoCmd({cmd, CmdType::Execute});
+                ProcessPending();
+                result = DoCmd({ cmd, CmdType::Execute, nullptr });
                 break;
             }
             case SyncType::Force:
@@ -147,6 +255,8 @@ namespace SR_UTILS_NS {
                 /// так как она выполнилась ни синхронно,
                 /// ни асинхронно, следовательно она нарушит историю,
                 /// поэтому отменить ее нельзя
+                DropRedoHistory();
+                m_canMerge = false;
                 result = cmd->Redo();
                 delete cmd;
                 break;
@@ -160,37 +270,76 @@ namespace SR_UTILS_NS {
     void CmdManager::Clear() {
         SR_LOCK_GUARD;
 
-        while (!m_commands.empty()) {
-            m_history.emplace_back(m_commands.front().m_cmd);
-            m_commands.pop();
+        while (Cmd* pCmd = TakePending()) {
+            while (pCmd) {
+                Cmd* pNext = pCmd->m_next;
+                SR_SAFE_DELETE_PTR(pCmd->m_cmd)
+                delete pCmd;
+                pCmd = pNext;
+            }
         }
 
-        for (auto&& pCommand : m_history) {
-            SR_SAFE_DELETE_PTR(pCommand)
+        for (auto&& entry : m_history) {
+            SR_SAFE_DELETE_PTR(entry.pCmd)
         }
 
         m_history.clear();
-        m_historyPC = UINT32_MAX;
+        m_historyBegin = 0;
+        m_historySize = 0;
+        m_historyPC = 0;
+        m_historyMemory = 0;
+        m_canMerge = false;
     }
 
     bool CmdManager::Redo() {
+        Push(nullptr, CmdType::Redo);
+        return true;
+    }
+
+    bool CmdManager::Cancel() {
+        Push(nullptr, CmdType::Undo);
+        return true;
+    }
+
+    void CmdManager::SetMaxHistorySize(uint32_t size) {
         SR_LOCK_GUARD;
 
-        m_commands.push({ nullptr, CmdType::Redo });
+        m_maxHistorySize = SR_MAX(size, 1u);
 
-        return true;
+        if (!m_history.empty()) {
+            SetHistoryCapacity(m_maxHistorySize);
+        }
     }
 
-    bool CmdManager::Cancel() {
+    void CmdManager::SetMaxHistoryMemory(uint64_t bytes) {
+        SR_LOCK_GUARD;
+
+        m_maxHistoryMemory = bytes;
+        TrimHistory();
+    }
+
+    uint32_t CmdManager::GetHistorySize() const {
         SR_LOCK_GUARD;
+        return m_historySize;
+    }
 
-        m_commands.push({ nullptr, CmdType::Undo });
+    uint64_t CmdManager::GetHistoryMemory() const {
+        SR_LOCK_GUARD;
+        return m_historyMemory;
+    }
 
-        return true;
+    bool CmdManager::CanUndo() const {
+        SR_LOCK_GUARD;
+        return m_historyPC > 0;
+    }
+
+    bool CmdManager::CanRedo() const {
+        SR_LOCK_GUARD;
+        return m_historyPC < m_historySize;
     }
 
     std::string CmdManager::GetLastCmdName() const {
         SR_LOCK_GUARD;
         return m_lastCmdName;
     }
-}
\ No newline at end of file
+}
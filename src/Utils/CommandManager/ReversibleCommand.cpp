@@ -31,5 +31,86 @@ namespace SR_UTILS_NS {
         return true;
     }
 
+    uint64_t GroupCommand::GetMemorySize() const {
+        uint64_t size = sizeof(GroupCommand) + m_commands.capacity() * sizeof(ReversibleCommand*);
 
-}
\ No newline at end of file
+        for (ReversibleCommand* command : m_commands) {
+            size += command->GetMemorySize();
+        }
+
+        return size;
+    }
+
+    StateDelta::StateDelta(std::string_view before, std::string_view after) {
+        const uint64_t minSize = SR_MIN(before.size(), after.size());
+
+        while (m_prefixSize < minSize && before[m_prefixSize] == after[m_prefixSize]) {
+            ++m_prefixSize;
+        }
+
+        while (m_suffixSize < minSize - m_prefixSize &&
+            before[before.size() - m_suffixSize - 1] == after[after.size() - m_suffixSize - 1]
+        ) {
+            ++m_suffixSize;
+        }
+
+        m_before = before.substr(m_prefixSize, before.size() - m_prefixSize - m_suffixSize);
+        m_after = after.substr(m_prefixSize, after.size() - m_prefixSize - m_suffixSize);
+    }
+
+    std::string StateDelta::Apply(std::string_view state, const std::string& middle, uint64_t stateMiddleSize) const {
+        if (state.size() != m_prefixSize + m_suffixSize + stateMiddleSize) {
+            SRHalt("StateDelta::Apply() : state does not match the delta!");
+            return std::string(state);
+        }
+
+        std::string result;
+        result.reserve(m_prefixSize + middle.size() + m_suffixSize);
+        result.append(state.substr(0, m_prefixSize));
+        result.append(middle);
+        result.append(state.substr(state.size() - m_suffixSize));
+
+        return result;
+    }
+
+    std::string StateDelta::ApplyBackward(std::string_view after) const {
+        return Apply(after, m_before, m_after.size());
+    }
+
+    std::string StateDelta::ApplyForward(std::string_view before) const {
+        return Apply(before, m_after, m_before.size());
+    }
+
+    StateDeltaCommand::StateDeltaCommand(uint64_t target, std::string_view before, std::string_view after)
+        : m_target(target)
+        , m_delta(before, after)
+    { }
+
+    bool StateDeltaCommand::Redo() {
+        return SetState(m_delta.ApplyForward(GetState()));
+    }
+
+    bool StateDeltaCommand::Undo() {
+        return SetState(m_delta.ApplyBackward(GetState()));
+    }
+
+    bool StateDeltaCommand::Merge(ReversibleCommand* pNext) {
+        auto&& pDeltaCmd = dynamic_cast<StateDeltaCommand*>(pNext);
+        if (!pDeltaCmd || pDeltaCmd->m_target != m_target || typeid(*pDeltaCmd) != typeid(*this)) {
+            return false;
+        }
+
+        /// pNext уже выполнена, поэтому текущее состояние - "после" для pNext,
+        /// а "до" восстанавливается обратным проходом по обеим разницам
+        const std::string after = GetState();
+        const std::string before = m_delta.ApplyBackward(pDeltaCmd->m_delta.ApplyBackward(after));
+
+        m_delta = StateDelta(before, after);
+
+        return true;
+    }
+
+    uint64_t StateDeltaCommand::GetMemorySize() const {
+        return sizeof(StateDeltaCommand) + m_delta.GetMemorySize();
+    }
+}
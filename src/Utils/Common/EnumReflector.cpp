@@ -31,27 +31,87 @@ namespace SR_UTILS_NS {
         SR_SAFE_DELETE_PTR(m_data)
     }
 
-    bool EnumReflector::IsIdentChar(char c) {
-        return (c >= 'A' && c <= 'Z') ||
-               (c >= 'a' && c <= 'z') ||
-               (c >= '0' && c <= '9') ||
-               (c == '_');
-    }
-
     void EnumReflector::ErrorInternal(const std::string& msg) {
         SRHalt(msg);
     }
 
+    void EnumReflector::BuildValueIndex() {
+        auto&& values = m_data->values;
+
+        m_data->denseIndices.clear();
+        m_data->sortedValues.clear();
+
+        if (values.empty()) {
+            return;
+        }
+
+        int64_t minValue = values.front().value;
+        int64_t maxValue = values.front().value;
+
+        for (auto&& enumerator : values) {
+            minValue = std::min(minValue, enumerator.value);
+            maxValue = std::max(maxValue, enumerator.value);
+        }
+
+        /// при повторяющихся значениях (Esc = 27, Escape = 27) побеждает первое, как и при линейном поиске
+        const uint64_t range = static_cast<uint64_t>(maxValue - minValue) + 1;
+        if (range <= std::max<uint64_t>(256, values.size() * 4)) {
+            m_data->minValue = minValue;
+            m_data->denseIndices.assign(range, SR_UINT32_MAX);
+
+            for (uint32_t i = 0; i < values.size(); ++i) {
+                auto&& index = m_data->denseIndices[values[i].value - minValue];
+                if (index == SR_UINT32_MAX) {
+                    index = i;
+                }
+            }
+
+            return;
+        }
+
+        m_data->sortedValues.reserve(values.size());
+
+        for (uint32_t i = 0; i < values.size(); ++i) {
+            m_data->sortedValues.emplace_back(values[i].value, i);
+        }
+
+        std::stable_sort(m_data->sortedValues.begin(), m_data->sortedValues.end(), [](auto&& lhs, auto&& rhs) {
+            return lhs.first < rhs.first;
+        });
+    }
+
+    std::optional<uint32_t> EnumReflector::FindByValue(int64_t value) const {
+        if (!m_data->denseIndices.empty()) {
+            const uint64_t offset = static_cast<uint64_t>(value - m_data->minValue);
+            if (value < m_data->minValue || offset >= m_data->denseIndices.size()) {
+                return std::nullopt;
+            }
+
+            const uint32_t index = m_data->denseIndices[offset];
+            return index == SR_UINT32_MAX ? std::nullopt : std::optional<uint32_t>(index);
+        }
+
+        auto&& sorted = m_data->sortedValues;
+
+        auto&& pIt = std::lower_bound(sorted.begin(), sorted.end(), value, [](auto&& pair, int64_t v) {
+            return pair.first < v;
+        });
+
+        if (pIt == sorted.end() || pIt->first != value) {
+            return std::nullopt;
+        }
+
+        return pIt->second;
+    }
+
     std::optional<SR_UTILS_NS::StringAtom> EnumReflector::ToStringInternal(int64_t value) const {
         if (!m_data) {
             std::cerr << "EnumReflector::ToStringInternal() : reflector is empty!\n";
             return std::nullopt;
         }
 
-        for (auto&& enumerator : m_data->values) {
-            if (enumerator.value == value) {
-                return enumerator.name;
-            }
+        if (auto&& index = FindByValue(value); index.has_value()) {
+            return m_data->names[index.value()];
         }
 
         return std::nullopt;
@@ -63,23 +123,19 @@ namespace SR_UTILS_NS {
             return std::nullopt;
         }
 
-        for (auto&& enumerator : m_data->values) {
-            if (enumerator.hashName == name.GetHash()) {
-                return enumerator.value;
-            }
+        const uint64_t hash = name.GetHash();
+
+        auto&& pIt = std::lower_bound(m_data->byHash.begin(), m_data->byHash.end(), EnumReflectorDetails::HashIndex { hash, 0 });
+        if (pIt == m_data->byHash.end() || pIt->hash != hash) {
+            return std::nullopt;
         }
 
-        return std::nullopt;
+        return m_data->values[pIt->index].value;
     }
 
     std::optional<int64_t> EnumReflector::GetIndexInternal(int64_t value) const {
-        int64_t index = 0;
-
-        for (auto&& enumerator : m_data->values) {
-            if (enumerator.value == value) {
-                return index;
-            }
-            ++index;
+        if (auto&& index = FindByValue(value); index.has_value()) {
+            return static_cast<int64_t>(index.value());
         }
 
         return std::nullopt;
@@ -99,15 +155,23 @@ namespace SR_UTILS_NS {
             return std::nullopt;
         }
 
-        const std::string lower = SR_UTILS_NS::StringUtils::ToLower(value);
+        const uint64_t hash = EnumReflectorDetails::ComputeLowerHash(value);
+
+        auto&& pIt = std::lower_bound(m_data->byLowerHash.begin(), m_data->byLowerHash.end(), EnumReflectorDetails::HashIndex { hash, 0 });
+
+        /// хеши нижнего регистра могут совпасть у разных имен, поэтому сверяем строку
+        for (; pIt != m_data->byLowerHash.end() && pIt->hash == hash; ++pIt) {
+            const std::string_view name = m_data->names[pIt->index].ToStringView();
 
-        for (auto&& enumerator : m_data->values) {
-            if (SR_UTILS_NS::StringUtils::ToLower(enumerator.name) == lower) {
-                return enumerator.value;
+            const bool equals = name.size() == value.size() && std::equal(name.begin(), name.end(), value.begin(), [](char lhs, char rhs) {
+                return EnumReflectorDetails::ToLower(lhs) == EnumReflectorDetails::ToLower(rhs);
+            });
+
+            if (equals) {
+                return m_data->values[pIt->index].value;
             }
         }
 
         return std::nullopt;
     }
 }
-
@@ -60,6 +60,11 @@ namespace SR_UTILS_NS {
         return m_strings.find(hash) != m_strings.end();
     }
 
+    uint64_t HashManager::GetCount() const {
+        SR_LOCK_GUARD;
+        return m_strings.size();
+    }
+
     StringHashInfo* HashManager::Register(std::string str, Hash hash) {
         SR_LOCK_GUARD;
 
@@ -89,7 +94,7 @@ namespace SR_UTILS_NS {
         if (auto&& pIt = m_strings.find(hash); pIt != m_strings.end()) {
             return pIt->second;
         }
-        return Register(str.data(), hash);
+        return Register(std::string(str), hash);
     }
 
     StringHashInfo* HashManager::GetOrAddInfo(const char* str) {
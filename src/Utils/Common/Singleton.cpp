@@ -3,6 +3,7 @@
 //
 
 #include <Utils/Common/Singleton.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 namespace SR_UTILS_NS {
     SingletonManager* GetSingletonManager() noexcept {
@@ -50,6 +51,8 @@ namespace SR_UTILS_NS {
                 ++pIt;
             }
         }
+
+        MemoryTracker::ReportLeaks();
     }
 
     void SingletonManager::Remove(StringAtom name) {
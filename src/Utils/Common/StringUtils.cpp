@@ -3,9 +3,15 @@
 //
 
 #include <Utils/Common/StringUtils.h>
+#include <Utils/Common/StringTokenizer.h>
 #include <Utils/Profile/TracyContext.h>
 #include <Utils/Debug.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SR_STRING_UTILS_SSE2 1
+    #include <emmintrin.h>
+#endif
+
 namespace SR_UTILS_NS {
     std::string StringUtils::GetExtensionFromFilePath(std::string path) {
         if (path.empty()) {
@@ -55,145 +61,202 @@ namespace SR_UTILS_NS {
         return result;
     }
 
-    glm::vec2 StringUtils::MakeVec2FromString(const char *source, char chr, unsigned short start) {
-        glm::vec2 position = glm::vec3();
-        unsigned char found_floats = 0;
-
-        unsigned short count = 0;
-        unsigned short found = start;
+    template<typename Vector> static Vector MakeVectorFromString(const char* source, char chr, unsigned short start) {
+        Vector vector = Vector();
 
-        static short t = 0;
-        static short len = 0;
-
-        len = FastStrLen(source);
+        const std::string_view view(source);
+        if (start >= view.size()) {
+            return vector;
+        }
 
-        for (t = start; t < len; t++) {
-            count++;
+        typename Vector::length_type index = 0;
+        for (auto&& token : StringTokenizer(view.substr(start), chr, false)) {
+            if (index == Vector::length()) {
+                break;
+            }
+            vector[index++] = StringUtils::ParseNumber<typename Vector::value_type>(token);
+        }
 
-            if (t + 1 == len) {
-                if (found_floats == 2)
-                    return position;
+        return vector;
+    }
 
-                char *temp = new char[count + 1];
-                strcpy(temp, "");
+    glm::vec2 StringUtils::MakeVec2FromString(const char *source, char chr, unsigned short start) {
+        return MakeVectorFromString<glm::vec2>(source, chr, start);
+    }
 
-                strncat(temp, source + found, count);
-                position[found_floats] = (float) atof(temp);
-                found_floats++;
+    glm::vec3 StringUtils::MakeVec3FromString(const char *source, char chr, unsigned short start) {
+        return MakeVectorFromString<glm::vec3>(source, chr, start);
+    }
 
-                delete[] temp;
+    std::string StringUtils::ReadFrom(const std::string &str, const char &c, uint32_t start) {
+        if (start >= str.size())
+            return std::string();
 
-                return position;
-            } else if (source[t] == chr) {
-                if (found_floats == 2) //if (found_floats + 1 == 2) - bug
-                    return position;
+        std::string newStr = str.substr(start, str.size() - 1);
 
-                char *temp = new char[count + 1];
-                strcpy(temp, "");
+        int32_t to = IndexOf(newStr, c);
+        if (to <= 0)
+            return std::string();
 
-                strncat(temp, source + found, count - 1);
-                position[found_floats] = (float) atof(temp);
-                found_floats++;
+        return newStr.substr(0, to);
+    }
 
-                delete[] temp;
+    std::vector<std::string> StringUtils::Split(std::string source, const std::string &delimiter)  {
+        std::vector<std::string> tokens = {};
+        for (auto&& token : StringTokenizer(source, delimiter)) {
+            tokens.emplace_back(token);
+        }
+        return tokens;
+    }
 
-                found = t + 1;
-                count = 0;
-            }
+    std::vector<std::string_view> StringUtils::SplitView(std::string_view source, std::string_view delimiter) {
+        std::vector<std::string_view> tokens = {};
+        for (auto&& token : StringTokenizer(source, delimiter)) {
+            tokens.emplace_back(token);
         }
-        return position;
+        return tokens;
     }
 
-    glm::vec3 StringUtils::MakeVec3FromString(const char *source, char chr, unsigned short start) {
-        glm::vec3 position = glm::vec3();
-        unsigned char found_floats = 0;
+    char** StringUtils::Split(const char* source, char chr, unsigned short start, unsigned short count_strs) {
+        const std::string_view view(source);
+        if (start >= view.size()) {
+            return nullptr;
+        }
 
-        unsigned short count = 0;
-        unsigned short found = start;
+        auto&& strs = new char*[count_strs]();
 
-        static short t = 0;
-        static short len = 0;
+        unsigned short index = 0;
+        for (auto&& token : StringTokenizer(view.substr(start), chr, false)) {
+            if (index == count_strs) {
+                break;
+            }
 
-        len = FastStrLen(source);
+            auto&& str = new char[token.size() + 1];
+            memcpy(str, token.data(), token.size());
+            str[token.size()] = '\0';
 
-        for (t = start; t < len; t++) {
-            count++;
+            strs[index++] = str;
+        }
 
-            if (t + 1 == len) {
-                if (found_floats == 3)
-                    return position;
+        return strs;
+    }
 
-                char *temp = new char[count + 1];
-                strcpy(temp, "");
+    float* StringUtils::SplitFloats(const char* source, char chr, unsigned short start, unsigned short count_floats) {
+        const std::string_view view(source);
+        if (start >= view.size()) {
+            return nullptr;
+        }
 
-                strncat(temp, source + found, count);
-                position[found_floats] = (float) atof(temp);
-                found_floats++;
+        auto&& floats = new float[count_floats]();
 
-                delete[] temp;
+        unsigned short index = 0;
+        for (auto&& token : StringTokenizer(view.substr(start), chr, false)) {
+            if (index == count_floats) {
+                break;
+            }
+            floats[index++] = ParseNumber<float>(token);
+        }
 
-                return position;
-            } else if (source[t] == chr) {
-                if (found_floats + 1 == 3)
-                    return position;
+        return floats;
+    }
 
-                char *temp = new char[count + 1];
-                strcpy(temp, "");
+    uint64_t StringUtils::Find(std::string_view str, char symbol, uint64_t offset) noexcept {
+        const char* pData = str.data();
+        const uint64_t size = str.size();
+        uint64_t i = offset;
 
-                strncat(temp, source + found, count - 1);
-                position[found_floats] = (float) atof(temp);
-                found_floats++;
+    #if defined(SR_STRING_UTILS_SSE2)
+        const __m128i needle = _mm_set1_epi8(symbol);
 
-                delete[] temp;
+        for (; i + 16 <= size; i += 16) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData + i));
+            const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+            if (mask != 0) {
+                return i + static_cast<uint64_t>(std::countr_zero(mask));
+            }
+        }
+    #endif
 
-                found = t + 1;
-                count = 0;
+        for (; i < size; ++i) {
+            if (pData[i] == symbol) {
+                return i;
             }
         }
-        return position;
+
+        return std::string_view::npos;
     }
 
-    std::string StringUtils::ReadFrom(const std::string &str, const char &c, uint32_t start) {
-        if (start >= str.size())
-            return std::string();
+    uint64_t StringUtils::Find(std::string_view str, std::string_view subStr, uint64_t offset) noexcept {
+        const uint64_t size = str.size();
+        const uint64_t subSize = subStr.size();
 
-        std::string newStr = str.substr(start, str.size() - 1);
+        if (subSize == 1) {
+            return Find(str, subStr.front(), offset);
+        }
 
-        int32_t to = IndexOf(newStr, c);
-        if (to <= 0)
-            return std::string();
+        if (subSize == 0 || offset > size || size - offset < subSize) {
+            return str.find(subStr, offset);
+        }
 
-        return newStr.substr(0, to);
-    }
+        uint64_t i = offset;
 
-    std::vector<std::string> StringUtils::Split(std::string source, const std::string &delimiter)  {
-        size_t pos = 0;
-        std::vector<std::string> tokens = {};
-        while ((pos = source.find(delimiter)) != std::string::npos) {
-            if (auto&& token = source.substr(0, pos); !token.empty())
-                tokens.emplace_back(std::move(token));
-            source.erase(0, pos + delimiter.length());
-        }
+    #if defined(SR_STRING_UTILS_SSE2)
+        /// кандидаты - позиции, где совпали и первый, и последний символ, середину сверяем только для них
+        const char* pData = str.data();
+        const __m128i first = _mm_set1_epi8(subStr.front());
+        const __m128i last = _mm_set1_epi8(subStr.back());
 
-        if (!source.empty())
-            tokens.emplace_back(source);
+        for (; i + subSize - 1 + 16 <= size; i += 16) {
+            const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData + i));
+            const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData + i + subSize - 1));
 
-        return tokens;
+            auto mask = static_cast<uint32_t>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last))
+            ));
+
+            while (mask != 0) {
+                const uint64_t position = i + static_cast<uint64_t>(std::countr_zero(mask));
+                if (memcmp(pData + position + 1, subStr.data() + 1, subSize - 2) == 0) {
+                    return position;
+                }
+                mask &= mask - 1;
+            }
+        }
+    #endif
+
+        return str.find(subStr, i);
     }
 
-    std::vector<std::string_view> StringUtils::SplitView(std::string_view source, std::string_view delimiter) {
-        size_t pos = 0;
-        std::vector<std::string_view> tokens = {};
-        while ((pos = source.find(delimiter)) != std::string::npos) {
-            if (auto&& token = source.substr(0, pos); !token.empty())
-                tokens.emplace_back(token);
-            source.remove_prefix(pos + delimiter.length());
+    /// Сдвигаем диапазон [first, first + 26) к нулю и переключаем 0x20 у попавших в него байт
+    static void FlipAsciiCase(char* pData, uint64_t size, char first) noexcept {
+        uint64_t i = 0;
+
+    #if defined(SR_STRING_UTILS_SSE2)
+        const __m128i offset = _mm_set1_epi8(first);
+        const __m128i maxIndex = _mm_set1_epi8(25);
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+
+        for (; i + 16 <= size; i += 16) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData + i));
+            const __m128i index = _mm_sub_epi8(block, offset);
+            const __m128i inRange = _mm_cmpeq_epi8(_mm_min_epu8(index, maxIndex), index);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pData + i), _mm_xor_si128(block, _mm_and_si128(inRange, caseBit)));
+        }
+    #endif
+
+        for (; i < size; ++i) {
+            if (static_cast<uint8_t>(pData[i] - first) < 26) {
+                pData[i] = static_cast<char>(pData[i] ^ 0x20);
+            }
         }
+    }
 
-        if (!source.empty())
-            tokens.emplace_back(source);
+    void StringUtils::ToLowerInPlace(char* pData, uint64_t size) noexcept {
+        FlipAsciiCase(pData, size, 'A');
+    }
 
-        return tokens;
+    void StringUtils::ToUpperInPlace(char* pData, uint64_t size) noexcept {
+        FlipAsciiCase(pData, size, 'a');
     }
 
     std::string StringUtils::Tab(std::string code, uint32_t count) {
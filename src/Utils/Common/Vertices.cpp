@@ -4,33 +4,710 @@
 
 #include <Utils/Common/Vertices.h>
 #include <Utils/Debug.h>
+#include <Utils/Profile/TracyContext.h>
 
-// #include <Hull/Coordinate.h>
-// #include <QuickHull/FastQuickHull.h>
+namespace SR_UTILS_NS::VerticesDetails {
+    struct HullVector {
+        double_t x, y, z;
+
+        HullVector operator-(const HullVector& other) const { return { x - other.x, y - other.y, z - other.z }; }
+
+        SR_NODISCARD double_t Dot(const HullVector& other) const { return x * other.x + y * other.y + z * other.z; }
+
+        SR_NODISCARD HullVector Cross(const HullVector& other) const {
+            return { y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x };
+        }
+
+        SR_NODISCARD double_t Length() const { return std::sqrt(Dot(*this)); }
+    };
+
+    struct HullFace {
+        uint32_t v[3] = { };
+        HullVector normal = { };
+        double_t distance = 0.0;
+        std::vector<uint32_t> outside;
+        uint32_t furthest = 0;
+        double_t furthestDistance = 0.0;
+        bool alive = true;
+    };
+
+    /// Quickhull: грани хранятся плоским массивом, соседство - через таблицу направленных ребер
+    class QuickHull {
+    public:
+        explicit QuickHull(std::span<const Vec3> positions)
+            : m_points(positions.size())
+        {
+            for (uint64_t i = 0; i < positions.size(); ++i) {
+                m_points[i] = { positions[i].x, positions[i].y, positions[i].z };
+            }
+        }
+
+        bool Build(uint32_t maxVertices) {
+            if (m_points.size() < 4) {
+                return false;
+            }
+
+            HullVector maxAbs = { };
+            for (auto&& point : m_points) {
+                maxAbs.x = std::max(maxAbs.x, std::abs(point.x));
+                maxAbs.y = std::max(maxAbs.y, std::abs(point.y));
+                maxAbs.z = std::max(maxAbs.z, std::abs(point.z));
+            }
+
+            /// исходные данные во float, поэтому допуск считается от его точности
+            m_epsilon = (maxAbs.x + maxAbs.y + maxAbs.z) * static_cast<double_t>(std::numeric_limits<float_t>::epsilon()) * 3.0;
+
+            if (!BuildSimplex()) {
+                return false;
+            }
+
+            uint32_t verticesCount = 4;
+
+            for (uint32_t faceId = 0; faceId < m_faces.size(); ++faceId) {
+                while (m_faces[faceId].alive && !m_faces[faceId].outside.empty()) {
+                    if (maxVertices >= 4 && verticesCount >= maxVertices) {
+                        return true;
+                    }
+
+                    AddPoint(faceId, m_faces[faceId].furthest);
+                    ++verticesCount;
+                }
+            }
+
+            return true;
+        }
+
+        void GetIndices(std::vector<uint32_t>& indices) const {
+            indices.clear();
+
+            for (auto&& face : m_faces) {
+                if (face.alive) {
+                    indices.insert(indices.end(), { face.v[0], face.v[1], face.v[2] });
+                }
+            }
+        }
+
+    private:
+        static uint64_t EdgeKey(uint32_t from, uint32_t to) {
+            return (static_cast<uint64_t>(from) << 32u) | to;
+        }
+
+        SR_NODISCARD double_t Distance(const HullFace& face, uint32_t point) const {
+            return face.normal.Dot(m_points[point]) - face.distance;
+        }
+
+        uint32_t AddFace(uint32_t a, uint32_t b, uint32_t c) {
+            HullFace face;
+            face.v[0] = a;
+            face.v[1] = b;
+            face.v[2] = c;
+
+            const HullVector normal = (m_points[b] - m_points[a]).Cross(m_points[c] - m_points[a]);
+            const double_t length = normal.Length();
+            face.normal = length > 0.0 ? HullVector { normal.x / length, normal.y / length, normal.z / length } : normal;
+            face.distance = face.normal.Dot(m_points[a]);
+
+            const auto faceId = static_cast<uint32_t>(m_faces.size());
+            m_faces.emplace_back(std::move(face));
+
+            m_edges[EdgeKey(a, b)] = faceId;
+            m_edges[EdgeKey(b, c)] = faceId;
+            m_edges[EdgeKey(c, a)] = faceId;
+
+            return faceId;
+        }
+
+        void RemoveFace(uint32_t faceId) {
+            auto&& face = m_faces[faceId];
+            face.alive = false;
+
+            for (uint32_t i = 0; i < 3; ++i) {
+                m_edges.erase(EdgeKey(face.v[i], face.v[(i + 1) % 3]));
+            }
+        }
+
+        void AssignPoint(const std::vector<uint32_t>& faces, uint32_t point) {
+            for (const uint32_t faceId : faces) {
+                auto&& face = m_faces[faceId];
+
+                const double_t distance = Distance(face, point);
+                if (distance <= m_epsilon) {
+                    continue;
+                }
+
+                if (face.outside.empty() || distance > face.furthestDistance) {
+                    face.furthest = point;
+                    face.furthestDistance = distance;
+                }
+
+                face.outside.emplace_back(point);
+                return;
+            }
+        }
+
+        bool BuildSimplex() {
+            /// крайние точки по осям, из них берется самая длинная пара
+            uint32_t extremes[6] = { };
+            for (uint32_t i = 0; i < m_points.size(); ++i) {
+                auto&& point = m_points[i];
+                if (point.x < m_points[extremes[0]].x) { extremes[0] = i; }
+                if (point.x > m_points[extremes[1]].x) { extremes[1] = i; }
+                if (point.y < m_points[extremes[2]].y) { extremes[2] = i; }
+                if (point.y > m_points[extremes[3]].y) { extremes[3] = i; }
+                if (point.z < m_points[extremes[4]].z) { extremes[4] = i; }
+                if (point.z > m_points[extremes[5]].z) { extremes[5] = i; }
+            }
+
+            uint32_t a = 0, b = 0;
+            double_t maxDistance = -1.0;
+            for (uint32_t i = 0; i < 6; ++i) {
+                for (uint32_t j = i + 1; j < 6; ++j) {
+                    const double_t distance = (m_points[extremes[i]] - m_points[extremes[j]]).Length();
+                    if (distance > maxDistance) {
+                        maxDistance = distance;
+                        a = extremes[i];
+                        b = extremes[j];
+                    }
+                }
+            }
+
+            if (maxDistance <= m_epsilon) {
+                return false;
+            }
+
+            /// самая удаленная от прямой ab
+            const HullVector direction = m_points[b] - m_points[a];
+            uint32_t c = 0;
+            maxDistance = -1.0;
+            for (uint32_t i = 0; i < m_points.size(); ++i) {
+                const double_t distance = direction.Cross(m_points[i] - m_points[a]).Length();
+                if (distance > maxDistance) {
+                    maxDistance = distance;
+                    c = i;
+                }
+            }
+
+            if (maxDistance / direction.Length() <= m_epsilon) {
+                return false;
+            }
+
+            /// самая удаленная от плоскости abc
+            HullVector normal = direction.Cross(m_points[c] - m_points[a]);
+            const double_t normalLength = normal.Length();
+            normal = { normal.x / normalLength, normal.y / normalLength, normal.z / normalLength };
+
+            uint32_t d = 0;
+            maxDistance = -1.0;
+            for (uint32_t i = 0; i < m_points.size(); ++i) {
+                const double_t distance = std::abs(normal.Dot(m_points[i] - m_points[a]));
+                if (distance > maxDistance) {
+                    maxDistance = distance;
+                    d = i;
+                }
+            }
+
+            if (maxDistance <= m_epsilon) {
+                return false;
+            }
+
+            /// d должна оказаться под гранью abc
+            if (normal.Dot(m_points[d] - m_points[a]) > 0.0) {
+                std::swap(b, c);
+            }
+
+            std::vector<uint32_t> faces = {
+                AddFace(a, b, c),
+                AddFace(a, d, b),
+                AddFace(b, d, c),
+                AddFace(c, d, a)
+            };
+
+            for (uint32_t i = 0; i < m_points.size(); ++i) {
+                if (i != a && i != b && i != c && i != d) {
+                    AssignPoint(faces, i);
+                }
+            }
+
+            return true;
+        }
+
+        void AddPoint(uint32_t startFace, uint32_t eye) {
+            /// обход видимых из точки граней от стартовой, невидимые соседи дают горизонт
+            std::vector<uint32_t> visible = { startFace };
+            std::vector<std::pair<uint32_t, uint32_t>> horizon;
+
+            m_visited.assign(m_faces.size(), false);
+            m_visited[startFace] = true;
+
+            for (uint32_t i = 0; i < visible.size(); ++i) {
+                const HullFace& face = m_faces[visible[i]];
+
+                for (uint32_t e = 0; e < 3; ++e) {
+                    const uint32_t from = face.v[e];
+                    const uint32_t to = face.v[(e + 1) % 3];
+
+                    auto&& pIt = m_edges.find(EdgeKey(to, from));
+                    if (pIt == m_edges.end()) {
+                        SRHalt("QuickHull::AddPoint() : broken hull topology!");
+                        continue;
+                    }
+
+                    const uint32_t neighbour = pIt->second;
+                    if (m_visited[neighbour]) {
+                        continue;
+                    }
+
+                    if (Distance(m_faces[neighbour], eye) > m_epsilon) {
+                        m_visited[neighbour] = true;
+                        visible.emplace_back(neighbour);
+                    }
+                    else {
+                        horizon.emplace_back(from, to);
+                    }
+                }
+            }
+
+            std::vector<uint32_t> orphans;
+            for (const uint32_t faceId : visible) {
+                auto&& outside = m_faces[faceId].outside;
+                orphans.insert(orphans.end(), outside.begin(), outside.end());
+                outside.clear();
+                outside.shrink_to_fit();
+            }
+
+            for (const uint32_t faceId : visible) {
+                RemoveFace(faceId);
+            }
+
+            std::vector<uint32_t> newFaces;
+            newFaces.reserve(horizon.size());
+
+            for (auto&& [from, to] : horizon) {
+                newFaces.emplace_back(AddFace(from, to, eye));
+            }
+
+            for (const uint32_t point : orphans) {
+                if (point != eye) {
+                    AssignPoint(newFaces, point);
+                }
+            }
+        }
+
+    private:
+        std::vector<HullVector> m_points;
+        std::vector<HullFace> m_faces;
+        std::unordered_map<uint64_t, uint32_t> m_edges;
+        std::vector<bool> m_visited;
+        double_t m_epsilon = 0.0;
+
+    };
+
+    /// Forsyth, "Linear-Speed Vertex Cache Optimisation"
+    static constexpr uint32_t VERTEX_CACHE_SIZE = 32;
+
+    float_t VertexScore(int32_t cachePosition, uint32_t liveTriangles) {
+        if (liveTriangles == 0) {
+            return -1.f;
+        }
+
+        float_t score = 0.f;
+
+        if (cachePosition >= 0) {
+            if (cachePosition < 3) {
+                score = 0.75f;
+            }
+            else {
+                const float_t scaler = 1.f / (VERTEX_CACHE_SIZE - 3);
+                score = std::pow(1.f - static_cast<float_t>(cachePosition - 3) * scaler, 1.5f);
+            }
+        }
+
+        return score + 2.f * std::pow(static_cast<float_t>(liveTriangles), -0.5f);
+    }
+
+    bool IsSameAttributes(const Vertex& a, const Vertex& b) {
+        if (a.uv.x != b.uv.x || a.uv.y != b.uv.y) { return false; }
+        if (a.normal.x != b.normal.x || a.normal.y != b.normal.y || a.normal.z != b.normal.z) { return false; }
+        if (a.tangent.x != b.tangent.x || a.tangent.y != b.tangent.y || a.tangent.z != b.tangent.z) { return false; }
+        if (a.bitangent.x != b.bitangent.x || a.bitangent.y != b.bitangent.y || a.bitangent.z != b.bitangent.z) { return false; }
+        if (a.weightsNum != b.weightsNum) { return false; }
+
+        for (uint32_t i = 0; i < SR_MAX_BONES_ON_VERTEX; ++i) {
+            if (a.weights[i].boneId != b.weights[i].boneId || a.weights[i].weight != b.weights[i].weight) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
 
 namespace SR_UTILS_NS {
     std::vector<Vertex> ComputeConvexHull(const std::vector<Vertex>& vertices) {
-        /*std::vector<hull::Coordinate> coordinates;
-        coordinates.reserve(vertices.size());
+        std::vector<Vec3> positions;
+        positions.reserve(vertices.size());
 
         for (auto&& vertex : vertices) {
-            coordinates.emplace_back(hull::Coordinate{vertex.position.x, vertex.position.y, vertex.position.z});
+            positions.emplace_back(vertex.position);
+        }
+
+        std::vector<uint32_t> indices;
+        if (!ComputeConvexHull(positions, indices)) {
+            return std::vector<Vertex>();
+        }
+
+        return IndexedVerticesToNonIndexed(vertices, indices);
+    }
+
+    bool ComputeConvexHull(std::span<const Vec3> positions, std::vector<uint32_t>& indices, uint32_t maxVertices) {
+        SR_TRACY_ZONE;
+
+        VerticesDetails::QuickHull hull(positions);
+
+        if (!hull.Build(maxVertices)) {
+            indices.clear();
+            return false;
+        }
+
+        hull.GetIndices(indices);
+
+        return true;
+    }
+
+    uint32_t WeldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, float_t epsilon) {
+        SR_TRACY_ZONE;
+
+        /// при нулевом epsilon сливаются только точные совпадения, размер ячейки тогда не важен
+        const float_t cellSize = epsilon > 0.f ? epsilon * 2.f : 1.f;
+        const float_t epsilon2 = epsilon * epsilon;
+
+        const auto cellKey = [](int64_t x, int64_t y, int64_t z) -> uint64_t {
+            return (static_cast<uint64_t>(x) * 73856093u) ^ (static_cast<uint64_t>(y) * 19349663u) ^ (static_cast<uint64_t>(z) * 83492791u);
+        };
+
+        std::unordered_multimap<uint64_t, uint32_t> cells;
+        cells.reserve(vertices.size());
+
+        std::vector<uint32_t> remap(vertices.size());
+        std::vector<Vertex> unique;
+        unique.reserve(vertices.size());
+
+        for (uint32_t i = 0; i < vertices.size(); ++i) {
+            const Vertex& vertex = vertices[i];
+
+            const auto cx = static_cast<int64_t>(std::floor(vertex.position.x / cellSize));
+            const auto cy = static_cast<int64_t>(std::floor(vertex.position.y / cellSize));
+            const auto cz = static_cast<int64_t>(std::floor(vertex.position.z / cellSize));
+
+            uint32_t found = SR_UINT32_MAX;
+
+            /// соседние ячейки проверяются, чтобы не потерять пары на границе ячейки
+            for (int64_t x = cx - 1; x <= cx + 1 && found == SR_UINT32_MAX; ++x) {
+                for (int64_t y = cy - 1; y <= cy + 1 && found == SR_UINT32_MAX; ++y) {
+                    for (int64_t z = cz - 1; z <= cz + 1 && found == SR_UINT32_MAX; ++z) {
+                        auto&& [begin, end] = cells.equal_range(cellKey(x, y, z));
+                        for (auto pIt = begin; pIt != end; ++pIt) {
+                            const Vertex& candidate = unique[pIt->second];
+
+                            const float_t dx = candidate.position.x - vertex.position.x;
+                            const float_t dy = candidate.position.y - vertex.position.y;
+                            const float_t dz = candidate.position.z - vertex.position.z;
+
+                            if (dx * dx + dy * dy + dz * dz <= epsilon2 && VerticesDetails::IsSameAttributes(candidate, vertex)) {
+                                found = pIt->second;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (found == SR_UINT32_MAX) {
+                found = static_cast<uint32_t>(unique.size());
+                unique.emplace_back(vertex);
+                cells.emplace(cellKey(cx, cy, cz), found);
+            }
+
+            remap[i] = found;
+        }
+
+        for (auto&& index : indices) {
+            index = remap[index];
+        }
+
+        vertices = std::move(unique);
+
+        return static_cast<uint32_t>(vertices.size());
+    }
+
+    void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t verticesCount) {
+        SR_TRACY_ZONE;
+
+        using namespace VerticesDetails;
+
+        const auto trianglesCount = static_cast<uint32_t>(indices.size() / 3);
+        if (trianglesCount == 0) {
+            return;
+        }
+
+        /// треугольники каждой вершины, плоским массивом
+        std::vector<uint32_t> offsets(verticesCount + 1, 0);
+        for (const uint32_t index : indices) {
+            ++offsets[index + 1];
+        }
+        for (uint32_t i = 0; i < verticesCount; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+
+        std::vector<uint32_t> adjacency(indices.size());
+        std::vector<uint32_t> filled(offsets.begin(), offsets.end() - 1);
+        for (uint32_t triangle = 0; triangle < trianglesCount; ++triangle) {
+            for (uint32_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = indices[triangle * 3 + k];
+                adjacency[filled[vertex]++] = triangle;
+            }
+        }
+
+        std::vector<uint32_t> liveTriangles(verticesCount);
+        std::vector<int32_t> cachePosition(verticesCount, -1);
+        std::vector<float_t> vertexScore(verticesCount);
+
+        for (uint32_t vertex = 0; vertex < verticesCount; ++vertex) {
+            liveTriangles[vertex] = offsets[vertex + 1] - offsets[vertex];
+            vertexScore[vertex] = VertexScore(-1, liveTriangles[vertex]);
+        }
+
+        std::vector<float_t> triangleScore(trianglesCount);
+        std::vector<bool> emitted(trianglesCount, false);
+
+        for (uint32_t triangle = 0; triangle < trianglesCount; ++triangle) {
+            triangleScore[triangle] = vertexScore[indices[triangle * 3]] + vertexScore[indices[triangle * 3 + 1]] + vertexScore[indices[triangle * 3 + 2]];
+        }
+
+        std::vector<uint32_t> result;
+        result.reserve(indices.size());
+
+        std::vector<uint32_t> cache;
+        std::vector<uint32_t> newCache;
+        cache.reserve(VERTEX_CACHE_SIZE + 3);
+        newCache.reserve(VERTEX_CACHE_SIZE + 3);
+
+        uint32_t bestTriangle = SR_UINT32_MAX;
+        uint32_t scanCursor = 0;
+
+        for (uint32_t emittedCount = 0; emittedCount < trianglesCount; ++emittedCount) {
+            if (bestTriangle == SR_UINT32_MAX) {
+                /// в кэше не осталось вершин с живыми треугольниками, ищем лучший среди оставшихся
+                float_t bestScore = -1.f;
+                for (; scanCursor < trianglesCount && emitted[scanCursor]; ++scanCursor) { }
+                for (uint32_t triangle = scanCursor; triangle < trianglesCount; ++triangle) {
+                    if (!emitted[triangle] && triangleScore[triangle] > bestScore) {
+                        bestScore = triangleScore[triangle];
+                        bestTriangle = triangle;
+                    }
+                }
+            }
+
+            const uint32_t triangle = bestTriangle;
+            emitted[triangle] = true;
+
+            newCache.clear();
+
+            for (uint32_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = indices[triangle * 3 + k];
+                result.emplace_back(vertex);
+                newCache.emplace_back(vertex);
+
+                /// убираем треугольник из списка живых у вершины
+                const uint32_t begin = offsets[vertex];
+                const uint32_t end = begin + liveTriangles[vertex];
+                for (uint32_t j = begin; j < end; ++j) {
+                    if (adjacency[j] == triangle) {
+                        std::swap(adjacency[j], adjacency[end - 1]);
+                        break;
+                    }
+                }
+                --liveTriangles[vertex];
+            }
+
+            for (const uint32_t vertex : cache) {
+                if (std::find(newCache.begin(), newCache.end(), vertex) == newCache.end()) {
+                    newCache.emplace_back(vertex);
+                }
+            }
+
+            for (uint32_t i = 0; i < newCache.size(); ++i) {
+                cachePosition[newCache[i]] = i < VERTEX_CACHE_SIZE ? static_cast<int32_t>(i) : -1;
+            }
+
+            /// пересчитываем очки вершин кэша и их треугольников, выбираем следующий треугольник
+            for (const uint32_t vertex : newCache) {
+                vertexScore[vertex] = VertexScore(cachePosition[vertex], liveTriangles[vertex]);
+            }
+
+            bestTriangle = SR_UINT32_MAX;
+            float_t bestScore = -1.f;
+
+            for (const uint32_t vertex : newCache) {
+                const uint32_t begin = offsets[vertex];
+                for (uint32_t j = begin; j < begin + liveTriangles[vertex]; ++j) {
+                    const uint32_t candidate = adjacency[j];
+                    const float_t score = vertexScore[indices[candidate * 3]] + vertexScore[indices[candidate * 3 + 1]] + vertexScore[indices[candidate * 3 + 2]];
+                    triangleScore[candidate] = score;
+
+                    if (score > bestScore) {
+                        bestScore = score;
+                        bestTriangle = candidate;
+                    }
+                }
+            }
+
+            if (newCache.size() > VERTEX_CACHE_SIZE) {
+                newCache.resize(VERTEX_CACHE_SIZE);
+            }
+            std::swap(cache, newCache);
+        }
+
+        indices = std::move(result);
+    }
+
+    void OptimizeOverdraw(std::vector<uint32_t>& indices, std::span<const Vertex> vertices) {
+        SR_TRACY_ZONE;
+
+        using namespace VerticesDetails;
+
+        const auto trianglesCount = static_cast<uint32_t>(indices.size() / 3);
+        if (trianglesCount < 2) {
+            return;
         }
 
-        auto&& hullCoordinates = qh::convex_hull(coordinates);
+        /// кластер заканчивается на треугольнике, все три вершины которого промахиваются мимо кэша:
+        /// такие разрывы не портят порядок, полученный OptimizeVertexCache
+        constexpr uint32_t cacheSize = 16;
+        std::vector<uint32_t> timestamps(vertices.size(), 0);
+        uint32_t time = cacheSize + 1;
+
+        std::vector<uint32_t> clusters = { 0 };
+
+        for (uint32_t triangle = 0; triangle < trianglesCount; ++triangle) {
+            uint32_t misses = 0;
+
+            for (uint32_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = indices[triangle * 3 + k];
+                if (time - timestamps[vertex] > cacheSize) {
+                    timestamps[vertex] = time++;
+                    ++misses;
+                }
+            }
+
+            if (misses == 3 && triangle != 0) {
+                clusters.emplace_back(triangle);
+            }
+        }
+
+        const auto clustersCount = static_cast<uint32_t>(clusters.size());
+        clusters.emplace_back(trianglesCount);
+
+        HullVector meshCenter = { };
+        for (const Vertex& vertex : vertices) {
+            meshCenter.x += vertex.position.x;
+            meshCenter.y += vertex.position.y;
+            meshCenter.z += vertex.position.z;
+        }
+        if (!vertices.empty()) {
+            const double_t inv = 1.0 / static_cast<double_t>(vertices.size());
+            meshCenter = { meshCenter.x * inv, meshCenter.y * inv, meshCenter.z * inv };
+        }
+
+        std::vector<std::pair<double_t, uint32_t>> order(clustersCount);
+
+        for (uint32_t cluster = 0; cluster < clustersCount; ++cluster) {
+            HullVector center = { };
+            HullVector normal = { };
+            double_t area = 0.0;
 
-        std::vector<Vertex> hullVertices;
-        hullVertices.reserve(hullCoordinates.size() * 3);
+            for (uint32_t triangle = clusters[cluster]; triangle < clusters[cluster + 1]; ++triangle) {
+                const Vec3& p0 = vertices[indices[triangle * 3]].position;
+                const Vec3& p1 = vertices[indices[triangle * 3 + 1]].position;
+                const Vec3& p2 = vertices[indices[triangle * 3 + 2]].position;
+
+                const HullVector a = { p0.x, p0.y, p0.z };
+                const HullVector n = (HullVector { p1.x, p1.y, p1.z } - a).Cross(HullVector { p2.x, p2.y, p2.z } - a);
+                const double_t weight = n.Length();
+
+                center.x += (p0.x + p1.x + p2.x) / 3.0 * weight;
+                center.y += (p0.y + p1.y + p2.y) / 3.0 * weight;
+                center.z += (p0.z + p1.z + p2.z) / 3.0 * weight;
+
+                normal = { normal.x + n.x, normal.y + n.y, normal.z + n.z };
+                area += weight;
+            }
+
+            double_t score = 0.0;
+
+            if (area > 0.0) {
+                center = { center.x / area, center.y / area, center.z / area };
+                const double_t length = normal.Length();
+                if (length > 0.0) {
+                    normal = { normal.x / length, normal.y / length, normal.z / length };
+                }
+                score = (center - meshCenter).Dot(normal);
+            }
+
+            order[cluster] = std::make_pair(score, cluster);
+        }
+
+        /// сначала кластеры, лежащие дальше всего от центра вдоль своей нормали
+        std::stable_sort(order.begin(), order.end(), [](auto&& a, auto&& b) {
+            return a.first > b.first;
+        });
+
+        std::vector<uint32_t> result;
+        result.reserve(indices.size());
+
+        for (auto&& [score, cluster] : order) {
+            result.insert(result.end(), indices.begin() + clusters[cluster] * 3, indices.begin() + clusters[cluster + 1] * 3);
+        }
+
+        indices = std::move(result);
+    }
+
+    uint32_t OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+        SR_TRACY_ZONE;
+
+        std::vector<uint32_t> remap(vertices.size(), SR_UINT32_MAX);
+        std::vector<Vertex> result;
+        result.reserve(vertices.size());
+
+        for (auto&& index : indices) {
+            if (remap[index] == SR_UINT32_MAX) {
+                remap[index] = static_cast<uint32_t>(result.size());
+                result.emplace_back(vertices[index]);
+            }
+            index = remap[index];
+        }
+
+        vertices = std::move(result);
+
+        return static_cast<uint32_t>(vertices.size());
+    }
+
+    float_t CalculateACMR(std::span<const uint32_t> indices, uint32_t verticesCount, uint32_t cacheSize) {
+        if (indices.size() < 3) {
+            return 0.f;
+        }
 
-        for (uint16_t i = 0; i <= hullCoordinates.size(); ++i) {
-            auto&& face = hullCoordinates[i];
+        std::vector<uint32_t> timestamps(verticesCount, 0);
+        uint32_t time = cacheSize + 1;
+        uint32_t misses = 0;
 
-            hullVertices.emplace_back(vertices[face[0]]);
-            hullVertices.emplace_back(vertices[face[1]]);
-            hullVertices.emplace_back(vertices[face[2]]);
+        for (const uint32_t index : indices) {
+            if (time - timestamps[index] > cacheSize) {
+                timestamps[index] = time++;
+                ++misses;
+            }
         }
 
-        return hullVertices;*/
-        return std::vector<Vertex>();
+        return static_cast<float_t>(misses) / static_cast<float_t>(indices.size() / 3);
     }
 }
@@ -28,9 +28,9 @@ namespace SR_UTILS_NS {
         }
         msg.append("\n");
 
-        std::string threadName = SR_UTILS_NS::GetThisThreadId();
+        auto&& threadName = SR_UTILS_NS::GetThisThreadName();
 
-        auto&& prefix = SR_FORMAT("[{}] [{}]", SR_UTILS_NS::EnumReflector::ToStringAtom(type).ToCStr(), threadName);
+        auto&& prefix = SR_FORMAT("[{}] [{}]", SR_UTILS_NS::EnumReflector::ToStringAtom(type).ToCStr(), threadName.ToCStr());
         auto&& memoryUsage = m_showUseMemory ? SR_FORMAT("<{} KB> ", static_cast<uint32_t>(SR_PLATFORM_NS::GetProcessUsedMemory() / 1024)) : std::string();
 
         {
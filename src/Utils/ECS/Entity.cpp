@@ -99,9 +99,11 @@ namespace SR_UTILS_NS {
         , m_entityId(ENTITY_ID_MAX)
     {
         m_entityId = EntityManager::Instance().Register(this);
+        m_entityHandle = EntityManager::Instance().AcquireHandle(this);
     }
 
     Entity::~Entity() {
+        EntityManager::Instance().ReleaseHandle(m_entityHandle);
         EntityManager::Instance().Unregister(m_entityId);
         m_entityMessages.ClearContainer();
     }
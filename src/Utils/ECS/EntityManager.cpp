@@ -11,6 +11,12 @@ namespace SR_UTILS_NS {
         : m_nextId(ENTITY_ID_MAX)
     { }
 
+    EntityManager::~EntityManager() {
+        for (auto&& page : m_handlePages) {
+            delete[] page.exchange(nullptr);
+        }
+    }
+
     bool EntityManager::Reserve(const EntityId &id) {
         SR_SCOPED_LOCK;
 
@@ -139,4 +145,85 @@ namespace SR_UTILS_NS {
 
         return true;
     }
-}
\ No newline at end of file
+
+    EntityManager::HandleSlot* EntityManager::GetHandleSlot(uint32_t index) const noexcept {
+        if (index >= m_handleSlotsCount.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        HandleSlot* pPage = m_handlePages[index >> HANDLE_PAGE_SHIFT].load(std::memory_order_acquire);
+        if (!pPage) {
+            return nullptr;
+        }
+
+        return &pPage[index & (HANDLE_PAGE_SIZE - 1)];
+    }
+
+    EntityHandle EntityManager::AcquireHandle(Entity* pEntity) {
+        SR_SCOPED_LOCK;
+
+        uint32_t index;
+
+        if (!m_freeHandles.empty()) {
+            index = m_freeHandles.back();
+            m_freeHandles.pop_back();
+        }
+        else {
+            index = m_handleSlotsCount.load(std::memory_order_relaxed);
+
+            const uint32_t page = index >> HANDLE_PAGE_SHIFT;
+            if (page >= HANDLE_MAX_PAGES) {
+                SRHalt("EntityManager::AcquireHandle() : handle table overflow!");
+                return EntityHandle();
+            }
+
+            if (!m_handlePages[page].load(std::memory_order_relaxed)) {
+                m_handlePages[page].store(new HandleSlot[HANDLE_PAGE_SIZE], std::memory_order_release);
+            }
+
+            m_handleSlotsCount.store(index + 1, std::memory_order_release);
+        }
+
+        HandleSlot* pSlot = GetHandleSlot(index);
+        pSlot->pEntity = pEntity;
+
+        EntityHandle handle;
+        handle.index = index;
+        handle.generation = pSlot->generation.load(std::memory_order_relaxed);
+        return handle;
+    }
+
+    void EntityManager::ReleaseHandle(const EntityHandle& handle) {
+        SR_SCOPED_LOCK;
+
+        HandleSlot* pSlot = GetHandleSlot(handle.index);
+        if (!pSlot || pSlot->generation.load(std::memory_order_relaxed) != handle.generation) {
+            SRHalt("EntityManager::ReleaseHandle() : invalid handle!");
+            return;
+        }
+
+        pSlot->pEntity = nullptr;
+        pSlot->generation.fetch_add(1, std::memory_order_release);
+        m_freeHandles.emplace_back(handle.index);
+    }
+
+    bool EntityManager::IsAlive(const EntityHandle& handle) const noexcept {
+        if (!handle.Valid()) {
+            return false;
+        }
+
+        if (HandleSlot* pSlot = GetHandleSlot(handle.index)) {
+            return pSlot->generation.load(std::memory_order_acquire) == handle.generation;
+        }
+
+        return false;
+    }
+
+    Entity* EntityManager::GetByHandle(const EntityHandle& handle) const noexcept {
+        if (!IsAlive(handle)) {
+            return nullptr;
+        }
+
+        return GetHandleSlot(handle.index)->pEntity;
+    }
+}
@@ -9,25 +9,54 @@ namespace SR_UTILS_NS {
         : m_owner(owner)
     { }
 
+    EntityRef::~EntityRef() {
+        if (m_remapTable) {
+            m_remapTable->RemoveRef(this);
+        }
+    }
+
     EntityRef::EntityRef(EntityRef&& other) noexcept
         : m_path(SR_UTILS_NS::Exchange(other.m_path, { }))
+        , m_pathDirty(SR_UTILS_NS::Exchange(other.m_pathDirty, { }))
         , m_relative(SR_UTILS_NS::Exchange(other.m_relative, { }))
+        , m_remapTable(SR_UTILS_NS::Exchange(other.m_remapTable, { }))
         , m_owner(SR_UTILS_NS::Exchange(other.m_owner, { }))
         , m_target(SR_UTILS_NS::Exchange(other.m_target, { }))
-    { }
+        , m_targetHandle(SR_UTILS_NS::Exchange(other.m_targetHandle, { }))
+        , m_targetId(SR_UTILS_NS::Exchange(other.m_targetId, ENTITY_ID_MAX))
+    {
+        if (m_remapTable) {
+            m_remapTable->MoveRef(&other, this);
+        }
+    }
 
     EntityRef &EntityRef::operator=(EntityRef&& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (m_remapTable) {
+            m_remapTable->RemoveRef(this);
+        }
+
         m_path = SR_UTILS_NS::Exchange(other.m_path, { });
+        m_pathDirty = SR_UTILS_NS::Exchange(other.m_pathDirty, { });
         m_relative = SR_UTILS_NS::Exchange(other.m_relative, { });
+        m_remapTable = SR_UTILS_NS::Exchange(other.m_remapTable, { });
         m_owner = SR_UTILS_NS::Exchange(other.m_owner, { });
         m_target = SR_UTILS_NS::Exchange(other.m_target, { });
+        m_targetHandle = SR_UTILS_NS::Exchange(other.m_targetHandle, { });
+        m_targetId = SR_UTILS_NS::Exchange(other.m_targetId, ENTITY_ID_MAX);
+
+        if (m_remapTable) {
+            m_remapTable->MoveRef(&other, this);
+        }
+
         return *this;
     }
 
     GameObject::Ptr EntityRef::GetGameObject() const {
-        if (m_path.empty() && m_target) {
-            UpdatePath();
-        }
+        ValidateTarget();
 
         if (!m_target) {
             UpdateTarget();
@@ -37,9 +66,7 @@ namespace SR_UTILS_NS {
     }
 
     SR_HTYPES_NS::SharedPtr<SceneObject> EntityRef::GetSceneObject() const {
-        if (m_path.empty() && m_target) {
-            UpdatePath();
-        }
+        ValidateTarget();
 
         if (!m_target) {
             UpdateTarget();
@@ -49,9 +76,7 @@ namespace SR_UTILS_NS {
     }
 
     Component::Ptr EntityRef::GetComponent() const {
-        if (m_path.empty() && m_target) {
-            UpdatePath();
-        }
+        ValidateTarget();
 
         if (!m_target) {
             UpdateTarget();
@@ -60,17 +85,38 @@ namespace SR_UTILS_NS {
         return m_target.DynamicCast<Component>();
     }
 
+    void EntityRef::ValidateTarget() const {
+        if (m_target && !EntityManager::Instance().IsAlive(m_targetHandle)) {
+            m_target = nullptr;
+            m_targetHandle.Reset();
+        }
+    }
+
+    void EntityRef::SetTarget(const Entity::Ptr& pEntity) const {
+        m_target = pEntity;
+
+        if (pEntity) {
+            m_targetHandle = pEntity->GetEntityHandle();
+            m_targetId = pEntity->GetEntityId();
+        }
+        else {
+            m_targetHandle.Reset();
+        }
+    }
+
     void EntityRef::UpdatePath() const {
-        if (!EntityRefUtils::IsTargetInitialized(m_target)) {
+        if (!m_pathDirty) {
             return;
         }
 
-        if (!EntityRefUtils::IsOwnerValid(m_owner)) {
-            SRHalt("Invalid owner!");
+        ValidateTarget();
+
+        if (!m_target || !EntityRefUtils::IsTargetInitialized(m_target)) {
             return;
         }
 
-        if (!m_target) {
+        if (!EntityRefUtils::IsOwnerValid(m_owner)) {
+            SRHalt("Invalid owner!");
             return;
         }
 
@@ -80,23 +126,52 @@ namespace SR_UTILS_NS {
         else {
             m_path = EntityRefUtils::CalculatePath(m_target);
         }
+
+        m_pathDirty = false;
     }
 
     void EntityRef::UpdateTarget() const {
+        ResolveTarget(EntityRefUtils::RemapTable::GetCurrent(), true);
+    }
+
+    void EntityRef::ResolveTarget(const EntityRefUtils::RemapTable* pTable, bool allowGlobalLookup) const {
         SRAssert(EntityRefUtils::IsOwnerValid(m_owner));
 
+        if (m_targetId != ENTITY_ID_MAX) {
+            if (pTable) {
+                if (auto&& pEntity = pTable->FindEntity(m_targetId)) {
+                    SetTarget(pEntity);
+                    m_pathDirty = true;
+                    return;
+                }
+            }
+
+            if (allowGlobalLookup) {
+                auto&& pEntity = EntityManager::Instance().FindById(m_targetId);
+                if (pEntity && EntityRefUtils::GetSceneFromOwner(pEntity) == EntityRefUtils::GetSceneFromOwner(m_owner)) {
+                    SetTarget(pEntity);
+                    return;
+                }
+            }
+        }
+
         if (IsRelative()) {
-            m_target = EntityRefUtils::GetEntity(m_owner, m_path);
+            SetTarget(EntityRefUtils::GetEntity(m_owner, m_path));
         }
         else {
             auto&& pScene = EntityRefUtils::GetSceneFromOwner(m_owner);
-            m_target = EntityRefUtils::GetEntity(pScene, m_path);
+            SetTarget(EntityRefUtils::GetEntity(pScene, m_path));
         }
     }
 
+    EntityId EntityRef::GetTargetId() const {
+        ValidateTarget();
+        return m_target ? m_target->GetEntityId() : m_targetId;
+    }
+
     void EntityRef::SetRelative(bool relative) {
         m_relative = relative;
-        UpdatePath();
+        m_pathDirty |= static_cast<bool>(m_target);
     }
 
     EntityRef& EntityRef::SetPathTo(const Entity::Ptr& pEntity) {
@@ -106,30 +181,27 @@ namespace SR_UTILS_NS {
         }
 
         if (!pEntity) {
-            m_target = pEntity;
+            SetTarget(pEntity);
+            m_targetId = ENTITY_ID_MAX;
             m_path.clear();
+            m_pathDirty = false;
             return *this;
         }
 
-        if (IsRelative()) {
-            m_path = EntityRefUtils::CalculateRelativePath(m_owner, pEntity);
-        }
-        else {
-            m_path = EntityRefUtils::CalculatePath(pEntity);
-        }
-
-        UpdateTarget();
+        SetTarget(pEntity);
+        m_pathDirty = true;
 
         return *this;
     }
 
     bool EntityRef::IsValid() const {
+        ValidateTarget();
         return m_target && EntityRefUtils::IsOwnerValid(m_owner);
     }
 
     void EntityRef::SetOwner(const EntityRefUtils::OwnerRef& owner) {
         m_owner = owner;
-        UpdatePath();
+        m_pathDirty |= static_cast<bool>(m_target);
     }
 
     SR_HTYPES_NS::Marshal::Ptr EntityRef::Save(SR_HTYPES_NS::Marshal::Ptr pMarshal) const {
@@ -145,6 +217,10 @@ namespace SR_UTILS_NS {
     void EntityRef::Load(SR_HTYPES_NS::Marshal& marshal) {
         m_relative = marshal.Read<bool>();
         m_path.clear();
+        m_pathDirty = false;
+
+        SetTarget(nullptr);
+        m_targetId = ENTITY_ID_MAX;
 
         const auto length = marshal.Read<uint16_t>();
 
@@ -154,6 +230,10 @@ namespace SR_UTILS_NS {
             item.action = static_cast<EntityRefUtils::Action>(marshal.Read<uint8_t>());
             item.name = marshal.Read<StringAtom>();
         }
+
+        if (auto&& pTable = EntityRefUtils::RemapTable::GetCurrent(); pTable && !m_remapTable) {
+            pTable->AddRef(this, true);
+        }
     }
 
     void EntityRef::Save(SR_HTYPES_NS::Marshal& marshal) const {
@@ -170,15 +250,28 @@ namespace SR_UTILS_NS {
     }
 
     EntityRef EntityRef::Copy(const EntityRefUtils::OwnerRef& owner) const {
+        UpdatePath();
+
         EntityRef ref(owner);
         ref.m_relative = m_relative;
         ref.m_path = m_path;
+
+        /// относительная ссылка без таблицы переназначения должна разрешаться от нового владельца
+        if (auto&& pTable = EntityRefUtils::RemapTable::GetCurrent()) {
+            ref.m_targetId = GetTargetId();
+            pTable->AddRef(&ref, !m_relative);
+        }
+        else if (!m_relative) {
+            ref.m_targetId = GetTargetId();
+        }
+
         return ref;
     }
 
     void EntityRefProperty::SaveProperty(MarshalRef marshal) const noexcept {
         if (auto&& pBlock = AllocatePropertyBlock()) {
             m_entityRef.Save(*pBlock);
+            pBlock->Write<uint64_t>(m_entityRef.GetTargetId());
             SavePropertyBase(marshal, std::move(pBlock));
         }
     }
@@ -186,6 +279,11 @@ namespace SR_UTILS_NS {
     void EntityRefProperty::LoadProperty(MarshalRef marshal) noexcept {
         if (auto&& pBlock = LoadPropertyBase(marshal)) {
             m_entityRef.Load(*pBlock);
+
+            /// старые сцены не содержат id цели, в этом случае ссылка разрешается по пути
+            if (pBlock->GetPosition() + sizeof(uint64_t) <= pBlock->Size()) {
+                m_entityRef.SetTargetId(pBlock->Read<uint64_t>());
+            }
         }
     }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 //
 
 #include <Utils/ECS/EntityRefUtils.h>
+#include <Utils/ECS/EntityRef.h>
 #include <Utils/World/Scene.h>
 #include <Utils/ECS/Entity.h>
 #include <Utils/ECS/Component.h>
@@ -277,4 +278,87 @@ namespace SR_UTILS_NS::EntityRefUtils {
 
         return owner.pScene;
     }
-}
+
+    static thread_local RemapTable* g_currentRemapTable = nullptr;
+
+    RemapTable::Scope::Scope(RemapTable& table)
+        : m_previous(g_currentRemapTable)
+    {
+        g_currentRemapTable = &table;
+    }
+
+    RemapTable::Scope::~Scope() {
+        g_currentRemapTable = m_previous;
+    }
+
+    RemapTable::~RemapTable() {
+        Clear();
+    }
+
+    RemapTable* RemapTable::GetCurrent() noexcept {
+        return g_currentRemapTable;
+    }
+
+    void RemapTable::AddEntity(EntityId from, const Entity::Ptr& pTo) {
+        if (from == ENTITY_ID_MAX || !pTo) {
+            return;
+        }
+
+        m_entities[from] = pTo;
+    }
+
+    Entity::Ptr RemapTable::FindEntity(EntityId from) const {
+        if (auto&& pIt = m_entities.find(from); pIt != m_entities.end()) {
+            return pIt->second;
+        }
+
+        return Entity::Ptr();
+    }
+
+    void RemapTable::AddRef(EntityRef* pRef, bool allowGlobalLookup) {
+        SRAssert(!pRef->m_remapTable || pRef->m_remapTable == this);
+        pRef->m_remapTable = this;
+        m_refs[pRef] = allowGlobalLookup;
+    }
+
+    void RemapTable::MoveRef(EntityRef* pFrom, EntityRef* pTo) {
+        if (auto&& pIt = m_refs.find(pFrom); pIt != m_refs.end()) {
+            const bool allowGlobalLookup = pIt->second;
+            m_refs.erase(pIt);
+            m_refs[pTo] = allowGlobalLookup;
+        }
+    }
+
+    void RemapTable::RemoveRef(EntityRef* pRef) {
+        m_refs.erase(pRef);
+        pRef->m_remapTable = nullptr;
+    }
+
+    void RemapTable::Resolve() {
+        SR_TRACY_ZONE;
+
+        auto&& refs = std::move(m_refs);
+        m_refs.clear();
+
+        for (auto&& [pRef, allowGlobalLookup] : refs) {
+            pRef->m_remapTable = nullptr;
+
+            if (pRef->m_target || !IsOwnerValid(pRef->m_owner)) {
+                continue;
+            }
+
+            pRef->ResolveTarget(this, allowGlobalLookup);
+        }
+
+        m_entities.clear();
+    }
+
+    void RemapTable::Clear() {
+        for (auto&& [pRef, allowGlobalLookup] : m_refs) {
+            pRef->m_remapTable = nullptr;
+        }
+
+        m_refs.clear();
+        m_entities.clear();
+    }
+}
\ No newline at end of file
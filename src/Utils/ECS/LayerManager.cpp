@@ -16,6 +16,8 @@ namespace SR_UTILS_NS {
 
         m_defaultLayer = StringAtom();
         m_layers.clear();
+        m_indices.clear();
+        m_defaultLayerIndex = 0;
 
         Super::ClearSettings();
     }
@@ -26,17 +28,34 @@ namespace SR_UTILS_NS {
         SR_LOG("LayerManager::LoadSettings() : loading settings...");
 
         m_layers.clear();
+        m_indices.clear();
 
         m_defaultLayer = node.TryGetNode("Default").TryGetAttribute("Name").ToString("Default");
 
         SRAssert2(!m_defaultLayer.load().Empty(), "Default layer is not set");
 
         if (auto&& layersNode = node.GetNode("Layers")) {
-            for (auto&& layerNode : layersNode.GetNodes()) {
-                m_layers.emplace_back(layerNode.Name());
+            for (auto&& layerNode : layersNode.Children()) {
+                StringAtom layer = layerNode.Name();
+                if (m_indices.count(layer) != 0) {
+                    continue;
+                }
+                m_indices[layer] = static_cast<uint16_t>(m_layers.size());
+                m_layers.emplace_back(layer);
             }
         }
 
+        if (auto&& pIt = m_indices.find(m_defaultLayer.load()); pIt != m_indices.end()) {
+            m_defaultLayerIndex = pIt->second;
+        }
+        else {
+            m_defaultLayerIndex = static_cast<uint16_t>(m_layers.size());
+        }
+
+        if (m_defaultLayerIndex >= SR_OBJECT_MASK_BITS || m_layers.size() > SR_OBJECT_MASK_BITS) {
+            SR_WARN("LayerManager::LoadSettings() : too many layers, only first {} will be present in layer masks!", SR_OBJECT_MASK_BITS);
+        }
+
         m_hashState = m_defaultLayer.load().GetHash();
 
         for (auto&& layer : m_layers) {
@@ -47,23 +66,32 @@ namespace SR_UTILS_NS {
     }
 
     uint16_t LayerManager::GetLayerIndex(StringAtom layer) const {
-        for (uint16_t i = 0; i < m_layers.size(); ++i) {
-            if (layer == m_layers[i]) {
-                return i;
-            }
-        }
-
-        return SR_ID_INVALID;
+        auto&& pIt = m_indices.find(layer);
+        return pIt == m_indices.end() ? SR_ID_INVALID : pIt->second;
     }
 
     bool LayerManager::HasLayer(StringAtom layer) const {
-        for (uint16_t i = 0; i < m_layers.size(); ++i) {
-            if (layer == m_layers[i]) {
-                return true;
-            }
+        return m_indices.count(layer) != 0;
+    }
+
+    ObjectMask LayerManager::GetLayerMask(StringAtom layer) const {
+        if (auto&& pIt = m_indices.find(layer); pIt != m_indices.end()) {
+            return MakeObjectMask(pIt->second);
+        }
+
+        if (layer == m_defaultLayer.load()) {
+            return MakeObjectMask(m_defaultLayerIndex);
         }
 
-        return false;
+        return SR_OBJECT_MASK_NONE;
+    }
+
+    ObjectMask LayerManager::GetLayersMask(std::initializer_list<StringAtom> layers) const {
+        ObjectMask mask = SR_OBJECT_MASK_NONE;
+        for (auto&& layer : layers) {
+            mask |= GetLayerMask(layer);
+        }
+        return mask;
     }
 
     StringAtom LayerManager::GetDefaultLayer() {
@@ -5,6 +5,18 @@
 #include <Utils/ECS/Migration.h>
 
 namespace SR_UTILS_NS {
+    namespace {
+        /// буферы переиспользуются между вызовами, вложенная миграция (из мигратора) берет свои.
+        /// Два буфера чередуются между шагами, третий хранит снимок для отката шагов Migrator
+        thread_local SR_HTYPES_NS::Marshal g_migrationBuffers[3];
+        thread_local uint32_t g_migrationDepth = 0;
+
+        struct MigrationDepthGuard {
+            MigrationDepthGuard() { ++g_migrationDepth; }
+            ~MigrationDepthGuard() { --g_migrationDepth; }
+        };
+    }
+
     bool Migration::Migrate(uint64_t hashName, SR_HTYPES_NS::Marshal& marshal, Version from, Version to) const {
         SR_TRACY_ZONE;
 
@@ -13,43 +25,223 @@ namespace SR_UTILS_NS {
             return false;
         }
 
-        auto&& pIt = m_migrators.find(hashName);
-        if (pIt == m_migrators.end()) {
+        const Plan plan = GetPlan(hashName, from, to);
+        if (plan.empty()) {
             return false;
         }
 
-        SR_HTYPES_NS::Marshal migrated = marshal.FullCopy();
+        MigrationDepthGuard guard;
+
+        if (g_migrationDepth > 1) {
+            SR_HTYPES_NS::Marshal buffers[3];
+            return ApplyPlan(plan, marshal, buffers);
+        }
+
+        return ApplyPlan(plan, marshal, g_migrationBuffers);
+    }
+
+    uint64_t Migration::MigrateBatch(uint64_t hashName, const std::vector<SR_HTYPES_NS::Marshal*>& marshals, Version from, Version to) const {
+        SR_TRACY_ZONE;
+
+        if (from == to) {
+            SRHalt("Migration from and to versions are the same!");
+            return 0;
+        }
+
+        const Plan plan = GetPlan(hashName, from, to);
+        if (plan.empty()) {
+            return 0;
+        }
+
+        MigrationDepthGuard guard;
+
+        SR_HTYPES_NS::Marshal nestedBuffers[3];
+        SR_HTYPES_NS::Marshal* pBuffers = g_migrationDepth > 1 ? nestedBuffers : g_migrationBuffers;
+
+        uint64_t migrated = 0;
+
+        for (auto&& pMarshal : marshals) {
+            if (pMarshal && ApplyPlan(plan, *pMarshal, pBuffers)) {
+                ++migrated;
+            }
+        }
 
-        for (auto&& migrator : pIt->second) {
-            if (migrator.from == from) {
-                if (migrator.migrator(migrated)) {
-                    from = migrator.to;
+        return migrated;
+    }
+
+    bool Migration::ApplyPlan(const Plan& plan, SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal* pBuffers) {
+        const uint64_t start = marshal.GetPosition();
+
+        /// где сейчас лежит тело: в маршале вызывающего или в одном из буферов
+        SR_HTYPES_NS::Marshal* pCurrent = &marshal;
+        uint64_t originalEnd = start;
+        uint32_t bufferIndex = 0;
+
+        /// шаги Migrator меняют маршал вызывающего на месте, перед первым из них запоминаем остаток маршала,
+        /// чтобы при неудаче любого следующего шага вернуть его как было
+        auto&& snapshot = pBuffers[2];
+        bool hasSnapshot = false;
+
+        const auto&& fail = [&]() {
+            if (hasSnapshot) {
+                marshal.Replace(start, marshal.Size() - start, snapshot.ToStringView().data(), snapshot.Size());
+            }
+            marshal.SetPosition(start);
+            return false;
+        };
+
+        for (auto&& pStep : plan) {
+            if (pStep->bufferMigrator) {
+                auto&& output = pBuffers[bufferIndex];
+                output.Clear();
+
+                if (!pStep->bufferMigrator(*pCurrent, output)) {
+                    return fail();
                 }
-                else {
-                    break;
+
+                if (pCurrent == &marshal) {
+                    originalEnd = marshal.GetPosition();
                 }
+
+                output.SetPosition(0);
+                pCurrent = &output;
+                bufferIndex ^= 1U;
+            }
+            else {
+                const uint64_t position = pCurrent->GetPosition();
+
+                if (pCurrent == &marshal && !hasSnapshot) {
+                    snapshot.Clear();
+                    snapshot.write(marshal.ToStringView().data() + start, marshal.Size() - start);
+                    hasSnapshot = true;
+                }
+
+                if (!pStep->migrator(*pCurrent)) {
+                    return fail();
+                }
+
+                pCurrent->SetPosition(position);
             }
         }
 
-        if (!pIt->second.empty() && pIt->second.back().to == to) {
-            marshal = migrated.FullCopy();
+        if (pCurrent == &marshal) {
+            marshal.SetPosition(start);
             return true;
         }
 
-        return false;
+        const uint64_t size = pCurrent->Size();
+        const uint64_t originalSize = originalEnd - start;
+
+        /// новое тело не больше старого - пишем его вплотную к концу старого, хвост маршала не двигается.
+        /// Байты [start, newStart) остаются мусором, их пропускает позиция (см. контракт Migrate)
+        if (size <= originalSize) {
+            const uint64_t newStart = originalEnd - size;
+            marshal.Replace(newStart, size, pCurrent->ToStringView().data(), size);
+            marshal.SetPosition(newStart);
+        }
+        else {
+            marshal.Replace(start, originalSize, pCurrent->ToStringView().data(), size);
+            marshal.SetPosition(start);
+        }
+
+        return true;
     }
 
     bool Migration::RegisterMigrator(uint64_t hashName, Migration::Version from, Migration::Version to, Migration::Migrator&& migrator) {
-        auto&& migrators = m_migrators[hashName];
+        SR_SCOPED_LOCK;
+
+        MigrationInfo migrationInfo;
+
+        migrationInfo.from = from;
+        migrationInfo.to = to;
+        migrationInfo.migrator = std::move(migrator);
+
+        m_migrators[hashName].emplace_back(std::move(migrationInfo));
+        m_plans.clear();
+
+        return true;
+    }
+
+    bool Migration::RegisterBufferMigrator(uint64_t hashName, Migration::Version from, Migration::Version to, Migration::BufferMigrator&& migrator) {
+        SR_SCOPED_LOCK;
 
         MigrationInfo migrationInfo;
 
         migrationInfo.from = from;
         migrationInfo.to = to;
-        migrationInfo.migrator = migrator;
+        migrationInfo.bufferMigrator = std::move(migrator);
 
-        migrators.emplace_back(std::move(migrationInfo));
+        m_migrators[hashName].emplace_back(std::move(migrationInfo));
+        m_plans.clear();
 
         return true;
     }
-}
\ No newline at end of file
+
+    bool Migration::CanMigrate(uint64_t hashName, Version from, Version to) const {
+        return from == to || !GetPlan(hashName, from, to).empty();
+    }
+
+    uint32_t Migration::GetChainLength(uint64_t hashName, Version from, Version to) const {
+        return static_cast<uint32_t>(GetPlan(hashName, from, to).size());
+    }
+
+    Migration::Plan Migration::GetPlan(uint64_t hashName, Version from, Version to) const {
+        SR_SCOPED_LOCK;
+
+        const PlanKey key = { hashName, from, to };
+
+        if (auto&& pIt = m_plans.find(key); pIt != m_plans.end()) {
+            return pIt->second;
+        }
+
+        return m_plans[key] = BuildPlan(hashName, from, to);
+    }
+
+    Migration::Plan Migration::BuildPlan(uint64_t hashName, Version from, Version to) const {
+        SR_TRACY_ZONE;
+
+        auto&& pIt = m_migrators.find(hashName);
+        if (pIt == m_migrators.end() || from == to) {
+            return Plan();
+        }
+
+        /// поиск в ширину по версиям, при равной длине выигрывает шаг, зарегистрированный раньше
+        std::unordered_map<Version, const MigrationInfo*> cameBy;
+        std::deque<Version> queue = { from };
+        cameBy[from] = nullptr;
+
+        while (!queue.empty()) {
+            const Version version = queue.front();
+            queue.pop_front();
+
+            if (version == to) {
+                break;
+            }
+
+            for (auto&& step : pIt->second) {
+                if (step.from != version || cameBy.count(step.to) != 0) {
+                    continue;
+                }
+
+                cameBy[step.to] = &step;
+                queue.emplace_back(step.to);
+            }
+        }
+
+        if (cameBy.count(to) == 0) {
+            return Plan();
+        }
+
+        Plan plan;
+
+        for (Version version = to; version != from; ) {
+            const MigrationInfo* pStep = cameBy.at(version);
+            plan.emplace_back(pStep);
+            version = pStep->from;
+        }
+
+        std::reverse(plan.begin(), plan.end());
+
+        return plan;
+    }
+}
@@ -0,0 +1,97 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/ECS/ObjectMask.h>
+
+#include <bit>
+
+#if defined(__AVX2__)
+    #define SR_OBJECT_MASK_AVX2 1
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SR_OBJECT_MASK_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+namespace SR_UTILS_NS {
+    SR_FORCE_INLINE static uint32_t EmitIndices(uint32_t bits, uint32_t base, uint32_t* pIndices, uint32_t found) noexcept {
+        while (bits) {
+            pIndices[found++] = base + static_cast<uint32_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+        }
+        return found;
+    }
+
+#if defined(SR_OBJECT_MASK_SSE2)
+    /// в SSE2 нет сравнения 64-битных слов, собираем его из двух 32-битных половин
+    SR_FORCE_INLINE static __m128i IsZero64(__m128i value, __m128i zero) noexcept {
+        const __m128i equal = _mm_cmpeq_epi32(value, zero);
+        return _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+#endif
+
+    uint32_t FilterObjectMasks(const ObjectMask* pTags, const ObjectMask* pLayers, uint32_t count,
+        const ObjectMaskQuery& query, uint32_t* pIndices) noexcept
+    {
+        const bool checkTags = query.anyTags != SR_OBJECT_MASK_ALL;
+
+        uint32_t found = 0;
+        uint32_t i = 0;
+
+    #if defined(SR_OBJECT_MASK_AVX2)
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i anyTags = _mm256_set1_epi64x(static_cast<int64_t>(query.anyTags));
+        const __m256i includeLayers = _mm256_set1_epi64x(static_cast<int64_t>(query.includeLayers));
+        const __m256i excludeLayers = _mm256_set1_epi64x(static_cast<int64_t>(query.excludeLayers));
+
+        for (; i + 4 <= count; i += 4) {
+            const __m256i layers = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pLayers + i));
+
+            /// accept = (layers & include) != 0 && (layers & exclude) == 0
+            __m256i reject = _mm256_cmpeq_epi64(_mm256_and_si256(layers, includeLayers), zero);
+            reject = _mm256_or_si256(reject, _mm256_andnot_si256(
+                _mm256_cmpeq_epi64(_mm256_and_si256(layers, excludeLayers), zero), _mm256_set1_epi64x(-1)
+            ));
+
+            if (checkTags) {
+                const __m256i tags = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pTags + i));
+                reject = _mm256_or_si256(reject, _mm256_cmpeq_epi64(_mm256_and_si256(tags, anyTags), zero));
+            }
+
+            const auto accept = static_cast<uint32_t>(~_mm256_movemask_pd(_mm256_castsi256_pd(reject))) & 0xFu;
+            found = EmitIndices(accept, i, pIndices, found);
+        }
+    #elif defined(SR_OBJECT_MASK_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i anyTags = _mm_set1_epi64x(static_cast<int64_t>(query.anyTags));
+        const __m128i includeLayers = _mm_set1_epi64x(static_cast<int64_t>(query.includeLayers));
+        const __m128i excludeLayers = _mm_set1_epi64x(static_cast<int64_t>(query.excludeLayers));
+
+        for (; i + 2 <= count; i += 2) {
+            const __m128i layers = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pLayers + i));
+
+            __m128i reject = IsZero64(_mm_and_si128(layers, includeLayers), zero);
+            reject = _mm_or_si128(reject, _mm_andnot_si128(
+                IsZero64(_mm_and_si128(layers, excludeLayers), zero), _mm_set1_epi32(-1)
+            ));
+
+            if (checkTags) {
+                const __m128i tags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pTags + i));
+                reject = _mm_or_si128(reject, IsZero64(_mm_and_si128(tags, anyTags), zero));
+            }
+
+            const auto accept = static_cast<uint32_t>(~_mm_movemask_pd(_mm_castsi128_pd(reject))) & 0x3u;
+            found = EmitIndices(accept, i, pIndices, found);
+        }
+    #endif
+
+        for (; i < count; ++i) {
+            if (query.Test(pTags[i], pLayers[i])) {
+                pIndices[found++] = i;
+            }
+        }
+
+        return found;
+    }
+}
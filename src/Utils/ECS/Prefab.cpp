@@ -80,7 +80,17 @@ namespace SR_UTILS_NS {
 
     Prefab::SceneObjectPtr Prefab::Instance(const Prefab::ScenePtr& scene) const {
         if (m_data) {
-            auto&& pInstanced = m_data->Copy(scene, nullptr);
+            EntityRefUtils::RemapTable remapTable;
+            SceneObjectPtr pInstanced;
+
+            {
+                EntityRefUtils::RemapTable::Scope remapScope(remapTable);
+                pInstanced = m_data->Copy(scene, nullptr);
+            }
+
+            /// ссылки внутри префаба переназначаются на скопированные объекты без обхода путей
+            remapTable.Resolve();
+
             pInstanced->SetPrefab(const_cast<Prefab*>(this), true);
             return pInstanced;
         }
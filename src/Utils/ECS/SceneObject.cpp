@@ -47,8 +47,17 @@ namespace SR_UTILS_NS {
             pScene->RegisterSceneObject(pObject);
         }
 
+        auto&& pRemapTable = EntityRefUtils::RemapTable::GetCurrent();
+        if (pRemapTable) {
+            pRemapTable->AddEntity(GetEntityId(), pObject.DynamicCast<Entity>());
+        }
+
         for (auto&& pComponent : m_components) {
-            pObject->AddComponent(pComponent->CopyComponent());
+            auto&& pCopy = pComponent->CopyComponent();
+            if (pRemapTable && pCopy) {
+                pRemapTable->AddEntity(pComponent->GetEntityId(), pCopy->GetEntity());
+            }
+            pObject->AddComponent(pCopy);
         }
 
         for (auto&& children : GetChildrenRef()) {
@@ -207,6 +216,10 @@ namespace SR_UTILS_NS {
 
         m_cachedLayer = m_layer = layer;
 
+        if (m_scene) {
+            m_scene->UpdateObjectMask(this);
+        }
+
         ForEachComponent([](const Component::Ptr& pComponent) -> bool {
             pComponent->OnLayerChanged();
             return true;
@@ -315,6 +328,10 @@ namespace SR_UTILS_NS {
 
         m_cachedLayer = m_parent->m_cachedLayer;
 
+        if (m_scene) {
+            m_scene->UpdateObjectMask(this);
+        }
+
         ForEachComponent([](const Component::Ptr& pComponent) -> bool {
             pComponent->OnLayerChanged();
             return true;
@@ -392,6 +409,10 @@ namespace SR_UTILS_NS {
 
     void SceneObject::SetTag(SR_UTILS_NS::StringAtom tag) {
         m_tag = tag;
+
+        if (m_scene) {
+            m_scene->UpdateObjectMask(this);
+        }
     }
 
     StringAtom SceneObject::GetTag() const {
@@ -10,8 +10,13 @@ namespace SR_UTILS_NS {
         SR_LOCK_GUARD;
 
         if (m_indices.count(tag) == 0) {
+            if (m_tags.size() == SR_OBJECT_MASK_BITS) {
+                SR_WARN("TagManager::RegisterTag() : too many tags, tag \"{}\" will not be present in tag masks!", tag.ToStringRef());
+            }
+
+            m_indices[tag] = static_cast<uint16_t>(m_tags.size());
             m_tags.emplace_back(tag);
-            m_indices[tag] = m_indices.size();
+            m_hashState = SR_COMBINE_HASHES(m_hashState, tag.GetHash());
         }
     }
 
@@ -24,6 +29,7 @@ namespace SR_UTILS_NS {
 
         m_tags.clear();
         m_indices.clear();
+        m_hashState = 0;
 
         Super::ClearSettings();
     }
@@ -33,11 +39,12 @@ namespace SR_UTILS_NS {
 
         m_tags.clear();
         m_indices.clear();
+        m_hashState = 0;
 
         RegisterTag(UNTAGGED);
 
         if (auto&& tagsNode = node.GetNode("Tags")) {
-            for (auto&& tagNode : tagsNode.GetNodes()) {
+            for (auto&& tagNode : tagsNode.Children()) {
                 RegisterTag(tagNode.Name());
             }
         }
@@ -62,6 +69,25 @@ namespace SR_UTILS_NS {
         return pIt->second;
     }
 
+    ObjectMask TagManager::GetTagMask(StringAtom tag) const {
+        SR_LOCK_GUARD;
+
+        if (tag == StringAtom()) {
+            return MakeObjectMask(0);
+        }
+
+        auto&& pIt = m_indices.find(tag);
+        return pIt == m_indices.end() ? SR_OBJECT_MASK_NONE : MakeObjectMask(pIt->second);
+    }
+
+    ObjectMask TagManager::GetTagsMask(std::initializer_list<StringAtom> tags) const {
+        ObjectMask mask = SR_OBJECT_MASK_NONE;
+        for (auto&& tag : tags) {
+            mask |= GetTagMask(tag);
+        }
+        return mask;
+    }
+
     StringAtom TagManager::GetTagByIndex(uint16_t index) const {
         SR_LOCK_GUARD;
 
@@ -12,405 +12,612 @@
 #include <assimp/include/assimp/Exporter.hpp>
 #include <assimp/include/assimp/cexport.h>
 
+#include <filesystem>
+
 namespace SR_UTILS_NS {
+    namespace {
+        constexpr uint32_t ASSIMP_CACHE_MAGIC = 0x43415253; /// SRAC
+        constexpr uint64_t ASSIMP_CACHE_ALIGNMENT = 16;
+
+        struct AssimpCacheHeader {
+            uint32_t magic = 0;
+            uint32_t headerSize = 0;
+            uint64_t version = 0;
+            uint64_t sourceHash = 0;
+            uint64_t layoutHash = 0;
+            uint64_t structureSize = 0;
+            uint64_t structureHash = 0;
+            uint64_t dataOffset = 0;
+            uint64_t dataSize = 0;
+        };
+
+        uint64_t AlignCacheOffset(uint64_t offset) {
+            return (offset + ASSIMP_CACHE_ALIGNMENT - 1) & ~(ASSIMP_CACHE_ALIGNMENT - 1);
+        }
+
+        /// массивы лежат в файле как есть, поэтому кэш другой сборки assimp с иной раскладкой не подходит
+        uint64_t GetAssimpLayoutHash() {
+            const uint64_t sizes[] = {
+                sizeof(ai_real), sizeof(aiVector3D), sizeof(aiColor4D), sizeof(aiVertexWeight),
+                sizeof(aiVectorKey), sizeof(aiQuatKey), sizeof(aiMeshKey), sizeof(aiMatrix4x4),
+                AI_MAX_NUMBER_OF_COLOR_SETS, AI_MAX_NUMBER_OF_TEXTURECOORDS
+            };
+
+            return HashArrayRepresentation(sizes, std::size(sizes));
+        }
+
+        template<typename T> void DetachMeshArrays(T* pMesh) {
+            pMesh->mVertices = nullptr;
+            pMesh->mNormals = nullptr;
+            pMesh->mTangents = nullptr;
+            pMesh->mBitangents = nullptr;
+
+            for (auto&& pColors : pMesh->mColors) {
+                pColors = nullptr;
+            }
+
+            for (auto&& pTextureCoords : pMesh->mTextureCoords) {
+                pTextureCoords = nullptr;
+            }
+        }
+
+        /// обнуляет указатели в отображенный файл, чтобы деструкторы assimp их не освобождали
+        void DetachMappedData(aiScene* pScene) {
+            for (uint32_t meshId = 0; pScene->mMeshes && meshId < pScene->mNumMeshes; ++meshId) {
+                auto&& pMesh = pScene->mMeshes[meshId];
+                if (!pMesh) {
+                    continue;
+                }
+
+                DetachMeshArrays(pMesh);
+
+                for (uint32_t faceId = 0; pMesh->mFaces && faceId < pMesh->mNumFaces; ++faceId) {
+                    pMesh->mFaces[faceId].mIndices = nullptr;
+                }
+
+                for (uint32_t boneId = 0; pMesh->mBones && boneId < pMesh->mNumBones; ++boneId) {
+                    if (auto&& pBone = pMesh->mBones[boneId]) {
+                        pBone->mWeights = nullptr;
+                    }
+                }
+
+                for (uint32_t animatedMeshId = 0; pMesh->mAnimMeshes && animatedMeshId < pMesh->mNumAnimMeshes; ++animatedMeshId) {
+                    if (auto&& pAnimatedMesh = pMesh->mAnimMeshes[animatedMeshId]) {
+                        DetachMeshArrays(pAnimatedMesh);
+                    }
+                }
+            }
+
+            for (uint32_t skeletonId = 0; pScene->mSkeletons && skeletonId < pScene->mNumSkeletons; ++skeletonId) {
+                auto&& pSkeleton = pScene->mSkeletons[skeletonId];
+
+                for (uint32_t boneId = 0; pSkeleton && pSkeleton->mBones && boneId < pSkeleton->mNumBones; ++boneId) {
+                    if (auto&& pBone = pSkeleton->mBones[boneId]) {
+                        pBone->mWeights = nullptr;
+                    }
+                }
+            }
+
+            for (uint32_t animationId = 0; pScene->mAnimations && animationId < pScene->mNumAnimations; ++animationId) {
+                auto&& pAnimation = pScene->mAnimations[animationId];
+                if (!pAnimation) {
+                    continue;
+                }
+
+                for (uint32_t channelId = 0; pAnimation->mChannels && channelId < pAnimation->mNumChannels; ++channelId) {
+                    if (auto&& pChannel = pAnimation->mChannels[channelId]) {
+                        pChannel->mPositionKeys = nullptr;
+                        pChannel->mRotationKeys = nullptr;
+                        pChannel->mScalingKeys = nullptr;
+                    }
+                }
+
+                for (uint32_t meshChannelId = 0; pAnimation->mMeshChannels && meshChannelId < pAnimation->mNumMeshChannels; ++meshChannelId) {
+                    if (auto&& pMeshChannel = pAnimation->mMeshChannels[meshChannelId]) {
+                        pMeshChannel->mKeys = nullptr;
+                    }
+                }
+
+                for (uint32_t morphId = 0; pAnimation->mMorphMeshChannels && morphId < pAnimation->mNumMorphMeshChannels; ++morphId) {
+                    auto&& pMorphMeshChannel = pAnimation->mMorphMeshChannels[morphId];
+
+                    for (uint32_t keyId = 0; pMorphMeshChannel && pMorphMeshChannel->mKeys && keyId < pMorphMeshChannel->mNumKeys; ++keyId) {
+                        pMorphMeshChannel->mKeys[keyId].mValues = nullptr;
+                        pMorphMeshChannel->mKeys[keyId].mWeights = nullptr;
+                    }
+                }
+            }
+        }
+    }
+
+    /// структура сцены пишется в structure, большие массивы - выровненно в data, в структуре остается ссылка
+    struct AssimpCache::Writer {
+        SR_HTYPES_NS::Marshal structure;
+        SR_HTYPES_NS::Marshal data;
+
+        void WriteArray(const void* pArray, uint64_t size) {
+            structure.Write<bool>(pArray && size > 0);
+            if (!pArray || size == 0) {
+                return;
+            }
+
+            static const char padding[ASSIMP_CACHE_ALIGNMENT] = { };
+            data.write(padding, AlignCacheOffset(data.Size()) - data.Size());
+
+            structure.Write<uint64_t>(data.Size());
+            structure.Write<uint64_t>(size);
+
+            data.write(pArray, size);
+        }
+
+        template<typename T> void WriteReference(const std::unordered_map<T*, uint64_t>& indices, const T* pItem) {
+            structure.Write<bool>(pItem);
+            if (pItem) {
+                structure.Write<uint64_t>(indices.at(const_cast<T*>(pItem)));
+            }
+        }
+    };
+
+    struct AssimpCache::Reader {
+        Reader(const char* pStructure, uint64_t structureSize, const char* pData, uint64_t dataSize)
+            : structure(pStructure, structureSize)
+            , pData(pData)
+            , dataSize(dataSize)
+        { }
+
+        SR_HTYPES_NS::Marshal structure;
+        const char* pData = nullptr;
+        uint64_t dataSize = 0;
+        bool valid = true;
+
+        /// Указатель прямо в отображение. Память только для чтения,
+        /// неконстантный тип нужен лишь потому, что так объявлены поля assimp
+        template<typename T> T* ReadArray(uint64_t count) {
+            if (!structure.Read<bool>()) {
+                return nullptr;
+            }
+
+            const uint64_t offset = structure.Read<uint64_t>();
+            const uint64_t size = structure.Read<uint64_t>();
+
+            if (offset > dataSize || size > dataSize - offset || size != count * sizeof(T) || offset % alignof(T) != 0) {
+                valid = false;
+                return nullptr;
+            }
+
+            return reinterpret_cast<T*>(const_cast<char*>(pData + offset));
+        }
+
+        template<typename T> T* ReadReference(const std::vector<T*>& items) {
+            if (!structure.Read<bool>()) {
+                return nullptr;
+            }
+
+            const uint64_t index = structure.Read<uint64_t>();
+            if (index >= items.size()) {
+                valid = false;
+                return nullptr;
+            }
+
+            return items[index];
+        }
+    };
+
     const uint8_t AssimpCache::SR_ASSIMP_MAX_NUMBER_OF_COLOR_SETS = AI_MAX_NUMBER_OF_COLOR_SETS;
     const uint8_t AssimpCache::SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS = AI_MAX_NUMBER_OF_TEXTURECOORDS;
 
-    bool AssimpCache::Save(const SR_UTILS_NS::Path& path, const aiScene* pScene) const {
-        SR_HTYPES_NS::Marshal marshal;
+    AssimpCache::CachedScene::CachedScene(aiScene* pScene, SR_HTYPES_NS::MappedFile&& file)
+        : m_scene(pScene)
+        , m_file(std::move(file))
+    { }
+
+    AssimpCache::CachedScene::~CachedScene() {
+        if (m_scene) {
+            DetachMappedData(m_scene);
+            delete m_scene;
+        }
+    }
+
+    bool AssimpCache::Save(const SR_UTILS_NS::Path& path, const aiScene* pScene, uint64_t sourceHash) const {
+        SR_TRACY_ZONE;
 
-        marshal.Write<uint64_t>(VERSION);
+        Writer writer;
 
-        marshal.Write<std::string>(std::string(pScene->mName.C_Str()));
-        marshal.Write<uint64_t>(pScene->mFlags);
+        writer.structure.Write<std::string>(std::string(pScene->mName.C_Str()));
+        writer.structure.Write<uint64_t>(pScene->mFlags);
 
-        marshal.Write<bool>(pScene->mRootNode); /// has root node
+        writer.structure.Write<bool>(pScene->mRootNode); /// has root node
         if (pScene->mRootNode) {
-            SaveNode(&marshal, pScene->mRootNode);
+            SaveNode(writer, pScene->mRootNode);
+        }
+
+        SaveMeshes(writer, pScene);
+        SaveSkeletons(writer, pScene);
+        SaveAnimations(writer, pScene);
+
+        AssimpCacheHeader header;
+        header.magic = ASSIMP_CACHE_MAGIC;
+        header.headerSize = sizeof(AssimpCacheHeader);
+        header.version = VERSION;
+        header.sourceHash = sourceHash;
+        header.layoutHash = GetAssimpLayoutHash();
+        header.structureSize = writer.structure.Size();
+        header.structureHash = HashArrayRepresentation(writer.structure.ToStringView().data(), writer.structure.Size());
+        header.dataOffset = AlignCacheOffset(sizeof(AssimpCacheHeader) + header.structureSize);
+        header.dataSize = writer.data.Size();
+
+        SR_HTYPES_NS::Marshal file;
+        file.Reserve(header.dataOffset + header.dataSize);
+
+        static const char padding[ASSIMP_CACHE_ALIGNMENT] = { };
+
+        file.write(&header, sizeof(AssimpCacheHeader));
+        file.write(writer.structure.ToStringView().data(), header.structureSize);
+        file.write(padding, header.dataOffset - file.Size());
+        file.write(writer.data.ToStringView().data(), header.dataSize);
+
+        /// пишем рядом и подменяем: тот, кто еще держит отображение старого файла, не увидит его обрезанным
+        auto&& temporary = path.ConcatExt("tmp");
+
+        if (!file.Save(temporary)) {
+            SR_ERROR("AssimpCache::Save() : failed to write cache!\n\tPath: " + temporary.ToString());
+            return false;
         }
 
-        SaveMeshes(&marshal, pScene);
-        SaveSkeletons(&marshal, pScene);
-        SaveAnimations(&marshal, pScene);
+        std::error_code error;
+        std::filesystem::rename(temporary.ToStringRef(), path.ToStringRef(), error);
+
+        if (error) {
+            SR_ERROR("AssimpCache::Save() : failed to replace cache!\n\tPath: " + path.ToString() + "\n\tReason: " + error.message());
+            std::filesystem::remove(temporary.ToStringRef(), error);
+            return false;
+        }
 
-        return marshal.Save(path);
+        return true;
     }
 
-    aiScene* AssimpCache::Load(const Path& path) const {
+    AssimpCache::CachedScene::Ptr AssimpCache::Load(const Path& path, uint64_t sourceHash) const {
         SR_TRACY_ZONE;
         SR_TRACY_ZONE_TEXT(path.ToStringRef());
 
-        auto&& marshal = SR_HTYPES_NS::Marshal::Load(path);
-        if (!marshal.Valid()) {
+        SR_HTYPES_NS::MappedFile file;
+        if (!file.Open(path) || file.Size() < sizeof(AssimpCacheHeader)) {
             return nullptr;
         }
 
-        /// version
-        if (marshal.Read<uint64_t>() != VERSION) {
+        AssimpCacheHeader header;
+        memcpy(&header, file.Data(), sizeof(AssimpCacheHeader));
+
+        /// старая версия или другой исходник - обычная ситуация, кэш просто пересоздается
+        if (header.magic != ASSIMP_CACHE_MAGIC || header.version != VERSION || header.sourceHash != sourceHash) {
+            return nullptr;
+        }
+
+        if (header.headerSize != sizeof(AssimpCacheHeader) || header.layoutHash != GetAssimpLayoutHash()) {
+            SR_WARN("AssimpCache::Load() : cache was written by an incompatible build!\n\tPath: " + path.ToString());
             return nullptr;
         }
 
+        const bool validLayout = header.structureSize <= file.Size() - sizeof(AssimpCacheHeader)
+            && header.dataOffset == AlignCacheOffset(sizeof(AssimpCacheHeader) + header.structureSize)
+            && header.dataOffset <= file.Size()
+            && header.dataSize == file.Size() - header.dataOffset;
+
+        const char* pStructure = file.Data() + sizeof(AssimpCacheHeader);
+
+        if (!validLayout || HashArrayRepresentation(pStructure, header.structureSize) != header.structureHash) {
+            SR_WARN("AssimpCache::Load() : cache is corrupted!\n\tPath: " + path.ToString());
+            return nullptr;
+        }
+
+        Reader reader(pStructure, header.structureSize, file.Data() + header.dataOffset, header.dataSize);
+
         auto&& pScene = new aiScene();
 
-        pScene->mName = marshal.Read<std::string>();
-        pScene->mFlags = marshal.Read<uint64_t>();
+        pScene->mName = reader.structure.Read<std::string>();
+        pScene->mFlags = reader.structure.Read<uint64_t>();
 
-        if (marshal.Read<bool>()) { /// has root node
-            LoadNode(&marshal, pScene->mRootNode);
+        if (reader.structure.Read<bool>()) { /// has root node
+            LoadNode(reader, pScene->mRootNode);
         }
 
-        LoadMeshes(&marshal, pScene);
-        LoadSkeletons(&marshal, pScene);
-        LoadAnimations(&marshal, pScene);
+        LoadMeshes(reader, pScene);
+        LoadSkeletons(reader, pScene);
+        LoadAnimations(reader, pScene);
+
+        if (!reader.valid) {
+            SR_WARN("AssimpCache::Load() : cache references data out of range!\n\tPath: " + path.ToString());
+            DetachMappedData(pScene);
+            delete pScene;
+            return nullptr;
+        }
 
-        return pScene;
+        return std::make_unique<CachedScene>(pScene, std::move(file));
     }
 
-    void AssimpCache::SaveAnimations(SR_HTYPES_NS::Marshal* pMarshal, const aiScene* pScene) const {
-        pMarshal->Write<uint64_t>(pScene->mNumAnimations);
+    template<typename T> void AssimpCache::SaveMesh(Writer& writer, const T* pMesh) const {
+        writer.structure.Write<std::string>(std::string(pMesh->mName.C_Str()));
+        writer.structure.Write<uint64_t>(pMesh->mNumVertices);
+
+        const uint64_t count = pMesh->mNumVertices;
+
+        for (uint8_t colorId = 0; colorId < SR_ASSIMP_MAX_NUMBER_OF_COLOR_SETS; ++colorId) {
+            writer.WriteArray(pMesh->mColors[colorId], count * sizeof(aiColor4D));
+        }
+
+        writer.WriteArray(pMesh->mVertices, count * sizeof(aiVector3D));
+        writer.WriteArray(pMesh->mNormals, count * sizeof(aiVector3D));
+        writer.WriteArray(pMesh->mTangents, count * sizeof(aiVector3D));
+        writer.WriteArray(pMesh->mBitangents, count * sizeof(aiVector3D));
+
+        for (uint8_t numberTextureCoords = 0; numberTextureCoords < SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS; ++numberTextureCoords) {
+            writer.WriteArray(pMesh->mTextureCoords[numberTextureCoords], count * sizeof(aiVector3D));
+        }
+    }
+
+    template<typename T> void AssimpCache::LoadMesh(Reader& reader, T* pMesh) const {
+        pMesh->mName = reader.structure.Read<std::string>();
+        pMesh->mNumVertices = reader.structure.Read<uint64_t>();
+
+        const uint64_t count = pMesh->mNumVertices;
+
+        for (uint8_t colorId = 0; colorId < SR_ASSIMP_MAX_NUMBER_OF_COLOR_SETS; ++colorId) {
+            pMesh->mColors[colorId] = reader.ReadArray<aiColor4D>(count);
+        }
+
+        pMesh->mVertices = reader.ReadArray<aiVector3D>(count);
+        pMesh->mNormals = reader.ReadArray<aiVector3D>(count);
+        pMesh->mTangents = reader.ReadArray<aiVector3D>(count);
+        pMesh->mBitangents = reader.ReadArray<aiVector3D>(count);
+
+        for (uint8_t numberTextureCoords = 0; numberTextureCoords < SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS; ++numberTextureCoords) {
+            pMesh->mTextureCoords[numberTextureCoords] = reader.ReadArray<aiVector3D>(count);
+        }
+    }
+
+    void AssimpCache::SaveAnimations(Writer& writer, const aiScene* pScene) const {
+        auto&& structure = writer.structure;
+
+        structure.Write<uint64_t>(pScene->mNumAnimations);
 
         for (uint64_t animationId = 0; animationId < pScene->mNumAnimations; ++animationId) {
             auto&& pAnimation = pScene->mAnimations[animationId];
 
-            pMarshal->Write<std::string>(std::string(pAnimation->mName.C_Str()));
-            pMarshal->Write<double_t>(pAnimation->mDuration);
-            pMarshal->Write<double_t>(pAnimation->mTicksPerSecond);
+            structure.Write<std::string>(std::string(pAnimation->mName.C_Str()));
+            structure.Write<double_t>(pAnimation->mDuration);
+            structure.Write<double_t>(pAnimation->mTicksPerSecond);
 
-            pMarshal->Write<uint64_t>(pAnimation->mNumChannels);
+            structure.Write<uint64_t>(pAnimation->mNumChannels);
 
             for (uint64_t channelId = 0; channelId < pAnimation->mNumChannels; ++channelId) {
                 auto&& pChannel = pAnimation->mChannels[channelId];
 
-                pMarshal->Write<std::string>(std::string(pChannel->mNodeName.C_Str()));
-                pMarshal->Write<uint64_t>(pChannel->mPreState);
-                pMarshal->Write<uint64_t>(pChannel->mPostState);
+                structure.Write<std::string>(std::string(pChannel->mNodeName.C_Str()));
+                structure.Write<uint64_t>(pChannel->mPreState);
+                structure.Write<uint64_t>(pChannel->mPostState);
 
-                pMarshal->Write<bool>(pChannel->mPositionKeys);
-                if (pChannel->mPositionKeys) {
-                    pMarshal->Write<uint64_t>(pChannel->mNumPositionKeys);
-                    pMarshal->WriteBlock((void*)pChannel->mPositionKeys, pChannel->mNumPositionKeys * sizeof(aiVectorKey));
-                }
+                structure.Write<uint64_t>(pChannel->mPositionKeys ? pChannel->mNumPositionKeys : 0);
+                writer.WriteArray(pChannel->mPositionKeys, pChannel->mNumPositionKeys * sizeof(aiVectorKey));
 
-                pMarshal->Write<bool>(pChannel->mRotationKeys);
-                if (pChannel->mRotationKeys) {
-                    pMarshal->Write<uint64_t>(pChannel->mNumRotationKeys);
-                    pMarshal->WriteBlock((void*)pChannel->mRotationKeys, pChannel->mNumRotationKeys * sizeof(aiQuatKey));
-                }
+                structure.Write<uint64_t>(pChannel->mRotationKeys ? pChannel->mNumRotationKeys : 0);
+                writer.WriteArray(pChannel->mRotationKeys, pChannel->mNumRotationKeys * sizeof(aiQuatKey));
 
-                pMarshal->Write<bool>(pChannel->mScalingKeys);
-                if (pChannel->mScalingKeys) {
-                    pMarshal->Write<uint64_t>(pChannel->mNumScalingKeys);
-                    pMarshal->WriteBlock((void*)pChannel->mScalingKeys, pChannel->mNumScalingKeys * sizeof(aiVectorKey));
-                }
+                structure.Write<uint64_t>(pChannel->mScalingKeys ? pChannel->mNumScalingKeys : 0);
+                writer.WriteArray(pChannel->mScalingKeys, pChannel->mNumScalingKeys * sizeof(aiVectorKey));
             }
 
-            pMarshal->Write<uint64_t>(pAnimation->mNumMeshChannels);
+            structure.Write<uint64_t>(pAnimation->mNumMeshChannels);
 
             for (uint64_t meshChannelId = 0; meshChannelId < pAnimation->mNumMeshChannels; ++meshChannelId) {
                 auto&& pMeshChannel = pAnimation->mMeshChannels[meshChannelId];
 
-                pMarshal->Write<std::string>(std::string(pMeshChannel->mName.C_Str()));
+                structure.Write<std::string>(std::string(pMeshChannel->mName.C_Str()));
 
-                pMarshal->Write<bool>(pMeshChannel->mKeys);
-                if (pMeshChannel->mKeys) {
-                    pMarshal->Write<uint64_t>(pMeshChannel->mNumKeys);
-                    pMarshal->WriteBlock((void*)pMeshChannel->mKeys, pMeshChannel->mNumKeys * sizeof(aiMeshKey));
-                }
+                structure.Write<uint64_t>(pMeshChannel->mKeys ? pMeshChannel->mNumKeys : 0);
+                writer.WriteArray(pMeshChannel->mKeys, pMeshChannel->mNumKeys * sizeof(aiMeshKey));
             }
 
-            pMarshal->Write<uint64_t>(pAnimation->mNumMorphMeshChannels);
+            structure.Write<uint64_t>(pAnimation->mNumMorphMeshChannels);
 
             for (uint64_t morphMeshChannelId = 0; morphMeshChannelId < pAnimation->mNumMorphMeshChannels; ++morphMeshChannelId) {
                 auto&& pMorphMeshChannel = pAnimation->mMorphMeshChannels[morphMeshChannelId];
 
-                pMarshal->Write<std::string>(std::string(pMorphMeshChannel->mName.C_Str()));
+                structure.Write<std::string>(std::string(pMorphMeshChannel->mName.C_Str()));
 
-                pMarshal->Write<uint64_t>(pMorphMeshChannel->mNumKeys);
+                structure.Write<uint64_t>(pMorphMeshChannel->mNumKeys);
 
                 for (uint64_t keyId = 0; keyId < pMorphMeshChannel->mNumKeys; ++keyId) {
                     auto&& key = pMorphMeshChannel->mKeys[keyId];
 
-                    pMarshal->Write<double_t>(key.mTime);
-                    pMarshal->Write<uint64_t>(key.mNumValuesAndWeights);
+                    structure.Write<double_t>(key.mTime);
+                    structure.Write<uint64_t>(key.mNumValuesAndWeights);
 
-                    if (key.mNumValuesAndWeights > 0) {
-                        pMarshal->WriteBlock((void *) key.mValues, key.mNumValuesAndWeights * sizeof(uint32_t));
-                        pMarshal->WriteBlock((void *) key.mWeights, key.mNumValuesAndWeights * sizeof(double_t));
-                    }
+                    writer.WriteArray(key.mValues, key.mNumValuesAndWeights * sizeof(uint32_t));
+                    writer.WriteArray(key.mWeights, key.mNumValuesAndWeights * sizeof(double_t));
                 }
             }
         }
     }
 
-    void AssimpCache::LoadAnimations(SR_HTYPES_NS::Marshal* pMarshal, aiScene* pScene) const {
-        pScene->mNumAnimations = pMarshal->Read<uint64_t>();
-        if (pScene->mNumAnimations > 0) {
-            pScene->mAnimations = new aiAnimation*[pScene->mNumAnimations];
-        }
-        else {
-            pScene->mAnimations = nullptr;
-        }
+    void AssimpCache::LoadAnimations(Reader& reader, aiScene* pScene) const {
+        auto&& structure = reader.structure;
+
+        pScene->mNumAnimations = structure.Read<uint64_t>();
+        pScene->mAnimations = pScene->mNumAnimations > 0 ? new aiAnimation*[pScene->mNumAnimations]() : nullptr;
 
         for (uint64_t animationId = 0; animationId < pScene->mNumAnimations; ++animationId) {
             auto&& pAnimation = pScene->mAnimations[animationId];
             pAnimation = new aiAnimation();
 
-            pAnimation->mName = pMarshal->Read<std::string>();
-            pAnimation->mDuration = pMarshal->Read<double_t>();
-            pAnimation->mTicksPerSecond = pMarshal->Read<double_t>();
+            pAnimation->mName = structure.Read<std::string>();
+            pAnimation->mDuration = structure.Read<double_t>();
+            pAnimation->mTicksPerSecond = structure.Read<double_t>();
 
-            pAnimation->mNumChannels = pMarshal->Read<uint64_t>();
-            if (pAnimation->mNumChannels > 0) {
-                pAnimation->mChannels = new aiNodeAnim*[pAnimation->mNumChannels];
-            }
-            else {
-                pAnimation->mChannels = nullptr;
-            }
+            pAnimation->mNumChannels = structure.Read<uint64_t>();
+            pAnimation->mChannels = pAnimation->mNumChannels > 0 ? new aiNodeAnim*[pAnimation->mNumChannels]() : nullptr;
 
             for (uint64_t channelId = 0; channelId < pAnimation->mNumChannels; ++channelId) {
                 auto&& pChannel = pAnimation->mChannels[channelId];
                 pChannel = new aiNodeAnim();
 
-                pChannel->mNodeName = pMarshal->Read<std::string>();
-                pChannel->mPreState = static_cast<aiAnimBehaviour>(pMarshal->Read<uint64_t>());
-                pChannel->mPostState = static_cast<aiAnimBehaviour>(pMarshal->Read<uint64_t>());
+                pChannel->mNodeName = structure.Read<std::string>();
+                pChannel->mPreState = static_cast<aiAnimBehaviour>(structure.Read<uint64_t>());
+                pChannel->mPostState = static_cast<aiAnimBehaviour>(structure.Read<uint64_t>());
 
-                if (pMarshal->Read<bool>()) {
-                    pChannel->mNumPositionKeys = pMarshal->Read<uint64_t>();
-                    pChannel->mPositionKeys = new aiVectorKey[pChannel->mNumPositionKeys];
-                    pMarshal->ReadBlock((void*)pChannel->mPositionKeys);
-                }
-                else {
-                    pChannel->mPositionKeys = nullptr;
-                }
+                pChannel->mNumPositionKeys = structure.Read<uint64_t>();
+                pChannel->mPositionKeys = reader.ReadArray<aiVectorKey>(pChannel->mNumPositionKeys);
 
-                if (pMarshal->Read<bool>()) {
-                    pChannel->mNumRotationKeys = pMarshal->Read<uint64_t>();
-                    pChannel->mRotationKeys = new aiQuatKey[pChannel->mNumRotationKeys];
-                    pMarshal->ReadBlock((void*)pChannel->mRotationKeys);
-                }
-                else {
-                    pChannel->mRotationKeys = nullptr;
-                }
+                pChannel->mNumRotationKeys = structure.Read<uint64_t>();
+                pChannel->mRotationKeys = reader.ReadArray<aiQuatKey>(pChannel->mNumRotationKeys);
 
-                if (pMarshal->Read<bool>()) {
-                    pChannel->mNumScalingKeys = pMarshal->Read<uint64_t>();
-                    pChannel->mScalingKeys = new aiVectorKey[pChannel->mNumScalingKeys];
-                    pMarshal->ReadBlock((void*)pChannel->mScalingKeys);
-                }
-                else {
-                    pChannel->mScalingKeys = nullptr;
-                }
+                pChannel->mNumScalingKeys = structure.Read<uint64_t>();
+                pChannel->mScalingKeys = reader.ReadArray<aiVectorKey>(pChannel->mNumScalingKeys);
             }
 
-            pAnimation->mNumMeshChannels = pMarshal->Read<uint64_t>();
-            if (pAnimation->mNumMeshChannels > 0) {
-                pAnimation->mMeshChannels = new aiMeshAnim*[pAnimation->mNumMeshChannels];
-            }
-            else {
-                pAnimation->mMeshChannels = nullptr;
-            }
+            pAnimation->mNumMeshChannels = structure.Read<uint64_t>();
+            pAnimation->mMeshChannels = pAnimation->mNumMeshChannels > 0 ? new aiMeshAnim*[pAnimation->mNumMeshChannels]() : nullptr;
 
             for (uint64_t meshChannelId = 0; meshChannelId < pAnimation->mNumMeshChannels; ++meshChannelId) {
                 auto&& pMeshChannel = pAnimation->mMeshChannels[meshChannelId];
                 pMeshChannel = new aiMeshAnim();
 
-                pMeshChannel->mName = pMarshal->Read<std::string>();
+                pMeshChannel->mName = structure.Read<std::string>();
 
-                if (pMarshal->Read<bool>()) {
-                    pMeshChannel->mNumKeys = pMarshal->Read<uint64_t>();
-                    pMeshChannel->mKeys = new aiMeshKey[pMeshChannel->mNumKeys];
-                    pMarshal->ReadBlock((void*)pMeshChannel->mKeys);
-                }
-                else {
-                    pMeshChannel->mKeys = nullptr;
-                }
+                pMeshChannel->mNumKeys = structure.Read<uint64_t>();
+                pMeshChannel->mKeys = reader.ReadArray<aiMeshKey>(pMeshChannel->mNumKeys);
             }
 
-            pAnimation->mNumMorphMeshChannels = pMarshal->Read<uint64_t>();
-            if (pAnimation->mNumMorphMeshChannels > 0) {
-                pAnimation->mMorphMeshChannels = new aiMeshMorphAnim*[pAnimation->mNumMorphMeshChannels];
-            }
-            else {
-                pAnimation->mMorphMeshChannels = nullptr;
-            }
+            pAnimation->mNumMorphMeshChannels = structure.Read<uint64_t>();
+            pAnimation->mMorphMeshChannels = pAnimation->mNumMorphMeshChannels > 0 ? new aiMeshMorphAnim*[pAnimation->mNumMorphMeshChannels]() : nullptr;
 
             for (uint64_t morphMeshChannelId = 0; morphMeshChannelId < pAnimation->mNumMorphMeshChannels; ++morphMeshChannelId) {
                 auto&& pMorphMeshChannel = pAnimation->mMorphMeshChannels[morphMeshChannelId];
                 pMorphMeshChannel = new aiMeshMorphAnim();
 
-                pMorphMeshChannel->mName = pMarshal->Read<std::string>();
+                pMorphMeshChannel->mName = structure.Read<std::string>();
 
-                pMorphMeshChannel->mNumKeys = pMarshal->Read<uint64_t>();
-                if (pMorphMeshChannel->mNumKeys > 0) {
-                    pMorphMeshChannel->mKeys = new aiMeshMorphKey[pMorphMeshChannel->mNumKeys];
-                }
-                else {
-                    pMorphMeshChannel->mKeys = nullptr;
-                }
+                pMorphMeshChannel->mNumKeys = structure.Read<uint64_t>();
+                pMorphMeshChannel->mKeys = pMorphMeshChannel->mNumKeys > 0 ? new aiMeshMorphKey[pMorphMeshChannel->mNumKeys] : nullptr;
 
                 for (uint64_t keyId = 0; keyId < pMorphMeshChannel->mNumKeys; ++keyId) {
                     auto&& key = pMorphMeshChannel->mKeys[keyId];
 
-                    key.mTime = pMarshal->Read<double_t>();
-                    key.mNumValuesAndWeights = pMarshal->Read<uint64_t>();
+                    key.mTime = structure.Read<double_t>();
+                    key.mNumValuesAndWeights = structure.Read<uint64_t>();
 
-                    if (key.mNumValuesAndWeights > 0) {
-                        pMarshal->ReadBlock((void*)key.mValues);
-                        pMarshal->ReadBlock((void*)key.mWeights);
-                    }
+                    key.mValues = reader.ReadArray<uint32_t>(key.mNumValuesAndWeights);
+                    key.mWeights = reader.ReadArray<double_t>(key.mNumValuesAndWeights);
                 }
             }
         }
     }
 
-    void AssimpCache::SaveSkeletons(SR_HTYPES_NS::Marshal* pMarshal, const aiScene* pScene) const {
+    void AssimpCache::SaveSkeletons(Writer& writer, const aiScene* pScene) const {
         auto&& nodeMap = BuildNodeMap(pScene);
         auto&& meshMap = BuildMeshMap(pScene);
+        auto&& structure = writer.structure;
 
-        pMarshal->Write<uint64_t>(pScene->mNumSkeletons);
-
-        if (pScene->mNumSkeletons == 0) {
-            return;
-        }
+        structure.Write<uint64_t>(pScene->mNumSkeletons);
 
         for (uint64_t skeletonId = 0; skeletonId < pScene->mNumSkeletons; ++skeletonId) {
             auto&& pSkeleton = pScene->mSkeletons[skeletonId];
 
-            pMarshal->Write<std::string>(std::string(pSkeleton->mName.C_Str()));
-            pMarshal->Write<uint64_t>(pSkeleton->mNumBones);
+            structure.Write<std::string>(std::string(pSkeleton->mName.C_Str()));
+            structure.Write<uint64_t>(pSkeleton->mNumBones);
 
             for (uint64_t boneId = 0; boneId < pSkeleton->mNumBones; ++boneId) {
                 auto&& pBone = pSkeleton->mBones[boneId];
 
-                pMarshal->Write<bool>(pBone->mMeshId);
-                if (pBone->mMeshId) {
-                    pMarshal->Write<uint64_t>(meshMap.second.at(pBone->mMeshId));
-                }
+                writer.WriteReference(meshMap.second, pBone->mMeshId);
+                writer.WriteReference(nodeMap.second, pBone->mArmature);
+                writer.WriteReference(nodeMap.second, pBone->mNode);
 
-                pMarshal->Write<bool>(pBone->mArmature);
-                if (pBone->mArmature) {
-                    pMarshal->Write<uint64_t>(nodeMap.second.at(pBone->mArmature));
-                }
-
-                pMarshal->Write<bool>(pBone->mNode);
-                if (pBone->mNode) {
-                    pMarshal->Write<uint64_t>(nodeMap.second.at(pBone->mNode));
-                }
+                structure.Write<int32_t>(pBone->mParent);
 
-                pMarshal->Write<uint64_t>(pBone->mParent);
+                structure.Write<uint64_t>(pBone->mWeights ? pBone->mNumnWeights : 0);
+                writer.WriteArray(pBone->mWeights, pBone->mNumnWeights * sizeof(aiVertexWeight));
 
-                pMarshal->Write<uint64_t>(pBone->mNumnWeights);
-                if (pBone->mNumnWeights > 0) {
-                    pMarshal->WriteBlock((void *) pBone->mWeights, pBone->mNumnWeights * sizeof(aiVertexWeight));
-                }
-
-                pMarshal->WriteBlock((void*)&pBone->mLocalMatrix, sizeof(aiMatrix4x4));
-                pMarshal->WriteBlock((void*)&pBone->mOffsetMatrix, sizeof(aiMatrix4x4));
+                structure.WriteBlock((void*)&pBone->mLocalMatrix, sizeof(aiMatrix4x4));
+                structure.WriteBlock((void*)&pBone->mOffsetMatrix, sizeof(aiMatrix4x4));
             }
         }
     }
 
-    void AssimpCache::LoadSkeletons(SR_HTYPES_NS::Marshal* pMarshal, aiScene* pScene) const {
+    void AssimpCache::LoadSkeletons(Reader& reader, aiScene* pScene) const {
         auto&& nodeMap = BuildNodeMap(pScene);
         auto&& meshMap = BuildMeshMap(pScene);
+        auto&& structure = reader.structure;
 
-        pScene->mNumSkeletons = pMarshal->Read<uint64_t>();
-        if (pScene->mNumSkeletons > 0) {
-            pScene->mSkeletons = new aiSkeleton*[pScene->mNumSkeletons];
-        }
+        pScene->mNumSkeletons = structure.Read<uint64_t>();
+        pScene->mSkeletons = pScene->mNumSkeletons > 0 ? new aiSkeleton*[pScene->mNumSkeletons]() : nullptr;
 
         for (uint64_t skeletonId = 0; skeletonId < pScene->mNumSkeletons; ++skeletonId) {
             auto&& pSkeleton = pScene->mSkeletons[skeletonId];
             pSkeleton = new aiSkeleton();
 
-            pSkeleton->mName = pMarshal->Read<std::string>();
+            pSkeleton->mName = structure.Read<std::string>();
 
-            pSkeleton->mNumBones = pMarshal->Read<uint64_t>();
-            if (pSkeleton->mNumBones > 0) {
-                pSkeleton->mBones = new aiSkeletonBone*[pSkeleton->mNumBones];
-            }
+            pSkeleton->mNumBones = structure.Read<uint64_t>();
+            pSkeleton->mBones = pSkeleton->mNumBones > 0 ? new aiSkeletonBone*[pSkeleton->mNumBones]() : nullptr;
 
             for (uint64_t boneId = 0; boneId < pSkeleton->mNumBones; ++boneId) {
                 auto&& pBone = pSkeleton->mBones[boneId];
                 pBone = new aiSkeletonBone();
 
-                if (pMarshal->Read<bool>()) {
-                    pBone->mMeshId = meshMap.first[pMarshal->Read<uint64_t>()];
-                }
-                else {
-                    pBone->mMeshId = nullptr;
-                }
+                pBone->mMeshId = reader.ReadReference(meshMap.first);
+                pBone->mArmature = reader.ReadReference(nodeMap.first);
+                pBone->mNode = reader.ReadReference(nodeMap.first);
 
-                if (pMarshal->Read<bool>()) {
-                    pBone->mArmature = nodeMap.first[pMarshal->Read<uint64_t>()];
-                }
-                else {
-                    pBone->mArmature = nullptr;
-                }
+                pBone->mParent = structure.Read<int32_t>();
 
-                if (pMarshal->Read<bool>()) {
-                    pBone->mNode = nodeMap.first[pMarshal->Read<uint64_t>()];
-                }
-                else {
-                    pBone->mNode = nullptr;
-                }
+                pBone->mNumnWeights = structure.Read<uint64_t>();
+                pBone->mWeights = reader.ReadArray<aiVertexWeight>(pBone->mNumnWeights);
 
-                pBone->mParent = pMarshal->Read<uint64_t>();
-
-                pBone->mNumnWeights = pMarshal->Read<uint64_t>();
-                if (pBone->mNumnWeights > 0) {
-                    pBone->mWeights = new aiVertexWeight[pBone->mNumnWeights];
-                    pMarshal->ReadBlock((void *) pBone->mWeights);
-                }
-                else {
-                    pBone->mWeights = nullptr;
-                }
-
-                pMarshal->ReadBlock((void*)&pBone->mLocalMatrix);
-                pMarshal->ReadBlock((void*)&pBone->mOffsetMatrix);
+                structure.ReadBlock((void*)&pBone->mLocalMatrix);
+                structure.ReadBlock((void*)&pBone->mOffsetMatrix);
             }
         }
     }
 
-    void AssimpCache::LoadMeshes(SR_HTYPES_NS::Marshal* pMarshal, aiScene* pScene) const {
+    void AssimpCache::LoadMeshes(Reader& reader, aiScene* pScene) const {
         auto&& nodeMap = BuildNodeMap(pScene);
+        auto&& structure = reader.structure;
 
-        pScene->mNumMeshes = pMarshal->Read<uint64_t>();
-        pScene->mMeshes = new aiMesh*[pScene->mNumMeshes];
+        pScene->mNumMeshes = structure.Read<uint64_t>();
+        pScene->mMeshes = pScene->mNumMeshes > 0 ? new aiMesh*[pScene->mNumMeshes]() : nullptr;
 
         for (uint64_t meshId = 0; meshId < pScene->mNumMeshes; ++meshId) {
             auto&& pMesh = pScene->mMeshes[meshId];
             pMesh = new aiMesh();
 
-            pMesh->mPrimitiveTypes = pMarshal->Read<uint64_t>();
-            pMesh->mMaterialIndex = pMarshal->Read<uint64_t>();
-            pMesh->mMethod = static_cast<aiMorphingMethod>(pMarshal->Read<uint64_t>());
+            pMesh->mPrimitiveTypes = structure.Read<uint64_t>();
+            pMesh->mMaterialIndex = structure.Read<uint64_t>();
+            pMesh->mMethod = static_cast<aiMorphingMethod>(structure.Read<uint64_t>());
 
-            pMarshal->ReadBlock(&pMesh->mAABB);
+            structure.ReadBlock(&pMesh->mAABB);
 
             /// --------------------------------------------------------------------------------------------------------
 
-            LoadMesh(pMarshal, pMesh);
+            LoadMesh(reader, pMesh);
 
             /// --------------------------------------------------------------------------------------------------------
 
             for (uint8_t i = 0; i < SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                pMesh->mNumUVComponents[i] = pMarshal->Read<uint64_t>();
+                pMesh->mNumUVComponents[i] = structure.Read<uint64_t>();
             }
 
             /// has texture coords names
-            if (pMarshal->Read<bool>()) {
-                pMesh->mTextureCoordsNames = new aiString*[SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS];
+            if (structure.Read<bool>()) {
+                pMesh->mTextureCoordsNames = new aiString*[SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS]();
             }
 
             for (uint8_t i = 0; pMesh->mTextureCoordsNames && i < SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
                 auto&& pTextureCoordName = pMesh->mTextureCoordsNames[i];
 
                 /// has name
-                if (pMarshal->Read<bool>()) {
+                if (structure.Read<bool>()) {
                     pTextureCoordName = new aiString();
-                    *pTextureCoordName = pMarshal->Read<std::string>();
+                    *pTextureCoordName = structure.Read<std::string>();
                 }
                 else {
                     pTextureCoordName = nullptr;
@@ -419,201 +626,203 @@ namespace SR_UTILS_NS {
 
             /// --------------------------------------------------------------------------------------------------------
 
-            pMesh->mNumFaces = pMarshal->Read<uint64_t>();
+            /// индексы всех граней одним массивом, грани ссылаются в него
+            pMesh->mNumFaces = structure.Read<uint64_t>();
+            const uint64_t faceSize = structure.Read<uint64_t>();
+            const uint64_t indexCount = structure.Read<uint64_t>();
+
+            auto&& pIndices = reader.ReadArray<uint32_t>(indexCount);
+            auto&& pFaceSizes = faceSize == 0 ? reader.ReadArray<uint32_t>(pMesh->mNumFaces) : nullptr;
 
             if (pMesh->mNumFaces > 0) {
                 pMesh->mFaces = new aiFace[pMesh->mNumFaces];
             }
 
-            for (uint64_t faceId = 0; faceId < pMesh->mNumFaces; ++faceId) {
-                auto&& face = pMesh->mFaces[faceId];
-                face.mNumIndices = pMarshal->Read<uint64_t>();
-                if (face.mNumIndices > 0) {
-                    face.mIndices = new unsigned int[face.mNumIndices];
-                    pMarshal->ReadBlock(face.mIndices);
+            for (uint64_t faceId = 0, offset = 0; pIndices && faceId < pMesh->mNumFaces; ++faceId) {
+                const uint64_t count = pFaceSizes ? pFaceSizes[faceId] : faceSize;
+
+                if (count > indexCount - offset) {
+                    reader.valid = false;
+                    break;
                 }
+
+                auto&& face = pMesh->mFaces[faceId];
+                face.mNumIndices = count;
+                face.mIndices = pIndices + offset;
+
+                offset += count;
             }
 
             /// --------------------------------------------------------------------------------------------------------
 
-            pMesh->mNumBones = pMarshal->Read<uint64_t>();
-            if (pMesh->mNumBones > 0) {
-                pMesh->mBones = new aiBone*[pMesh->mNumBones];
-            }
+            pMesh->mNumBones = structure.Read<uint64_t>();
+            pMesh->mBones = pMesh->mNumBones > 0 ? new aiBone*[pMesh->mNumBones]() : nullptr;
 
             for (uint64_t boneId = 0; boneId < pMesh->mNumBones; ++boneId) {
                 auto&& pBone = pMesh->mBones[boneId];
                 pBone = new aiBone();
 
-                pBone->mName = pMarshal->Read<std::string>();
+                pBone->mName = structure.Read<std::string>();
 
-                if (pMarshal->Read<bool>()) {
-                    pBone->mArmature = nodeMap.first[pMarshal->Read<uint64_t>()];
-                }
-                else {
-                    pBone->mArmature = nullptr;
-                }
+                pBone->mArmature = reader.ReadReference(nodeMap.first);
+                pBone->mNode = reader.ReadReference(nodeMap.first);
 
-                if (pMarshal->Read<bool>()) {
-                    pBone->mNode = nodeMap.first[pMarshal->Read<uint64_t>()];
-                }
-                else {
-                    pBone->mNode = nullptr;
-                }
+                pBone->mNumWeights = structure.Read<uint64_t>();
+                pBone->mWeights = reader.ReadArray<aiVertexWeight>(pBone->mNumWeights);
 
-                pBone->mNumWeights = pMarshal->Read<uint64_t>();
-                if (pBone->mNumWeights > 0) {
-                    pBone->mWeights = new aiVertexWeight[pBone->mNumWeights];
-                    pMarshal->ReadBlock((void*)pBone->mWeights);
-                }
-                else {
-                    pBone->mWeights = nullptr;
-                }
-
-                pMarshal->ReadBlock((void*)&pBone->mOffsetMatrix);
+                structure.ReadBlock((void*)&pBone->mOffsetMatrix);
             }
 
             /// --------------------------------------------------------------------------------------------------------
 
-            pMesh->mNumAnimMeshes = pMarshal->Read<uint64_t>();
-            if (pMesh->mNumAnimMeshes > 0) {
-                pMesh->mAnimMeshes = new aiAnimMesh*[pMesh->mNumAnimMeshes];
-            }
+            pMesh->mNumAnimMeshes = structure.Read<uint64_t>();
+            pMesh->mAnimMeshes = pMesh->mNumAnimMeshes > 0 ? new aiAnimMesh*[pMesh->mNumAnimMeshes]() : nullptr;
 
             for (uint64_t animatedMeshId = 0; animatedMeshId < pMesh->mNumAnimMeshes; ++animatedMeshId) {
                 auto&& pAnimatedMesh = pMesh->mAnimMeshes[animatedMeshId];
                 pAnimatedMesh = new aiAnimMesh();
 
-                pAnimatedMesh->mWeight = pMarshal->Read<float_t>();
+                pAnimatedMesh->mWeight = structure.Read<float_t>();
 
-                LoadMesh(pMarshal, pAnimatedMesh);
+                LoadMesh(reader, pAnimatedMesh);
             }
         }
     }
 
-    void AssimpCache::SaveMeshes(SR_HTYPES_NS::Marshal* pMarshal, const aiScene* pScene) const {
+    void AssimpCache::SaveMeshes(Writer& writer, const aiScene* pScene) const {
         auto&& nodeMap = BuildNodeMap(pScene);
+        auto&& structure = writer.structure;
 
-        pMarshal->Write<uint64_t>(pScene->mNumMeshes);
+        structure.Write<uint64_t>(pScene->mNumMeshes);
+
+        std::vector<uint32_t> indices;
+        std::vector<uint32_t> faceSizes;
 
         for (uint64_t meshId = 0; meshId < pScene->mNumMeshes; ++meshId) {
             auto&& pMesh = pScene->mMeshes[meshId];
 
-            pMarshal->Write<uint64_t>(pMesh->mPrimitiveTypes);
-            pMarshal->Write<uint64_t>(pMesh->mMaterialIndex);
-            pMarshal->Write<uint64_t>(pMesh->mMethod);
+            structure.Write<uint64_t>(pMesh->mPrimitiveTypes);
+            structure.Write<uint64_t>(pMesh->mMaterialIndex);
+            structure.Write<uint64_t>(pMesh->mMethod);
 
-            pMarshal->WriteBlock(&pMesh->mAABB, 2 * 3 * sizeof(float_t));
+            structure.WriteBlock(&pMesh->mAABB, 2 * 3 * sizeof(float_t));
 
             /// --------------------------------------------------------------------------------------------------------
 
-            SaveMesh(pMarshal, pMesh);
+            SaveMesh(writer, pMesh);
 
             /// --------------------------------------------------------------------------------------------------------
 
             for (uint8_t i = 0; i < SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
-                pMarshal->Write<uint64_t>(pMesh->mNumUVComponents[i]);
+                structure.Write<uint64_t>(pMesh->mNumUVComponents[i]);
             }
 
-            pMarshal->Write<bool>(pMesh->mTextureCoordsNames); /// has texture coords names
+            structure.Write<bool>(pMesh->mTextureCoordsNames); /// has texture coords names
 
             for (uint8_t i = 0; pMesh->mTextureCoordsNames && i < SR_ASSIMP_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
                 auto&& pTextureCoordName = pMesh->mTextureCoordsNames[i];
-                pMarshal->Write<bool>(pTextureCoordName); /// has name
+                structure.Write<bool>(pTextureCoordName); /// has name
                 if (pTextureCoordName) {
-                    pMarshal->Write<std::string>(pTextureCoordName->C_Str());
+                    structure.Write<std::string>(pTextureCoordName->C_Str());
                 }
             }
 
             /// --------------------------------------------------------------------------------------------------------
 
-            pMarshal->Write<uint64_t>(pMesh->mNumFaces);
+            /// у триангулированных мешей размер граней одинаковый, тогда массив размеров не пишется
+            indices.clear();
+            faceSizes.clear();
+
+            uint64_t faceSize = pMesh->mNumFaces > 0 ? pMesh->mFaces[0].mNumIndices : 0;
 
             for (uint64_t faceId = 0; faceId < pMesh->mNumFaces; ++faceId) {
                 auto&& face = pMesh->mFaces[faceId];
-                pMarshal->Write<uint64_t>(face.mNumIndices);
-                if (face.mNumIndices > 0) {
-                    pMarshal->WriteBlock(face.mIndices, face.mNumIndices * sizeof(unsigned int));
+                indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
+                faceSizes.emplace_back(face.mNumIndices);
+
+                if (face.mNumIndices != faceSize) {
+                    faceSize = 0;
                 }
             }
 
+            structure.Write<uint64_t>(pMesh->mNumFaces);
+            structure.Write<uint64_t>(faceSize);
+            structure.Write<uint64_t>(indices.size());
+
+            writer.WriteArray(indices.data(), indices.size() * sizeof(uint32_t));
+            if (faceSize == 0) {
+                writer.WriteArray(faceSizes.data(), faceSizes.size() * sizeof(uint32_t));
+            }
+
             /// --------------------------------------------------------------------------------------------------------
 
-            pMarshal->Write<uint64_t>(pMesh->mNumBones);
+            structure.Write<uint64_t>(pMesh->mNumBones);
 
             for (uint64_t boneId = 0; boneId < pMesh->mNumBones; ++boneId) {
                 auto&& pBone = pMesh->mBones[boneId];
 
-                pMarshal->Write<std::string>(std::string(pBone->mName.C_Str()));
+                structure.Write<std::string>(std::string(pBone->mName.C_Str()));
 
-                pMarshal->Write<bool>(pBone->mArmature);
-                if (pBone->mArmature) {
-                    pMarshal->Write<uint64_t>(nodeMap.second.at(pBone->mArmature));
-                }
-
-                pMarshal->Write<bool>(pBone->mNode);
-                if (pBone->mNode) {
-                    pMarshal->Write<uint64_t>(nodeMap.second.at(pBone->mNode));
-                }
+                writer.WriteReference(nodeMap.second, pBone->mArmature);
+                writer.WriteReference(nodeMap.second, pBone->mNode);
 
-                pMarshal->Write<uint64_t>(pBone->mNumWeights);
                 SRAssertOnce(pBone->mNumWeights <= AI_MAX_BONE_WEIGHTS);
-                if (pBone->mNumWeights > 0) {
-                    pMarshal->WriteBlock((void *) pBone->mWeights, pBone->mNumWeights * sizeof(aiVertexWeight));
-                }
+                structure.Write<uint64_t>(pBone->mWeights ? pBone->mNumWeights : 0);
+                writer.WriteArray(pBone->mWeights, pBone->mNumWeights * sizeof(aiVertexWeight));
 
-                pMarshal->WriteBlock((void*)&pBone->mOffsetMatrix, sizeof(aiMatrix4x4));
+                structure.WriteBlock((void*)&pBone->mOffsetMatrix, sizeof(aiMatrix4x4));
             }
 
             /// --------------------------------------------------------------------------------------------------------
 
-            pMarshal->Write<uint64_t>(pMesh->mNumAnimMeshes);
+            structure.Write<uint64_t>(pMesh->mNumAnimMeshes);
 
             for (uint64_t animatedMeshId = 0; animatedMeshId < pMesh->mNumAnimMeshes; ++animatedMeshId) {
                 auto&& pAnimatedMesh = pMesh->mAnimMeshes[animatedMeshId];
 
-                pMarshal->Write<float_t>(pAnimatedMesh->mWeight);
+                structure.Write<float_t>(pAnimatedMesh->mWeight);
 
-                SaveMesh(pMarshal, pAnimatedMesh);
+                SaveMesh(writer, pAnimatedMesh);
             }
         }
     }
 
-    void AssimpCache::LoadNode(SR_HTYPES_NS::Marshal* pMarshal, aiNode*& pNode) const {
-        pNode = new aiNode();
+    void AssimpCache::LoadNode(Reader& reader, aiNode*& pNode) const {
+        auto&& structure = reader.structure;
 
-        pNode->mName = pMarshal->Read<std::string>();
+        pNode = new aiNode();
 
-        pMarshal->ReadBlock((void*)&pNode->mTransformation);
+        pNode->mName = structure.Read<std::string>();
 
-        pNode->mNumMeshes = pMarshal->Read<uint64_t>();
-        pNode->mMeshes = new uint32_t[pNode->mNumMeshes];
-        pMarshal->ReadBlock((void*)pNode->mMeshes);
+        structure.ReadBlock((void*)&pNode->mTransformation);
 
-        pNode->mNumChildren = pMarshal->Read<uint64_t>();
+        pNode->mNumMeshes = structure.Read<uint64_t>();
+        pNode->mMeshes = pNode->mNumMeshes > 0 ? new uint32_t[pNode->mNumMeshes] : nullptr;
+        structure.ReadBlock((void*)pNode->mMeshes);
 
-        if (pNode->mNumChildren > 0) {
-            pNode->mChildren = new aiNode*[pNode->mNumChildren];
-        }
+        pNode->mNumChildren = structure.Read<uint64_t>();
+        pNode->mChildren = pNode->mNumChildren > 0 ? new aiNode*[pNode->mNumChildren]() : nullptr;
 
         for (uint64_t childId = 0; childId < pNode->mNumChildren; ++childId) {
-            LoadNode(pMarshal, pNode->mChildren[childId]);
+            LoadNode(reader, pNode->mChildren[childId]);
             pNode->mChildren[childId]->mParent = pNode;
         }
     }
 
-    void AssimpCache::SaveNode(SR_HTYPES_NS::Marshal* pMarshal, const aiNode* pNode) const {
-        pMarshal->Write<std::string>(std::string(pNode->mName.C_Str()));
+    void AssimpCache::SaveNode(Writer& writer, const aiNode* pNode) const {
+        auto&& structure = writer.structure;
+
+        structure.Write<std::string>(std::string(pNode->mName.C_Str()));
 
-        pMarshal->WriteBlock((void*)&pNode->mTransformation, sizeof(aiMatrix4x4));
+        structure.WriteBlock((void*)&pNode->mTransformation, sizeof(aiMatrix4x4));
 
-        pMarshal->Write<uint64_t>(pNode->mNumMeshes);
-        pMarshal->WriteBlock((void*)pNode->mMeshes, pNode->mNumMeshes * sizeof(uint32_t));
+        structure.Write<uint64_t>(pNode->mNumMeshes);
+        structure.WriteBlock((void*)pNode->mMeshes, pNode->mNumMeshes * sizeof(uint32_t));
 
-        pMarshal->Write<uint64_t>(pNode->mNumChildren);
+        structure.Write<uint64_t>(pNode->mNumChildren);
 
         for (uint64_t childId = 0; childId < pNode->mNumChildren; ++childId) {
-            SaveNode(pMarshal, pNode->mChildren[childId]);
+            SaveNode(writer, pNode->mChildren[childId]);
         }
     }
 
@@ -621,35 +830,25 @@ namespace SR_UTILS_NS {
         AssimpCache::NodeMap nodeMap;
 
         if (!pScene->mRootNode) {
-            return std::move(nodeMap);
+            return nodeMap;
         }
 
-        std::stack<uint64_t> stack;
-        aiNode* pCurrentNode = pScene->mRootNode;
-
-        uint64_t index = 0;
-        uint64_t childId = 0;
+        /// прямой обход, порядок одинаковый при сохранении и загрузке
+        std::vector<aiNode*> stack = { pScene->mRootNode };
 
-        nodeMap.second[pCurrentNode] = index;
-        nodeMap.first.emplace_back(pCurrentNode);
+        while (!stack.empty()) {
+            aiNode* pNode = stack.back();
+            stack.pop_back();
 
-    retry:
-        if (pCurrentNode && childId < pCurrentNode->mNumChildren) {
-            pCurrentNode = pCurrentNode->mChildren[childId];
-            nodeMap.second[pCurrentNode] = ++index;
-            nodeMap.first.emplace_back(pCurrentNode);
-            stack.push(childId);
-            goto retry;
-        }
+            nodeMap.second[pNode] = nodeMap.first.size();
+            nodeMap.first.emplace_back(pNode);
 
-        if (!stack.empty()) {
-            pCurrentNode = pCurrentNode->mParent;
-            childId = stack.top() + 1;
-            stack.pop();
-            goto retry;
+            for (uint32_t childId = pNode->mNumChildren; childId > 0; --childId) {
+                stack.emplace_back(pNode->mChildren[childId - 1]);
+            }
         }
 
-        return std::move(nodeMap);
+        return nodeMap;
     }
 
     AssimpCache::MeshMap AssimpCache::BuildMeshMap(const aiScene* pScene) const {
@@ -660,15 +859,7 @@ namespace SR_UTILS_NS {
             meshMap.first.emplace_back(pScene->mMeshes[i]);
         }
 
-        return std::move(meshMap);
-    }
-
-    void AssimpCache::AllocateAiColor4t(void** pData, uint32_t count) {
-        *pData = (void*)(new aiColor4t<float>[count]);
-    }
-
-    void AssimpCache::AllocateAiVector3t(void** pData, uint32_t count) {
-        *pData = (void*)(new aiVector3t<float>[count]);
+        return meshMap;
     }
 }
-#endif
\ No newline at end of file
+#endif
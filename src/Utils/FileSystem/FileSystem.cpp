@@ -176,6 +176,8 @@ namespace SR_UTILS_NS {
         stream << text;
         stream.close();
 
+        Path::InvalidateAllMetadata();
+
         return true;
     }
 
@@ -278,6 +280,8 @@ namespace SR_UTILS_NS {
         file.write((char*)&hash, sizeof(uint64_t));
         file.close();
 
+        path.InvalidateMetadata();
+
         return true;
     }
 }
\ No newline at end of file
@@ -7,78 +7,318 @@
 #include <Utils/Platform/Platform.h>
 #include <Utils/Profile/TracyContext.h>
 
+#include <shared_mutex>
+#include <forward_list>
+
 namespace SR_UTILS_NS {
+    /// Метаданные упакованы в одно слово: тип (2 бита), поколение (30 бит), время проверки в мс (32 бита)
+    static constexpr uint64_t SR_PATH_METADATA_EMPTY = 0;
+
+    struct Path::Data {
+        std::string path;
+        std::string_view name;
+        std::string_view ext;
+        uint64_t hash = SR_UINT64_MAX;
+        mutable std::atomic<uint64_t> metadata = SR_PATH_METADATA_EMPTY;
+        /// число живых Path на запись, у пустой записи не считается
+        mutable std::atomic<uint32_t> references = 0;
+        bool pooled = false;
+        /// исходные строки, из которых получалась запись; узлы списка не перемещаются, на них ссылается индекс пула
+        std::forward_list<std::string> aliases;
+    };
+
+    static void ExtractNameAndExt(const std::string& path, std::string_view& name, std::string_view& ext) {
+        if (auto&& index = path.find_last_of("/\\"); index == std::string::npos) {
+            if (index = path.find_last_of('.'); index != std::string::npos) {
+                name = std::string_view { path.data(), index };
+                ext = std::string_view { path.data() + index + 1, path.size() - index - 1 };
+            }
+            else {
+                name = path;
+                ext = std::string_view();
+            }
+        }
+        else {
+            ++index;
+
+            if (auto dot = path.find_last_of('.'); dot != std::string::npos && dot > index) {
+                name = std::string_view { path.data() + index, dot - index };
+                ext = std::string_view { path.data() + dot + 1, path.size() - dot - 1 };
+            }
+            else {
+                name = std::string_view { path.data() + index, path.size() - index };
+                ext = std::string_view();
+            }
+        }
+    }
+
+    /**
+     * Пул нормализованных путей. Индекс ведется по полной строке, поэтому одинаковые пути
+     * всегда попадают в одну запись и сравнение Path по указателю корректно.
+     * Запись живет, пока на нее ссылается хоть один Path, и удаляется вместе со своими исходными строками.
+     * Счетчик увеличивается только под блокировкой пула, а последнее уменьшение делается под эксклюзивной,
+     * поэтому запись не может быть найдена в момент удаления.
+    */
+    class PathPool : public NonCopyable {
+    public:
+        static PathPool& Instance() {
+            static PathPool pool;
+            return pool;
+        }
+
+        SR_NODISCARD const Path::Data* GetEmpty() const noexcept { return &m_empty; }
+
+        SR_NODISCARD uint64_t GetSize() const {
+            std::shared_lock lock(m_mutex);
+            return m_paths.size();
+        }
+
+        const Path::Data* Intern(std::string_view source) {
+            if (source.empty()) {
+                return &m_empty;
+            }
+
+            {
+                std::shared_lock lock(m_mutex);
+                if (auto&& pIt = m_aliases.find(source); pIt != m_aliases.end()) {
+                    return Acquire(pIt->second);
+                }
+            }
+
+            SR_TRACY_ZONE;
+
+            std::string normalized = FileSystem::NormalizePath(std::string(source));
+            if (normalized.empty()) {
+                return &m_empty;
+            }
+
+            std::unique_lock lock(m_mutex);
+
+            /// другой поток мог добавить эту же строку, пока мы нормализовали
+            if (auto&& pIt = m_aliases.find(source); pIt != m_aliases.end()) {
+                return Acquire(pIt->second);
+            }
+
+            Path::Data* pData = nullptr;
+
+            if (auto&& pIt = m_paths.find(normalized); pIt != m_paths.end()) {
+                pData = pIt->second;
+            }
+            else {
+                pData = new Path::Data();
+                pData->path = std::move(normalized);
+                pData->hash = SR_HASH_STR(pData->path);
+                pData->pooled = true;
+                ExtractNameAndExt(pData->path, pData->name, pData->ext);
+
+                m_paths.insert(std::make_pair(std::string_view(pData->path), pData));
+            }
+
+            pData->aliases.emplace_front(source);
+            m_aliases.insert(std::make_pair(std::string_view(pData->aliases.front()), pData));
+
+            return Acquire(pData);
+        }
+
+        static void AddReference(const Path::Data* pData) noexcept {
+            if (pData->pooled) {
+                pData->references.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void RemoveReference(const Path::Data* pData) noexcept {
+            if (!pData->pooled) {
+                return;
+            }
+
+            /// пока ссылок больше одной, запись точно не удаляется и блокировка не нужна
+            uint32_t references = pData->references.load(std::memory_order_relaxed);
+            while (references > 1) {
+                if (pData->references.compare_exchange_weak(references, references - 1, std::memory_order_acq_rel)) {
+                    return;
+                }
+            }
+
+            std::unique_lock lock(m_mutex);
+
+            /// пока ждали блокировку, запись могли найти заново
+            if (pData->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+
+            for (auto&& alias : pData->aliases) {
+                m_aliases.erase(std::string_view(alias));
+            }
+
+            m_paths.erase(std::string_view(pData->path));
+
+            delete pData;
+        }
+
+    private:
+        PathPool() {
+            m_aliases.max_load_factor(0.9f);
+            m_paths.max_load_factor(0.9f);
+        }
+
+        static const Path::Data* Acquire(Path::Data* pData) noexcept {
+            pData->references.fetch_add(1, std::memory_order_relaxed);
+            return pData;
+        }
+
+    private:
+        mutable std::shared_mutex m_mutex;
+        Path::Data m_empty;
+        ska::flat_hash_map<std::string_view, Path::Data*> m_paths;
+        ska::flat_hash_map<std::string_view, Path::Data*> m_aliases;
+
+    };
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    static std::atomic<uint32_t> g_metadataGeneration = 1;
+    static std::atomic<uint32_t> g_metadataLifetime = 0;
+    static std::atomic<uint64_t> g_metadataQueries = 0;
+    static std::atomic<uint64_t> g_metadataSyscalls = 0;
+
+    static uint32_t GetMetadataTime() noexcept {
+        static const auto start = std::chrono::steady_clock::now();
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    static uint64_t PackMetadata(Path::Type type, uint32_t generation, uint32_t time) noexcept {
+        return (static_cast<uint64_t>(type) + 1) | (static_cast<uint64_t>(generation & 0x3FFFFFFFu) << 2u) | (static_cast<uint64_t>(time) << 32u);
+    }
+
+    static Path::Type QueryPathType(const std::string& path) {
+#ifdef SR_WIN32
+    if (path.size() < 2 || path[1] != ':') {
+        return Path::Type::Undefined;
+    }
+#elif defined(SR_LINUX)
+    if (path.empty() || path[0] != '/') {
+        return Path::Type::Undefined;
+    }
+#endif
+
+        SR_TRACY_ZONE;
+
+        ++g_metadataSyscalls;
+
+#if defined(SR_MSVC) || defined (SR_LINUX)
+        struct stat s{};
+        if(stat(path.c_str(), &s) == 0) {
+            if (s.st_mode & S_IFDIR) {
+                return Path::Type::Folder;
+            } else if (s.st_mode & S_IFREG) {
+                return Path::Type::File;
+            }
+        }
+
+        return Path::Type::Undefined;
+#elif defined(SR_WIN32)
+        DWORD attrib = GetFileAttributes(path.c_str());
+
+        if ((attrib & FILE_ATTRIBUTE_DIRECTORY) != 0)
+            return Path::Type::Folder;
+
+        return Path::Type::File;
+#elif defined(SR_ANDROID)
+        /// TODO: будем считать что мы обращаемся только к файлам. Это заглушка - нужно переделать
+        return Path::Type::File;
+#else
+        SRHalt("Unsupported OS!");
+        return Path::Type::Undefined;
+#endif
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
     Path::Path()
-        : m_path()
-        , m_name()
-        , m_ext()
-        , m_hash(SR_UINT64_MAX)
-        , m_type(Type::Undefined)
+        : m_data(GetEmptyData())
+    { }
+
+    Path::Path(const Path& path) noexcept
+        : m_data(path.m_data)
+    {
+        PathPool::AddReference(m_data);
+    }
+
+    Path::Path(Path&& path) noexcept
+        : m_data(SR_UTILS_NS::Exchange(path.m_data, GetEmptyData()))
     { }
 
     Path::Path(std::string_view path)
-        : Path(std::string(path))
+        : m_data(PathPool::Instance().Intern(path))
     { }
 
     Path::Path(std::wstring path)
-        : m_path(SR_WS2S(path))
-        , m_name()
-        , m_ext()
-        , m_hash(SR_UINT64_MAX)
-        , m_type(Type::Undefined)
-    {
-        Update();
-        m_hash = SR_HASH_STR(m_path);
-    }
+        : m_data(PathPool::Instance().Intern(SR_WS2S(path)))
+    { }
 
     Path::Path(SR_UTILS_NS::StringAtom stringAtom)
-        : m_path(stringAtom)
-        , m_name()
-        , m_ext()
-        , m_hash(SR_UINT64_MAX)
-        , m_type(Type::Undefined)
-    {
-        Update();
-        m_hash = SR_HASH_STR(m_path);
-    }
+        : m_data(PathPool::Instance().Intern(stringAtom.ToStringView()))
+    { }
 
     Path::Path(std::string path)
-        : m_path(std::move(path))
-        , m_name()
-        , m_ext()
-        , m_hash(SR_UINT64_MAX)
-        , m_type(Type::Undefined)
-    {
-        Update();
-        m_hash = SR_HASH_STR(m_path);
-    }
+        : m_data(PathPool::Instance().Intern(path))
+    { }
 
     Path::Path(const char* path)
-        : m_path(path)
-        , m_name()
-        , m_ext()
-        , m_hash(SR_UINT64_MAX)
-        , m_type(Type::Undefined)
-    {
-        Update();
-        m_hash = SR_HASH_STR(m_path);
+        : m_data(PathPool::Instance().Intern(path ? std::string_view(path) : std::string_view()))
+    { }
+
+    Path::~Path() {
+        PathPool::Instance().RemoveReference(m_data);
     }
 
-    Path Path::Normalize() {
-        NormalizeSelf();
+    Path& Path::operator=(const Path& path) noexcept {
+        /// сначала ссылка на новую запись, чтобы присваивание самому себе не удалило запись
+        PathPool::AddReference(path.m_data);
+        PathPool::Instance().RemoveReference(m_data);
+        m_data = path.m_data;
+        return *this;
+    }
+
+    Path& Path::operator=(Path&& path) noexcept {
+        if (this != &path) {
+            PathPool::Instance().RemoveReference(m_data);
+            m_data = SR_UTILS_NS::Exchange(path.m_data, GetEmptyData());
+        }
         return *this;
     }
 
+    const Path::Data* Path::GetEmptyData() noexcept {
+        return PathPool::Instance().GetEmpty();
+    }
+
+    uint64_t Path::GetPoolSize() {
+        return PathPool::Instance().GetSize();
+    }
+
+    Path::operator const std::string&() const noexcept {
+        return m_data->path;
+    }
+
+    char Path::operator[](size_t index) const noexcept {
+        if (index >= m_data->path.size()) {
+             std::cerr << "Path::operator[] : index is out of range!\n";
+             SR_MAKE_BREAKPOINT;
+             return char();
+        }
+        return m_data->path[index];
+    }
+
     std::string Path::ToString() const {
-        return m_path;
+        return m_data->path;
     }
 
     const std::string& Path::ToStringRef() const {
-        return m_path;
+        return m_data->path;
     }
 
     std::string_view Path::ToStringView() const {
-        return m_path;
+        return m_data->path;
     }
 
     bool Path::IsDir() const {
@@ -102,85 +342,84 @@ namespace SR_UTILS_NS {
     }
 
     bool Path::Valid() const {
-        return m_type != Type::Undefined;
+        return GetType() != Type::Undefined;
     }
 
-    const char* Path::CStr() const {
-        return m_path.c_str();
-    }
+    Path::Type Path::GetType() const {
+        ++g_metadataQueries;
 
-    void Path::Update() {
-        SR_TRACY_ZONE;
+        const uint32_t lifetime = g_metadataLifetime.load(std::memory_order_relaxed);
+        if (lifetime == 0 || IsEmpty()) {
+            return QueryPathType(m_data->path);
+        }
 
-        NormalizeSelf();
-        ExtractNameAndExt();
-    }
+        const uint64_t metadata = m_data->metadata.load(std::memory_order_acquire);
+        const uint32_t generation = g_metadataGeneration.load(std::memory_order_acquire);
 
-    std::string Path::GetExtension() const {
-        return std::string(m_ext);
-    }
+        if (metadata != SR_PATH_METADATA_EMPTY
+            && ((metadata >> 2u) & 0x3FFFFFFFu) == (generation & 0x3FFFFFFFu)
+            && GetMetadataTime() - static_cast<uint32_t>(metadata >> 32u) < lifetime
+        ) {
+            return static_cast<Type>((metadata & 0x3u) - 1);
+        }
 
-    std::string Path::GetBaseName() const {
-        return std::string(m_name);
+        return QueryType();
     }
 
-    Path::Path(const Path& path) {
-        m_path = path.m_path;
+    Path::Type Path::QueryType() const {
+        const uint32_t generation = g_metadataGeneration.load(std::memory_order_acquire);
+        const Type type = QueryPathType(m_data->path);
 
-        ExtractNameAndExt();
+        if (!IsEmpty()) {
+            m_data->metadata.store(PackMetadata(type, generation, GetMetadataTime()), std::memory_order_release);
+        }
 
-        m_hash = path.m_hash;
-        m_type = path.m_type;
+        return type;
     }
 
-    size_t Path::GetHash() const {
-        return m_hash;
+    void Path::InvalidateMetadata() const noexcept {
+        if (!IsEmpty()) {
+            m_data->metadata.store(SR_PATH_METADATA_EMPTY, std::memory_order_release);
+        }
     }
 
-    Path::Type Path::GetType() const {
-#ifdef SR_WIN32
-    if (m_path.size() < 2 || m_path[1] != ':') {
-        return Type::Undefined;
+    void Path::InvalidateAllMetadata() noexcept {
+        ++g_metadataGeneration;
     }
-#elif defined(SR_LINUX)
-    if (m_path.empty() || m_path[0] != '/') {
-        return Type::Undefined;
+
+    void Path::SetMetadataLifetime(uint32_t milliseconds) noexcept {
+        g_metadataLifetime = milliseconds;
+        InvalidateAllMetadata();
     }
-#endif
 
-        SR_TRACY_ZONE;
-#if defined(SR_MSVC) || defined (SR_LINUX)
-        struct stat s{};
-        if(stat(m_path.c_str(), &s) == 0) {
-            if (s.st_mode & S_IFDIR) {
-                return Type::Folder;
-            } else if (s.st_mode & S_IFREG) {
-                return Type::File;
-            }
-        }
+    Path::MetadataStats Path::GetMetadataStats() noexcept {
+        MetadataStats stats;
+        stats.queries = g_metadataQueries.load(std::memory_order_relaxed);
+        stats.syscalls = g_metadataSyscalls.load(std::memory_order_relaxed);
+        return stats;
+    }
 
-        return Type::Undefined;
-#elif defined(SR_WIN32)
-        DWORD attrib = GetFileAttributes(m_path.c_str());
+    const char* Path::CStr() const {
+        return m_data->path.c_str();
+    }
 
-        if ((attrib & FILE_ATTRIBUTE_DIRECTORY) != 0)
-            return Type::Folder;
+    std::string Path::GetExtension() const {
+        return std::string(m_data->ext);
+    }
 
-        return Type::File;
-#elif defined(SR_ANDROID)
-        /// TODO: будем считать что мы обращаемся только к файлам. Это заглушка - нужно переделать
-        return Type::File;
-#else
-        SRHalt("Unsupported OS!");
-        return Type::Undefined;
-#endif
+    std::string Path::GetBaseName() const {
+        return std::string(m_data->name);
+    }
+
+    size_t Path::GetHash() const {
+        return m_data->hash;
     }
 
     Path Path::Concat(const Path &path) const {
-        if ((!m_path.empty() && m_path.back() != '/') && (!path.IsEmpty() && path.m_path.front() != '/'))
-            return m_path + "/" + path.m_path;
+        if ((!m_data->path.empty() && m_data->path.back() != '/') && (!path.IsEmpty() && path.m_data->path.front() != '/'))
+            return m_data->path + "/" + path.m_data->path;
 
-        return m_path + path.m_path;
+        return m_data->path + path.m_data->path;
     }
 
     bool Path::Exists() const {
@@ -194,31 +433,25 @@ namespace SR_UTILS_NS {
         return GetType() == type;
     }
 
-    void Path::NormalizeSelf() {
-        SR_TRACY_ZONE;
-        m_path = FileSystem::NormalizePath(m_path);
-        m_type = GetType();
-    }
-
     Path Path::ConcatExt(const std::string& ext) const {
         if (ext.empty())
             return *this;
 
         if (ext[0] == '.')
-            return m_path + ext;
+            return m_data->path + ext;
 
-        return m_path + "." + ext;
+        return m_data->path + "." + ext;
     }
 
     bool Path::Create() const {
-        if (m_path.empty())
+        if (m_data->path.empty())
             return false;
 
-        if (m_ext.empty()) {
-            return FileSystem::CreatePath(m_path);
+        if (m_data->ext.empty()) {
+            return FileSystem::CreatePath(m_data->path);
         }
 
-        return FileSystem::CreatePath(m_path.substr(0, m_path.size() - (m_name.size() + m_ext.size() + 1)));
+        return FileSystem::CreatePath(m_data->path.substr(0, m_data->path.size() - (m_data->name.size() + m_data->ext.size() + 1)));
     }
 
     bool Path::CreateIfNotExists() const {
@@ -230,7 +463,7 @@ namespace SR_UTILS_NS {
     }
 
     bool Path::Make(Type type) const {
-        if (m_path.empty())
+        if (m_data->path.empty())
             return false;
 
         switch (type) {
@@ -239,97 +472,97 @@ namespace SR_UTILS_NS {
                 SR_FALLTHROUGH;
             case Type::Undefined:
             case Type::File:
-                return FileSystem::CreatePath(m_path.substr(0, m_path.size() - (m_name.size() + m_ext.size() + 1)));
+                return FileSystem::CreatePath(m_data->path.substr(0, m_data->path.size() - (m_data->name.size() + m_data->ext.size() + 1)));
             case Type::Folder:
-                return FileSystem::CreatePath(m_path);
+                return FileSystem::CreatePath(m_data->path);
         }
     }
 
     Path Path::GetPrevious() const {
-        if (m_path.empty())
-            return m_path;
+        if (m_data->path.empty())
+            return m_data->path;
 
-        if (const auto&& pos = m_path.rfind('/'); pos != std::string::npos) {
+        if (const auto&& pos = m_data->path.rfind('/'); pos != std::string::npos) {
             if (pos <= 1)
-                return m_path;
+                return m_data->path;
 
-            return m_path.substr(0, pos);
+            return m_data->path.substr(0, pos);
         }
 
-        return m_path;
+        return m_data->path;
     }
 
     Path Path::GetFolder() const {
         switch (GetType()) {
             case Type::File:
-                return SR_UTILS_NS::StringUtils::GetDirToFileFromFullPath(m_path);
+                return SR_UTILS_NS::StringUtils::GetDirToFileFromFullPath(m_data->path);
             default:
                 SRHalt0();
                 SR_FALLTHROUGH;
             case Type::Folder:
             case Type::Undefined:
-                return m_path;
+                return m_data->path;
         }
     }
 
     std::string_view Path::GetExtensionView() const {
-        return m_ext;
+        return m_data->ext;
     }
 
     std::string_view Path::GetBaseNameView() const {
-        return m_name;
+        return m_data->name;
     }
 
     uint64_t Path::GetFileHash() const {
-        return FileSystem::GetFileHash(m_path);
+        return FileSystem::GetFileHash(m_data->path);
     }
 
     uint64_t Path::GetFolderHash(uint64_t deep) const {
-        return FileSystem::GetFolderHash(m_path, deep);
+        return FileSystem::GetFolderHash(m_data->path, deep);
     }
 
     bool Path::IsAbs() const {
-        return Platform::IsAbsolutePath(m_path);
+        return Platform::IsAbsolutePath(m_data->path);
     }
 
     bool Path::IsSubPath(const Path &subPath) const {
-        return m_path.find(subPath.m_path) != std::string::npos;
+        return m_data->path.find(subPath.m_data->path) != std::string::npos;
     }
 
     Path Path::RemoveSubPath(const Path &subPath) const {
-        auto&& index = m_path.find(subPath.m_path);
+        auto&& index = m_data->path.find(subPath.m_data->path);
 
         if (index == std::string::npos) {
             return *this;
         }
 
-        if (m_path.size() == subPath.m_path.size()) {
+        if (m_data->path.size() == subPath.m_data->path.size()) {
             return Path();
         }
 
-        return StringUtils::Remove(m_path, index, subPath.m_path.size() + 1);
+        return StringUtils::Remove(m_data->path, index, subPath.m_data->path.size() + 1);
     }
 
     Path Path::SelfRemoveSubPath(const Path &subPath) const {
-        auto&& index = m_path.find(subPath.m_path);
+        auto&& index = m_data->path.find(subPath.m_data->path);
 
         if (index == std::string::npos) {
             return std::move(*this);
         }
 
-        if (m_path.size() == subPath.m_path.size()) {
+        if (m_data->path.size() == subPath.m_data->path.size()) {
             return Path();
         }
 
-        return StringUtils::Remove(m_path, index, subPath.m_path.size() + 1);
+        return StringUtils::Remove(m_data->path, index, subPath.m_data->path.size() + 1);
     }
 
     bool Path::IsHidden() const {
-        return Platform::FileIsHidden(m_path);
+        return Platform::FileIsHidden(m_data->path);
     }
 
     std::wstring Path::ToUnicodeString() const {
-        return SR_S2WS(m_path);
+        return SR_S2WS(m_data->path);
     }
 
     std::wstring Path::ToWinApiPath() const {
@@ -338,7 +571,7 @@ namespace SR_UTILS_NS {
     }
 
     bool Path::IsEmpty() const {
-        return m_path.empty();
+        return m_data->path.empty();
     }
 
     SR_NODISCARD bool Path::IsDirEmpty() const {
@@ -350,32 +583,32 @@ namespace SR_UTILS_NS {
     }
 
     std::string Path::GetBaseNameAndExt() const {
-        if (m_ext.empty()) {
-            return std::string(m_name);
+        if (m_data->ext.empty()) {
+            return std::string(m_data->name);
         }
-        return std::string(m_name) + "." + std::string(m_ext);
+        return std::string(m_data->name) + "." + std::string(m_data->ext);
     }
 
     std::string_view Path::View() const {
-        return m_path;
+        return m_data->path;
     }
 
     std::string Path::GetWithoutExtension() const {
-        if (m_ext.empty()) {
-            return m_path;
+        if (m_data->ext.empty()) {
+            return m_data->path;
         }
 
-        std::string path = m_path;
-        path.resize(path.size() - (m_ext.size() + 1));
+        std::string path = m_data->path;
+        path.resize(path.size() - (m_data->ext.size() + 1));
         return path;
     }
 
     bool Path::Contains(const std::string &str) const {
-        return m_path.find(str) != std::string::npos;
+        return m_data->path.find(str) != std::string::npos;
     }
 
     Path Path::EmplaceFront(const std::string &str) const {
-        return str + m_path;
+        return str + m_data->path;
     }
 
     std::string Path::ConvertToFileName() const {
@@ -393,29 +626,4 @@ namespace SR_UTILS_NS {
 
         return str;
     }
-
-    void Path::ExtractNameAndExt() {
-        if (auto&& index = m_path.find_last_of("/\\"); index == std::string::npos) {
-            if (index = m_path.find_last_of('.'); index != std::string::npos) {
-                m_name = std::string_view { m_path.data(), index };
-                m_ext = std::string_view { m_path.data() + index + 1, m_path.size() - index - 1 };
-            }
-            else {
-                m_name = m_path;
-                m_ext = std::string_view();
-            }
-        }
-        else {
-            ++index;
-
-            if (auto dot = m_path.find_last_of('.'); dot != std::string::npos && dot > index) {
-                m_name = std::string_view { m_path.data() + index, dot - index };
-                m_ext = std::string_view { m_path.data() + dot + 1, m_path.size() - dot - 1 };
-            }
-            else {
-                m_name = std::string_view { m_path.data() + index, m_path.size() - index };
-                m_ext = std::string_view();
-            }
-        }
-    }
 }
@@ -6,6 +6,7 @@
 #include <rapidyaml/src/ryml.hpp>
 #include <rapidyaml/src/ryml_std.hpp> ///needed to use rapidyaml with std containers
 #include <utility>
+#include <Utils/Profile/TracyContext.h>
 
 namespace SR_UTILS_NS::Localization {
 
@@ -20,20 +21,25 @@ namespace SR_UTILS_NS::Localization {
         //m_watchedFile ///TODO: Что делать с FileWatcher
     }
 
+    Path LocalizationFile::GetTablePath(const Path& filePath) {
+        auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
+        return resourceManager.GetCachePath().Concat("Localization").Concat(filePath.RemoveSubPath(resourceManager.GetResPathRef())).ConcatExt("table");
+    }
+
     void LocalizationFile::LoadLocalizationStrings(const Path& filePath) {
+        SR_TRACY_ZONE;
+
         auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
         m_watchedFile = resourceManager.StartWatch(filePath);
-        std::string fileContents = FileSystem::ReadAllText(filePath.ToString());
-        ryml::Tree tree = ryml::parse_in_arena(ryml::to_csubstr(fileContents));
-        ryml::ConstNodeRef root = tree.crootref();
-        for (auto&& n : root.children()) {
-            std::string id; ///это должен был быть StringAtom
-            std::string str; ///это должен был быть UnicodeString
-            n >> ryml::key(id); ///deserialize key
-            n >> str; ///deserialize value
-            m_locStrings[id] = str; ///но операторы десериализации делают всё сложнее
-            ///альтернативой десериализации может быть закидывание в конструктор std::string двух указателей на начало и конец val() или key() или что-то в подобном роде
-            ///пример auto id = std::string(locFile.key().data(), locFile.key().end());
+
+        /// YAML остается исходником, таблица пересобирается только при его изменении
+        auto&& tablePath = GetTablePath(filePath);
+        if (filePath.Exists() && LocalizationTable::ReadSourceHash(tablePath) != filePath.GetFileHash()) {
+            LocalizationTable::CompileYaml(filePath, tablePath);
+        }
+
+        if (!m_table.Load(tablePath)) {
+            SR_ERROR("LocalizationFile::LoadLocalizationStrings() : failed to load localization table!\n\tPath: " + filePath.ToString());
         }
     }
 
@@ -47,7 +53,11 @@ namespace SR_UTILS_NS::Localization {
     }
 
     SR_HTYPES_NS::UnicodeString LocalizationFile::GetStringById(const StringAtom &id) {
-        return m_locStrings[id];
+        return SR_HTYPES_NS::UnicodeString(std::string(GetStringViewById(id)));
+    }
+
+    std::string_view LocalizationFile::GetStringViewById(const StringAtom& id) const {
+        return m_table.Find(id.ToStringView());
     }
 
     /*LocalizationGroup::LocalizationGroup(const std::list<LocalizationFile>& locFiles) :
@@ -110,8 +120,7 @@ namespace SR_UTILS_NS::Localization {
     StringAtom LocalizationManager::MakeLocFile(const std::unordered_map<Locale, Path>& localePaths,
                                                 const Locale& languageToLoad,
                                                 StringAtom fileId) {
-        LocalizationFile locFile = LocalizationFile(localePaths, languageToLoad);
-        m_localizationFiles[fileId] = locFile;
+        m_localizationFiles[fileId] = LocalizationFile(localePaths, languageToLoad);
         return fileId;
     }
 
@@ -0,0 +1,361 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Localization/LocalizationTable.h>
+#include <Utils/FileSystem/FileSystem.h>
+#include <Utils/Common/Hashes.h>
+#include <Utils/Profile/TracyContext.h>
+
+#include <rapidyaml/src/ryml.hpp>
+#include <rapidyaml/src/ryml_std.hpp>
+
+namespace SR_UTILS_NS::Localization {
+    /// хеш ключа в корзине с перебираемым смещением (hash and displace), должен совпадать при сборке и поиске
+    SR_FORCE_INLINE static uint64_t DisplaceHash(uint64_t hash, uint32_t displacement) noexcept {
+        uint64_t x = hash + static_cast<uint64_t>(displacement) * 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    static constexpr uint32_t TABLE_MAX_DISPLACEMENT = 1u << 24;
+
+    LocalizationTable::LocalizationTable(LocalizationTable&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    LocalizationTable& LocalizationTable::operator=(LocalizationTable&& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+
+        /// отображение не перемещается в памяти, указатели остаются валидными
+        m_file = std::move(other.m_file);
+        m_displacements = SR_EXCHANGE(other.m_displacements, nullptr);
+        m_slots = SR_EXCHANGE(other.m_slots, nullptr);
+        m_pool = SR_EXCHANGE(other.m_pool, nullptr);
+        m_poolSize = SR_EXCHANGE(other.m_poolSize, 0);
+        m_count = SR_EXCHANGE(other.m_count, 0);
+        m_bucketCount = SR_EXCHANGE(other.m_bucketCount, 0);
+        m_sourceHash = SR_EXCHANGE(other.m_sourceHash, 0);
+
+        return *this;
+    }
+
+    std::string LocalizationTable::Compile(const Entries& entries, uint64_t sourceHash) {
+        SR_TRACY_ZONE;
+
+        std::unordered_map<std::string_view, uint32_t> uniqueKeys;
+        uniqueKeys.reserve(entries.size());
+
+        for (uint32_t i = 0; i < entries.size(); ++i) {
+            uniqueKeys[entries[i].first] = i;
+        }
+
+        std::vector<uint32_t> order;
+        order.reserve(uniqueKeys.size());
+        for (auto&& [key, index] : uniqueKeys) {
+            order.emplace_back(index);
+        }
+        std::sort(order.begin(), order.end());
+
+        const auto count = static_cast<uint32_t>(order.size());
+        const uint32_t bucketCount = count / 2 + 1;
+
+        std::vector<uint64_t> hashes(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            hashes[i] = SR_HASH_STR_VIEW(entries[order[i]].first);
+        }
+
+        {
+            std::vector<uint64_t> sortedHashes = hashes;
+            std::sort(sortedHashes.begin(), sortedHashes.end());
+            if (std::adjacent_find(sortedHashes.begin(), sortedHashes.end()) != sortedHashes.end()) {
+                SR_ERROR("LocalizationTable::Compile() : key hash collision!");
+                return std::string();
+            }
+        }
+
+        std::vector<std::vector<uint32_t>> buckets(bucketCount);
+        for (uint32_t i = 0; i < count; ++i) {
+            buckets[hashes[i] % bucketCount].emplace_back(i);
+        }
+
+        std::vector<uint32_t> bucketOrder(bucketCount);
+        for (uint32_t i = 0; i < bucketCount; ++i) {
+            bucketOrder[i] = i;
+        }
+
+        /// большие корзины размещаются первыми, одиночные ключи занимают оставшиеся слоты напрямую
+        std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&buckets](uint32_t a, uint32_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        std::vector<int32_t> displacements(bucketCount, 0);
+        std::vector<uint32_t> slotEntries(count, SR_UINT32_MAX);
+        std::vector<uint32_t> candidates;
+        uint32_t freeSlot = 0;
+
+        for (const uint32_t bucketIndex : bucketOrder) {
+            auto&& bucket = buckets[bucketIndex];
+
+            if (bucket.empty()) {
+                break;
+            }
+
+            if (bucket.size() == 1) {
+                while (slotEntries[freeSlot] != SR_UINT32_MAX) {
+                    ++freeSlot;
+                }
+                slotEntries[freeSlot] = bucket.front();
+                displacements[bucketIndex] = -static_cast<int32_t>(freeSlot) - 1;
+                continue;
+            }
+
+            bool placed = false;
+
+            for (uint32_t displacement = 1; displacement < TABLE_MAX_DISPLACEMENT && !placed; ++displacement) {
+                candidates.clear();
+                placed = true;
+
+                for (const uint32_t entry : bucket) {
+                    const auto slot = static_cast<uint32_t>(DisplaceHash(hashes[entry], displacement) % count);
+                    if (slotEntries[slot] != SR_UINT32_MAX || std::find(candidates.begin(), candidates.end(), slot) != candidates.end()) {
+                        placed = false;
+                        break;
+                    }
+                    candidates.emplace_back(slot);
+                }
+
+                if (placed) {
+                    for (uint32_t i = 0; i < bucket.size(); ++i) {
+                        slotEntries[candidates[i]] = bucket[i];
+                    }
+                    displacements[bucketIndex] = static_cast<int32_t>(displacement);
+                }
+            }
+
+            if (!placed) {
+                SR_ERROR("LocalizationTable::Compile() : failed to build perfect hash!");
+                return std::string();
+            }
+        }
+
+        const uint64_t displacementsOffset = sizeof(Header);
+        /// слоты выравниваются на 8 байт, чтобы читать их прямо из отображенного файла
+        const uint64_t slotsOffset = (displacementsOffset + bucketCount * sizeof(int32_t) + 7) & ~static_cast<uint64_t>(7);
+        const uint64_t poolOffset = slotsOffset + static_cast<uint64_t>(count) * sizeof(Slot);
+
+        std::vector<Slot> slots(count);
+        std::string pool;
+
+        for (uint32_t slot = 0; slot < count; ++slot) {
+            auto&& [key, value] = entries[order[slotEntries[slot]]];
+
+            slots[slot].keyHash = hashes[slotEntries[slot]];
+            slots[slot].keyOffset = static_cast<uint32_t>(pool.size());
+            slots[slot].keySize = static_cast<uint32_t>(key.size());
+            pool.append(key);
+
+            slots[slot].valueOffset = static_cast<uint32_t>(pool.size());
+            slots[slot].valueSize = static_cast<uint32_t>(value.size());
+            pool.append(value);
+            pool.push_back('\0');
+        }
+
+        if (pool.size() > SR_UINT32_MAX) {
+            SR_ERROR("LocalizationTable::Compile() : string pool is too large!");
+            return std::string();
+        }
+
+        Header header = { };
+        header.magic = TABLE_MAGIC;
+        header.version = TABLE_VERSION;
+        header.count = count;
+        header.bucketCount = bucketCount;
+        header.sourceHash = sourceHash;
+        header.slotsOffset = slotsOffset;
+        header.poolOffset = poolOffset;
+        header.poolSize = pool.size();
+
+        std::string table(poolOffset + pool.size(), '\0');
+        memcpy(table.data(), &header, sizeof(Header));
+        memcpy(table.data() + displacementsOffset, displacements.data(), bucketCount * sizeof(int32_t));
+        if (count > 0) {
+            memcpy(table.data() + slotsOffset, slots.data(), count * sizeof(Slot));
+        }
+        memcpy(table.data() + poolOffset, pool.data(), pool.size());
+
+        return table;
+    }
+
+    bool LocalizationTable::CompileYaml(const Path& yamlPath, const Path& tablePath) {
+        SR_TRACY_ZONE;
+
+        std::string fileContents = FileSystem::ReadAllText(yamlPath.ToString());
+        ryml::Tree tree = ryml::parse_in_arena(ryml::to_csubstr(fileContents));
+        ryml::ConstNodeRef root = tree.crootref();
+
+        Entries entries;
+        entries.reserve(root.num_children());
+
+        for (auto&& node : root.children()) {
+            if (!node.has_val()) {
+                continue;
+            }
+
+            std::string id;
+            std::string str;
+            node >> ryml::key(id);
+            node >> str;
+            entries.emplace_back(std::move(id), std::move(str));
+        }
+
+        auto&& table = Compile(entries, yamlPath.GetFileHash());
+        if (table.empty()) {
+            SR_ERROR("LocalizationTable::CompileYaml() : failed to compile \"{}\"!", yamlPath.ToStringRef());
+            return false;
+        }
+
+        if (!tablePath.Create()) {
+            SR_ERROR("LocalizationTable::CompileYaml() : failed to create file!\n\tPath: " + tablePath.ToString());
+            return false;
+        }
+
+        std::ofstream file(tablePath.ToString(), std::ios::binary);
+        if (!file.is_open()) {
+            SR_ERROR("LocalizationTable::CompileYaml() : failed to open file!\n\tPath: " + tablePath.ToString());
+            return false;
+        }
+
+        file.write(table.data(), static_cast<std::streamsize>(table.size()));
+
+        return file.good();
+    }
+
+    uint64_t LocalizationTable::ReadSourceHash(const Path& tablePath) {
+        std::ifstream file(tablePath.ToString(), std::ios::binary);
+        if (!file.is_open()) {
+            return 0;
+        }
+
+        Header header = { };
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(Header)) || header.magic != TABLE_MAGIC || header.version != TABLE_VERSION) {
+            return 0;
+        }
+
+        return header.sourceHash;
+    }
+
+    bool LocalizationTable::Load(const Path& tablePath) {
+        SR_TRACY_ZONE;
+
+        Clear();
+
+        SR_HTYPES_NS::MappedFile file;
+        if (!file.Open(tablePath)) {
+            SR_ERROR("LocalizationTable::Load() : failed to map file!\n\tPath: " + tablePath.ToString());
+            return false;
+        }
+
+        if (!LoadFromMemory(file.Data(), file.Size())) {
+            SR_ERROR("LocalizationTable::Load() : invalid table!\n\tPath: " + tablePath.ToString());
+            return false;
+        }
+
+        m_file = std::move(file);
+
+        return true;
+    }
+
+    bool LocalizationTable::LoadFromMemory(const char* pData, uint64_t size) {
+        Clear();
+
+        if (!pData || size < sizeof(Header)) {
+            return false;
+        }
+
+        const auto&& pHeader = reinterpret_cast<const Header*>(pData);
+
+        if (pHeader->magic != TABLE_MAGIC || pHeader->version != TABLE_VERSION || pHeader->bucketCount == 0) {
+            return false;
+        }
+
+        const bool valid = sizeof(Header) + static_cast<uint64_t>(pHeader->bucketCount) * sizeof(int32_t) <= pHeader->slotsOffset
+            && pHeader->slotsOffset + static_cast<uint64_t>(pHeader->count) * sizeof(Slot) <= pHeader->poolOffset
+            && pHeader->poolOffset + pHeader->poolSize <= size;
+
+        if (!valid) {
+            return false;
+        }
+
+        m_displacements = reinterpret_cast<const int32_t*>(pData + sizeof(Header));
+        m_slots = reinterpret_cast<const Slot*>(pData + pHeader->slotsOffset);
+        m_pool = pData + pHeader->poolOffset;
+        m_poolSize = pHeader->poolSize;
+        m_count = pHeader->count;
+        m_bucketCount = pHeader->bucketCount;
+        m_sourceHash = pHeader->sourceHash;
+
+        return true;
+    }
+
+    void LocalizationTable::Clear() {
+        m_file.Close();
+
+        m_displacements = nullptr;
+        m_slots = nullptr;
+        m_pool = nullptr;
+        m_poolSize = 0;
+        m_count = 0;
+        m_bucketCount = 0;
+        m_sourceHash = 0;
+    }
+
+    const LocalizationTable::Slot* LocalizationTable::FindSlot(std::string_view key) const noexcept {
+        if (m_count == 0) {
+            return nullptr;
+        }
+
+        const uint64_t hash = SR_HASH_STR_VIEW(key);
+        const int32_t displacement = m_displacements[hash % m_bucketCount];
+
+        const uint64_t index = displacement < 0
+            ? static_cast<uint64_t>(-static_cast<int64_t>(displacement) - 1)
+            : DisplaceHash(hash, static_cast<uint32_t>(displacement)) % m_count;
+
+        if (index >= m_count) {
+            return nullptr;
+        }
+
+        const Slot* pSlot = m_slots + index;
+        if (pSlot->keyHash != hash || pSlot->keySize != key.size()) {
+            return nullptr;
+        }
+
+        /// смещения проверяются при поиске, чтобы загрузка не трогала все страницы файла
+        if (static_cast<uint64_t>(pSlot->keyOffset) + pSlot->keySize > m_poolSize ||
+            static_cast<uint64_t>(pSlot->valueOffset) + pSlot->valueSize > m_poolSize
+        ) {
+            return nullptr;
+        }
+
+        if (memcmp(m_pool + pSlot->keyOffset, key.data(), key.size()) != 0) {
+            return nullptr;
+        }
+
+        return pSlot;
+    }
+
+    std::string_view LocalizationTable::Find(std::string_view key) const noexcept {
+        if (const Slot* pSlot = FindSlot(key)) {
+            return std::string_view(m_pool + pSlot->valueOffset, pSlot->valueSize);
+        }
+        return std::string_view();
+    }
+
+    bool LocalizationTable::Contains(std::string_view key) const noexcept {
+        return FindSlot(key) != nullptr;
+    }
+}
@@ -0,0 +1,567 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Localization/Transcode.h>
+#include <Utils/Localization/UTF.h>
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+    #define SR_TRANSCODE_SSSE3 1
+    #define SR_TRANSCODE_SSE2 1
+    #include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SR_TRANSCODE_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+namespace SR_UTILS_NS::Localization {
+    /// Блок, который переводится векторно один к одному: ASCII или BMP без суррогатов.
+    /// Convert ничего не пишет, если блок не подходит.
+    template<typename In, typename Out> struct TranscodeBlock {
+        static constexpr uint64_t SIZE = 0;
+        static bool Convert(const In*, Out*) noexcept { return false; }
+    };
+
+#if defined(SR_TRANSCODE_SSE2)
+    SR_FORCE_INLINE static __m128i Load128(const void* pData) noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
+    }
+
+    SR_FORCE_INLINE static void Store128(void* pData, __m128i value) noexcept {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pData), value);
+    }
+
+    /// в SSE2 нет беззнакового сравнения, сдвигаем диапазон на знаковый
+    SR_FORCE_INLINE static __m128i GreaterU32(__m128i value, uint32_t limit) noexcept {
+        const __m128i bias = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+        return _mm_cmpgt_epi32(_mm_xor_si128(value, bias), _mm_set1_epi32(static_cast<int32_t>(limit ^ 0x80000000u)));
+    }
+
+    SR_FORCE_INLINE static __m128i IsSurrogate16(__m128i value) noexcept {
+        return _mm_cmpeq_epi16(_mm_and_si128(value, _mm_set1_epi16(static_cast<int16_t>(0xF800))), _mm_set1_epi16(static_cast<int16_t>(0xD800)));
+    }
+
+    SR_FORCE_INLINE static __m128i IsSurrogate32(__m128i value) noexcept {
+        return _mm_cmpeq_epi32(_mm_and_si128(value, _mm_set1_epi32(static_cast<int32_t>(0xFFFFF800u))), _mm_set1_epi32(0xD800));
+    }
+
+    template<> struct TranscodeBlock<char, char16_t> {
+        static constexpr uint64_t SIZE = 16;
+        SR_FORCE_INLINE static bool Convert(const char* pIn, char16_t* pOut) noexcept {
+            const __m128i input = Load128(pIn);
+            if (_mm_movemask_epi8(input) != 0) {
+                return false;
+            }
+            const __m128i zero = _mm_setzero_si128();
+            Store128(pOut, _mm_unpacklo_epi8(input, zero));
+            Store128(pOut + 8, _mm_unpackhi_epi8(input, zero));
+            return true;
+        }
+    };
+
+    template<> struct TranscodeBlock<char, char32_t> {
+        static constexpr uint64_t SIZE = 16;
+        SR_FORCE_INLINE static bool Convert(const char* pIn, char32_t* pOut) noexcept {
+            const __m128i input = Load128(pIn);
+            if (_mm_movemask_epi8(input) != 0) {
+                return false;
+            }
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i low = _mm_unpacklo_epi8(input, zero);
+            const __m128i high = _mm_unpackhi_epi8(input, zero);
+            Store128(pOut, _mm_unpacklo_epi16(low, zero));
+            Store128(pOut + 4, _mm_unpackhi_epi16(low, zero));
+            Store128(pOut + 8, _mm_unpacklo_epi16(high, zero));
+            Store128(pOut + 12, _mm_unpackhi_epi16(high, zero));
+            return true;
+        }
+    };
+
+    template<> struct TranscodeBlock<char16_t, char> {
+        static constexpr uint64_t SIZE = 8;
+        SR_FORCE_INLINE static bool Convert(const char16_t* pIn, char* pOut) noexcept {
+            const __m128i input = Load128(pIn);
+            const __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16(static_cast<int16_t>(0xFF80))), _mm_setzero_si128());
+            if (_mm_movemask_epi8(ascii) != 0xFFFF) {
+                return false;
+            }
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(pOut), _mm_packus_epi16(input, input));
+            return true;
+        }
+    };
+
+    template<> struct TranscodeBlock<char16_t, char32_t> {
+        static constexpr uint64_t SIZE = 8;
+        SR_FORCE_INLINE static bool Convert(const char16_t* pIn, char32_t* pOut) noexcept {
+            const __m128i input = Load128(pIn);
+            if (_mm_movemask_epi8(IsSurrogate16(input)) != 0) {
+                return false;
+            }
+            const __m128i zero = _mm_setzero_si128();
+            Store128(pOut, _mm_unpacklo_epi16(input, zero));
+            Store128(pOut + 4, _mm_unpackhi_epi16(input, zero));
+            return true;
+        }
+    };
+
+    template<> struct TranscodeBlock<char32_t, char> {
+        static constexpr uint64_t SIZE = 8;
+        SR_FORCE_INLINE static bool Convert(const char32_t* pIn, char* pOut) noexcept {
+            const __m128i low = Load128(pIn);
+            const __m128i high = Load128(pIn + 4);
+            if (_mm_movemask_epi8(_mm_or_si128(GreaterU32(low, 0x7F), GreaterU32(high, 0x7F))) != 0) {
+                return false;
+            }
+            const __m128i packed = _mm_packs_epi32(low, high);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(pOut), _mm_packus_epi16(packed, packed));
+            return true;
+        }
+    };
+
+    template<> struct TranscodeBlock<char32_t, char16_t> {
+        static constexpr uint64_t SIZE = 8;
+        SR_FORCE_INLINE static bool Convert(const char32_t* pIn, char16_t* pOut) noexcept {
+            const __m128i low = Load128(pIn);
+            const __m128i high = Load128(pIn + 4);
+            if (_mm_movemask_epi8(_mm_or_si128(GreaterU32(low, 0xFFFF), GreaterU32(high, 0xFFFF))) != 0) {
+                return false;
+            }
+            /// упаковка со знаковым насыщением, поэтому смещаем значения в знаковый диапазон и обратно
+            const __m128i bias32 = _mm_set1_epi32(0x8000);
+            const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(low, bias32), _mm_sub_epi32(high, bias32));
+            Store128(pOut, _mm_add_epi16(packed, _mm_set1_epi16(static_cast<int16_t>(0x8000))));
+            return true;
+        }
+    };
+#endif
+
+    /// Вход уже проверен, выходной буфер достаточен
+    template<typename In, typename Out> static uint64_t TranscodeValid(const In* pIn, uint64_t size, Out* pOut) noexcept {
+        using Block = TranscodeBlock<In, Out>;
+        using InTraits = Utf::UtfTraits<In>;
+        using OutTraits = Utf::UtfTraits<Out>;
+
+        const In* p = pIn;
+        const In* pEnd = pIn + size;
+        Out* pDestination = pOut;
+
+        if constexpr (Block::SIZE > 0) {
+            while (static_cast<uint64_t>(pEnd - p) >= Block::SIZE) {
+                if (Block::Convert(p, pDestination)) {
+                    p += Block::SIZE;
+                    pDestination += Block::SIZE;
+                    continue;
+                }
+
+                /// блок с многоединичными последовательностями разбираем скалярно целиком,
+                /// иначе на плотном не-ASCII тексте векторная проверка будет проваливаться на каждом символе
+                const In* pBlockEnd = p + Block::SIZE;
+                while (p < pBlockEnd) {
+                    pDestination = OutTraits::Encode(InTraits::DecodeValid(p), pDestination);
+                }
+            }
+        }
+
+        while (p < pEnd) {
+            pDestination = OutTraits::Encode(InTraits::DecodeValid(p), pDestination);
+        }
+
+        return static_cast<uint64_t>(pDestination - pOut);
+    }
+
+    /// Скалярный путь с проверкой каждой последовательности и места в выходном буфере
+    template<typename In, typename Out> static TranscodeResult TranscodeChecked(const In* pIn, uint64_t size, Out* pOut, uint64_t capacity) noexcept {
+        using InTraits = Utf::UtfTraits<In>;
+        using OutTraits = Utf::UtfTraits<Out>;
+
+        const In* p = pIn;
+        const In* pEnd = pIn + size;
+        uint64_t written = 0;
+
+        while (p != pEnd) {
+            const In* pSequence = p;
+            const Utf::CodePoint codePoint = InTraits::Decode(p, pEnd);
+            const auto read = static_cast<uint64_t>(pSequence - pIn);
+
+            if (codePoint == Utf::Illegal) {
+                return { TranscodeError::Illegal, read, written };
+            }
+
+            if (codePoint == Utf::Incomplete) {
+                return { TranscodeError::Incomplete, read, written };
+            }
+
+            if (written + static_cast<uint64_t>(OutTraits::Width(codePoint)) > capacity) {
+                return { TranscodeError::OutOfSpace, read, written };
+            }
+
+            written = static_cast<uint64_t>(OutTraits::Encode(codePoint, pOut + written) - pOut);
+        }
+
+        return { TranscodeError::None, size, written };
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+#if defined(SR_TRANSCODE_SSSE3)
+    /**
+     * Векторная проверка UTF-8 по таблицам (Keiser, Lemire. "Validating UTF-8 In Less Than One Instruction Per Byte").
+     * Для каждого байта по старшему и младшему полубайту предыдущего и старшему полубайту текущего
+     * выбираются маски возможных ошибок, их пересечение непусто только на некорректной паре байт.
+    */
+    class Utf8Validator {
+        static constexpr uint8_t TOO_SHORT = 1u << 0u;
+        static constexpr uint8_t TOO_LONG = 1u << 1u;
+        static constexpr uint8_t OVERLONG_3 = 1u << 2u;
+        static constexpr uint8_t TOO_LARGE = 1u << 3u;
+        static constexpr uint8_t SURROGATE = 1u << 4u;
+        static constexpr uint8_t OVERLONG_2 = 1u << 5u;
+        static constexpr uint8_t TOO_LARGE_1000 = 1u << 6u;
+        static constexpr uint8_t OVERLONG_4 = 1u << 6u;
+        static constexpr uint8_t TWO_CONTS = 1u << 7u;
+        static constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+        template<typename... Args> SR_FORCE_INLINE static __m128i Table(Args... values) noexcept {
+            return _mm_setr_epi8(static_cast<char>(values)...);
+        }
+
+        SR_FORCE_INLINE static __m128i HighNibble(__m128i value) noexcept {
+            return _mm_and_si128(_mm_srli_epi16(value, 4), _mm_set1_epi8(0x0F));
+        }
+
+        SR_FORCE_INLINE static __m128i CheckSpecialCases(__m128i input, __m128i prev1) noexcept {
+            const __m128i byte1High = _mm_shuffle_epi8(Table(
+                TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+                TOO_SHORT | OVERLONG_2,
+                TOO_SHORT,
+                TOO_SHORT | OVERLONG_3 | SURROGATE,
+                TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+            ), HighNibble(prev1));
+
+            const __m128i byte1Low = _mm_shuffle_epi8(Table(
+                CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+                CARRY | OVERLONG_2,
+                CARRY,
+                CARRY,
+                CARRY | TOO_LARGE,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000
+            ), _mm_and_si128(prev1, _mm_set1_epi8(0x0F)));
+
+            const __m128i byte2High = _mm_shuffle_epi8(Table(
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+                TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+                TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+            ), HighNibble(input));
+
+            return _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+        }
+
+        /// второй и третий байты после 3- и 4-байтовых лидеров обязаны быть продолжениями
+        SR_FORCE_INLINE static __m128i CheckMultibyteLengths(__m128i input, __m128i prevInput, __m128i specialCases) noexcept {
+            const __m128i prev2 = _mm_alignr_epi8(input, prevInput, 16 - 2);
+            const __m128i prev3 = _mm_alignr_epi8(input, prevInput, 16 - 3);
+            const __m128i isThirdByte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            const __m128i isFourthByte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            const __m128i must23 = _mm_and_si128(_mm_or_si128(isThirdByte, isFourthByte), _mm_set1_epi8(static_cast<char>(0x80)));
+            return _mm_xor_si128(must23, specialCases);
+        }
+
+        /// блок заканчивается незавершенной последовательностью
+        SR_FORCE_INLINE static __m128i IsIncomplete(__m128i input) noexcept {
+            return _mm_subs_epu8(input, Table(
+                0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+            ));
+        }
+
+    public:
+        SR_FORCE_INLINE void Check(__m128i input) noexcept {
+            if (_mm_movemask_epi8(input) == 0) {
+                m_error = _mm_or_si128(m_error, m_prevIncomplete);
+                m_prevIncomplete = _mm_setzero_si128();
+            }
+            else {
+                const __m128i prev1 = _mm_alignr_epi8(input, m_prevInput, 16 - 1);
+                const __m128i specialCases = CheckSpecialCases(input, prev1);
+                m_error = _mm_or_si128(m_error, CheckMultibyteLengths(input, m_prevInput, specialCases));
+                m_prevIncomplete = IsIncomplete(input);
+            }
+            m_prevInput = input;
+        }
+
+        SR_NODISCARD SR_FORCE_INLINE bool Finish() noexcept {
+            m_error = _mm_or_si128(m_error, m_prevIncomplete);
+            return HasError();
+        }
+
+        SR_NODISCARD SR_FORCE_INLINE bool HasError() const noexcept {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(m_error, _mm_setzero_si128())) != 0xFFFF;
+        }
+
+    private:
+        __m128i m_error = _mm_setzero_si128();
+        __m128i m_prevInput = _mm_setzero_si128();
+        __m128i m_prevIncomplete = _mm_setzero_si128();
+
+    };
+#endif
+
+    bool ValidateUtf8(const char* pData, uint64_t size) noexcept {
+    #if defined(SR_TRANSCODE_SSSE3)
+        Utf8Validator validator;
+
+        uint64_t i = 0;
+        for (; i + 64 <= size; i += 64) {
+            validator.Check(Load128(pData + i));
+            validator.Check(Load128(pData + i + 16));
+            validator.Check(Load128(pData + i + 32));
+            validator.Check(Load128(pData + i + 48));
+
+            if (validator.HasError()) {
+                return false;
+            }
+        }
+
+        for (; i + 16 <= size; i += 16) {
+            validator.Check(Load128(pData + i));
+        }
+
+        /// хвост дополняется нулями - это ASCII, незавершенная последовательность даст TOO_SHORT
+        if (i < size) {
+            char tail[16] = { };
+            memcpy(tail, pData + i, size - i);
+            validator.Check(Load128(tail));
+        }
+
+        return !validator.Finish();
+    #else
+        using Traits = Utf::UtfTraits<char>;
+
+        const char* p = pData;
+        const char* pEnd = pData + size;
+
+        while (p != pEnd) {
+        #if defined(SR_TRANSCODE_SSE2)
+            if (pEnd - p >= 16 && _mm_movemask_epi8(Load128(p)) == 0) {
+                p += 16;
+                continue;
+            }
+        #endif
+            const Utf::CodePoint codePoint = Traits::Decode(p, pEnd);
+            if (codePoint == Utf::Illegal || codePoint == Utf::Incomplete) {
+                return false;
+            }
+        }
+
+        return true;
+    #endif
+    }
+
+    bool ValidateUtf16(const char16_t* pData, uint64_t size) noexcept {
+        using Traits = Utf::UtfTraits<char16_t>;
+
+        const char16_t* p = pData;
+        const char16_t* pEnd = pData + size;
+
+        while (p != pEnd) {
+        #if defined(SR_TRANSCODE_SSE2)
+            if (pEnd - p >= 8 && _mm_movemask_epi8(IsSurrogate16(Load128(p))) == 0) {
+                p += 8;
+                continue;
+            }
+        #endif
+            const Utf::CodePoint codePoint = Traits::Decode(p, pEnd);
+            if (codePoint == Utf::Illegal || codePoint == Utf::Incomplete) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ValidateUtf32(const char32_t* pData, uint64_t size) noexcept {
+        uint64_t i = 0;
+
+    #if defined(SR_TRANSCODE_SSE2)
+        __m128i error = _mm_setzero_si128();
+        for (; i + 4 <= size; i += 4) {
+            const __m128i input = Load128(pData + i);
+            error = _mm_or_si128(error, _mm_or_si128(GreaterU32(input, 0x10FFFF), IsSurrogate32(input)));
+        }
+        if (_mm_movemask_epi8(error) != 0) {
+            return false;
+        }
+    #endif
+
+        for (; i < size; ++i) {
+            if (!Utf::IsValidCodePoint(pData[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    /// Подсчеты без ветвлений, компилятор сам разворачивает их в векторные циклы
+
+    uint64_t Utf32LengthFromUtf8(const char* pData, uint64_t size) noexcept {
+        uint64_t continuations = 0;
+        for (uint64_t i = 0; i < size; ++i) {
+            continuations += (static_cast<uint8_t>(pData[i]) & 0xC0u) == 0x80u;
+        }
+        return size - continuations;
+    }
+
+    uint64_t Utf16LengthFromUtf8(const char* pData, uint64_t size) noexcept {
+        /// каждая 4-байтовая последовательность дает суррогатную пару
+        uint64_t length = 0;
+        for (uint64_t i = 0; i < size; ++i) {
+            const auto byte = static_cast<uint8_t>(pData[i]);
+            length += static_cast<uint64_t>((byte & 0xC0u) != 0x80u) + static_cast<uint64_t>(byte >= 0xF0u);
+        }
+        return length;
+    }
+
+    uint64_t Utf8LengthFromUtf16(const char16_t* pData, uint64_t size) noexcept {
+        /// суррогатная пара: 1 + 1 + 1 - 1 на каждую половину, итого 4 байта
+        uint64_t length = 0;
+        for (uint64_t i = 0; i < size; ++i) {
+            const auto unit = static_cast<uint16_t>(pData[i]);
+            length += 1 + static_cast<uint64_t>(unit >= 0x80u) + static_cast<uint64_t>(unit >= 0x800u)
+                - static_cast<uint64_t>((unit & 0xF800u) == 0xD800u);
+        }
+        return length;
+    }
+
+    uint64_t Utf32LengthFromUtf16(const char16_t* pData, uint64_t size) noexcept {
+        uint64_t lowSurrogates = 0;
+        for (uint64_t i = 0; i < size; ++i) {
+            lowSurrogates += (static_cast<uint16_t>(pData[i]) & 0xFC00u) == 0xDC00u;
+        }
+        return size - lowSurrogates;
+    }
+
+    uint64_t Utf8LengthFromUtf32(const char32_t* pData, uint64_t size) noexcept {
+        uint64_t length = 0;
+        for (uint64_t i = 0; i < size; ++i) {
+            const auto value = static_cast<uint32_t>(pData[i]);
+            length += 1 + static_cast<uint64_t>(value >= 0x80u) + static_cast<uint64_t>(value >= 0x800u) + static_cast<uint64_t>(value >= 0x10000u);
+        }
+        return length;
+    }
+
+    uint64_t Utf16LengthFromUtf32(const char32_t* pData, uint64_t size) noexcept {
+        uint64_t length = 0;
+        for (uint64_t i = 0; i < size; ++i) {
+            length += 1 + static_cast<uint64_t>(static_cast<uint32_t>(pData[i]) >= 0x10000u);
+        }
+        return length;
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    SR_FORCE_INLINE static bool Validate(const char* pData, uint64_t size) noexcept { return ValidateUtf8(pData, size); }
+    SR_FORCE_INLINE static bool Validate(const char16_t* pData, uint64_t size) noexcept { return ValidateUtf16(pData, size); }
+    SR_FORCE_INLINE static bool Validate(const char32_t* pData, uint64_t size) noexcept { return ValidateUtf32(pData, size); }
+
+    template<typename Out> static uint64_t GetLength(const char* pData, uint64_t size) noexcept {
+        if constexpr (sizeof(Out) == 2) { return Utf16LengthFromUtf8(pData, size); }
+        else { return Utf32LengthFromUtf8(pData, size); }
+    }
+
+    template<typename Out> static uint64_t GetLength(const char16_t* pData, uint64_t size) noexcept {
+        if constexpr (sizeof(Out) == 1) { return Utf8LengthFromUtf16(pData, size); }
+        else { return Utf32LengthFromUtf16(pData, size); }
+    }
+
+    template<typename Out> static uint64_t GetLength(const char32_t* pData, uint64_t size) noexcept {
+        if constexpr (sizeof(Out) == 1) { return Utf8LengthFromUtf32(pData, size); }
+        else { return Utf16LengthFromUtf32(pData, size); }
+    }
+
+    template<typename In, typename Out> static TranscodeResult TranscodeImpl(const In* pIn, uint64_t size, Out* pOut, uint64_t capacity) noexcept {
+        if (size == 0) {
+            return TranscodeResult();
+        }
+
+        /// точный размер считаем только если буфер меньше худшего случая
+        const bool enoughSpace = capacity >= GetMaxTranscodedLength<Out, In>(size);
+
+        if (Validate(pIn, size)) {
+            if constexpr (std::is_same_v<In, Out>) {
+                if (enoughSpace) {
+                    memcpy(pOut, pIn, size * sizeof(In));
+                    return { TranscodeError::None, size, size };
+                }
+            }
+            else if (enoughSpace || capacity >= GetLength<Out>(pIn, size)) {
+                return { TranscodeError::None, size, TranscodeValid(pIn, size, pOut) };
+            }
+        }
+
+        /// некорректный вход или мало места - повторяем скалярно, чтобы найти позицию ошибки
+        return TranscodeChecked(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf8ToUtf16(const char* pIn, uint64_t size, char16_t* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf8ToUtf32(const char* pIn, uint64_t size, char32_t* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf16ToUtf8(const char16_t* pIn, uint64_t size, char* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf16ToUtf32(const char16_t* pIn, uint64_t size, char32_t* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf32ToUtf8(const char32_t* pIn, uint64_t size, char* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf32ToUtf16(const char32_t* pIn, uint64_t size, char16_t* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf8ToUtf8(const char* pIn, uint64_t size, char* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf16ToUtf16(const char16_t* pIn, uint64_t size, char16_t* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    TranscodeResult Utf32ToUtf32(const char32_t* pIn, uint64_t size, char32_t* pOut, uint64_t capacity) noexcept {
+        return TranscodeImpl(pIn, size, pOut, capacity);
+    }
+
+    const char* GetTranscodeInstructionSet() noexcept {
+    #if defined(SR_TRANSCODE_SSSE3)
+        return "SSSE3";
+    #elif defined(SR_TRANSCODE_SSE2)
+        return "SSE2";
+    #else
+        return "Scalar";
+    #endif
+    }
+}
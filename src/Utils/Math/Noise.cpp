@@ -4,6 +4,16 @@
 
 #include <Utils/Math/Noise.h>
 
+#if defined(__AVX2__)
+    #define SR_NOISE_AVX2 1
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SR_NOISE_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+SR_NOISE_FP_CONTRACT_OFF_BEGIN
+
 namespace SR_MATH_NS {
     double_t SNoise(double_t x, double_t y) {
         return NoiseTemplate(TableIndex2D, x, y);
@@ -16,4 +26,490 @@ namespace SR_MATH_NS {
     double_t SNoise(double_t x, double_t y, double_t z, double_t t) {
         return NoiseTemplate(TableIndex4D, x, y, z, t);
     }
-}
\ No newline at end of file
+}
+
+namespace SR_MATH_NS::NoiseDetails {
+    /// Для gather-инструкций нужна таблица 32-битных индексов
+    alignas(32) static constexpr auto Perm32 = []() {
+        std::array<int32_t, 256> table = { };
+        for (uint32_t i = 0; i < 256; ++i) {
+            table[i] = NoiseTable::perm[i];
+        }
+        return table;
+    }();
+
+    /// Всё, что не зависит от X, считается один раз на строку сетки
+    struct Row2D {
+        int32_t base[2];
+        double_t ry[2];
+        double_t sy;
+    };
+
+    /// base: (y, z), (y + 1, z), (y, z + 1), (y + 1, z + 1)
+    struct Row3D {
+        int32_t base[4];
+        double_t ry[2];
+        double_t rz[2];
+        double_t sy;
+        double_t sz;
+    };
+
+    SR_FORCE_INLINE int32_t Hash(int32_t ix, int32_t base) {
+        return NoiseTable::perm[(ix + base) & SR_NOISE_TABLE_MASK];
+    }
+
+    SR_FORCE_INLINE double_t Fade(double_t r) {
+        return r * r * (3.0 - 2.0 * r);
+    }
+
+    SR_FORCE_INLINE double_t Grad2(int32_t hash, double_t rx, double_t ry) {
+        const double_t* g = NoiseTable::grads2[hash];
+        return g[0] * rx + g[1] * ry;
+    }
+
+    SR_FORCE_INLINE double_t Grad3(int32_t hash, double_t rx, double_t ry, double_t rz) {
+        const double_t* g = NoiseTable::grads3[hash];
+        return g[0] * rx + g[1] * ry + g[2] * rz;
+    }
+
+    Row2D MakeRow2D(double_t y) {
+        Row2D row = { };
+
+        const int32_t iy = int32_t(floor(y));
+
+        row.base[0] = NoiseTable::perm[iy & SR_NOISE_TABLE_MASK];
+        row.base[1] = NoiseTable::perm[(iy + 1) & SR_NOISE_TABLE_MASK];
+        row.ry[0] = y - iy;
+        row.ry[1] = row.ry[0] - 1.0;
+        row.sy = Fade(row.ry[0]);
+
+        return row;
+    }
+
+    Row3D MakeRow3D(double_t y, double_t z) {
+        Row3D row = { };
+
+        const int32_t iy = int32_t(floor(y));
+        const int32_t iz = int32_t(floor(z));
+
+        const int32_t z0 = NoiseTable::perm[iz & SR_NOISE_TABLE_MASK];
+        const int32_t z1 = NoiseTable::perm[(iz + 1) & SR_NOISE_TABLE_MASK];
+
+        row.base[0] = NoiseTable::perm[(iy + z0) & SR_NOISE_TABLE_MASK];
+        row.base[1] = NoiseTable::perm[(iy + 1 + z0) & SR_NOISE_TABLE_MASK];
+        row.base[2] = NoiseTable::perm[(iy + z1) & SR_NOISE_TABLE_MASK];
+        row.base[3] = NoiseTable::perm[(iy + 1 + z1) & SR_NOISE_TABLE_MASK];
+
+        row.ry[0] = y - iy;
+        row.ry[1] = row.ry[0] - 1.0;
+        row.rz[0] = z - iz;
+        row.rz[1] = row.rz[0] - 1.0;
+        row.sy = Fade(row.ry[0]);
+        row.sz = Fade(row.rz[0]);
+
+        return row;
+    }
+
+    SR_FORCE_INLINE double_t Sample2D(const Row2D& row, double_t x) {
+        const int32_t ix = int32_t(floor(x));
+        const double_t rx0 = x - ix;
+        const double_t rx1 = rx0 - 1.0;
+        const double_t sx = Fade(rx0);
+
+        const double_t a = Lerp(sx, Grad2(Hash(ix, row.base[0]), rx0, row.ry[0]), Grad2(Hash(ix + 1, row.base[0]), rx1, row.ry[0]));
+        const double_t b = Lerp(sx, Grad2(Hash(ix, row.base[1]), rx0, row.ry[1]), Grad2(Hash(ix + 1, row.base[1]), rx1, row.ry[1]));
+
+        return Lerp(row.sy, a, b);
+    }
+
+    SR_FORCE_INLINE double_t Sample3D(const Row3D& row, double_t x) {
+        const int32_t ix = int32_t(floor(x));
+        const double_t rx0 = x - ix;
+        const double_t rx1 = rx0 - 1.0;
+        const double_t sx = Fade(rx0);
+
+        double_t a = Lerp(sx, Grad3(Hash(ix, row.base[0]), rx0, row.ry[0], row.rz[0]), Grad3(Hash(ix + 1, row.base[0]), rx1, row.ry[0], row.rz[0]));
+        double_t b = Lerp(sx, Grad3(Hash(ix, row.base[1]), rx0, row.ry[1], row.rz[0]), Grad3(Hash(ix + 1, row.base[1]), rx1, row.ry[1], row.rz[0]));
+        const double_t c = Lerp(row.sy, a, b);
+
+        a = Lerp(sx, Grad3(Hash(ix, row.base[2]), rx0, row.ry[0], row.rz[1]), Grad3(Hash(ix + 1, row.base[2]), rx1, row.ry[0], row.rz[1]));
+        b = Lerp(sx, Grad3(Hash(ix, row.base[3]), rx0, row.ry[1], row.rz[1]), Grad3(Hash(ix + 1, row.base[3]), rx1, row.ry[1], row.rz[1]));
+        const double_t d = Lerp(row.sy, a, b);
+
+        return Lerp(row.sz, c, d);
+    }
+
+#if defined(SR_NOISE_AVX2)
+    static constexpr uint32_t LANES = 4;
+
+    SR_FORCE_INLINE void Store(double_t* pOut, __m256d value) { _mm256_storeu_pd(pOut, value); }
+    SR_FORCE_INLINE void Store(float_t* pOut, __m256d value) { _mm_storeu_ps(pOut, _mm256_cvtpd_ps(value)); }
+
+    SR_FORCE_INLINE __m256d LerpV(__m256d t, __m256d a, __m256d b) {
+        return _mm256_add_pd(a, _mm256_mul_pd(_mm256_sub_pd(b, a), t));
+    }
+
+    SR_FORCE_INLINE __m256d FadeV(__m256d r) {
+        const __m256d three = _mm256_set1_pd(3.0);
+        const __m256d two = _mm256_set1_pd(2.0);
+        return _mm256_mul_pd(_mm256_mul_pd(r, r), _mm256_sub_pd(three, _mm256_mul_pd(two, r)));
+    }
+
+    SR_FORCE_INLINE __m128i HashV(__m128i ix, int32_t base) {
+        const __m128i index = _mm_and_si128(_mm_add_epi32(ix, _mm_set1_epi32(base)), _mm_set1_epi32(SR_NOISE_TABLE_MASK));
+        return _mm_i32gather_epi32(Perm32.data(), index, 4);
+    }
+
+    SR_FORCE_INLINE __m256d Grad2V(__m128i hash, __m256d rx, __m256d ry) {
+        const __m128i offset = _mm_slli_epi32(hash, 1);
+        const __m256d gx = _mm256_i32gather_pd(&NoiseTable::grads2[0][0], offset, 8);
+        const __m256d gy = _mm256_i32gather_pd(&NoiseTable::grads2[0][1], offset, 8);
+        return _mm256_add_pd(_mm256_mul_pd(gx, rx), _mm256_mul_pd(gy, ry));
+    }
+
+    SR_FORCE_INLINE __m256d Grad3V(__m128i hash, __m256d rx, __m256d ry, __m256d rz) {
+        const __m128i offset = _mm_mullo_epi32(hash, _mm_set1_epi32(3));
+        const __m256d gx = _mm256_i32gather_pd(&NoiseTable::grads3[0][0], offset, 8);
+        const __m256d gy = _mm256_i32gather_pd(&NoiseTable::grads3[0][1], offset, 8);
+        const __m256d gz = _mm256_i32gather_pd(&NoiseTable::grads3[0][2], offset, 8);
+        return _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(gx, rx), _mm256_mul_pd(gy, ry)), _mm256_mul_pd(gz, rz));
+    }
+
+    struct LaneX {
+        __m128i ix0;
+        __m128i ix1;
+        __m256d rx0;
+        __m256d rx1;
+        __m256d sx;
+    };
+
+    SR_FORCE_INLINE LaneX MakeLaneX(uint32_t i, double_t originX, double_t stepX) {
+        const __m256d index = _mm256_set_pd(i + 3, i + 2, i + 1, i);
+        const __m256d x = _mm256_add_pd(_mm256_set1_pd(originX), _mm256_mul_pd(index, _mm256_set1_pd(stepX)));
+        const __m256d fx = _mm256_floor_pd(x);
+
+        LaneX lane;
+        lane.ix0 = _mm256_cvttpd_epi32(fx);
+        lane.ix1 = _mm_add_epi32(lane.ix0, _mm_set1_epi32(1));
+        lane.rx0 = _mm256_sub_pd(x, fx);
+        lane.rx1 = _mm256_sub_pd(lane.rx0, _mm256_set1_pd(1.0));
+        lane.sx = FadeV(lane.rx0);
+        return lane;
+    }
+
+    template<typename T> uint32_t Row2DSimd(const Row2D& row, T* pOut, uint32_t width, double_t originX, double_t stepX) {
+        const __m256d ry0 = _mm256_set1_pd(row.ry[0]);
+        const __m256d ry1 = _mm256_set1_pd(row.ry[1]);
+        const __m256d sy = _mm256_set1_pd(row.sy);
+
+        uint32_t i = 0;
+        for (; i + LANES <= width; i += LANES) {
+            const LaneX lane = MakeLaneX(i, originX, stepX);
+
+            const __m256d a = LerpV(lane.sx, Grad2V(HashV(lane.ix0, row.base[0]), lane.rx0, ry0), Grad2V(HashV(lane.ix1, row.base[0]), lane.rx1, ry0));
+            const __m256d b = LerpV(lane.sx, Grad2V(HashV(lane.ix0, row.base[1]), lane.rx0, ry1), Grad2V(HashV(lane.ix1, row.base[1]), lane.rx1, ry1));
+
+            Store(pOut + i, LerpV(sy, a, b));
+        }
+
+        return i;
+    }
+
+    template<typename T> uint32_t Row3DSimd(const Row3D& row, T* pOut, uint32_t width, double_t originX, double_t stepX) {
+        const __m256d ry0 = _mm256_set1_pd(row.ry[0]);
+        const __m256d ry1 = _mm256_set1_pd(row.ry[1]);
+        const __m256d rz0 = _mm256_set1_pd(row.rz[0]);
+        const __m256d rz1 = _mm256_set1_pd(row.rz[1]);
+        const __m256d sy = _mm256_set1_pd(row.sy);
+        const __m256d sz = _mm256_set1_pd(row.sz);
+
+        uint32_t i = 0;
+        for (; i + LANES <= width; i += LANES) {
+            const LaneX lane = MakeLaneX(i, originX, stepX);
+
+            __m256d a = LerpV(lane.sx, Grad3V(HashV(lane.ix0, row.base[0]), lane.rx0, ry0, rz0), Grad3V(HashV(lane.ix1, row.base[0]), lane.rx1, ry0, rz0));
+            __m256d b = LerpV(lane.sx, Grad3V(HashV(lane.ix0, row.base[1]), lane.rx0, ry1, rz0), Grad3V(HashV(lane.ix1, row.base[1]), lane.rx1, ry1, rz0));
+            const __m256d c = LerpV(sy, a, b);
+
+            a = LerpV(lane.sx, Grad3V(HashV(lane.ix0, row.base[2]), lane.rx0, ry0, rz1), Grad3V(HashV(lane.ix1, row.base[2]), lane.rx1, ry0, rz1));
+            b = LerpV(lane.sx, Grad3V(HashV(lane.ix0, row.base[3]), lane.rx0, ry1, rz1), Grad3V(HashV(lane.ix1, row.base[3]), lane.rx1, ry1, rz1));
+            const __m256d d = LerpV(sy, a, b);
+
+            Store(pOut + i, LerpV(sz, c, d));
+        }
+
+        return i;
+    }
+#elif defined(SR_NOISE_SSE2)
+    static constexpr uint32_t LANES = 2;
+
+    SR_FORCE_INLINE void Store(double_t* pOut, __m128d value) { _mm_storeu_pd(pOut, value); }
+    SR_FORCE_INLINE void Store(float_t* pOut, __m128d value) { _mm_storel_pi(reinterpret_cast<__m64*>(pOut), _mm_cvtpd_ps(value)); }
+
+    SR_FORCE_INLINE __m128d LerpV(__m128d t, __m128d a, __m128d b) {
+        return _mm_add_pd(a, _mm_mul_pd(_mm_sub_pd(b, a), t));
+    }
+
+    SR_FORCE_INLINE __m128d FadeV(__m128d r) {
+        return _mm_mul_pd(_mm_mul_pd(r, r), _mm_sub_pd(_mm_set1_pd(3.0), _mm_mul_pd(_mm_set1_pd(2.0), r)));
+    }
+
+    /// в SSE2 нет gather, поэтому выборка из таблиц скалярная, а арифметика идет по две дорожки
+    SR_FORCE_INLINE __m128d Grad2V(const int32_t* hash, __m128d rx, __m128d ry) {
+        const double_t* g0 = NoiseTable::grads2[hash[0]];
+        const double_t* g1 = NoiseTable::grads2[hash[1]];
+        return _mm_add_pd(_mm_mul_pd(_mm_set_pd(g1[0], g0[0]), rx), _mm_mul_pd(_mm_set_pd(g1[1], g0[1]), ry));
+    }
+
+    SR_FORCE_INLINE __m128d Grad3V(const int32_t* hash, __m128d rx, __m128d ry, __m128d rz) {
+        const double_t* g0 = NoiseTable::grads3[hash[0]];
+        const double_t* g1 = NoiseTable::grads3[hash[1]];
+        return _mm_add_pd(
+            _mm_add_pd(_mm_mul_pd(_mm_set_pd(g1[0], g0[0]), rx), _mm_mul_pd(_mm_set_pd(g1[1], g0[1]), ry)),
+            _mm_mul_pd(_mm_set_pd(g1[2], g0[2]), rz)
+        );
+    }
+
+    struct LaneX {
+        int32_t ix[LANES];
+        __m128d rx0;
+        __m128d rx1;
+        __m128d sx;
+    };
+
+    SR_FORCE_INLINE LaneX MakeLaneX(uint32_t i, double_t originX, double_t stepX) {
+        const __m128d x = _mm_add_pd(_mm_set1_pd(originX), _mm_mul_pd(_mm_set_pd(i + 1, i), _mm_set1_pd(stepX)));
+
+        /// floor через усечение с поправкой для отрицательных дробных значений
+        const __m128d truncated = _mm_cvtepi32_pd(_mm_cvttpd_epi32(x));
+        const __m128d fx = _mm_sub_pd(truncated, _mm_and_pd(_mm_cmpgt_pd(truncated, x), _mm_set1_pd(1.0)));
+
+        LaneX lane;
+        const __m128i ix = _mm_cvttpd_epi32(fx);
+        lane.ix[0] = _mm_cvtsi128_si32(ix);
+        lane.ix[1] = _mm_cvtsi128_si32(_mm_srli_si128(ix, 4));
+        lane.rx0 = _mm_sub_pd(x, fx);
+        lane.rx1 = _mm_sub_pd(lane.rx0, _mm_set1_pd(1.0));
+        lane.sx = FadeV(lane.rx0);
+        return lane;
+    }
+
+    SR_FORCE_INLINE void HashLanes(const LaneX& lane, int32_t base, int32_t* h0, int32_t* h1) {
+        for (uint32_t l = 0; l < LANES; ++l) {
+            h0[l] = Hash(lane.ix[l], base);
+            h1[l] = Hash(lane.ix[l] + 1, base);
+        }
+    }
+
+    template<typename T> uint32_t Row2DSimd(const Row2D& row, T* pOut, uint32_t width, double_t originX, double_t stepX) {
+        const __m128d ry0 = _mm_set1_pd(row.ry[0]);
+        const __m128d ry1 = _mm_set1_pd(row.ry[1]);
+        const __m128d sy = _mm_set1_pd(row.sy);
+
+        int32_t h0[LANES], h1[LANES];
+
+        uint32_t i = 0;
+        for (; i + LANES <= width; i += LANES) {
+            const LaneX lane = MakeLaneX(i, originX, stepX);
+
+            HashLanes(lane, row.base[0], h0, h1);
+            const __m128d a = LerpV(lane.sx, Grad2V(h0, lane.rx0, ry0), Grad2V(h1, lane.rx1, ry0));
+
+            HashLanes(lane, row.base[1], h0, h1);
+            const __m128d b = LerpV(lane.sx, Grad2V(h0, lane.rx0, ry1), Grad2V(h1, lane.rx1, ry1));
+
+            Store(pOut + i, LerpV(sy, a, b));
+        }
+
+        return i;
+    }
+
+    template<typename T> uint32_t Row3DSimd(const Row3D& row, T* pOut, uint32_t width, double_t originX, double_t stepX) {
+        const __m128d ry0 = _mm_set1_pd(row.ry[0]);
+        const __m128d ry1 = _mm_set1_pd(row.ry[1]);
+        const __m128d rz0 = _mm_set1_pd(row.rz[0]);
+        const __m128d rz1 = _mm_set1_pd(row.rz[1]);
+        const __m128d sy = _mm_set1_pd(row.sy);
+        const __m128d sz = _mm_set1_pd(row.sz);
+
+        int32_t h0[LANES], h1[LANES];
+
+        uint32_t i = 0;
+        for (; i + LANES <= width; i += LANES) {
+            const LaneX lane = MakeLaneX(i, originX, stepX);
+
+            HashLanes(lane, row.base[0], h0, h1);
+            __m128d a = LerpV(lane.sx, Grad3V(h0, lane.rx0, ry0, rz0), Grad3V(h1, lane.rx1, ry0, rz0));
+            HashLanes(lane, row.base[1], h0, h1);
+            __m128d b = LerpV(lane.sx, Grad3V(h0, lane.rx0, ry1, rz0), Grad3V(h1, lane.rx1, ry1, rz0));
+            const __m128d c = LerpV(sy, a, b);
+
+            HashLanes(lane, row.base[2], h0, h1);
+            a = LerpV(lane.sx, Grad3V(h0, lane.rx0, ry0, rz1), Grad3V(h1, lane.rx1, ry0, rz1));
+            HashLanes(lane, row.base[3], h0, h1);
+            b = LerpV(lane.sx, Grad3V(h0, lane.rx0, ry1, rz1), Grad3V(h1, lane.rx1, ry1, rz1));
+            const __m128d d = LerpV(sy, a, b);
+
+            Store(pOut + i, LerpV(sz, c, d));
+        }
+
+        return i;
+    }
+#else
+    template<typename T> uint32_t Row2DSimd(const Row2D&, T*, uint32_t, double_t, double_t) { return 0; }
+    template<typename T> uint32_t Row3DSimd(const Row3D&, T*, uint32_t, double_t, double_t) { return 0; }
+#endif
+
+    template<typename T> void Grid2D(T* pOut, uint32_t width, uint32_t height, double_t originX, double_t originY, double_t stepX, double_t stepY) {
+        for (uint32_t y = 0; y < height; ++y) {
+            const Row2D row = MakeRow2D(originY + y * stepY);
+            T* pRow = pOut + static_cast<uint64_t>(y) * width;
+
+            for (uint32_t x = Row2DSimd(row, pRow, width, originX, stepX); x < width; ++x) {
+                pRow[x] = static_cast<T>(Sample2D(row, originX + x * stepX));
+            }
+        }
+    }
+
+    template<typename T> void Grid3D(T* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ)
+    {
+        for (uint32_t z = 0; z < depth; ++z) {
+            const double_t fz = originZ + z * stepZ;
+
+            for (uint32_t y = 0; y < height; ++y) {
+                const Row3D row = MakeRow3D(originY + y * stepY, fz);
+                T* pRow = pOut + (static_cast<uint64_t>(z) * height + y) * width;
+
+                for (uint32_t x = Row3DSimd(row, pRow, width, originX, stepX); x < width; ++x) {
+                    pRow[x] = static_cast<T>(Sample3D(row, originX + x * stepX));
+                }
+            }
+        }
+    }
+
+    /// октавы считаются в double, в T пишется только итоговая сумма
+    template<typename T, typename Fn> void FBmGrid(T* pOut, uint64_t count, const FBmSettings& settings, const Fn& octave) {
+        thread_local std::vector<double_t> sum;
+        thread_local std::vector<double_t> layer;
+
+        sum.assign(count, 0.0);
+        layer.resize(count);
+
+        double_t frequency = settings.frequency;
+        double_t amplitude = settings.amplitude;
+
+        for (uint32_t i = 0; i < settings.octaves; ++i) {
+            octave(layer.data(), frequency);
+
+            for (uint64_t j = 0; j < count; ++j) {
+                sum[j] += amplitude * layer[j];
+            }
+
+            frequency *= settings.lacunarity;
+            amplitude *= settings.gain;
+        }
+
+        for (uint64_t j = 0; j < count; ++j) {
+            pOut[j] = static_cast<T>(sum[j]);
+        }
+    }
+}
+
+namespace SR_MATH_NS {
+    void SNoiseGrid2D(double_t* pOut, uint32_t width, uint32_t height, double_t originX, double_t originY, double_t stepX, double_t stepY) {
+        NoiseDetails::Grid2D(pOut, width, height, originX, originY, stepX, stepY);
+    }
+
+    void SNoiseGrid2D(float_t* pOut, uint32_t width, uint32_t height, double_t originX, double_t originY, double_t stepX, double_t stepY) {
+        NoiseDetails::Grid2D(pOut, width, height, originX, originY, stepX, stepY);
+    }
+
+    void SNoiseGrid3D(double_t* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ)
+    {
+        NoiseDetails::Grid3D(pOut, width, height, depth, originX, originY, originZ, stepX, stepY, stepZ);
+    }
+
+    void SNoiseGrid3D(float_t* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ)
+    {
+        NoiseDetails::Grid3D(pOut, width, height, depth, originX, originY, originZ, stepX, stepY, stepZ);
+    }
+
+    double_t FBm(double_t x, double_t y, const FBmSettings& settings) {
+        double_t sum = 0.0;
+        double_t frequency = settings.frequency;
+        double_t amplitude = settings.amplitude;
+
+        for (uint32_t i = 0; i < settings.octaves; ++i) {
+            sum += amplitude * SNoise(x * frequency, y * frequency);
+            frequency *= settings.lacunarity;
+            amplitude *= settings.gain;
+        }
+
+        return sum;
+    }
+
+    double_t FBm(double_t x, double_t y, double_t z, const FBmSettings& settings) {
+        double_t sum = 0.0;
+        double_t frequency = settings.frequency;
+        double_t amplitude = settings.amplitude;
+
+        for (uint32_t i = 0; i < settings.octaves; ++i) {
+            sum += amplitude * SNoise(x * frequency, y * frequency, z * frequency);
+            frequency *= settings.lacunarity;
+            amplitude *= settings.gain;
+        }
+
+        return sum;
+    }
+
+    void FBmGrid2D(double_t* pOut, uint32_t width, uint32_t height,
+        double_t originX, double_t originY, double_t stepX, double_t stepY, const FBmSettings& settings)
+    {
+        NoiseDetails::FBmGrid(pOut, static_cast<uint64_t>(width) * height, settings, [&](double_t* pLayer, double_t frequency) {
+            NoiseDetails::Grid2D(pLayer, width, height, originX * frequency, originY * frequency, stepX * frequency, stepY * frequency);
+        });
+    }
+
+    void FBmGrid2D(float_t* pOut, uint32_t width, uint32_t height,
+        double_t originX, double_t originY, double_t stepX, double_t stepY, const FBmSettings& settings)
+    {
+        NoiseDetails::FBmGrid(pOut, static_cast<uint64_t>(width) * height, settings, [&](double_t* pLayer, double_t frequency) {
+            NoiseDetails::Grid2D(pLayer, width, height, originX * frequency, originY * frequency, stepX * frequency, stepY * frequency);
+        });
+    }
+
+    void FBmGrid3D(double_t* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ, const FBmSettings& settings)
+    {
+        NoiseDetails::FBmGrid(pOut, static_cast<uint64_t>(width) * height * depth, settings, [&](double_t* pLayer, double_t frequency) {
+            NoiseDetails::Grid3D(pLayer, width, height, depth,
+                originX * frequency, originY * frequency, originZ * frequency,
+                stepX * frequency, stepY * frequency, stepZ * frequency);
+        });
+    }
+
+    void FBmGrid3D(float_t* pOut, uint32_t width, uint32_t height, uint32_t depth,
+        double_t originX, double_t originY, double_t originZ, double_t stepX, double_t stepY, double_t stepZ, const FBmSettings& settings)
+    {
+        NoiseDetails::FBmGrid(pOut, static_cast<uint64_t>(width) * height * depth, settings, [&](double_t* pLayer, double_t frequency) {
+            NoiseDetails::Grid3D(pLayer, width, height, depth,
+                originX * frequency, originY * frequency, originZ * frequency,
+                stepX * frequency, stepY * frequency, stepZ * frequency);
+        });
+    }
+
+    const char* GetNoiseInstructionSet() {
+    #if defined(SR_NOISE_AVX2)
+        return "AVX2";
+    #elif defined(SR_NOISE_SSE2)
+        return "SSE2";
+    #else
+        return "Scalar";
+    #endif
+    }
+}
+
+SR_NOISE_FP_CONTRACT_OFF_END
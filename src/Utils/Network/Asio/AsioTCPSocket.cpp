@@ -3,6 +3,7 @@
 //
 
 #include <Utils/Network/Asio/AsioTCPSocket.h>
+#include <Utils/Profile/Metrics.h>
 
 namespace SR_NETWORK_NS {
     AsioTCPSocket::AsioTCPSocket(Context::Ptr pContext)
@@ -69,6 +70,8 @@ namespace SR_NETWORK_NS {
             return false;
         }
 
+        SR_METRIC_COUNTER_ADD("network.tcp_bytes_sent", size);
+
         return true;
     }
 
@@ -91,6 +94,8 @@ namespace SR_NETWORK_NS {
             return 0;
         }
 
+        SR_METRIC_COUNTER_ADD("network.tcp_bytes_received", receivedSize);
+
         return receivedSize;
     }
 
@@ -12,6 +12,11 @@
 #include <android/native_activity.h>
 #include <android/configuration.h>
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 namespace SR_UTILS_NS::Platform {
     static android_app* pAndroidInstance = nullptr;
 
@@ -65,6 +70,41 @@ namespace SR_UTILS_NS::Platform {
         return content;
     }
 
+    bool MapFile(const Path& path, FileMapping& mapping) {
+        const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat fileStat = { };
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+            close(fd);
+            return false;
+        }
+
+        void* pData = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+        /// после mmap дескриптор больше не нужен
+        close(fd);
+
+        if (pData == MAP_FAILED) {
+            return false;
+        }
+
+        mapping.pData = static_cast<const char*>(pData);
+        mapping.size = static_cast<uint64_t>(fileStat.st_size);
+        mapping.pHandle = nullptr;
+
+        return true;
+    }
+
+    void UnmapFile(FileMapping& mapping) {
+        if (mapping.pData) {
+            munmap(const_cast<char*>(mapping.pData), static_cast<size_t>(mapping.size));
+        }
+        mapping = FileMapping();
+    }
+
     void WriteConsoleLog(const std::string& msg) {
         ((void)__android_log_print(ANDROID_LOG_INFO, "SpaRcle Engine", msg.c_str()));
     }
@@ -119,8 +159,51 @@ namespace SR_UTILS_NS::Platform {
         SRHaltOnce("Not implemented!");
     }
 
-    void SetThreadPriority(void *nativeHandle, ThreadPriority priority) {
+    uint64_t GetCurrentThreadNativeId() {
+        return static_cast<uint64_t>(gettid());
+    }
+
+    bool SetThreadPriority(uint64_t nativeId, ThreadPriority priority) {
+        SRHaltOnce("Not implemented!");
+        return false;
+    }
+
+    std::optional<ThreadPriority> GetThreadPriority(uint64_t nativeId) {
+        SRHaltOnce("Not implemented!");
+        return std::nullopt;
+    }
+
+    bool SetThreadAffinity(uint64_t nativeId, const std::vector<uint32_t>& cpus) {
         SRHaltOnce("Not implemented!");
+        return false;
+    }
+
+    std::vector<uint32_t> GetThreadAffinity(uint64_t nativeId) {
+        SRHaltOnce("Not implemented!");
+        return { };
+    }
+
+    bool SetThreadName(uint64_t nativeId, const std::string& name) {
+        SRHaltOnce("Not implemented!");
+        return false;
+    }
+
+    std::string GetThreadName(uint64_t nativeId) {
+        SRHaltOnce("Not implemented!");
+        return std::string();
+    }
+
+    const CPUTopology& GetCPUTopology() {
+        static const CPUTopology topology = []() {
+            CPUTopology result;
+            for (uint32_t cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu) {
+                result.cpus.emplace_back(CPUInfo { cpu, cpu, 0, 0 });
+            }
+            result.coreCount = static_cast<uint32_t>(result.cpus.size());
+            result.packageCount = result.cacheGroupCount = 1;
+            return result;
+        }();
+        return topology;
     }
 
     void Terminate() {
@@ -4,6 +4,7 @@
 
 #include <Utils/Platform/Platform.h>
 #include <Utils/Common/StringFormat.h>
+#include <Utils/Common/StringTokenizer.h>
 #include <Utils/Debug.h>
 
 #include <X11/Xlib.h>
@@ -23,6 +24,11 @@
 #include <Utils/Platform/XKeySymToKeyCode.h>
 
 #include <sys/sendfile.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sched.h>
 #include <X11/extensions/Xfixes.h>
 
 namespace SR_PLATFORM_NS {
@@ -68,6 +74,8 @@ namespace SR_PLATFORM_NS {
     }
 
     void InitSegmentationHandler() {
+        /// раскрутчик подгружается заранее, в обработчике падения выделять память уже поздно
+        SR_UTILS_NS::StacktraceInit();
         signal(SIGSEGV, SegmentationHandler);
         std::set_terminate(StdHandler);
     }
@@ -211,6 +219,41 @@ namespace SR_PLATFORM_NS {
         return std::string((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
     }
 
+    bool MapFile(const Path& path, FileMapping& mapping) {
+        const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat fileStat = { };
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+            close(fd);
+            return false;
+        }
+
+        void* pData = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+        /// после mmap дескриптор больше не нужен
+        close(fd);
+
+        if (pData == MAP_FAILED) {
+            return false;
+        }
+
+        mapping.pData = static_cast<const char*>(pData);
+        mapping.size = static_cast<uint64_t>(fileStat.st_size);
+        mapping.pHandle = nullptr;
+
+        return true;
+    }
+
+    void UnmapFile(FileMapping& mapping) {
+        if (mapping.pData) {
+            munmap(const_cast<char*>(mapping.pData), static_cast<size_t>(mapping.size));
+        }
+        mapping = FileMapping();
+    }
+
     void WriteConsoleLog(const std::string& msg) {
         std::cout << msg << std::flush;
     }
@@ -354,31 +397,339 @@ namespace SR_PLATFORM_NS {
     }
 
     uint64_t GetProcessUsedMemory() {
-        std::ifstream proc_meminfo("/proc/self/status");
-        uint64_t result = 0;
-        if (proc_meminfo.good()) {
-            std::string content((std::istreambuf_iterator<char>(proc_meminfo)), std::istreambuf_iterator<char>());
-
-            static const auto&& getVal = [](const std::string &target, const std::string &content) {
-                int result = -1;
-                std::size_t start = content.find(target);
-                if (start != std::string::npos) {
-                    int begin = start + target.length();
-                    std::size_t end = content.find("kB", start);
-                    std::string substr = content.substr(begin, end - begin);
-                    result = std::stoi(substr);
+        /// statm - одна короткая строка "size resident shared ...", в страницах;
+        /// дескриптор держим открытым, pread с нуля заново формирует содержимое
+        static const int statmFd = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+        static const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+
+        if (statmFd < 0) {
+            return 0;
+        }
+
+        char buffer[128];
+        const ssize_t size = pread(statmFd, buffer, sizeof(buffer) - 1, 0);
+        if (size <= 0) {
+            return 0;
+        }
+        buffer[size] = '\0';
+
+        unsigned long long totalPages = 0;
+        unsigned long long residentPages = 0;
+        if (sscanf(buffer, "%llu %llu", &totalPages, &residentPages) != 2) {
+            return 0;
+        }
+
+        return static_cast<uint64_t>(residentPages) * pageSize;
+    }
+
+    static std::string ReadLinuxSystemFile(const std::string& path) {
+        std::ifstream file(path);
+        if (!file.good()) {
+            return std::string();
+        }
+
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        while (!content.empty() && (content.back() == '\n' || content.back() == ' ')) {
+            content.pop_back();
+        }
+
+        return content;
+    }
+
+    /// формат "0-3,8,10-11"
+    static std::vector<uint32_t> ParseLinuxCPUList(std::string_view list) {
+        std::vector<uint32_t> cpus;
+
+        for (auto&& range : SR_UTILS_NS::StringTokenizer(list, ',')) {
+            const uint64_t dash = range.find('-');
+            const auto first = SR_UTILS_NS::StringUtils::ParseNumber<uint32_t>(range.substr(0, dash), 0);
+            const auto last = dash == std::string_view::npos ? first : SR_UTILS_NS::StringUtils::ParseNumber<uint32_t>(range.substr(dash + 1), first);
+
+            for (uint32_t cpu = first; cpu <= last; ++cpu) {
+                cpus.emplace_back(cpu);
+            }
+        }
+
+        return cpus;
+    }
+
+    static std::string GetLinuxThreadPath(uint64_t nativeId) {
+        return "/proc/self/task/" + std::to_string(nativeId);
+    }
+
+    static int32_t ThreadPriorityToNice(ThreadPriority priority) {
+        switch (priority) {
+            case ThreadPriority::SR_THREAD_PRIORITY_TIME_CRITICAL: return -20;
+            case ThreadPriority::SR_THREAD_PRIORITY_HIGHEST: return -10;
+            case ThreadPriority::SR_THREAD_PRIORITY_ABOVE_NORMAL: return -5;
+            case ThreadPriority::SR_THREAD_PRIORITY_NORMAL: return 0;
+            case ThreadPriority::SR_THREAD_PRIORITY_BELOW_NORMAL: return 5;
+            case ThreadPriority::SR_THREAD_PRIORITY_LOWEST: return 10;
+            case ThreadPriority::SR_THREAD_PRIORITY_IDLE: return 19;
+            default:
+                SRHalt("Unknown thread priority!");
+                return 0;
+        }
+    }
+
+    uint64_t GetCurrentThreadNativeId() {
+        return static_cast<uint64_t>(::syscall(SYS_gettid));
+    }
+
+    /**
+     * Наименьший nice, который можно выставить без CAP_SYS_NICE: понижать nice ниже текущего
+     * ядро разрешает только до 20 - RLIMIT_NICE (по умолчанию лимит 0, то есть не ниже текущего).
+    */
+    static int32_t GetUnprivilegedNiceFloor(int32_t currentNice) {
+        rlimit limit = { };
+        if (getrlimit(RLIMIT_NICE, &limit) != 0 || limit.rlim_cur == RLIM_INFINITY) {
+            return currentNice;
+        }
+
+        const int32_t floor = 20 - static_cast<int32_t>(SR_MIN(limit.rlim_cur, static_cast<rlim_t>(40)));
+        return SR_MIN(currentNice, floor);
+    }
+
+    bool SetThreadPriority(uint64_t nativeId, ThreadPriority priority) {
+        const auto tid = static_cast<pid_t>(nativeId);
+        sched_param param = { };
+
+        /// реальное время требует CAP_SYS_NICE, без него остается nice в пределах RLIMIT_NICE
+        if (priority == ThreadPriority::SR_THREAD_PRIORITY_TIME_CRITICAL) {
+            param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+            if (sched_setscheduler(tid, SCHED_FIFO, &param) == 0) {
+                return true;
+            }
+            param.sched_priority = 0;
+        }
+
+        const int32_t policy = priority == ThreadPriority::SR_THREAD_PRIORITY_IDLE ? SCHED_IDLE : SCHED_OTHER;
+        if (sched_setscheduler(tid, policy, &param) != 0) {
+            SR_ERROR("Platform::SetThreadPriority() : failed to set scheduler policy for thread {}! Error: {}", nativeId, strerror(errno));
+            return false;
+        }
+
+        const int32_t nice = ThreadPriorityToNice(priority);
+        if (setpriority(PRIO_PROCESS, static_cast<id_t>(tid), nice) == 0) {
+            return true;
+        }
+
+        if (errno != EACCES && errno != EPERM) {
+            SR_WARN("Platform::SetThreadPriority() : failed to set nice {} for thread {}! Error: {}", nice, nativeId, strerror(errno));
+            return false;
+        }
+
+        /// без CAP_SYS_NICE ставим ближайший разрешенный nice, но сообщаем, что приоритет не тот, что просили
+        errno = 0;
+        const int32_t currentNice = getpriority(PRIO_PROCESS, static_cast<id_t>(tid));
+        const int32_t floor = errno == 0 ? GetUnprivilegedNiceFloor(currentNice) : nice;
+
+        if (floor > nice && floor < currentNice && setpriority(PRIO_PROCESS, static_cast<id_t>(tid), floor) == 0) {
+            SR_WARN("Platform::SetThreadPriority() : nice {} for thread {} is limited by RLIMIT_NICE, set {} instead!", nice, nativeId, floor);
+            return false;
+        }
+
+        SR_WARN("Platform::SetThreadPriority() : nice {} for thread {} requires CAP_SYS_NICE or a higher RLIMIT_NICE, keeping {}!", nice, nativeId, currentNice);
+        return false;
+    }
+
+    std::optional<ThreadPriority> GetThreadPriority(uint64_t nativeId) {
+        const auto tid = static_cast<pid_t>(nativeId);
+
+        const int32_t policy = sched_getscheduler(tid);
+        if (policy < 0) {
+            return std::nullopt;
+        }
+
+        if (policy == SCHED_FIFO || policy == SCHED_RR) {
+            return ThreadPriority::SR_THREAD_PRIORITY_TIME_CRITICAL;
+        }
+
+        if (policy == SCHED_IDLE) {
+            return ThreadPriority::SR_THREAD_PRIORITY_IDLE;
+        }
+
+        errno = 0;
+        const int32_t nice = getpriority(PRIO_PROCESS, static_cast<id_t>(tid));
+        if (errno != 0) {
+            return std::nullopt;
+        }
+
+        if (nice <= -15) { return ThreadPriority::SR_THREAD_PRIORITY_TIME_CRITICAL; }
+        if (nice <= -8) { return ThreadPriority::SR_THREAD_PRIORITY_HIGHEST; }
+        if (nice <= -3) { return ThreadPriority::SR_THREAD_PRIORITY_ABOVE_NORMAL; }
+        if (nice < 3) { return ThreadPriority::SR_THREAD_PRIORITY_NORMAL; }
+        if (nice < 8) { return ThreadPriority::SR_THREAD_PRIORITY_BELOW_NORMAL; }
+
+        return ThreadPriority::SR_THREAD_PRIORITY_LOWEST;
+    }
+
+    bool SetThreadAffinity(uint64_t nativeId, const std::vector<uint32_t>& cpus) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+
+        if (cpus.empty()) {
+            for (auto&& info : GetCPUTopology().cpus) {
+                CPU_SET(info.cpu, &set);
+            }
+        }
+
+        for (const uint32_t cpu : cpus) {
+            if (cpu >= CPU_SETSIZE) {
+                SR_ERROR("Platform::SetThreadAffinity() : cpu {} is out of range!", cpu);
+                return false;
+            }
+            CPU_SET(cpu, &set);
+        }
+
+        if (sched_setaffinity(static_cast<pid_t>(nativeId), sizeof(set), &set) != 0) {
+            SR_ERROR("Platform::SetThreadAffinity() : failed to set affinity for thread {}! Error: {}", nativeId, strerror(errno));
+            return false;
+        }
+
+        return true;
+    }
+
+    std::vector<uint32_t> GetThreadAffinity(uint64_t nativeId) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+
+        std::vector<uint32_t> cpus;
+
+        if (sched_getaffinity(static_cast<pid_t>(nativeId), sizeof(set), &set) != 0) {
+            return cpus;
+        }
+
+        for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.emplace_back(cpu);
+            }
+        }
+
+        return cpus;
+    }
+
+    bool SetThreadName(uint64_t nativeId, const std::string& name) {
+        /// ядро хранит не больше 15 символов
+        std::ofstream file(GetLinuxThreadPath(nativeId) + "/comm");
+        if (!file.good()) {
+            SR_WARN("Platform::SetThreadName() : failed to open comm of thread {}!", nativeId);
+            return false;
+        }
+
+        file << name.substr(0, 15);
+        file.close();
+
+        return !file.fail();
+    }
+
+    std::string GetThreadName(uint64_t nativeId) {
+        return ReadLinuxSystemFile(GetLinuxThreadPath(nativeId) + "/comm");
+    }
+
+    /// /sys/devices/system/cpu, при его отсутствии (старые ядра, песочницы) - /proc/cpuinfo
+    static CPUTopology DetectCPUTopology() {
+        struct RawCPU {
+            uint32_t cpu = 0;
+            int64_t package = 0;
+            int64_t core = 0;
+            std::string cache;
+        };
+
+        std::vector<RawCPU> raw;
+
+        for (const uint32_t cpu : ParseLinuxCPUList(ReadLinuxSystemFile("/sys/devices/system/cpu/online"))) {
+            const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+
+            RawCPU& info = raw.emplace_back();
+            info.cpu = cpu;
+            info.package = SR_UTILS_NS::StringUtils::ParseNumber<int64_t>(ReadLinuxSystemFile(base + "/topology/physical_package_id"), 0);
+            info.core = SR_UTILS_NS::StringUtils::ParseNumber<int64_t>(ReadLinuxSystemFile(base + "/topology/core_id"), cpu);
+
+            /// кеш последнего уровня - индекс с наибольшим level, кроме кеша инструкций
+            int32_t lastLevel = -1;
+            for (uint32_t index = 0; ; ++index) {
+                const std::string cache = base + "/cache/index" + std::to_string(index);
+                const std::string level = ReadLinuxSystemFile(cache + "/level");
+                if (level.empty()) {
+                    break;
+                }
+
+                if (ReadLinuxSystemFile(cache + "/type") == "Instruction") {
+                    continue;
                 }
-                return result * 1024;
-            };
 
-            result  = getVal("VmRSS:", content);
+                if (const auto value = SR_UTILS_NS::StringUtils::ParseNumber<int32_t>(level, 0); value > lastLevel) {
+                    lastLevel = value;
+                    info.cache = ReadLinuxSystemFile(cache + "/shared_cpu_list");
+                }
+            }
         }
 
-        return result;
+        if (raw.empty()) {
+            const std::string cpuinfo = ReadLinuxSystemFile("/proc/cpuinfo");
+
+            for (auto&& line : SR_UTILS_NS::StringTokenizer(cpuinfo, '\n')) {
+                const uint64_t colon = line.find(':');
+                if (colon == std::string_view::npos) {
+                    continue;
+                }
+
+                const std::string_view key = line.substr(0, line.find_last_not_of(" \t", colon - 1) + 1);
+                const std::string_view value = line.substr(std::min<uint64_t>(colon + 2, line.size()));
+
+                if (key == "processor") {
+                    RawCPU& info = raw.emplace_back();
+                    info.cpu = SR_UTILS_NS::StringUtils::ParseNumber<uint32_t>(value, static_cast<uint32_t>(raw.size() - 1));
+                    info.core = info.cpu;
+                }
+                else if (raw.empty()) {
+                    continue;
+                }
+                else if (key == "physical id") {
+                    raw.back().package = SR_UTILS_NS::StringUtils::ParseNumber<int64_t>(value, 0);
+                }
+                else if (key == "core id") {
+                    raw.back().core = SR_UTILS_NS::StringUtils::ParseNumber<int64_t>(value, raw.back().cpu);
+                }
+            }
+        }
+
+        if (raw.empty()) {
+            for (uint32_t cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu) {
+                raw.emplace_back(RawCPU { cpu, 0, cpu, std::string() });
+            }
+        }
+
+        CPUTopology topology;
+
+        std::map<std::pair<int64_t, int64_t>, uint32_t> cores;
+        std::map<int64_t, uint32_t> packages;
+        std::map<std::string, uint32_t> caches;
+
+        for (auto&& info : raw) {
+            /// без сведений о кеше считаем общим кешем весь пакет
+            const std::string cache = info.cache.empty() ? "package " + std::to_string(info.package) : info.cache;
+
+            CPUInfo& cpu = topology.cpus.emplace_back();
+            cpu.cpu = info.cpu;
+            cpu.core = cores.try_emplace(std::make_pair(info.package, info.core), static_cast<uint32_t>(cores.size())).first->second;
+            cpu.package = packages.try_emplace(info.package, static_cast<uint32_t>(packages.size())).first->second;
+            cpu.cacheGroup = caches.try_emplace(cache, static_cast<uint32_t>(caches.size())).first->second;
+        }
+
+        std::ranges::sort(topology.cpus, [](const CPUInfo& left, const CPUInfo& right) { return left.cpu < right.cpu; });
+
+        topology.coreCount = static_cast<uint32_t>(cores.size());
+        topology.packageCount = static_cast<uint32_t>(packages.size());
+        topology.cacheGroupCount = static_cast<uint32_t>(caches.size());
+
+        return topology;
     }
 
-    void SetThreadPriority(void *nativeHandle, ThreadPriority priority) {
-        SRHaltOnce("Not implemented!");
+    const CPUTopology& GetCPUTopology() {
+        static const CPUTopology topology = DetectCPUTopology();
+        return topology;
     }
 
     void Terminate() {
@@ -410,6 +761,9 @@ namespace SR_PLATFORM_NS {
             close(source);
             close(dest);
 
+            /// сбрасываем кеш только после изменения: запрос типа пути до копирования закешировал бы старое состояние
+            SR_UTILS_NS::Path::InvalidateAllMetadata();
+
             if (result == -1) {
                 SR_WARN("Platform::Copy() : failed to copy!\n\tFrom: {}\n\tTo: {}", from.CStr(), to.CStr());
             }
@@ -476,7 +830,12 @@ namespace SR_PLATFORM_NS {
         }
 
         const std::string command = "mkdir -p " + path;
-        if (system(command.c_str()) != 0) {
+        const int32_t code = system(command.c_str());
+
+        /// mkdir -p мог создать часть вложенных папок даже при ошибке
+        SR_UTILS_NS::Path::InvalidateAllMetadata();
+
+        if (code != 0) {
             SR_WARN("Platform::CreateFolder() : failed to create folder!\n\tPath: {}", path);
             return false;
         }
@@ -487,6 +846,7 @@ namespace SR_PLATFORM_NS {
     bool Delete(const Path &path) {
         if (path.IsFile()) {
             const bool result = std::remove(path.CStr()) == 0;
+            SR_UTILS_NS::Path::InvalidateAllMetadata();
 
             if (!result) {
                 SR_WARN("Platform::Delete() : failed to delete file!\n\tPath: {}", path.CStr());
@@ -508,6 +868,7 @@ namespace SR_PLATFORM_NS {
         }
 
         const bool result = rmdir(path.CStr()) == 0;
+        SR_UTILS_NS::Path::InvalidateAllMetadata();
 
         if (!result) {
             SR_WARN("Platform::Delete() : failed to delete folder!\n\tPath: {}", path.CStr());
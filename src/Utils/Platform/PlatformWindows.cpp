@@ -126,6 +126,8 @@ namespace SR_UTILS_NS::Platform {
     }
 
     void InitSegmentationHandler() {
+        /// раскрутчик подгружается заранее, в обработчике падения выделять память уже поздно
+        SR_UTILS_NS::StacktraceInit();
         signal(SIGSEGV, SegmentationHandler);
         std::set_terminate(StdHandler);
     }
@@ -211,6 +213,50 @@ namespace SR_UTILS_NS::Platform {
         return std::string((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
     }
 
+    bool MapFile(const Path& path, FileMapping& mapping) {
+        HANDLE hFile = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = { };
+        if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart <= 0) {
+            CloseHandle(hFile);
+            return false;
+        }
+
+        HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        /// объект отображения сам держит файл открытым
+        CloseHandle(hFile);
+
+        if (!hMapping) {
+            return false;
+        }
+
+        void* pData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+        if (!pData) {
+            CloseHandle(hMapping);
+            return false;
+        }
+
+        mapping.pData = static_cast<const char*>(pData);
+        mapping.size = static_cast<uint64_t>(fileSize.QuadPart);
+        mapping.pHandle = hMapping;
+
+        return true;
+    }
+
+    void UnmapFile(FileMapping& mapping) {
+        if (mapping.pData) {
+            UnmapViewOfFile(mapping.pData);
+        }
+        if (mapping.pHandle) {
+            CloseHandle(static_cast<HANDLE>(mapping.pHandle));
+        }
+        mapping = FileMapping();
+    }
+
     void TextToClipboard(const std::string &text) {
         if (text.empty()) {
             SR_WARN("Platform::TextToClipboard() : text is empty!");
@@ -400,7 +446,16 @@ namespace SR_UTILS_NS::Platform {
         SRHaltOnce("Platform::SetSamePermissions() : is not implemented!");
     }
 
-    void SetThreadPriority(void *nativeHandle, ThreadPriority priority) {
+    /// дескриптор потока по его идентификатору, закрывается вызывающим
+    static HANDLE OpenThreadByNativeId(uint64_t nativeId) {
+        return ::OpenThread(THREAD_SET_INFORMATION | THREAD_QUERY_INFORMATION, FALSE, static_cast<DWORD>(nativeId));
+    }
+
+    uint64_t GetCurrentThreadNativeId() {
+        return static_cast<uint64_t>(::GetCurrentThreadId());
+    }
+
+    bool SetThreadPriority(uint64_t nativeId, ThreadPriority priority) {
         int32_t winPriority = 0;
 
         switch (priority) {
@@ -426,15 +481,238 @@ namespace SR_UTILS_NS::Platform {
                 winPriority = THREAD_PRIORITY_TIME_CRITICAL;
                 break;
             default:
-                SRAssert(false);
-                return;
+                SRHalt("Unknown thread priority!");
+                return false;
         }
 
-        auto&& result = ::SetThreadPriority(static_cast<HANDLE>(nativeHandle), winPriority);
+        HANDLE handle = OpenThreadByNativeId(nativeId);
+        if (!handle) {
+            SR_ERROR("Platform::SetThreadPriority() : failed to open thread {}!", nativeId);
+            return false;
+        }
+
+        auto&& result = ::SetThreadPriority(handle, winPriority);
+        CloseHandle(handle);
 
         if (result == FALSE) {
             SR_ERROR("Platform::SetThreadPriority() : failed to set thread priority!");
+            return false;
         }
+
+        return true;
+    }
+
+    std::optional<ThreadPriority> GetThreadPriority(uint64_t nativeId) {
+        HANDLE handle = OpenThreadByNativeId(nativeId);
+        if (!handle) {
+            return std::nullopt;
+        }
+
+        const int32_t winPriority = ::GetThreadPriority(handle);
+        CloseHandle(handle);
+
+        switch (winPriority) {
+            case THREAD_PRIORITY_ABOVE_NORMAL: return ThreadPriority::SR_THREAD_PRIORITY_ABOVE_NORMAL;
+            case THREAD_PRIORITY_BELOW_NORMAL: return ThreadPriority::SR_THREAD_PRIORITY_BELOW_NORMAL;
+            case THREAD_PRIORITY_HIGHEST: return ThreadPriority::SR_THREAD_PRIORITY_HIGHEST;
+            case THREAD_PRIORITY_IDLE: return ThreadPriority::SR_THREAD_PRIORITY_IDLE;
+            case THREAD_PRIORITY_LOWEST: return ThreadPriority::SR_THREAD_PRIORITY_LOWEST;
+            case THREAD_PRIORITY_NORMAL: return ThreadPriority::SR_THREAD_PRIORITY_NORMAL;
+            case THREAD_PRIORITY_TIME_CRITICAL: return ThreadPriority::SR_THREAD_PRIORITY_TIME_CRITICAL;
+            default:
+                return std::nullopt;
+        }
+    }
+
+    bool SetThreadAffinity(uint64_t nativeId, const std::vector<uint32_t>& cpus) {
+        DWORD_PTR processMask = 0, systemMask = 0;
+        GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask);
+
+        /// только первая группа процессоров (до 64 логических)
+        DWORD_PTR mask = cpus.empty() ? processMask : 0;
+        for (const uint32_t cpu : cpus) {
+            if (cpu >= sizeof(DWORD_PTR) * 8) {
+                SR_ERROR("Platform::SetThreadAffinity() : cpu {} is out of range!", cpu);
+                return false;
+            }
+            mask |= static_cast<DWORD_PTR>(1) << cpu;
+        }
+
+        HANDLE handle = OpenThreadByNativeId(nativeId);
+        if (!handle) {
+            SR_ERROR("Platform::SetThreadAffinity() : failed to open thread {}!", nativeId);
+            return false;
+        }
+
+        const DWORD_PTR result = SetThreadAffinityMask(handle, mask);
+        CloseHandle(handle);
+
+        if (result == 0) {
+            SR_ERROR("Platform::SetThreadAffinity() : failed to set affinity for thread {}!", nativeId);
+            return false;
+        }
+
+        return true;
+    }
+
+    std::vector<uint32_t> GetThreadAffinity(uint64_t nativeId) {
+        std::vector<uint32_t> cpus;
+
+        DWORD_PTR processMask = 0, systemMask = 0;
+        GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask);
+
+        HANDLE handle = OpenThreadByNativeId(nativeId);
+        if (!handle) {
+            return cpus;
+        }
+
+        /// прямого запроса нет: SetThreadAffinityMask возвращает прежнюю маску, ее и восстанавливаем
+        const DWORD_PTR mask = SetThreadAffinityMask(handle, processMask);
+        if (mask != 0) {
+            SetThreadAffinityMask(handle, mask);
+        }
+        CloseHandle(handle);
+
+        for (uint32_t cpu = 0; cpu < sizeof(DWORD_PTR) * 8; ++cpu) {
+            if (mask & (static_cast<DWORD_PTR>(1) << cpu)) {
+                cpus.emplace_back(cpu);
+            }
+        }
+
+        return cpus;
+    }
+
+    bool SetThreadName(uint64_t nativeId, const std::string& name) {
+        /// SetThreadDescription есть только начиная с Windows 10 1607
+        using SetThreadDescriptionFn = HRESULT(WINAPI*)(HANDLE, PCWSTR);
+        static auto&& pSetThreadDescription = reinterpret_cast<SetThreadDescriptionFn>(
+            reinterpret_cast<void*>(GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "SetThreadDescription")));
+
+        if (!pSetThreadDescription) {
+            return false;
+        }
+
+        HANDLE handle = OpenThreadByNativeId(nativeId);
+        if (!handle) {
+            return false;
+        }
+
+        const HRESULT result = pSetThreadDescription(handle, ConvertToUnicode(name).c_str());
+        CloseHandle(handle);
+
+        return SUCCEEDED(result);
+    }
+
+    std::string GetThreadName(uint64_t nativeId) {
+        using GetThreadDescriptionFn = HRESULT(WINAPI*)(HANDLE, PWSTR*);
+        static auto&& pGetThreadDescription = reinterpret_cast<GetThreadDescriptionFn>(
+            reinterpret_cast<void*>(GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "GetThreadDescription")));
+
+        if (!pGetThreadDescription) {
+            return std::string();
+        }
+
+        HANDLE handle = OpenThreadByNativeId(nativeId);
+        if (!handle) {
+            return std::string();
+        }
+
+        PWSTR pDescription = nullptr;
+        std::string name;
+
+        if (SUCCEEDED(pGetThreadDescription(handle, &pDescription)) && pDescription) {
+            const int32_t size = WideCharToMultiByte(CP_UTF8, 0, pDescription, -1, nullptr, 0, nullptr, nullptr);
+            if (size > 1) {
+                name.resize(size - 1);
+                WideCharToMultiByte(CP_UTF8, 0, pDescription, -1, name.data(), size, nullptr, nullptr);
+            }
+            LocalFree(pDescription);
+        }
+
+        CloseHandle(handle);
+
+        return name;
+    }
+
+    static CPUTopology DetectCPUTopology() {
+        CPUTopology topology;
+
+        DWORD length = 0;
+        GetLogicalProcessorInformation(nullptr, &length);
+
+        std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+        if (infos.empty() || !GetLogicalProcessorInformation(infos.data(), &length)) {
+            for (uint32_t cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu) {
+                topology.cpus.emplace_back(CPUInfo { cpu, cpu, 0, 0 });
+            }
+            topology.coreCount = static_cast<uint32_t>(topology.cpus.size());
+            topology.packageCount = topology.cacheGroupCount = 1;
+            return topology;
+        }
+
+        constexpr uint32_t maxCPUs = sizeof(ULONG_PTR) * 8;
+        std::array<int32_t, maxCPUs> cores, packages, caches;
+        cores.fill(-1);
+        packages.fill(0);
+        caches.fill(-1);
+
+        uint8_t lastCacheLevel = 0;
+        for (auto&& info : infos) {
+            if (info.Relationship == RelationCache && info.Cache.Type != CacheInstruction) {
+                lastCacheLevel = std::max(lastCacheLevel, info.Cache.Level);
+            }
+        }
+
+        for (auto&& info : infos) {
+            int32_t* pTarget = nullptr;
+            uint32_t* pCounter = nullptr;
+
+            if (info.Relationship == RelationProcessorCore) {
+                pTarget = cores.data();
+                pCounter = &topology.coreCount;
+            }
+            else if (info.Relationship == RelationProcessorPackage) {
+                pTarget = packages.data();
+                pCounter = &topology.packageCount;
+            }
+            else if (info.Relationship == RelationCache && info.Cache.Level == lastCacheLevel && info.Cache.Type != CacheInstruction) {
+                pTarget = caches.data();
+                pCounter = &topology.cacheGroupCount;
+            }
+            else {
+                continue;
+            }
+
+            for (uint32_t cpu = 0; cpu < maxCPUs; ++cpu) {
+                if (info.ProcessorMask & (static_cast<ULONG_PTR>(1) << cpu)) {
+                    pTarget[cpu] = static_cast<int32_t>(*pCounter);
+                }
+            }
+
+            ++(*pCounter);
+        }
+
+        for (uint32_t cpu = 0; cpu < maxCPUs; ++cpu) {
+            if (cores[cpu] < 0) {
+                continue;
+            }
+            CPUInfo& info = topology.cpus.emplace_back();
+            info.cpu = cpu;
+            info.core = static_cast<uint32_t>(cores[cpu]);
+            info.package = static_cast<uint32_t>(packages[cpu]);
+            /// без сведений о кеше общим кешем считается пакет
+            info.cacheGroup = caches[cpu] < 0 ? info.package : static_cast<uint32_t>(caches[cpu]);
+        }
+
+        topology.packageCount = std::max(topology.packageCount, 1u);
+        topology.cacheGroupCount = std::max(topology.cacheGroupCount, topology.packageCount);
+
+        return topology;
+    }
+
+    const CPUTopology& GetCPUTopology() {
+        static const CPUTopology topology = DetectCPUTopology();
+        return topology;
     }
 
     void Terminate() {
@@ -459,6 +737,9 @@ namespace SR_UTILS_NS::Platform {
                     false
             );
 
+            /// сбрасываем кеш только после изменения: запрос типа пути до копирования закешировал бы старое состояние
+            SR_UTILS_NS::Path::InvalidateAllMetadata();
+
             if (!result) {
                 auto&& message = GetLastErrorAsString();
                 SR_WARN("Platform::Copy() : {}\n\tFrom: {}\n\tTo: {}", message.c_str(), from.CStr(), to.CStr());
@@ -513,10 +794,14 @@ namespace SR_UTILS_NS::Platform {
 
     bool CreateFolder(const std::string& path) {
 #ifdef SR_MINGW
-        return mkdir(path.c_str());
+        const bool result = mkdir(path.c_str());
 #else
-        return _mkdir(path.c_str());
+        const bool result = _mkdir(path.c_str());
 #endif
+
+        SR_UTILS_NS::Path::InvalidateAllMetadata();
+
+        return result;
     }
 
     bool IsConsoleFocused() {
@@ -526,6 +811,7 @@ namespace SR_UTILS_NS::Platform {
     bool Delete(const Path &path) { ///TODO: Обезопасить от безвозвратного удаления файлов
         if (path.IsFile()) {
             const bool result = std::remove(path.CStr()) == 0;
+            SR_UTILS_NS::Path::InvalidateAllMetadata();
 
             if (!result) {
                 SR_WARN("Platform::Delete() : failed to delete file!\n\tPath: {}", path.CStr());
@@ -547,6 +833,7 @@ namespace SR_UTILS_NS::Platform {
         }
 
         const bool result = _rmdir(path.CStr()) == 0;
+        SR_UTILS_NS::Path::InvalidateAllMetadata();
 
         if (!result) {
             SR_WARN("Platform::Delete() : failed to delete folder!\n\tPath: {}", path.CStr());
@@ -0,0 +1,159 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Platform/Stacktrace.h>
+#include <Utils/Common/Hashes.h>
+#include <Utils/Types/Map.h>
+
+namespace SR_UTILS_NS {
+    namespace {
+        struct StacktraceEntry {
+            void* frames[SR_STACKTRACE_MAX_FRAMES] = { };
+            uint32_t count = 0;
+            bool resolved = false;
+            std::string symbolized;
+        };
+
+        struct StacktraceRegistry {
+            std::mutex mutex;
+            /// deque не переносит записи при росте, ссылки на них живут без блокировки
+            std::deque<StacktraceEntry> entries;
+            ska::flat_hash_map<StacktraceId, StacktraceEntry*> index;
+        };
+
+        StacktraceRegistry& GetStacktraceRegistry() {
+            /// не уничтожается, стеки могут запрашиваться из деструкторов статических объектов
+            static auto&& registry = *new StacktraceRegistry();
+            return registry;
+        }
+
+        std::atomic<bool> g_stacktraceEnabled = true;
+    }
+
+    void DisableStacktrace() {
+        g_stacktraceEnabled = false;
+    }
+
+    bool IsStacktraceEnabled() {
+        return g_stacktraceEnabled;
+    }
+
+    void StacktraceInit() {
+        /// первый захват подгружает раскрутчик, это выделяет память и не должно случиться в обработчике падения
+        void* frames[4];
+        SR_UNUSED_VARIABLE(CaptureStacktrace(frames, 4));
+        SR_UNUSED_VARIABLE(GetStacktraceRegistry());
+    }
+
+    SR_NOINLINE std::string GetStacktrace() {
+        if (!g_stacktraceEnabled) {
+            return std::string();
+        }
+
+        void* frames[SR_STACKTRACE_MAX_FRAMES];
+        const uint32_t count = CaptureStacktrace(frames, SR_STACKTRACE_MAX_FRAMES, 1);
+
+        return SymbolizeStacktrace(frames, count);
+    }
+
+    SR_NOINLINE StacktraceId CaptureStacktraceId(uint32_t skip) {
+        if (!g_stacktraceEnabled) {
+            return 0;
+        }
+
+        void* frames[SR_STACKTRACE_MAX_FRAMES];
+        const uint32_t count = CaptureStacktrace(frames, SR_STACKTRACE_MAX_FRAMES, skip + 1);
+        if (count == 0) {
+            return 0;
+        }
+
+        StacktraceId id = HashArrayRepresentation(frames, count);
+
+        auto&& registry = GetStacktraceRegistry();
+        std::lock_guard lock(registry.mutex);
+
+        while (true) {
+            if (id == 0) {
+                ++id;
+            }
+
+            auto&& pIt = registry.index.find(id);
+            if (pIt == registry.index.end()) {
+                break;
+            }
+
+            /// разные стеки с одинаковым хешем получают соседние идентификаторы
+            const StacktraceEntry& entry = *pIt->second;
+            if (entry.count == count && memcmp(entry.frames, frames, count * sizeof(void*)) == 0) {
+                return id;
+            }
+
+            ++id;
+        }
+
+        auto&& entry = registry.entries.emplace_back();
+        memcpy(entry.frames, frames, count * sizeof(void*));
+        entry.count = count;
+        registry.index.insert(std::make_pair(id, &entry));
+
+        return id;
+    }
+
+    std::string ResolveStacktrace(StacktraceId id) {
+        if (id == 0) {
+            return std::string();
+        }
+
+        auto&& registry = GetStacktraceRegistry();
+        StacktraceEntry* pEntry = nullptr;
+
+        {
+            std::lock_guard lock(registry.mutex);
+
+            auto&& pIt = registry.index.find(id);
+            if (pIt == registry.index.end()) {
+                return std::string();
+            }
+
+            pEntry = pIt->second;
+
+            if (pEntry->resolved) {
+                return pEntry->symbolized;
+            }
+        }
+
+        /// символизация долгая, захват стеков в других потоках ее не ждет. Адреса записи неизменны
+        std::string symbolized = SymbolizeStacktrace(pEntry->frames, pEntry->count);
+
+        std::lock_guard lock(registry.mutex);
+
+        if (!pEntry->resolved) {
+            pEntry->symbolized = std::move(symbolized);
+            pEntry->resolved = true;
+        }
+
+        return pEntry->symbolized;
+    }
+
+    uint32_t GetStacktraceFrames(StacktraceId id, void** pFrames, uint32_t maxFrames) {
+        auto&& registry = GetStacktraceRegistry();
+        std::lock_guard lock(registry.mutex);
+
+        auto&& pIt = registry.index.find(id);
+        if (pIt == registry.index.end()) {
+            return 0;
+        }
+
+        const uint32_t count = std::min(pIt->second->count, maxFrames);
+        memcpy(pFrames, pIt->second->frames, count * sizeof(void*));
+
+        return count;
+    }
+
+    uint64_t GetUniqueStacktraceCount() {
+        auto&& registry = GetStacktraceRegistry();
+        std::lock_guard lock(registry.mutex);
+        return registry.entries.size();
+    }
+}
@@ -4,12 +4,68 @@
 
 #include <Utils/Platform/Stacktrace.h>
 
+#include <unwind.h>
+#include <dlfcn.h>
+
 namespace SR_UTILS_NS {
-    void DisableStacktrace() {
+    namespace {
+        struct AndroidUnwindState {
+            void** pFrames = nullptr;
+            uint32_t maxFrames = 0;
+            uint32_t skip = 0;
+            uint32_t count = 0;
+        };
+
+        _Unwind_Reason_Code AndroidUnwindCallback(struct _Unwind_Context* pContext, void* pArgument) {
+            auto&& state = *static_cast<AndroidUnwindState*>(pArgument);
+
+            const uintptr_t pc = _Unwind_GetIP(pContext);
+            if (pc == 0) {
+                return _URC_NO_REASON;
+            }
+
+            if (state.skip > 0) {
+                --state.skip;
+                return _URC_NO_REASON;
+            }
 
+            if (state.count >= state.maxFrames) {
+                return _URC_END_OF_STACK;
+            }
+
+            state.pFrames[state.count++] = reinterpret_cast<void*>(pc);
+
+            return _URC_NO_REASON;
+        }
     }
 
-    std::string GetStacktrace() {
-        return "Android not support stack trace!";
+    SR_NOINLINE uint32_t CaptureStacktrace(void** pFrames, uint32_t maxFrames, uint32_t skip) {
+        AndroidUnwindState state;
+        state.pFrames = pFrames;
+        state.maxFrames = maxFrames;
+        state.skip = skip + 1;
+
+        _Unwind_Backtrace(AndroidUnwindCallback, &state);
+
+        return state.count;
+    }
+
+    std::string SymbolizeStacktrace(void* const* pFrames, uint32_t count) {
+        std::string result;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            Dl_info info = { };
+
+            if (dladdr(pFrames[i], &info) && info.dli_sname) {
+                result += SR_FORMAT("#{} {} + {}\n", i, info.dli_sname,
+                    reinterpret_cast<const char*>(pFrames[i]) - reinterpret_cast<const char*>(info.dli_saddr)
+                );
+            }
+            else {
+                result += SR_FORMAT("#{} {}\n", i, pFrames[i]);
+            }
+        }
+
+        return result;
     }
-}
\ No newline at end of file
+}
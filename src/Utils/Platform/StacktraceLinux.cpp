@@ -5,23 +5,33 @@
 #include <Utils/Platform/Stacktrace.h>
 #include <cpptrace/cpptrace.hpp>
 
+#include <execinfo.h>
+
 namespace SR_UTILS_NS {
-    static bool g_stackStraceEnabled = true;
+    SR_NOINLINE uint32_t CaptureStacktrace(void** pFrames, uint32_t maxFrames, uint32_t skip) {
+        /// +1 - кадр самой функции
+        void* frames[SR_STACKTRACE_MAX_FRAMES + 16];
+        skip = std::min<uint32_t>(skip + 1, 16);
+
+        const int32_t captured = backtrace(frames, static_cast<int32_t>(std::min<uint32_t>(maxFrames, SR_STACKTRACE_MAX_FRAMES) + skip));
+        if (captured <= static_cast<int32_t>(skip)) {
+            return 0;
+        }
 
-    void DisableStacktrace() {
-        g_stackStraceEnabled = false;
+        const uint32_t count = static_cast<uint32_t>(captured) - skip;
+        memcpy(pFrames, frames + skip, count * sizeof(void*));
+
+        return count;
     }
 
-    std::string GetStacktrace() {
-        if (!g_stackStraceEnabled) {
-            return std::string();
-        }
+    std::string SymbolizeStacktrace(void* const* pFrames, uint32_t count) {
+        cpptrace::raw_trace trace;
+        trace.frames.reserve(count);
 
-        auto&& stacktrace = cpptrace::generate_trace();
-        auto&& result = stacktrace.to_string(true);
+        for (uint32_t i = 0; i < count; ++i) {
+            trace.frames.emplace_back(reinterpret_cast<cpptrace::frame_ptr>(pFrames[i]));
+        }
 
-        return result;
+        return trace.resolve().to_string(true);
     }
 }
-
-
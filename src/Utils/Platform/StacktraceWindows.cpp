@@ -14,13 +14,6 @@
 #include <ImageHlp.h>
 #pragma pack(pop, before_imagehlp)
 
-struct module_data {
-    std::string image_name;
-    std::string module_name;
-    void *base_address{};
-    DWORD load_size{};
-};
-
 class symbol {
     typedef IMAGEHLP_SYMBOL64 sym_type;
     sym_type *sym;
@@ -36,6 +29,10 @@ public:
         SymGetSymFromAddr64(process, address, &displacement, sym);
     }
 
+    ~symbol() {
+        ::operator delete(sym);
+    }
+
     std::string name() { return std::string(sym->Name); }
     std::string undecorated_name() {
         if (*sym->Name == '\0')
@@ -46,145 +43,47 @@ public:
     }
 };
 
-class get_mod_info {
-    HANDLE process;
-    static const int buffer_length = 4096;
-public:
-    explicit get_mod_info(HANDLE h) : process(h) {}
-
-    module_data operator()(HMODULE module) {
-        module_data ret;
-        char temp[buffer_length];
-        MODULEINFO mi;
-
-        GetModuleInformation(process, module, &mi, sizeof(mi));
-        ret.base_address = mi.lpBaseOfDll;
-        ret.load_size = mi.SizeOfImage;
-
-        GetModuleFileNameEx(process, module, temp, sizeof(temp));
-        ret.image_name = temp;
-        GetModuleBaseName(process, module, temp, sizeof(temp));
-        ret.module_name = temp;
-        std::vector<char> img(ret.image_name.begin(), ret.image_name.end());
-        std::vector<char> mod(ret.module_name.begin(), ret.module_name.end());
-        SymLoadModule64(process, 0, &img[0], &mod[0], (DWORD64)ret.base_address, ret.load_size);
-        return ret;
+namespace SR_UTILS_NS {
+    /// DbgHelp однопоточный, символы модулей загружаются один раз при первой символизации
+    static std::mutex g_symbolsMutex;
+    static bool g_symbolsInitialized = false;
+
+    SR_NOINLINE uint32_t CaptureStacktrace(void** pFrames, uint32_t maxFrames, uint32_t skip) {
+        return CaptureStackBackTrace(static_cast<DWORD>(skip + 1), static_cast<DWORD>(maxFrames), pFrames, nullptr);
     }
-};
 
-std::string builder;
-
-#ifdef SR_MSVC
-DWORD getStack(EXCEPTION_POINTERS* ep) {
-    HANDLE process = GetCurrentProcess();
-    HANDLE hThread = GetCurrentThread();
-    int frame_number=0;
-    DWORD offset_from_symbol=0;
-    IMAGEHLP_LINE64 line = {0};
-    std::vector<module_data> modules;
-    DWORD cbNeeded;
-    std::vector<HMODULE> module_handles(1);
-
-    // Load the symbols:
-    // WARNING: You'll need to replace <pdb-search-path> with either NULL
-    // or some folder where your clients will be able to find the .pdb file.
-    if (!SymInitialize(process,NULL, false))
-        throw (std::logic_error("Unable to initialize symbol handler"));
-    DWORD symOptions = SymGetOptions();
-    symOptions |= SYMOPT_LOAD_LINES | SYMOPT_UNDNAME;
-    SymSetOptions(symOptions);
-    EnumProcessModules(process, &module_handles[0], module_handles.size() * sizeof(HMODULE), &cbNeeded);
-    module_handles.resize(cbNeeded/sizeof(HMODULE));
-    EnumProcessModules(process, &module_handles[0], module_handles.size() * sizeof(HMODULE), &cbNeeded);
-    std::transform(module_handles.begin(), module_handles.end(), std::back_inserter(modules), get_mod_info(process));
-    void *base = modules[0].base_address;
-
-    // Setup stuff:
-    CONTEXT* context = ep->ContextRecord;
-#ifdef _M_X64
-    STACKFRAME64 frame;
-    frame.AddrPC.Offset = context->Rip;
-    frame.AddrPC.Mode = AddrModeFlat;
-    frame.AddrStack.Offset = context->Rsp;
-    frame.AddrStack.Mode = AddrModeFlat;
-    frame.AddrFrame.Offset = context->Rbp;
-    frame.AddrFrame.Mode = AddrModeFlat;
-#else
-    STACKFRAME64 frame;
-        frame.AddrPC.Offset = context->Eip;
-        frame.AddrPC.Mode = AddrModeFlat;
-        frame.AddrStack.Offset = context->Esp;
-        frame.AddrStack.Mode = AddrModeFlat;
-        frame.AddrFrame.Offset = context->Ebp;
-        frame.AddrFrame.Mode = AddrModeFlat;
-#endif
-    line.SizeOfStruct = sizeof line;
-    IMAGE_NT_HEADERS *h = ImageNtHeader(base);
-    DWORD image_type = h->FileHeader.Machine;
-    int n = 0;
-
-    // Build the string:
-    do {
-        if ( frame.AddrPC.Offset != 0 ) {
-            std::string fnName = symbol(process, frame.AddrPC.Offset).undecorated_name();
-            builder += fnName;
-            if (SymGetLineFromAddr64( process, frame.AddrPC.Offset, &offset_from_symbol, &line)) {
-                //builder << "  " /*<< line.FileName*/ << "(" << line.LineNumber << ")\n";
-                builder += " (" + std::to_string(line.LineNumber) + ")\n";
-            }
-            else {
-                builder += "\n";
-            }
+    std::string SymbolizeStacktrace(void* const* pFrames, uint32_t count) {
+        std::lock_guard lock(g_symbolsMutex);
+
+        HANDLE process = GetCurrentProcess();
 
-            if (fnName == "main")
-                break;
-            if (fnName == "RaiseException") {
-                // This is what we get when compiled in Release mode:
-                return EXCEPTION_EXECUTE_HANDLER;
+        if (!g_symbolsInitialized) {
+            SymSetOptions(SymGetOptions() | SYMOPT_LOAD_LINES | SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS);
+            if (!SymInitialize(process, NULL, TRUE)) {
+                return "Unable to initialize symbol handler";
             }
+            g_symbolsInitialized = true;
         }
-        else {
-            builder += "(No Symbols: PC == 0)";
-        }
-
-        if (!StackWalk64(image_type, process, hThread, &frame, context, NULL,
-                         SymFunctionTableAccess64, SymGetModuleBase64, NULL))
-            break;
-        if (++n > 10)
-            break;
-    } while (frame.AddrReturn.Offset != 0);
 
-    SymCleanup(process);
+        std::string builder;
 
-    return EXCEPTION_EXECUTE_HANDLER;
-}
-#endif
-
-void GetStacktraceImpl() {
-#ifdef SR_MSVC
-    __try {
-            int f = 0;
-            f = 7 / f;   // Trigger a divide-by-zero exception
-    } __except(getStack(GetExceptionInformation())) { }
-#endif
-}
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto address = reinterpret_cast<DWORD64>(pFrames[i]);
 
-namespace SR_UTILS_NS {
-    static bool g_stackStraceEnabled = true;
-    static std::mutex g_stackTraceMutex;
-
-    void DisableStacktrace() {
-        g_stackStraceEnabled = false;
-    }
+            builder += symbol(process, address).undecorated_name();
 
-    std::string GetStacktrace() {
-        std::lock_guard lock(g_stackTraceMutex);
+            IMAGEHLP_LINE64 line = { 0 };
+            line.SizeOfStruct = sizeof(line);
+            DWORD offsetFromSymbol = 0;
 
-        if (!g_stackStraceEnabled) {
-            return std::string();
+            if (SymGetLineFromAddr64(process, address, &offsetFromSymbol, &line)) {
+                builder += " (" + std::to_string(line.LineNumber) + ")\n";
+            }
+            else {
+                builder += "\n";
+            }
         }
-        builder.clear();
-        GetStacktraceImpl();
+
         return builder;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,208 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Profile/MemoryTracker.h>
+#include <Utils/Profile/Metrics.h>
+
+namespace SR_UTILS_NS {
+    namespace {
+        constexpr uint32_t MEMORY_TAGS_COUNT = static_cast<uint32_t>(MemoryTag::MemoryTagMAX);
+
+        struct alignas(64) MemoryTagCounters {
+            std::atomic<int64_t> liveBytes = 0;
+            std::atomic<int64_t> peakBytes = 0;
+            std::atomic<uint64_t> allocations = 0;
+            std::atomic<uint64_t> frees = 0;
+            std::atomic<uint64_t> allocatedBytes = 0;
+        };
+
+        /// константная инициализация, до любого динамического конструктора
+        MemoryTagCounters g_memoryCounters[MEMORY_TAGS_COUNT];
+
+        constexpr std::string_view MEMORY_TAG_NAMES[MEMORY_TAGS_COUNT] = {
+            "Common", "Strings", "Resources", "ECS", "Components",
+            "Scene", "SceneObjects", "SRLM", "Serialization", "Network"
+        };
+
+        /// первый Dump считает темп от загрузки модуля
+        const auto g_memoryTrackingStart = std::chrono::steady_clock::now();
+
+        SR_MAYBE_UNUSED void TrackAllocation(size_t size, MemoryTag tag) noexcept {
+            auto&& counters = g_memoryCounters[static_cast<uint32_t>(tag)];
+
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            counters.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+            const int64_t live = counters.liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+
+            int64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+            while (live > peak && !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) { }
+        }
+
+        SR_MAYBE_UNUSED void TrackFree(size_t size, MemoryTag tag) noexcept {
+            auto&& counters = g_memoryCounters[static_cast<uint32_t>(tag)];
+
+            counters.frees.fetch_add(1, std::memory_order_relaxed);
+            counters.liveBytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+        }
+    }
+
+    void* MemoryTracker::Allocate(size_t size, MemoryTag tag) {
+        void* pMemory = ::operator new(size);
+    #ifdef SR_MEMORY_TRACKING_ENABLE
+        TrackAllocation(size, tag);
+    #endif
+        return pMemory;
+    }
+
+    void* MemoryTracker::Allocate(size_t size, MemoryTag tag, std::align_val_t alignment) {
+        void* pMemory = ::operator new(size, alignment);
+    #ifdef SR_MEMORY_TRACKING_ENABLE
+        TrackAllocation(size, tag);
+    #endif
+        return pMemory;
+    }
+
+    void MemoryTracker::Free(void* pMemory, size_t size, MemoryTag tag) noexcept {
+        if (!pMemory) {
+            return;
+        }
+    #ifdef SR_MEMORY_TRACKING_ENABLE
+        TrackFree(size, tag);
+    #endif
+        ::operator delete(pMemory, size);
+    }
+
+    void MemoryTracker::Free(void* pMemory, size_t size, MemoryTag tag, std::align_val_t alignment) noexcept {
+        if (!pMemory) {
+            return;
+        }
+    #ifdef SR_MEMORY_TRACKING_ENABLE
+        TrackFree(size, tag);
+    #endif
+        ::operator delete(pMemory, size, alignment);
+    }
+
+    std::string_view MemoryTracker::GetTagName(MemoryTag tag) noexcept {
+        if (tag >= MemoryTag::MemoryTagMAX) {
+            return "Unknown";
+        }
+
+        return MEMORY_TAG_NAMES[static_cast<uint32_t>(tag)];
+    }
+
+    MemoryTagStats MemoryTracker::GetStats(MemoryTag tag) noexcept {
+        MemoryTagStats stats;
+        stats.tag = tag;
+
+        if (tag >= MemoryTag::MemoryTagMAX) {
+            return stats;
+        }
+
+        auto&& counters = g_memoryCounters[static_cast<uint32_t>(tag)];
+
+        stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+        stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+        stats.frees = counters.frees.load(std::memory_order_relaxed);
+        stats.allocatedBytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+
+        return stats;
+    }
+
+    std::vector<MemoryTagStats> MemoryTracker::GetStats() {
+        std::vector<MemoryTagStats> stats;
+        stats.reserve(MEMORY_TAGS_COUNT);
+
+        for (uint32_t i = 0; i < MEMORY_TAGS_COUNT; ++i) {
+            stats.emplace_back(GetStats(static_cast<MemoryTag>(i)));
+        }
+
+        return stats;
+    }
+
+    std::string MemoryTracker::Dump() {
+        using Clock = std::chrono::steady_clock;
+
+        static std::mutex mutex;
+        static Clock::time_point previousTime = g_memoryTrackingStart;
+        static uint64_t previousAllocations[MEMORY_TAGS_COUNT] = { };
+        static uint64_t previousBytes[MEMORY_TAGS_COUNT] = { };
+
+        std::lock_guard lock(mutex);
+
+        const auto now = Clock::now();
+        const double_t seconds = std::max(std::chrono::duration<double_t>(now - previousTime).count(), 1e-9);
+        previousTime = now;
+
+        std::string dump;
+
+    #ifndef SR_MEMORY_TRACKING_ENABLE
+        dump += "memory tracking is disabled (SR_MEMORY_TRACKING_ENABLE)\n";
+    #endif
+
+        for (auto&& stats : GetStats()) {
+            const auto index = static_cast<uint32_t>(stats.tag);
+
+            const double_t allocationsRate = static_cast<double_t>(stats.allocations - previousAllocations[index]) / seconds;
+            const double_t bytesRate = static_cast<double_t>(stats.allocatedBytes - previousBytes[index]) / seconds;
+
+            previousAllocations[index] = stats.allocations;
+            previousBytes[index] = stats.allocatedBytes;
+
+            dump += SR_FORMAT("{} live={} peak={} allocations={} frees={} rate={:.1f}/s {:.1f}B/s\n",
+                GetTagName(stats.tag), stats.liveBytes, stats.peakBytes, stats.allocations, stats.frees,
+                allocationsRate, bytesRate
+            );
+        }
+
+        return dump;
+    }
+
+    bool MemoryTracker::ReportLeaks() {
+    #ifdef SR_MEMORY_TRACKING_ENABLE
+        bool hasLeaks = false;
+
+        for (auto&& stats : GetStats()) {
+            /// таблица StringAtom живет до конца процесса и никогда не освобождается
+            if (stats.tag == MemoryTag::Strings) {
+                continue;
+            }
+
+            if (stats.liveBytes == 0 && stats.allocations == stats.frees) {
+                continue;
+            }
+
+            /// логгер к этому моменту уже может быть уничтожен
+            std::cerr << "MemoryTracker::ReportLeaks() : tag \"" << GetTagName(stats.tag) << "\" has "
+                << stats.liveBytes << " bytes in " << (stats.allocations - stats.frees) << " allocations not freed\n";
+
+            hasLeaks = true;
+        }
+
+        return !hasLeaks;
+    #else
+        return true;
+    #endif
+    }
+
+    void MemoryTracker::RegisterMetrics(Metrics& metrics) {
+        for (uint32_t i = 0; i < MEMORY_TAGS_COUNT; ++i) {
+            const auto tag = static_cast<MemoryTag>(i);
+            const std::string prefix = SR_FORMAT("memory.{}.", GetTagName(tag));
+
+            metrics.RegisterSampler(prefix + "live_bytes", [tag]() -> int64_t {
+                return GetStats(tag).liveBytes;
+            });
+
+            metrics.RegisterSampler(prefix + "peak_bytes", [tag]() -> int64_t {
+                return GetStats(tag).peakBytes;
+            });
+
+            metrics.RegisterSampler(prefix + "allocations", [tag]() -> int64_t {
+                return static_cast<int64_t>(GetStats(tag).allocations);
+            });
+        }
+    }
+}
@@ -0,0 +1,240 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Profile/Metrics.h>
+#include <Utils/Profile/MemoryTracker.h>
+#include <Utils/Common/HashManager.h>
+
+namespace SR_UTILS_NS {
+    namespace MetricsDetail {
+        uint32_t AcquireThreadSlot() noexcept {
+            static std::atomic<uint32_t> nextSlot = 0;
+            return nextSlot.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t MetricCounter::Get() const noexcept {
+        uint64_t sum = 0;
+
+        for (auto&& shard : m_shards) {
+            sum += shard.value.load(std::memory_order_relaxed);
+        }
+
+        return sum;
+    }
+
+    void MetricCounter::Reset() noexcept {
+        for (auto&& shard : m_shards) {
+            shard.value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    MetricHistogram::MetricHistogram()
+        : m_buckets(new std::atomic<uint64_t>[BUCKETS_COUNT])
+    {
+        for (uint32_t i = 0; i < BUCKETS_COUNT; ++i) {
+            m_buckets[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t MetricHistogram::GetMin() const noexcept {
+        const uint64_t min = m_min.load(std::memory_order_relaxed);
+        return min == UINT64_MAX ? 0 : min;
+    }
+
+    uint64_t MetricHistogram::GetPercentile(double_t percentile) const noexcept {
+        /// корзины читаются без снимка, при одновременной записи сумма может не совпасть с m_count
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < BUCKETS_COUNT; ++i) {
+            total += m_buckets[i].load(std::memory_order_relaxed);
+        }
+
+        if (total == 0) {
+            return 0;
+        }
+
+        percentile = std::clamp(percentile, 0.0, 100.0);
+        const auto target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double_t>(total))));
+
+        uint64_t accumulated = 0;
+        for (uint32_t i = 0; i < BUCKETS_COUNT; ++i) {
+            accumulated += m_buckets[i].load(std::memory_order_relaxed);
+            if (accumulated >= target) {
+                /// точнее границы корзины может быть только реальный максимум
+                return std::min(GetBucketUpperBound(i), GetMax());
+            }
+        }
+
+        return GetMax();
+    }
+
+    void MetricHistogram::Reset() noexcept {
+        for (uint32_t i = 0; i < BUCKETS_COUNT; ++i) {
+            m_buckets[i].store(0, std::memory_order_relaxed);
+        }
+
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_min.store(UINT64_MAX, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t MetricHistogram::GetBucketLowerBound(uint32_t index) noexcept {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+
+        const uint32_t shift = index / SUB_BUCKETS - 1;
+        const uint64_t subBucket = index % SUB_BUCKETS;
+
+        return (SUB_BUCKETS + subBucket) << shift;
+    }
+
+    uint64_t MetricHistogram::GetBucketUpperBound(uint32_t index) noexcept {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+
+        const uint32_t shift = index / SUB_BUCKETS - 1;
+
+        return GetBucketLowerBound(index) + ((1ULL << shift) - 1);
+    }
+
+    void Metrics::InitSingleton() {
+        RegisterSampler("strings.atoms", []() -> int64_t {
+            return static_cast<int64_t>(HashManager::Instance().GetCount());
+        });
+
+        MemoryTracker::RegisterMetrics(*this);
+
+        Singleton::InitSingleton();
+    }
+
+    MetricCounter& Metrics::GetCounter(std::string_view name) {
+        SR_SCOPED_LOCK;
+
+        if (auto&& pIt = m_counters.find(name); pIt != m_counters.end()) {
+            return *pIt->second;
+        }
+
+        return *m_counters.emplace(std::string(name), std::make_unique<MetricCounter>()).first->second;
+    }
+
+    MetricGauge& Metrics::GetGauge(std::string_view name) {
+        SR_SCOPED_LOCK;
+
+        if (auto&& pIt = m_gauges.find(name); pIt != m_gauges.end()) {
+            return *pIt->second;
+        }
+
+        return *m_gauges.emplace(std::string(name), std::make_unique<MetricGauge>()).first->second;
+    }
+
+    MetricHistogram& Metrics::GetHistogram(std::string_view name) {
+        SR_SCOPED_LOCK;
+
+        if (auto&& pIt = m_histograms.find(name); pIt != m_histograms.end()) {
+            return *pIt->second;
+        }
+
+        return *m_histograms.emplace(std::string(name), std::make_unique<MetricHistogram>()).first->second;
+    }
+
+    void Metrics::RegisterSampler(std::string_view name, Sampler&& sampler) {
+        SR_SCOPED_LOCK;
+
+        if (!sampler) {
+            SR_ERROR("Metrics::RegisterSampler() : sampler \"{}\" is empty!", name);
+            return;
+        }
+
+        m_samplers[std::string(name)] = std::move(sampler);
+    }
+
+    std::vector<MetricSnapshot> Metrics::Snapshot() const {
+        SR_SCOPED_LOCK;
+
+        std::vector<MetricSnapshot> snapshot;
+        snapshot.reserve(m_counters.size() + m_gauges.size() + m_histograms.size() + m_samplers.size());
+
+        for (auto&& [name, pCounter] : m_counters) {
+            auto&& metric = snapshot.emplace_back();
+            metric.name = name;
+            metric.type = MetricType::Counter;
+            metric.value = static_cast<int64_t>(pCounter->Get());
+        }
+
+        for (auto&& [name, pGauge] : m_gauges) {
+            auto&& metric = snapshot.emplace_back();
+            metric.name = name;
+            metric.type = MetricType::Gauge;
+            metric.value = pGauge->Get();
+        }
+
+        for (auto&& [name, sampler] : m_samplers) {
+            auto&& metric = snapshot.emplace_back();
+            metric.name = name;
+            metric.type = MetricType::Gauge;
+            metric.value = sampler();
+        }
+
+        for (auto&& [name, pHistogram] : m_histograms) {
+            auto&& metric = snapshot.emplace_back();
+            metric.name = name;
+            metric.type = MetricType::Histogram;
+            metric.count = pHistogram->GetCount();
+            metric.sum = pHistogram->GetSum();
+            metric.min = pHistogram->GetMin();
+            metric.max = pHistogram->GetMax();
+            metric.p50 = pHistogram->GetPercentile(50.0);
+            metric.p90 = pHistogram->GetPercentile(90.0);
+            metric.p99 = pHistogram->GetPercentile(99.0);
+            metric.p999 = pHistogram->GetPercentile(99.9);
+        }
+
+        std::sort(snapshot.begin(), snapshot.end(), [](const MetricSnapshot& left, const MetricSnapshot& right) {
+            return left.name < right.name;
+        });
+
+        return snapshot;
+    }
+
+    std::string Metrics::Dump() const {
+        std::string dump;
+
+        for (auto&& metric : Snapshot()) {
+            switch (metric.type) {
+                case MetricType::Counter:
+                    dump += SR_FORMAT("{} counter {}\n", metric.name, metric.value);
+                    break;
+                case MetricType::Gauge:
+                    dump += SR_FORMAT("{} gauge {}\n", metric.name, metric.value);
+                    break;
+                case MetricType::Histogram:
+                    dump += SR_FORMAT("{} histogram count={} sum={} min={} max={} p50={} p90={} p99={} p999={}\n",
+                        metric.name, metric.count, metric.sum, metric.min, metric.max,
+                        metric.p50, metric.p90, metric.p99, metric.p999
+                    );
+                    break;
+                default:
+                    SRHalt("Metrics::Dump() : unknown metric type!");
+                    break;
+            }
+        }
+
+        return dump;
+    }
+
+    void Metrics::Reset() {
+        SR_SCOPED_LOCK;
+
+        for (auto&& [name, pCounter] : m_counters) {
+            pCounter->Reset();
+        }
+
+        for (auto&& [name, pHistogram] : m_histograms) {
+            pHistogram->Reset();
+        }
+    }
+}
@@ -51,6 +51,8 @@ namespace SR_UTILS_NS {
             auto &&hash = m_path.GetFileHash();
             m_lastWriteTime = writeTime;
             if (m_hash != hash) {
+                /// файл мог быть удален или пересоздан
+                m_path.InvalidateMetadata();
                 m_isDirty = true;
                 m_hash = hash;
                 return true;
@@ -65,6 +67,7 @@ namespace SR_UTILS_NS {
             if (m_lastWriteTime == 0) {
                 auto &&hash = m_path.GetFileHash();
                 if (m_hash != hash) {
+                    m_path.InvalidateMetadata();
                     m_isDirty = true;
                     m_hash = hash;
                     return true;
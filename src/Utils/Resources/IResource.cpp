@@ -5,6 +5,7 @@
 #include <Utils/Resources/IResource.h>
 #include <Utils/Resources/ResourceManager.h>
 #include <Utils/Resources/FileWatcher.h>
+#include <Utils/Profile/Metrics.h>
 
 namespace SR_UTILS_NS {
     IResource::IResource(uint64_t hashName)
@@ -31,7 +32,15 @@ namespace SR_UTILS_NS {
 
         Unload();
 
-        if (!Load()) {
+        bool loaded = false;
+
+        {
+            SR_METRIC_SCOPED_TIMER("resources.load_ns");
+            loaded = Load();
+        }
+
+        if (!loaded) {
+            SR_METRIC_COUNTER_ADD("resources.load_errors", 1);
             m_loadState = LoadState::Error;
             return false;
         }
@@ -141,7 +150,7 @@ namespace SR_UTILS_NS {
 
             /// TODO: получение синглтона дорогая операция, нужно оптимизировать
             if (SR_UTILS_NS::ResourceManager::Instance().IsUsePointStackTraceProfilingEnabled()) {
-                m_debugUnUseStackTraces.emplace_back(SR_UTILS_NS::GetStacktrace());
+                m_debugUnUseStackTraces.emplace_back(SR_UTILS_NS::CaptureStacktraceId());
             }
         });
 
@@ -161,7 +170,7 @@ namespace SR_UTILS_NS {
 
         /// TODO: получение синглтона дорогая операция, нужно оптимизировать
         if (SR_UTILS_NS::ResourceManager::Instance().IsUsePointStackTraceProfilingEnabled()) {
-            m_debugUseStackTraces.emplace_back(SR_UTILS_NS::GetStacktrace());
+            m_debugUseStackTraces.emplace_back(SR_UTILS_NS::CaptureStacktraceId());
         }
     }
 
@@ -169,6 +178,35 @@ namespace SR_UTILS_NS {
         return m_countUses;
     }
 
+    std::string IResource::GetUsePointsReport() const {
+        SR_TRACY_ZONE;
+
+        const auto appendGroup = [](std::string& report, const char* title, const std::vector<StacktraceId>& stacktraces) {
+            std::unordered_map<StacktraceId, uint32_t> counts;
+            std::vector<StacktraceId> order;
+
+            for (auto&& id : stacktraces) {
+                if (counts[id]++ == 0) {
+                    order.emplace_back(id);
+                }
+            }
+
+            report.append(SR_FORMAT("{}: {} calls, {} unique stacks\n", title, stacktraces.size(), order.size()));
+
+            for (auto&& id : order) {
+                report.append(SR_FORMAT("--- x{} ---\n", counts[id]));
+                report.append(SR_UTILS_NS::ResolveStacktrace(id));
+                report.append("\n");
+            }
+        };
+
+        std::string report = SR_FORMAT("Resource \"{}\" use points: {}\n", GetResourcePath().ToStringRef(), GetCountUses());
+        appendGroup(report, "AddUsePoint", m_debugUseStackTraces);
+        appendGroup(report, "RemoveUsePoint", m_debugUnUseStackTraces);
+
+        return report;
+    }
+
     IResource* IResource::CopyResource(IResource* pDestination) const {
         pDestination->m_resourcePath = m_resourcePath;
         pDestination->m_loadState.store(m_loadState);
@@ -3,8 +3,168 @@
 //
 
 #include <Utils/Resources/ResourceEmbedder.h>
+#include <Utils/Profile/TracyContext.h>
+
+#ifdef SR_COMMON_ZLIB
+    #include <zlib/zlib.h>
+#endif
 
 namespace SR_UTILS_NS {
+    bool ResourceEmbedder::RegisterPack(const char* pData, uint64_t size) {
+        SR_TRACY_ZONE;
+
+        std::lock_guard lock(m_mutex);
+
+        if (m_pack) {
+            SR_ERROR("ResourceEmbedder::RegisterPack() : pack is already registered!");
+            return false;
+        }
+
+        if (!pData || size < sizeof(PackHeader)) {
+            SR_ERROR("ResourceEmbedder::RegisterPack() : pack is empty!");
+            return false;
+        }
+
+        PackHeader header = { };
+        memcpy(&header, pData, sizeof(PackHeader));
+
+        if (header.magic != PACK_MAGIC || header.version != PACK_VERSION) {
+            SR_ERROR("ResourceEmbedder::RegisterPack() : incompatible pack! Magic: {}, version: {}", header.magic, header.version);
+            return false;
+        }
+
+        if (sizeof(PackHeader) + static_cast<uint64_t>(header.count) * sizeof(PackEntry) > size) {
+            SR_ERROR("ResourceEmbedder::RegisterPack() : pack index is truncated!");
+            return false;
+        }
+
+        m_pack = pData;
+        m_packSize = size;
+        m_count = header.count;
+        m_entries = reinterpret_cast<const PackEntry*>(pData + sizeof(PackHeader));
+
+        return true;
+    }
+
+    const ResourceEmbedder::PackEntry* ResourceEmbedder::FindEntry(std::string_view path) const {
+        if (!m_entries) {
+            return nullptr;
+        }
+
+        const uint64_t hash = SR_HASH_STR_VIEW(path);
+
+        const PackEntry* pEnd = m_entries + m_count;
+        const PackEntry* pEntry = std::lower_bound(m_entries, pEnd, hash, [](const PackEntry& entry, uint64_t value) {
+            return entry.pathHash < value;
+        });
+
+        /// при совпадении хешей сверяем сами пути
+        for (; pEntry != pEnd && pEntry->pathHash == hash; ++pEntry) {
+            if (GetEntryPath(*pEntry) == path) {
+                return pEntry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::string_view ResourceEmbedder::GetEntryPath(const PackEntry& entry) const {
+        if (static_cast<uint64_t>(entry.pathOffset) + entry.pathSize > m_packSize) {
+            return std::string_view();
+        }
+        return std::string_view(m_pack + entry.pathOffset, entry.pathSize);
+    }
+
+    bool ResourceEmbedder::Contains(const SR_UTILS_NS::Path& path) const {
+        return FindEntry(path.ToStringView()) != nullptr;
+    }
+
+    std::vector<std::string_view> ResourceEmbedder::GetPaths() const {
+        std::vector<std::string_view> paths;
+        paths.reserve(m_count);
+
+        for (uint32_t i = 0; i < m_count; ++i) {
+            paths.emplace_back(GetEntryPath(m_entries[i]));
+        }
+
+        return paths;
+    }
+
+    bool ResourceEmbedder::Unpack(const PackEntry& entry, char* pDestination) const {
+        if (entry.dataOffset + entry.packedSize > m_packSize) {
+            SR_ERROR("ResourceEmbedder::Unpack() : resource data is out of pack bounds!");
+            return false;
+        }
+
+        const char* pSource = m_pack + entry.dataOffset;
+
+        switch (entry.compression) {
+            case PackCompression::None:
+                memcpy(pDestination, pSource, entry.size);
+                return true;
+            case PackCompression::Zlib: {
+            #ifdef SR_COMMON_ZLIB
+                auto destinationSize = static_cast<uLongf>(entry.size);
+                const int result = uncompress(
+                    reinterpret_cast<Bytef*>(pDestination), &destinationSize,
+                    reinterpret_cast<const Bytef*>(pSource), static_cast<uLong>(entry.packedSize)
+                );
+
+                if (result != Z_OK || destinationSize != entry.size) {
+                    SR_ERROR("ResourceEmbedder::Unpack() : failed to decompress resource! Error: {}", result);
+                    return false;
+                }
+
+                return true;
+            #else
+                SR_ERROR("ResourceEmbedder::Unpack() : resource is compressed, but zlib is disabled!");
+                return false;
+            #endif
+            }
+            default:
+                SR_ERROR("ResourceEmbedder::Unpack() : unknown compression!");
+                return false;
+        }
+    }
+
+    SR_HTYPES_NS::Stream ResourceEmbedder::Open(const SR_UTILS_NS::Path& path) {
+        SR_TRACY_ZONE;
+
+        auto&& pEntry = FindEntry(path.ToStringView());
+        if (!pEntry) {
+            return SR_HTYPES_NS::Stream();
+        }
+
+        if (pEntry->compression == PackCompression::None) {
+            if (pEntry->dataOffset + pEntry->size > m_packSize) {
+                SR_ERROR("ResourceEmbedder::Open() : resource data is out of pack bounds!");
+                return SR_HTYPES_NS::Stream();
+            }
+            return SR_HTYPES_NS::Stream::View(m_pack + pEntry->dataOffset, pEntry->size);
+        }
+
+        std::lock_guard lock(m_mutex);
+
+        if (auto&& pIt = m_unpacked.find(pEntry->pathHash); pIt != m_unpacked.end()) {
+            return SR_HTYPES_NS::Stream::View(pIt->second.get(), pEntry->size);
+        }
+
+        auto&& pData = std::make_unique<char[]>(pEntry->size);
+        if (!Unpack(*pEntry, pData.get())) {
+            return SR_HTYPES_NS::Stream();
+        }
+
+        auto&& stream = SR_HTYPES_NS::Stream::View(pData.get(), pEntry->size);
+        m_unpacked[pEntry->pathHash] = std::move(pData);
+
+        return stream;
+    }
+
+    void ResourceEmbedder::ClearCache() {
+        std::lock_guard lock(m_mutex);
+        m_unpacked.clear();
+    }
+
     bool ResourceEmbedder::ExportAllResources() {
         return ExportAllResources(SR_UTILS_NS::Path());
     }
@@ -18,10 +178,13 @@ namespace SR_UTILS_NS {
             }
         }
 
-        for (auto&& it : m_resources) {
-            EmbedResourceStructure resource = {it.first.c_str(), it.second.second, it.second.first};
+        for (auto&& path : GetPaths()) {
+            auto&& stream = Open(SR_UTILS_NS::Path(path));
+            const std::string pathString(path);
 
-            if (!ExportToFile(resource, newDirectory)) {
+            EmbedResourceStructure resource = { pathString.c_str(), stream.View(), stream.Size() };
+
+            if (!stream.Valid() || !ExportToFile(resource, newDirectory)) {
                 result = false;
             }
         }
@@ -38,13 +201,6 @@ namespace SR_UTILS_NS {
             path = SR_UTILS_NS::Path(resource.path);
         }
 
-        auto&& dataSize = resource.size;
-        auto&& pData = resource.data;
-
-        std::string buffer;
-        buffer.resize(dataSize);
-        memcpy(buffer.data(), pData, dataSize);
-
         if (!path.Exists()) {
         #ifdef SR_LINUX
             /// It is needed because on Linux there are files without extensions.
@@ -67,7 +223,7 @@ namespace SR_UTILS_NS {
             return false;
         }
 
-        file.write(buffer.data(), buffer.size());
+        file.write(resource.data, static_cast<std::streamsize>(resource.size));
         file.close();
 
     #ifdef SR_LINUX
@@ -79,12 +235,12 @@ namespace SR_UTILS_NS {
     }
 
     bool ResourceEmbedder::ExportToFile(const SR_UTILS_NS::Path &path) {
-        auto&& it = m_resources.find(path.ToStringRef());
-        return ExportToFile({path.CStr(), it->second.second, it->second.first}, SR_UTILS_NS::Path());
-    }
+        auto&& stream = Open(path);
+        if (!stream.Valid()) {
+            SR_ERROR("ResourceEmbedder::ExportToFile() : resource '{}' is not embedded.", path.ToStringRef());
+            return false;
+        }
 
-    bool ResourceEmbedder::ExportToMemory(const EmbedResourceStructure &resource) {
-		SRHalt("Not yet implemented!");
-        return false;
+        return ExportToFile({ path.CStr(), stream.View(), stream.Size() }, SR_UTILS_NS::Path());
     }
-}
\ No newline at end of file
+}
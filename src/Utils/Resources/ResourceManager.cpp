@@ -10,6 +10,7 @@
 #include <Utils/Common/StringFormat.h>
 #include <Utils/Common/Hashes.h>
 #include <Utils/Common/StringUtils.h>
+#include <Utils/Profile/Metrics.h>
 
 namespace SR_UTILS_NS {
     std::optional<Path> GetResourceFolder(const Path& appFolder) {
@@ -247,6 +248,8 @@ namespace SR_UTILS_NS {
             return;
         }
 
+        SR_METRIC_COUNTER_ADD("resources.gc_passes", 1);
+
         if (m_force) {
             for (auto&& [hashName, group] : m_resources) {
                 group->CollectUnused();
@@ -289,6 +292,7 @@ namespace SR_UTILS_NS {
             }
 
             Remove(pResource);
+            SR_METRIC_COUNTER_ADD("resources.gc_freed", 1);
 
             {
                 /// так как некоторые ресурсы рекурсивно уничтожают дочерныие ресурсы при вызове деструктора, например материал,
@@ -301,6 +305,8 @@ namespace SR_UTILS_NS {
             }
         }
 
+        SR_METRIC_GAUGE_SET("resources.gc_pending", m_destroyed.size());
+
         if (Debug::Instance().GetLevel() >= Debug::Level::High && m_destroyed.empty()) {
             SR_LOG("ResourceManager::GC() : complete garbage collection.");
         }
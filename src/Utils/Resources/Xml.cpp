@@ -3,10 +3,11 @@
 //
 
 #include <Utils/Resources/Xml.h>
+#include <Utils/Types/MappedFile.h>
 
 namespace SR_UTILS_NS {
     std::string Xml::Attribute::ToString() const {
-        if (!CheckError(SR_FORMAT("Attribute::ToStringAtom() : attribute isn't valid! Name: {}", m_attribute.name()))) {
+        if (!CheckError("Attribute::ToStringAtom()")) {
             return std::string();
         }
         else
@@ -14,7 +15,7 @@ namespace SR_UTILS_NS {
     }
 
     int32_t Xml::Attribute::ToInt() const {
-        if (!CheckError(SR_FORMAT("Attribute::ToInt() : attribute isn't valid! Name: {}", m_attribute.name()))) {
+        if (!CheckError("Attribute::ToInt()")) {
             return 0;
         }
         else
@@ -22,7 +23,7 @@ namespace SR_UTILS_NS {
     }
 
     float_t Xml::Attribute::ToFloat() const {
-        if (!CheckError(SR_FORMAT("Attribute::ToFloat() : attribute isn't valid! Name: {}", m_attribute.name()))) {
+        if (!CheckError("Attribute::ToFloat()")) {
             return 0.f;
         }
         else
@@ -30,7 +31,7 @@ namespace SR_UTILS_NS {
     }
 
     double_t Xml::Attribute::ToDouble() const {
-        if (!CheckError(SR_FORMAT("Attribute::ToFloat() : attribute isn't valid! Name: {}", m_attribute.name()))) {
+        if (!CheckError("Attribute::ToFloat()")) {
             return 0.f;
         }
         else
@@ -38,13 +39,25 @@ namespace SR_UTILS_NS {
     }
 
     bool Xml::Attribute::ToBool() const {
-        if (!CheckError(SR_FORMAT("Attribute::ToBool() : attribute isn't valid! Name: {}", m_attribute.name()))) {
+        if (!CheckError("Attribute::ToBool()")) {
             return false;
         }
         else
             return m_attribute.as_bool();
     }
 
+    std::string_view Xml::Attribute::ToStringView() const {
+        if (!CheckError("Attribute::ToStringView()")) {
+            return std::string_view();
+        }
+
+        return m_attribute.as_string();
+    }
+
+    std::string_view Xml::Attribute::ToStringView(std::string_view def) const {
+        return m_valid ? std::string_view(m_attribute.as_string()) : def;
+    }
+
     std::string Xml::Attribute::ToString(const std::string &def) const {
         return m_valid ? m_attribute.as_string() : def;
     }
@@ -66,21 +79,21 @@ namespace SR_UTILS_NS {
     }
 
     int64_t Xml::Attribute::ToInt64() const {
-        if (!CheckError("Attribute::ToInt64() : attribute isn't valid!"))
+        if (!CheckError("Attribute::ToInt64()"))
             return 0;
         else
             return m_attribute.as_llong();
     }
 
     uint64_t Xml::Attribute::ToUInt64() const {
-        if (!CheckError("Attribute::ToInt64() : attribute isn't valid!"))
+        if (!CheckError("Attribute::ToInt64()"))
             return 0;
         else
             return m_attribute.as_ullong();
     }
 
     uint32_t Xml::Attribute::ToUInt() const {
-        if (!CheckError("Attribute::ToUInt() : attribute isn't valid!"))
+        if (!CheckError("Attribute::ToUInt()"))
             return 0;
         else
             return m_attribute.as_uint();
@@ -98,17 +111,18 @@ namespace SR_UTILS_NS {
         SR_TRACY_ZONE;
         SR_TRACY_TEXT_N("Path", path.ToStringRef());
 
-        auto&& fileData = SR_PLATFORM_NS::ReadFile(path);
-        auto xml = Document::New();
+        SR_HTYPES_NS::MappedFile file;
 
-        if (!fileData) {
+        if (!file.Open(path)) {
             SR_ERROR("Document::Load() : file not exists! \n\tPath: " + path.ToString());
             return Document(); /// NOLINT
         }
 
-        if (pugi::xml_parse_result result = xml.m_document->load_string(fileData->c_str())) {
+        auto xml = Document::New();
+
+        if (pugi::xml_parse_result result = xml.m_document->load_buffer(file.Data(), file.Size())) {
             xml.m_valid = true;
-            xml.m_path = std::move(path.ToString());
+            xml.m_path = path.ToString();
         }
         else {
             SR_ERROR("Document::Load() : failed to load xml! \n\tPath: " + path.ToString() + "\n\tDescription: " + std::string(result.description()));
@@ -119,6 +133,23 @@ namespace SR_UTILS_NS {
         return xml;
     }
 
+    Xml::Document Xml::Document::LoadInPlace(char* pData, uint64_t size) {
+        SR_TRACY_ZONE;
+
+        auto xml = Document::New();
+
+        if (pugi::xml_parse_result result = xml.m_document->load_buffer_inplace(pData, size)) {
+            xml.m_valid = true;
+        }
+        else {
+            SR_ERROR("Document::LoadInPlace() : failed to load xml! \n\tDescription: " + std::string(result.description()));
+            Xml::g_xml_last_error = -3;
+            xml.m_valid = false;
+        }
+
+        return xml;
+    }
+
     std::string Xml::Document::Dump() const {
         if (!Valid())
             return std::string();
@@ -158,8 +189,8 @@ namespace SR_UTILS_NS {
         }
 
         auto&& nodes = std::vector<Node>();
-        for (const auto child : m_node.children())
-            nodes.emplace_back(Node(child));
+        for (auto&& child : Children())
+            nodes.emplace_back(child);
 
         return nodes;
     }
@@ -187,9 +218,8 @@ namespace SR_UTILS_NS {
         }
 
         auto nodes = std::vector<Node>();
-        for (const auto child : m_node.children())
-            if (std::string(child.name()) == name)
-                nodes.emplace_back(Node(child));
+        for (auto&& child : Children(name.c_str()))
+            nodes.emplace_back(child);
 
         return nodes;
     }
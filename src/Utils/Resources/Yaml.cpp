@@ -4,6 +4,7 @@
 
 #include <Utils/Resources/Yaml.h>
 #include <Utils/FileSystem/Path.h>
+#include <Utils/Types/MappedFile.h>
 
 namespace SR_UTILS_NS::Yaml {
     Node::Node()
@@ -22,7 +23,7 @@ namespace SR_UTILS_NS::Yaml {
             return { };
         }
 
-        return m_node.key().str;
+        return { m_node.key().str, m_node.key().len };
     }
 
     std::string Node::GetValue() const {
@@ -43,27 +44,54 @@ namespace SR_UTILS_NS::Yaml {
         return { m_node.key().begin(), m_node.key().end() };
     }
 
+    std::string_view Node::GetValueView() const {
+        if (!m_isValid) {
+            SRHalt("Node::GetValueView() : node is not valid!");
+            return { };
+        }
+
+        return { m_node.val().str, m_node.val().len };
+    }
+
+    std::string_view Node::GetKeyView() const {
+        if (!m_isValid) {
+            SRHalt("Node::GetKeyView() : node is not valid!");
+            return { };
+        }
+
+        return { m_node.key().str, m_node.key().len };
+    }
+
     std::vector<Node> Node::GetChildren() const {
+        if (!m_isValid) {
+            return { };
+        }
+
         std::vector<Node> children;
-        children.resize(m_node.num_children());
+        children.reserve(m_node.num_children());
 
-        for (auto&& child : m_node.children()) {
+        for (auto&& child : Children()) {
             children.emplace_back(child);
         }
 
         return children;
     }
 
-    SR_NODISCARD Node Node::GetChild(const std::string& name) const {
+    NodeRange Node::Children() const {
         if (!m_isValid) {
             return { };
         }
 
-        if (!m_node.has_child(name.c_str())) {
+        return NodeRange(m_node.tree(), m_node.tree()->first_child(m_node.id()));
+    }
+
+    SR_NODISCARD Node Node::GetChild(std::string_view name) const {
+        if (!m_isValid || !m_node.is_map()) {
             return { };
         }
 
-        auto&& child = m_node.find_child(name.c_str());
+        /// один проход по детям вместо has_child + find_child
+        auto&& child = m_node.find_child(ryml::csubstr(name.data(), name.size()));
         if (!child.valid()) {
             return { };
         }
@@ -77,7 +105,7 @@ namespace SR_UTILS_NS::Yaml {
             return {};
         }
 
-        return m_node.key().str;
+        return { m_node.key().str, m_node.key().len };
     }
 
     Document::Document() {
@@ -118,24 +146,45 @@ namespace SR_UTILS_NS::Yaml {
         SR_TRACY_ZONE;
         SR_TRACY_TEXT_N("Path", path.ToStringRef());
 
-        auto&& contents = FileSystem::ReadAllText(path.ToStringRef());
-        Document yaml = Document::New();
+        SR_HTYPES_NS::MappedFile file;
 
-        if (contents.empty()) {
+        if (!file.Open(path) || file.Size() == 0) {
             SR_ERROR("Document::Load() : failed to read YAML contents! \n\tPath: " + path.ToString());
             return { };
         }
 
-        ryml::Tree tree = ryml::parse_in_arena(ryml::to_csubstr(contents));
-        if (tree.empty()) {
-            SR_ERROR("ThreadsWorker::Load() : failed to parse file \"{}\"", path.ToStringRef());
-            yaml.m_isValid = false;
+        Document yaml = Document::New();
+
+        /// разбор сразу в дерево документа, без промежуточной строки и копии дерева
+        yaml.m_tree.reserve_arena(file.Size());
+        ryml::parse_in_arena(ryml::csubstr(file.Data(), file.Size()), &yaml.m_tree);
+
+        if (yaml.m_tree.empty()) {
+            SR_ERROR("Document::Load() : failed to parse file \"{}\"", path.ToStringRef());
             return { };
         }
 
-        yaml.m_isValid = true;
-        yaml.m_tree = tree;
-        yaml.m_path = std::move(path.ToString());
+        yaml.m_path = path.ToString();
+
+        return yaml;
+    }
+
+    Document Document::LoadInPlace(char* pData, uint64_t size) {
+        SR_TRACY_ZONE;
+
+        if (!pData || size == 0) {
+            SR_ERROR("Document::LoadInPlace() : buffer is empty!");
+            return { };
+        }
+
+        Document yaml = Document::New();
+
+        ryml::parse_in_place(ryml::substr(pData, size), &yaml.m_tree);
+
+        if (yaml.m_tree.empty()) {
+            SR_ERROR("Document::LoadInPlace() : failed to parse buffer!");
+            return { };
+        }
 
         return yaml;
     }
@@ -1,4 +1,5 @@
 #include <Utils/TaskManager/TaskManager.h>
+#include <Utils/Profile/Metrics.h>
 
 namespace SR_UTILS_NS {
     Task::Task(TaskFn fn, bool createThread)
@@ -147,11 +148,14 @@ namespace SR_UTILS_NS {
                         m_results.insert(std::make_pair(pIt->GetId(), pIt->GetResult()));
                         m_ids.erase(pIt->GetId());
                         pIt = m_tasks.erase(pIt);
+                        SR_METRIC_COUNTER_ADD("tasks.completed", 1);
                     }
                     else {
                         ++pIt;
                     }
                 }
+
+                SR_METRIC_GAUGE_SET("tasks.queue_depth", m_tasks.size());
             }
         });
 
@@ -171,6 +175,9 @@ namespace SR_UTILS_NS {
         m_ids.insert(uniqueId);
         m_tasks.emplace_back(std::move(task));
 
+        SR_METRIC_COUNTER_ADD("tasks.submitted", 1);
+        SR_METRIC_GAUGE_SET("tasks.queue_depth", m_tasks.size());
+
         return uniqueId;
     }
 
@@ -106,12 +106,20 @@ namespace SR_UTILS_NS {
         m_states.emplace_back(std::move(pState));
     }
 
-    void ThreadWorker::Start() {
+    void ThreadWorker::Start(const std::vector<uint32_t>& cpus) {
         SRAssert(!m_isActive);
         m_isActive = true;
 
         SR_HTYPES_NS::Thread::Factory::Instance().Create(m_thread, &ThreadWorker::Work, this);
         m_thread->SetName(m_name);
+
+        if (m_priority.has_value() && !m_thread->SetPriority(m_priority.value())) {
+            SR_WARN("ThreadWorker::Start() : failed to set priority for thread \"{}\"", m_name);
+        }
+
+        if (!cpus.empty() && !m_thread->SetAffinity(cpus)) {
+            SR_WARN("ThreadWorker::Start() : failed to set affinity for thread \"{}\"", m_name);
+        }
     }
 
     void ThreadWorker::Stop() {
@@ -204,7 +212,7 @@ namespace SR_UTILS_NS {
         ThreadsWorker::Ptr pThreadsWorker = new ThreadsWorker();
 
         if (auto&& finalizeNode = root.GetChild("finalize"); finalizeNode.IsValid()) {
-            for (auto&& item : finalizeNode.GetChildren()) {
+            for (auto&& item : finalizeNode.Children()) {
                 if (!item.IsValid()) {
                     continue;
                 }
@@ -229,7 +237,7 @@ namespace SR_UTILS_NS {
             }
         }
 
-        for (auto&& threadNode : threadsNode.GetChildren()) {
+        for (auto&& threadNode : threadsNode.Children()) {
             auto&& threadName = threadNode.GetChild("name");
             if (!threadName.IsValid()) {
                 continue;
@@ -243,6 +251,19 @@ namespace SR_UTILS_NS {
            auto&& threadNameStr = threadName.GetValue();
             ThreadWorker::Ptr pThreadWorker = new ThreadWorker(threadNameStr);
 
+            if (auto&& placementNode = threadNode.GetChild("placement"); placementNode.IsValid()) {
+                auto&& cacheGroupNode = threadNode.GetChild("cache_group");
+                pThreadWorker->SetPlacement(
+                    SR_UTILS_NS::EnumReflector::FromStringLowerCase<ThreadPlacement>(placementNode.GetValue()),
+                    cacheGroupNode.IsValid() ? SR_UTILS_NS::StringUtils::ParseNumber<uint32_t>(cacheGroupNode.GetValue(), 0) : 0
+                );
+            }
+
+            /// priority: highest, above_normal, ...
+            if (auto&& priorityNode = threadNode.GetChild("priority"); priorityNode.IsValid()) {
+                pThreadWorker->SetPriority(SR_UTILS_NS::EnumReflector::FromStringLowerCase<ThreadPriority>("SR_THREAD_PRIORITY_" + priorityNode.GetValue()));
+            }
+
             static auto processCondition = [](int type, SR_YAML_NS::Node conditionNode, const ThreadWorkerStateBase::Ptr& pState) {
                 if (!conditionNode.IsValid()) {
                     return;
@@ -252,7 +273,7 @@ namespace SR_UTILS_NS {
                     auto&& stateName = SR_UTILS_NS::StringUtils::ToLower(state.name);
 
                     if (auto&& stateNode = conditionNode.GetChild(stateName.c_str()); stateNode.IsValid()) {
-                        for (auto&& item : stateNode.GetChildren()) {
+                        for (auto&& item : stateNode.Children()) {
                             switch (type) {
                             case 0:
                                 pState->AddSkipCondition(item.GetValue(), static_cast<ThreadWorkerState>(state.value));
@@ -271,7 +292,7 @@ namespace SR_UTILS_NS {
                 }
             };
 
-            for (auto&& state : states.GetChildren()) {
+            for (auto&& state : states.Children()) {
                 auto&& stateName = state.GetChild("name");
                 if (!stateName.IsValid()) {
                     continue;
@@ -315,8 +336,25 @@ namespace SR_UTILS_NS {
         SRAssert(!m_isActive);
         m_isActive = true;
 
+        auto&& topology = SR_PLATFORM_NS::GetCPUTopology();
+        uint32_t nextCore = 0;
+
         for (auto&& pThread : m_threadWorkers) {
-            pThread->Start();
+            std::vector<uint32_t> cpus;
+
+            switch (pThread->GetPlacement()) {
+                case ThreadPlacement::PhysicalCore:
+                    /// SMT-соседи остаются за тем же потоком, другие потоки ядро не делят, пока ядер хватает
+                    cpus = topology.GetCoreCPUs(nextCore++ % std::max(topology.coreCount, 1u));
+                    break;
+                case ThreadPlacement::SharedCache:
+                    cpus = topology.GetCacheGroupCPUs(pThread->GetCacheGroup() % std::max(topology.cacheGroupCount, 1u));
+                    break;
+                default:
+                    break;
+            }
+
+            pThread->Start(cpus);
         }
     }
 
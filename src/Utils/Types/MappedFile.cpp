@@ -0,0 +1,34 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Types/MappedFile.h>
+
+namespace SR_HTYPES_NS {
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : m_mapping(SR_EXCHANGE(other.m_mapping, { }))
+    { }
+
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            m_mapping = SR_EXCHANGE(other.m_mapping, { });
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const SR_UTILS_NS::Path& path) {
+        Close();
+        return SR_PLATFORM_NS::MapFile(path, m_mapping);
+    }
+
+    void MappedFile::Close() {
+        if (m_mapping.pData) {
+            SR_PLATFORM_NS::UnmapFile(m_mapping);
+        }
+    }
+}
@@ -12,8 +12,6 @@
     #include <assimp/scene.h>
     #include <assimp/postprocess.h>
     #include <assimp/Importer.hpp>
-    #include <assimp/include/assimp/Exporter.hpp>
-    #include <assimp/include/assimp/cexport.h>
 #endif
 
 namespace SR_HTYPES_NS {
@@ -35,10 +33,8 @@ namespace SR_HTYPES_NS {
     #ifdef SR_UTILS_ASSIMP
         delete m_importer;
 
-        if (m_fromCache) {
-            delete m_scene;
-            m_scene = nullptr;
-        }
+        m_cachedScene.reset();
+        m_scene = nullptr;
     #endif
     }
 
@@ -93,7 +89,7 @@ namespace SR_HTYPES_NS {
         }
 
         if (m_fromCache) {
-            delete m_scene;
+            m_cachedScene.reset();
             m_scene = nullptr;
         }
 
@@ -103,7 +99,11 @@ namespace SR_HTYPES_NS {
         m_fromCache = false;
 
         m_indices.clear();
+        m_vertices.clear();
+        m_convexHulls.clear();
         m_bones.clear();
+        m_boneTables.clear();
+        m_boneNames.clear();
         m_optimizedBones.clear();
 
         m_boneOffsetsMap.clear();
@@ -131,23 +131,16 @@ namespace SR_HTYPES_NS {
         }
 
         SR_MAYBE_UNUSED Path&& binary = cache.ConcatExt("cache");
-        SR_MAYBE_UNUSED Path&& hashFile = cache.ConcatExt("hash");
 
         SR_MAYBE_UNUSED const uint64_t resourceHash = path.GetFileHash();
 
         SR_MAYBE_UNUSED const bool supportFastLoad = SR_UTILS_NS::Features::Instance().Enabled("FastModelsLoad", false);
-        SR_MAYBE_UNUSED bool needFastLoad = supportFastLoad;
 
     #ifdef SR_UTILS_ASSIMP
-    retry:
-        if (needFastLoad && resourceHash == SR_UTILS_NS::FileSystem::ReadHashFromFile(hashFile)) {
-            if ((m_scene = SR_UTILS_NS::AssimpCache::Instance().Load(binary))) {
-                m_fromCache = true;
-            }
-            else {
-                needFastLoad = false;
-                goto retry;
-            }
+        /// хэш исходника лежит в заголовке кэша, устаревший кэш просто не загрузится
+        if (supportFastLoad && (m_cachedScene = SR_UTILS_NS::AssimpCache::Instance().Load(binary, resourceHash))) {
+            m_scene = m_cachedScene->GetScene();
+            m_fromCache = true;
         }
         else {
             m_scene = m_importer->ReadFile(path.ToStringRef(), m_params.animation ? SR_RAW_MESH_ASSIMP_ANIMATION_FLAGS : SR_RAW_MESH_ASSIMP_FLAGS);
@@ -157,26 +150,11 @@ namespace SR_HTYPES_NS {
                 return false;
             }
 
-            if (m_params.convexHull) {
-                ComputeConvexHull();
-            }
-
             NormalizeWeights();
-
-            if (needFastLoad) {
-                SR_LOG("RawMesh::Load() : export model to cache... \n\tPath: " + binary.ToString());
-
-                Assimp::Exporter exporter;
-                const aiExportFormatDesc* format = exporter.GetExportFormatDescription(14);
-
-                exporter.Export(m_scene, format->id, binary.ToString(), m_params.animation ? SR_RAW_MESH_ASSIMP_ANIMATION_FLAGS : SR_RAW_MESH_ASSIMP_FLAGS);
-
-                SR_UTILS_NS::FileSystem::WriteHashToFile(hashFile, resourceHash);
-            }
         }
 
         if (m_scene && !m_fromCache && supportFastLoad) {
-            SR_UTILS_NS::AssimpCache::Instance().Save(binary, m_scene);
+            SR_UTILS_NS::AssimpCache::Instance().Save(binary, m_scene, resourceHash);
         }
 
         if (m_scene) {
@@ -185,6 +163,10 @@ namespace SR_HTYPES_NS {
             CalculateOffsets();
             CalculateTransforms();
             CalculateAnimations();
+
+            if (m_params.convexHull) {
+                ComputeConvexHull();
+            }
         }
         else {
             SR_ERROR("RawMesh::Load() : failed to read file! \n\tPath: " + path.ToString() + "\n\tReason: " + m_importer->GetErrorString());
@@ -263,11 +245,13 @@ namespace SR_HTYPES_NS {
         //}
 
         if (hasBones) {
-            auto&& bones = GetBones(id);
+            auto&& boneTable = m_boneTables[id];
 
             bool hasWarn = false;
 
             for (uint32_t i = 0; i < mesh->mNumBones; i++) {
+                const uint32_t boneIndex = boneTable[i];
+
                 for (uint32_t j = 0; j < mesh->mBones[i]->mNumWeights; j++) {
                     auto&& vertex = vertices[mesh->mBones[i]->mWeights[j].mVertexId];
 
@@ -282,8 +266,6 @@ namespace SR_HTYPES_NS {
                         continue;
                     }
 
-                    auto&& boneIndex = bones.at(SR_UTILS_NS::StringAtom(mesh->mBones[i]->mName.C_Str()));
-
                     vertex.weights[vertex.weightsNum - 1].boneId = boneIndex;
                     vertex.weights[vertex.weightsNum - 1].weight = mesh->mBones[i]->mWeights[j].mWeight;
                 }
@@ -326,6 +308,8 @@ namespace SR_HTYPES_NS {
             return empty;
         }
 
+        std::lock_guard lock(m_viewsMutex);
+
         if (!m_indices[id].empty()) {
             return m_indices[id];
         }
@@ -364,6 +348,51 @@ namespace SR_HTYPES_NS {
         return m_indices[id];
     }
 
+    std::span<const SR_UTILS_NS::Vec3> RawMesh::GetPositions(uint32_t id) const {
+    #ifdef SR_UTILS_ASSIMP
+        if (!m_scene || id >= m_scene->mNumMeshes) {
+            SRAssert2(false, "Out of range or invalid scene!");
+            return { };
+        }
+
+        static_assert(sizeof(SR_UTILS_NS::Vec3) == sizeof(aiVector3D), "Incompatible vector layout!");
+
+        auto&& mesh = m_scene->mMeshes[id];
+        return { reinterpret_cast<const SR_UTILS_NS::Vec3*>(mesh->mVertices), mesh->mNumVertices };
+    #else
+        return { };
+    #endif
+    }
+
+    std::span<const SR_UTILS_NS::Vertex> RawMesh::GetVerticesView(uint32_t id) const {
+        SR_TRACY_ZONE;
+
+        if (id >= m_vertices.size()) {
+            SRHalt("Out of range!");
+            return { };
+        }
+
+        std::lock_guard lock(m_viewsMutex);
+
+        if (m_vertices[id].empty()) {
+            m_vertices[id] = GetVertices(id);
+        }
+
+        return m_vertices[id];
+    }
+
+    std::span<const uint32_t> RawMesh::GetIndicesView(uint32_t id) const {
+        return GetIndices(id);
+    }
+
+    std::span<const SR_UTILS_NS::StringAtom> RawMesh::GetBoneNames(uint32_t id) const {
+        if (id >= m_boneNames.size()) {
+            return { };
+        }
+
+        return m_boneNames[id];
+    }
+
     uint32_t RawMesh::GetVerticesCount(uint32_t id) const {
     #ifdef SR_UTILS_ASSIMP
         if (!m_scene || id >= m_scene->mNumMeshes) {
@@ -490,19 +519,29 @@ namespace SR_HTYPES_NS {
     void RawMesh::CalculateBones() {
     #ifdef SR_UTILS_ASSIMP
         m_bones.resize(m_scene->mNumMeshes);
+        m_boneTables.resize(m_scene->mNumMeshes);
+        m_boneNames.resize(m_scene->mNumMeshes);
         m_indices.resize(m_scene->mNumMeshes);
+        m_vertices.resize(m_scene->mNumMeshes);
 
         for (uint32_t meshId = 0; meshId < m_scene->mNumMeshes; ++meshId) {
             auto&& pMesh = m_scene->mMeshes[meshId];
 
+            auto&& boneTable = m_boneTables[meshId];
+            boneTable.resize(pMesh->mNumBones);
+
             for (uint32_t boneId = 0; boneId < pMesh->mNumBones; ++boneId) {
                 auto&& name = SR_UTILS_NS::StringAtom(pMesh->mBones[boneId]->mName.data);
 
-                if (m_bones[meshId].count(name) == 1) {
+                if (auto&& pIt = m_bones[meshId].find(name); pIt != m_bones[meshId].end()) {
                     SR_WARN("RawMesh::CalculateBones() : bone already exists! \n\tName: " + name.ToString());
+                    boneTable[boneId] = pIt->second;
                     continue;
                 }
-                m_bones[meshId].insert(std::make_pair(name, static_cast<uint32_t>(m_bones[meshId].size())));
+
+                boneTable[boneId] = static_cast<uint32_t>(m_bones[meshId].size());
+                m_bones[meshId].insert(std::make_pair(name, boneTable[boneId]));
+                m_boneNames[meshId].emplace_back(name);
             }
         }
     #endif
@@ -707,18 +746,33 @@ namespace SR_HTYPES_NS {
 #endif
 
     void RawMesh::ComputeConvexHull() {
+        SR_TRACY_ZONE;
+
         if (!m_params.convexHull) {
             return;
         }
 
-        //std::vector<>
+        const uint32_t meshesCount = GetMeshesCount();
 
-        for (uint16_t i = 0; i <= static_cast<uint16_t>(GetMeshesCount()); ++i) {
-            auto&& computedVertices = SR_UTILS_NS::ComputeConvexHull(GetVertices(i));
-            SR_NOOP;
+        m_convexHulls.clear();
+        m_convexHulls.resize(meshesCount);
+
+        for (uint32_t i = 0; i < meshesCount; ++i) {
+            if (!SR_UTILS_NS::ComputeConvexHull(GetPositions(i), m_convexHulls[i], m_params.convexHullVertexLimit)) {
+                SR_WARN("RawMesh::ComputeConvexHull() : mesh is degenerate, convex hull is not computed!\n\tPath: " +
+                    GetResourcePath().ToStringRef() + "\n\tIndex: " + std::to_string(i)
+                );
+            }
+        }
+    }
 
+    std::span<const uint32_t> RawMesh::GetConvexHullIndices(uint32_t id) const {
+        if (id >= m_convexHulls.size()) {
+            SRAssert2(m_params.convexHull == false, "Out of range!");
+            return { };
         }
 
+        return m_convexHulls[id];
     }
 
     int32_t RawMesh::GetMeshId(SR_UTILS_NS::StringAtom name) const {
@@ -3,42 +3,1442 @@
 //
 
 #include <Utils/Types/Regex.h>
+#include <Utils/Debug.h>
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_HTYPES_NS::RegexDetails {
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t MAX_INSTRUCTIONS = 1u << 14u;
+    static constexpr uint32_t MAX_REPEAT = 1000;
+    static constexpr uint32_t MAX_DEPTH = 256;
+    /// однопроходный разбор строит множества первых символов для каждой инструкции, это квадрат от размера программы
+    static constexpr uint32_t MAX_ONE_PASS_INSTRUCTIONS = 256;
+    /// перебор с возвратом держит бит на каждую пару (инструкция, позиция), больше 32 КБ - уже Pike VM
+    static constexpr size_t MAX_BACKTRACK_BITS = 256 * 1024;
+
+    struct CharClass {
+        std::array<uint64_t, 4> bits = { };
+
+        void Set(uint8_t c) noexcept { bits[c >> 6u] |= 1ull << (c & 63u); }
+        void Reset(uint8_t c) noexcept { bits[c >> 6u] &= ~(1ull << (c & 63u)); }
+        SR_NODISCARD bool Test(uint8_t c) const noexcept { return (bits[c >> 6u] >> (c & 63u)) & 1ull; }
+
+        void SetRange(uint8_t from, uint8_t to) noexcept {
+            for (uint32_t c = from; c <= to; ++c) {
+                Set(static_cast<uint8_t>(c));
+            }
+        }
+
+        void Merge(const CharClass& other) noexcept {
+            for (uint32_t i = 0; i < 4; ++i) {
+                bits[i] |= other.bits[i];
+            }
+        }
+
+        void Invert() noexcept {
+            for (auto&& word : bits) {
+                word = ~word;
+            }
+        }
+
+        SR_NODISCARD bool Intersects(const CharClass& other) const noexcept {
+            for (uint32_t i = 0; i < 4; ++i) {
+                if (bits[i] & other.bits[i]) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    enum class OpCode : uint8_t {
+        Char, Any, Class, Split, Jump, Save, LineBegin, LineEnd, WordBoundary, NotWordBoundary, Match
+    };
+
+    struct Instruction {
+        OpCode code = OpCode::Match;
+        uint8_t ch = 0;
+        /// Split: x - приоритетная ветка, y - вторая; Jump: x; Save: x - слот; Class: x - индекс класса
+        uint32_t x = 0;
+        uint32_t y = 0;
+    };
+
+    struct Program {
+        std::vector<Instruction> code;
+        std::vector<CharClass> classes;
+        CharClass firstChars;
+        /// пустое совпадение возможно или первый символ не определен, пропуск по firstChars невозможен
+        bool canSkip = false;
+        bool anchored = false;
+        uint32_t groupsCount = 1;
+
+        /// цепочка символов, которая есть в любом совпадении: вход без нее отбрасывается одним поиском подстроки
+        std::string literal;
+
+        /// на каждой развилке ветку однозначно выбирает следующий символ (см. CalculateOnePass)
+        bool onePass = false;
+        /// для каждой инструкции: с каких символов может начаться путь из нее и достижим ли Match без символов
+        std::vector<CharClass> onePassChars;
+        std::vector<uint8_t> onePassMatch;
+    };
+
+    /// Буферы Pike VM, размер зависит только от программы
+    struct Context {
+        struct ThreadList {
+            std::vector<uint32_t> sparse;
+            std::vector<uint32_t> dense;
+            uint32_t visited = 0;
+
+            std::vector<uint32_t> pcs;
+            std::vector<uint32_t> captures;
+            uint32_t count = 0;
+
+            void Reset(uint32_t programSize, uint32_t slots) {
+                sparse.assign(programSize, 0);
+                dense.assign(programSize, 0);
+                pcs.assign(programSize, 0);
+                captures.assign(static_cast<size_t>(programSize) * slots, NONE);
+                visited = 0;
+                count = 0;
+            }
+
+            void Clear() noexcept {
+                visited = 0;
+                count = 0;
+            }
+
+            /// true, если pc уже был посещен на этом шаге
+            bool Visit(uint32_t pc) noexcept {
+                const uint32_t index = sparse[pc];
+                if (index < visited && dense[index] == pc) {
+                    return true;
+                }
+                sparse[pc] = visited;
+                dense[visited++] = pc;
+                return false;
+            }
+        };
+
+        struct Frame {
+            uint32_t pc = 0;
+            /// NONE - посетить pc (при переборе с возвратом value - позиция), иначе восстановить слот значением value
+            uint32_t slot = NONE;
+            uint32_t value = 0;
+        };
+
+        ThreadList lists[2];
+        std::vector<Frame> stack;
+        std::vector<uint32_t> scratch;
+        uint32_t slots = 0;
+
+        /// буферы перебора с возвратом, растут до MAX_BACKTRACK_BITS и дальше переиспользуются
+        std::vector<uint64_t> visited;
+        std::vector<Frame> jobs;
+
+        explicit Context(const Program& program) {
+            slots = program.groupsCount * 2;
+            const auto size = static_cast<uint32_t>(program.code.size());
+            lists[0].Reset(size, slots);
+            lists[1].Reset(size, slots);
+            stack.resize(size * 3 + 1);
+            scratch.resize(slots, NONE);
+        }
+    };
+
+    /// ------------------------------------------------- Разбор ---------------------------------------------------------
+
+    struct Node {
+        enum class Type : uint8_t {
+            Empty, Char, Any, Class, LineBegin, LineEnd, WordBoundary, NotWordBoundary, Group, Concat, Alternate, Repeat
+        };
+
+        Type type = Type::Empty;
+        uint8_t ch = 0;
+        bool greedy = true;
+        int32_t group = -1;
+        uint32_t classId = 0;
+        uint32_t min = 0;
+        uint32_t max = 0;
+        std::vector<uint32_t> children;
+    };
+
+    class Parser {
+    public:
+        Parser(std::string_view pattern, Program& program)
+            : m_pattern(pattern)
+            , m_program(program)
+        { }
+
+        /// false - синтаксис не поддерживается или некорректен
+        bool Parse(uint32_t& root) {
+            if (!ParseAlternate(root, 0)) {
+                return false;
+            }
+            return m_position == m_pattern.size();
+        }
+
+        SR_NODISCARD const std::vector<Node>& GetNodes() const noexcept { return m_nodes; }
+
+    private:
+        SR_NODISCARD bool End() const noexcept { return m_position >= m_pattern.size(); }
+        SR_NODISCARD char Peek() const noexcept { return m_pattern[m_position]; }
+
+        uint32_t AddNode(Node::Type type) {
+            m_nodes.emplace_back().type = type;
+            return static_cast<uint32_t>(m_nodes.size() - 1);
+        }
+
+        uint32_t AddClass(const CharClass& charClass) {
+            m_program.classes.emplace_back(charClass);
+            return static_cast<uint32_t>(m_program.classes.size() - 1);
+        }
+
+        bool ParseAlternate(uint32_t& result, uint32_t depth) {
+            if (depth > MAX_DEPTH) {
+                return false;
+            }
+
+            uint32_t branch = 0;
+            if (!ParseConcat(branch, depth)) {
+                return false;
+            }
+
+            if (End() || Peek() != '|') {
+                result = branch;
+                return true;
+            }
+
+            const uint32_t alternate = AddNode(Node::Type::Alternate);
+            m_nodes[alternate].children.emplace_back(branch);
+
+            while (!End() && Peek() == '|') {
+                ++m_position;
+                if (!ParseConcat(branch, depth)) {
+                    return false;
+                }
+                m_nodes[alternate].children.emplace_back(branch);
+            }
+
+            result = alternate;
+            return true;
+        }
+
+        bool ParseConcat(uint32_t& result, uint32_t depth) {
+            const uint32_t concat = AddNode(Node::Type::Concat);
+
+            while (!End() && Peek() != '|' && Peek() != ')') {
+                uint32_t atom = 0;
+                if (!ParseRepeat(atom, depth)) {
+                    return false;
+                }
+                m_nodes[concat].children.emplace_back(atom);
+            }
+
+            result = concat;
+            return true;
+        }
+
+        bool ParseRepeat(uint32_t& result, uint32_t depth) {
+            uint32_t atom = 0;
+            if (!ParseAtom(atom, depth)) {
+                return false;
+            }
+
+            while (!End()) {
+                uint32_t min = 0, max = 0;
+
+                const char c = Peek();
+                if (c == '*') { min = 0; max = NONE; ++m_position; }
+                else if (c == '+') { min = 1; max = NONE; ++m_position; }
+                else if (c == '?') { min = 0; max = 1; ++m_position; }
+                else if (c == '{') {
+                    if (!ParseCount(min, max)) {
+                        return false;
+                    }
+                }
+                else {
+                    break;
+                }
+
+                const auto type = m_nodes[atom].type;
+                if (type == Node::Type::LineBegin || type == Node::Type::LineEnd || type == Node::Type::WordBoundary || type == Node::Type::NotWordBoundary) {
+                    return false;
+                }
+
+                const uint32_t repeat = AddNode(Node::Type::Repeat);
+                m_nodes[repeat].min = min;
+                m_nodes[repeat].max = max;
+                m_nodes[repeat].children.emplace_back(atom);
+
+                if (!End() && Peek() == '?') {
+                    m_nodes[repeat].greedy = false;
+                    ++m_position;
+                }
+
+                atom = repeat;
+            }
+
+            result = atom;
+            return true;
+        }
+
+        bool ParseNumber(uint32_t& value) {
+            const size_t start = m_position;
+            value = 0;
+            while (!End() && Peek() >= '0' && Peek() <= '9') {
+                value = value * 10 + static_cast<uint32_t>(Peek() - '0');
+                if (value > MAX_REPEAT) {
+                    return false;
+                }
+                ++m_position;
+            }
+            return m_position != start;
+        }
+
+        bool ParseCount(uint32_t& min, uint32_t& max) {
+            ++m_position; /// {
+
+            if (!ParseNumber(min)) {
+                return false;
+            }
+
+            max = min;
+
+            if (!End() && Peek() == ',') {
+                ++m_position;
+                max = NONE;
+                if (!End() && Peek() != '}' && (!ParseNumber(max) || max < min)) {
+                    return false;
+                }
+            }
+
+            if (End() || Peek() != '}') {
+                return false;
+            }
+
+            ++m_position;
+            return true;
+        }
+
+        bool ParseAtom(uint32_t& result, uint32_t depth) {
+            const char c = Peek();
+
+            switch (c) {
+                case '(': {
+                    ++m_position;
+
+                    int32_t group = -1;
+                    if (!End() && Peek() == '?') {
+                        if (m_position + 1 >= m_pattern.size() || m_pattern[m_position + 1] != ':') {
+                            return false; /// просмотр вперед
+                        }
+                        m_position += 2;
+                    }
+                    else {
+                        group = static_cast<int32_t>(m_program.groupsCount++);
+                    }
+
+                    uint32_t inner = 0;
+                    if (!ParseAlternate(inner, depth + 1) || End() || Peek() != ')') {
+                        return false;
+                    }
+                    ++m_position;
+
+                    result = AddNode(Node::Type::Group);
+                    m_nodes[result].group = group;
+                    m_nodes[result].children.emplace_back(inner);
+                    return true;
+                }
+                case '[':
+                    return ParseClass(result);
+                case '.':
+                    ++m_position;
+                    result = AddNode(Node::Type::Any);
+                    return true;
+                case '^':
+                    ++m_position;
+                    result = AddNode(Node::Type::LineBegin);
+                    return true;
+                case '$':
+                    ++m_position;
+                    result = AddNode(Node::Type::LineEnd);
+                    return true;
+                case '\\': {
+                    ++m_position;
+                    if (End()) {
+                        return false;
+                    }
+
+                    const char escape = Peek();
+                    if (escape == 'b' || escape == 'B') {
+                        ++m_position;
+                        result = AddNode(escape == 'b' ? Node::Type::WordBoundary : Node::Type::NotWordBoundary);
+                        return true;
+                    }
+
+                    CharClass charClass;
+                    uint8_t ch = 0;
+                    bool isClass = false;
+
+                    if (!ParseEscape(ch, charClass, isClass)) {
+                        return false;
+                    }
+
+                    if (isClass) {
+                        result = AddNode(Node::Type::Class);
+                        m_nodes[result].classId = AddClass(charClass);
+                    }
+                    else {
+                        result = AddNode(Node::Type::Char);
+                        m_nodes[result].ch = ch;
+                    }
+                    return true;
+                }
+                case '*': case '+': case '?': case '{': case ')': case ']': case '}':
+                    return false;
+                default:
+                    ++m_position;
+                    result = AddNode(Node::Type::Char);
+                    m_nodes[result].ch = static_cast<uint8_t>(c);
+                    return true;
+            }
+        }
+
+        static int32_t HexValue(char c) noexcept {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+
+        /// позиция стоит на символе после '\'
+        bool ParseEscape(uint8_t& ch, CharClass& charClass, bool& isClass) {
+            const char escape = Peek();
+            ++m_position;
+
+            isClass = false;
+
+            switch (escape) {
+                case 'd': case 'D':
+                    charClass.SetRange('0', '9');
+                    break;
+                case 'w': case 'W':
+                    charClass.SetRange('a', 'z');
+                    charClass.SetRange('A', 'Z');
+                    charClass.SetRange('0', '9');
+                    charClass.Set('_');
+                    break;
+                case 's': case 'S':
+                    for (const char space : { ' ', '\t', '\n', '\v', '\f', '\r' }) {
+                        charClass.Set(static_cast<uint8_t>(space));
+                    }
+                    break;
+                case 't': ch = '\t'; return true;
+                case 'n': ch = '\n'; return true;
+                case 'r': ch = '\r'; return true;
+                case 'v': ch = '\v'; return true;
+                case 'f': ch = '\f'; return true;
+                case '0':
+                    if (!End() && Peek() >= '0' && Peek() <= '9') {
+                        return false;
+                    }
+                    ch = '\0';
+                    return true;
+                case 'x': {
+                    if (m_position + 2 > m_pattern.size()) {
+                        return false;
+                    }
+                    const int32_t high = HexValue(m_pattern[m_position]);
+                    const int32_t low = HexValue(m_pattern[m_position + 1]);
+                    if (high < 0 || low < 0) {
+                        return false;
+                    }
+                    m_position += 2;
+                    ch = static_cast<uint8_t>(high * 16 + low);
+                    return true;
+                }
+                default:
+                    /// обратные ссылки, \u, \c и прочие буквенные escape-последовательности отдаются std::regex
+                    if ((escape >= '0' && escape <= '9') || (escape >= 'a' && escape <= 'z') || (escape >= 'A' && escape <= 'Z')) {
+                        return false;
+                    }
+                    ch = static_cast<uint8_t>(escape);
+                    return true;
+            }
+
+            isClass = true;
+
+            if (escape >= 'A' && escape <= 'Z') {
+                charClass.Invert();
+            }
+
+            return true;
+        }
+
+        bool ParseClass(uint32_t& result) {
+            ++m_position; /// [
+
+            bool negative = false;
+            if (!End() && Peek() == '^') {
+                negative = true;
+                ++m_position;
+            }
+
+            /// пустые классы и POSIX-классы отдаются std::regex
+            if (End() || Peek() == ']') {
+                return false;
+            }
+
+            CharClass charClass;
+
+            while (!End() && Peek() != ']') {
+                uint8_t from = 0;
+                bool isClass = false;
+
+                if (!ParseClassAtom(from, charClass, isClass)) {
+                    return false;
+                }
+
+                if (isClass) {
+                    continue;
+                }
+
+                if (m_position + 1 < m_pattern.size() && Peek() == '-' && m_pattern[m_position + 1] != ']') {
+                    ++m_position;
+
+                    uint8_t to = 0;
+                    if (!ParseClassAtom(to, charClass, isClass) || isClass || to < from) {
+                        return false;
+                    }
+
+                    charClass.SetRange(from, to);
+                    continue;
+                }
+
+                charClass.Set(from);
+            }
+
+            if (End()) {
+                return false;
+            }
+
+            ++m_position; /// ]
+
+            if (negative) {
+                charClass.Invert();
+            }
+
+            result = AddNode(Node::Type::Class);
+            m_nodes[result].classId = AddClass(charClass);
+            return true;
+        }
+
+        bool ParseClassAtom(uint8_t& ch, CharClass& charClass, bool& isClass) {
+            const char c = Peek();
+
+            if (c == '[' && m_position + 1 < m_pattern.size()) {
+                const char next = m_pattern[m_position + 1];
+                if (next == ':' || next == '=' || next == '.') {
+                    return false;
+                }
+            }
+
+            if (c != '\\') {
+                ++m_position;
+                ch = static_cast<uint8_t>(c);
+                isClass = false;
+                return true;
+            }
+
+            ++m_position;
+            if (End()) {
+                return false;
+            }
+
+            /// внутри класса \b означает backspace
+            if (Peek() == 'b') {
+                ++m_position;
+                ch = '\b';
+                isClass = false;
+                return true;
+            }
+
+            CharClass escaped;
+            if (!ParseEscape(ch, escaped, isClass)) {
+                return false;
+            }
+
+            if (isClass) {
+                charClass.Merge(escaped);
+            }
+
+            return true;
+        }
+
+    private:
+        std::string_view m_pattern;
+        size_t m_position = 0;
+        Program& m_program;
+        std::vector<Node> m_nodes;
+
+    };
+
+    /// ----------------------------------------------- Компиляция -------------------------------------------------------
+
+    class Compiler {
+    public:
+        Compiler(const std::vector<Node>& nodes, Program& program)
+            : m_nodes(nodes)
+            , m_program(program)
+        { }
+
+        bool Compile(uint32_t root) {
+            Emit({ OpCode::Save, 0, 0, 0 });
+
+            if (!CompileNode(root)) {
+                return false;
+            }
+
+            Emit({ OpCode::Save, 0, 1, 0 });
+            Emit({ OpCode::Match });
+
+            return m_program.code.size() <= MAX_INSTRUCTIONS;
+        }
+
+    private:
+        uint32_t Emit(const Instruction& instruction) {
+            m_program.code.emplace_back(instruction);
+            return static_cast<uint32_t>(m_program.code.size() - 1);
+        }
+
+        SR_NODISCARD uint32_t Next() const noexcept {
+            return static_cast<uint32_t>(m_program.code.size());
+        }
+
+        bool CompileNode(uint32_t index) {
+            if (m_program.code.size() > MAX_INSTRUCTIONS) {
+                return false;
+            }
+
+            auto&& node = m_nodes[index];
+
+            switch (node.type) {
+                case Node::Type::Empty:
+                    return true;
+                case Node::Type::Char:
+                    Emit({ OpCode::Char, node.ch, 0, 0 });
+                    return true;
+                case Node::Type::Any:
+                    Emit({ OpCode::Any });
+                    return true;
+                case Node::Type::Class:
+                    Emit({ OpCode::Class, 0, node.classId, 0 });
+                    return true;
+                case Node::Type::LineBegin:
+                    Emit({ OpCode::LineBegin });
+                    return true;
+                case Node::Type::LineEnd:
+                    Emit({ OpCode::LineEnd });
+                    return true;
+                case Node::Type::WordBoundary:
+                    Emit({ OpCode::WordBoundary });
+                    return true;
+                case Node::Type::NotWordBoundary:
+                    Emit({ OpCode::NotWordBoundary });
+                    return true;
+                case Node::Type::Concat:
+                    for (auto&& child : node.children) {
+                        if (!CompileNode(child)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                case Node::Type::Group: {
+                    if (node.group >= 0) {
+                        Emit({ OpCode::Save, 0, static_cast<uint32_t>(node.group) * 2, 0 });
+                    }
+                    if (!CompileNode(node.children.front())) {
+                        return false;
+                    }
+                    if (node.group >= 0) {
+                        Emit({ OpCode::Save, 0, static_cast<uint32_t>(node.group) * 2 + 1, 0 });
+                    }
+                    return true;
+                }
+                case Node::Type::Alternate: {
+                    std::vector<uint32_t> jumps;
+
+                    for (size_t i = 0; i + 1 < node.children.size(); ++i) {
+                        const uint32_t split = Emit({ OpCode::Split });
+                        m_program.code[split].x = Next();
+                        if (!CompileNode(node.children[i])) {
+                            return false;
+                        }
+                        jumps.emplace_back(Emit({ OpCode::Jump }));
+                        m_program.code[split].y = Next();
+                    }
+
+                    if (!CompileNode(node.children.back())) {
+                        return false;
+                    }
+
+                    for (auto&& jump : jumps) {
+                        m_program.code[jump].x = Next();
+                    }
+                    return true;
+                }
+                case Node::Type::Repeat:
+                    return CompileRepeat(node);
+            }
+
+            return false;
+        }
+
+        void SetSplit(uint32_t split, uint32_t body, uint32_t exit, bool greedy) {
+            m_program.code[split].x = greedy ? body : exit;
+            m_program.code[split].y = greedy ? exit : body;
+        }
+
+        bool CompileRepeat(const Node& node) {
+            const uint32_t child = node.children.front();
+
+            for (uint32_t i = 0; i < node.min; ++i) {
+                if (!CompileNode(child)) {
+                    return false;
+                }
+            }
+
+            if (node.max == NONE) {
+                /// L: split body, exit; body; jump L
+                const uint32_t split = Emit({ OpCode::Split });
+                if (!CompileNode(child)) {
+                    return false;
+                }
+                Emit({ OpCode::Jump, 0, split, 0 });
+                SetSplit(split, split + 1, Next(), node.greedy);
+                return true;
+            }
+
+            /// каждая необязательная копия может сразу уйти на общий выход
+            std::vector<uint32_t> splits;
+
+            for (uint32_t i = node.min; i < node.max; ++i) {
+                splits.emplace_back(Emit({ OpCode::Split }));
+                if (!CompileNode(child)) {
+                    return false;
+                }
+            }
+
+            for (auto&& split : splits) {
+                SetSplit(split, split + 1, Next(), node.greedy);
+            }
+
+            return true;
+        }
+
+    private:
+        const std::vector<Node>& m_nodes;
+        Program& m_program;
+
+    };
+
+    /// Множество первых символов совпадения, чтобы быстро пропускать заведомо неподходящие позиции.
+    /// Ветки после '^' тоже учитываются, так что множество всегда надмножество настоящего.
+    static void CalculateFirstChars(Program& program) {
+        /// бит 0 - состояние достигнуто без '^', бит 1 - после '^'
+        std::vector<uint8_t> visited(program.code.size(), 0);
+        std::vector<std::pair<uint32_t, bool>> stack = { { 0, false } };
+
+        program.canSkip = true;
+        program.anchored = true;
+
+        while (!stack.empty()) {
+            const auto [pc, afterAnchor] = stack.back();
+            stack.pop_back();
+
+            const uint8_t mask = afterAnchor ? 2 : 1;
+            if (visited[pc] & mask) {
+                continue;
+            }
+            visited[pc] |= mask;
+
+            auto&& instruction = program.code[pc];
+
+            switch (instruction.code) {
+                case OpCode::Char:
+                    program.firstChars.Set(instruction.ch);
+                    program.anchored &= afterAnchor;
+                    break;
+                case OpCode::Class:
+                    program.firstChars.Merge(program.classes[instruction.x]);
+                    program.anchored &= afterAnchor;
+                    break;
+                case OpCode::Any:
+                case OpCode::Match:
+                    program.canSkip = false;
+                    program.anchored &= afterAnchor;
+                    break;
+                case OpCode::Split:
+                    stack.emplace_back(instruction.y, afterAnchor);
+                    stack.emplace_back(instruction.x, afterAnchor);
+                    break;
+                case OpCode::Jump:
+                    stack.emplace_back(instruction.x, afterAnchor);
+                    break;
+                case OpCode::LineBegin:
+                    stack.emplace_back(pc + 1, true);
+                    break;
+                case OpCode::Save:
+                case OpCode::LineEnd:
+                case OpCode::WordBoundary:
+                case OpCode::NotWordBoundary:
+                    stack.emplace_back(pc + 1, afterAnchor);
+                    break;
+            }
+        }
+    }
+
+    /// Самая длинная цепочка символов, идущих подряд в любом совпадении. Смотрим верхнюю конкатенацию
+    /// и группы внутри нее: повтор или альтернатива цепочку обрывают, проверки позиции не занимают символов.
+    static void CollectLiteral(const std::vector<Node>& nodes, uint32_t index, std::string& current, std::string& best) {
+        auto&& node = nodes[index];
+
+        switch (node.type) {
+            case Node::Type::Char:
+                current.push_back(static_cast<char>(node.ch));
+                if (current.size() > best.size()) {
+                    best = current;
+                }
+                return;
+            case Node::Type::Empty:
+            case Node::Type::LineBegin:
+            case Node::Type::LineEnd:
+            case Node::Type::WordBoundary:
+            case Node::Type::NotWordBoundary:
+                return;
+            case Node::Type::Group:
+                CollectLiteral(nodes, node.children.front(), current, best);
+                return;
+            case Node::Type::Concat:
+                for (auto&& child : node.children) {
+                    CollectLiteral(nodes, child, current, best);
+                }
+                return;
+            default:
+                current.clear();
+                return;
+        }
+    }
+
+    /// Программа однопроходная, если на каждой развилке множества первых символов веток не пересекаются
+    /// и Match без символов достижим не больше чем из одной ветки. Тогда путь полного совпадения единственный,
+    /// и его можно пройти одним потоком без списков и копий групп. Проверки позиции (^, $, \b) не поддерживаются.
+    static void CalculateOnePass(Program& program) {
+        const auto size = static_cast<uint32_t>(program.code.size());
+        if (size > MAX_ONE_PASS_INSTRUCTIONS) {
+            return;
+        }
+
+        for (auto&& instruction : program.code) {
+            switch (instruction.code) {
+                case OpCode::LineBegin:
+                case OpCode::LineEnd:
+                case OpCode::WordBoundary:
+                case OpCode::NotWordBoundary:
+                    return;
+                default:
+                    break;
+            }
+        }
+
+        CharClass anyChar;
+        anyChar.Invert();
+        anyChar.Reset('\n');
+        anyChar.Reset('\r');
+
+        std::vector<CharClass> chars(size);
+        std::vector<uint8_t> reachesMatch(size, 0);
+
+        std::vector<uint8_t> visited(size);
+        std::vector<uint32_t> stack;
+
+        for (uint32_t start = 0; start < size; ++start) {
+            std::fill(visited.begin(), visited.end(), 0);
+            stack.assign(1, start);
+
+            while (!stack.empty()) {
+                const uint32_t pc = stack.back();
+                stack.pop_back();
+
+                if (visited[pc]) {
+                    continue;
+                }
+                visited[pc] = 1;
+
+                auto&& instruction = program.code[pc];
+
+                switch (instruction.code) {
+                    case OpCode::Char:
+                        chars[start].Set(instruction.ch);
+                        break;
+                    case OpCode::Any:
+                        chars[start].Merge(anyChar);
+                        break;
+                    case OpCode::Class:
+                        chars[start].Merge(program.classes[instruction.x]);
+                        break;
+                    case OpCode::Match:
+                        reachesMatch[start] = 1;
+                        break;
+                    case OpCode::Split:
+                        stack.emplace_back(instruction.y);
+                        stack.emplace_back(instruction.x);
+                        break;
+                    case OpCode::Jump:
+                        stack.emplace_back(instruction.x);
+                        break;
+                    default:
+                        stack.emplace_back(pc + 1);
+                        break;
+                }
+            }
+        }
+
+        for (auto&& instruction : program.code) {
+            if (instruction.code != OpCode::Split) {
+                continue;
+            }
+
+            if (chars[instruction.x].Intersects(chars[instruction.y]) || (reachesMatch[instruction.x] && reachesMatch[instruction.y])) {
+                return;
+            }
+        }
+
+        program.onePass = true;
+        program.onePassChars = std::move(chars);
+        program.onePassMatch = std::move(reachesMatch);
+    }
+
+    static std::unique_ptr<Program> Compile(std::string_view pattern) {
+        auto&& pProgram = std::make_unique<Program>();
+
+        Parser parser(pattern, *pProgram);
+
+        uint32_t root = 0;
+        if (!parser.Parse(root)) {
+            return nullptr;
+        }
+
+        Compiler compiler(parser.GetNodes(), *pProgram);
+        if (!compiler.Compile(root)) {
+            return nullptr;
+        }
+
+        CalculateFirstChars(*pProgram);
+        CalculateOnePass(*pProgram);
+
+        std::string literal;
+        CollectLiteral(parser.GetNodes(), root, literal, pProgram->literal);
+
+        return std::move(pProgram);
+    }
+
+    /// ------------------------------------------------ Исполнение ------------------------------------------------------
+
+    static bool IsWordChar(std::string_view input, uint32_t position) noexcept {
+        if (position >= input.size()) {
+            return false;
+        }
+        const char c = input[position];
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    static bool IsWordBoundary(std::string_view input, uint32_t position) noexcept {
+        const bool before = position > 0 && IsWordChar(input, position - 1);
+        return before != IsWordChar(input, position);
+    }
+
+    /// Добавляет поток и его epsilon-замыкание в порядке приоритета, без рекурсии
+    static void AddThread(const Program& program, Context& context, Context::ThreadList& list, uint32_t startPc, std::string_view input, uint32_t position) {
+        auto&& captures = context.scratch;
+        auto&& stack = context.stack;
+
+        uint32_t top = 0;
+        stack[top++] = { startPc, NONE, 0 };
+
+        while (top > 0) {
+            const Context::Frame frame = stack[--top];
+
+            if (frame.slot != NONE) {
+                captures[frame.slot] = frame.value;
+                continue;
+            }
+
+            const uint32_t pc = frame.pc;
+            if (list.Visit(pc)) {
+                continue;
+            }
+
+            auto&& instruction = program.code[pc];
+
+            switch (instruction.code) {
+                case OpCode::Jump:
+                    stack[top++] = { instruction.x, NONE, 0 };
+                    break;
+                case OpCode::Split:
+                    stack[top++] = { instruction.y, NONE, 0 };
+                    stack[top++] = { instruction.x, NONE, 0 };
+                    break;
+                case OpCode::Save:
+                    stack[top++] = { 0, instruction.x, captures[instruction.x] };
+                    captures[instruction.x] = position;
+                    stack[top++] = { pc + 1, NONE, 0 };
+                    break;
+                case OpCode::LineBegin:
+                    if (position == 0) {
+                        stack[top++] = { pc + 1, NONE, 0 };
+                    }
+                    break;
+                case OpCode::LineEnd:
+                    if (position == input.size()) {
+                        stack[top++] = { pc + 1, NONE, 0 };
+                    }
+                    break;
+                case OpCode::WordBoundary:
+                    if (IsWordBoundary(input, position)) {
+                        stack[top++] = { pc + 1, NONE, 0 };
+                    }
+                    break;
+                case OpCode::NotWordBoundary:
+                    if (!IsWordBoundary(input, position)) {
+                        stack[top++] = { pc + 1, NONE, 0 };
+                    }
+                    break;
+                default: {
+                    const uint32_t thread = list.count++;
+                    list.pcs[thread] = pc;
+                    std::copy_n(captures.data(), context.slots, list.captures.data() + static_cast<size_t>(thread) * context.slots);
+                    break;
+                }
+            }
+        }
+    }
+
+    static bool RunPike(const Program& program, Context& context, std::string_view input, bool fullMatch, std::vector<uint32_t>& groups) {
+        auto* pCurrent = &context.lists[0];
+        auto* pNext = &context.lists[1];
+
+        pCurrent->Clear();
+
+        const auto length = static_cast<uint32_t>(input.size());
+        const bool anchored = fullMatch || program.anchored;
+
+        bool matched = false;
+
+        for (uint32_t position = 0; position <= length; ++position) {
+            if (!matched && (position == 0 || !anchored)) {
+                if (pCurrent->count == 0) {
+                    pCurrent->Clear();
+
+                    /// пока потоков нет, ищем ближайшую позицию, с которой совпадение вообще возможно
+                    if (program.canSkip && !anchored) {
+                        while (position < length && !program.firstChars.Test(static_cast<uint8_t>(input[position]))) {
+                            ++position;
+                        }
+                        if (position == length) {
+                            break;
+                        }
+                    }
+                }
+
+                /// новый поток стартует с наименьшим приоритетом, уже посещенные на этой позиции состояния не повторяются
+                std::fill(context.scratch.begin(), context.scratch.end(), NONE);
+                AddThread(program, context, *pCurrent, 0, input, position);
+            }
+
+            if (pCurrent->count == 0) {
+                if (matched || anchored) {
+                    break;
+                }
+                continue;
+            }
+
+            pNext->Clear();
+
+            const uint8_t ch = position < length ? static_cast<uint8_t>(input[position]) : 0;
+
+            for (uint32_t i = 0; i < pCurrent->count; ++i) {
+                const uint32_t pc = pCurrent->pcs[i];
+                const uint32_t* pCaptures = pCurrent->captures.data() + static_cast<size_t>(i) * context.slots;
+
+                auto&& instruction = program.code[pc];
+
+                bool step = false;
+
+                switch (instruction.code) {
+                    case OpCode::Char:
+                        step = position < length && ch == instruction.ch;
+                        break;
+                    case OpCode::Any:
+                        step = position < length && ch != '\n' && ch != '\r';
+                        break;
+                    case OpCode::Class:
+                        step = position < length && program.classes[instruction.x].Test(ch);
+                        break;
+                    case OpCode::Match:
+                        if (fullMatch && position != length) {
+                            break;
+                        }
+                        std::copy_n(pCaptures, context.slots, groups.data());
+                        matched = true;
+                        /// потоки с меньшим приоритетом отбрасываются
+                        i = pCurrent->count;
+                        break;
+                    default:
+                        break;
+                }
+
+                if (step) {
+                    std::copy_n(pCaptures, context.slots, context.scratch.data());
+                    AddThread(program, context, *pNext, pc + 1, input, position + 1);
+                }
+            }
+
+            std::swap(pCurrent, pNext);
+        }
+
+        return matched;
+    }
+
+    /// Полное совпадение однопроходной программы: один поток идет по единственному возможному пути,
+    /// группы пишутся сразу в результат
+    static bool RunOnePass(const Program& program, std::string_view input, std::vector<uint32_t>& groups) {
+        const auto length = static_cast<uint32_t>(input.size());
+        const auto size = static_cast<uint32_t>(program.code.size());
+
+        uint32_t pc = 0;
+        uint32_t position = 0;
+        /// без потребления символа путь длиннее программы только по пустому циклу, совпадения на нем нет
+        uint32_t steps = 0;
+
+        while (++steps <= size) {
+            auto&& instruction = program.code[pc];
+
+            switch (instruction.code) {
+                case OpCode::Char:
+                    if (position == length || static_cast<uint8_t>(input[position]) != instruction.ch) {
+                        return false;
+                    }
+                    ++position;
+                    ++pc;
+                    steps = 0;
+                    break;
+                case OpCode::Any:
+                    if (position == length || input[position] == '\n' || input[position] == '\r') {
+                        return false;
+                    }
+                    ++position;
+                    ++pc;
+                    steps = 0;
+                    break;
+                case OpCode::Class:
+                    if (position == length || !program.classes[instruction.x].Test(static_cast<uint8_t>(input[position]))) {
+                        return false;
+                    }
+                    ++position;
+                    ++pc;
+                    steps = 0;
+                    break;
+                case OpCode::Split: {
+                    const bool first = position < length
+                        ? program.onePassChars[instruction.x].Test(static_cast<uint8_t>(input[position]))
+                        : program.onePassMatch[instruction.x] != 0;
+                    pc = first ? instruction.x : instruction.y;
+                    break;
+                }
+                case OpCode::Jump:
+                    pc = instruction.x;
+                    break;
+                case OpCode::Save:
+                    groups[instruction.x] = position;
+                    ++pc;
+                    break;
+                case OpCode::Match:
+                    return position == length;
+                default:
+                    return false;
+            }
+        }
+
+        return false;
+    }
+
+    /// Перебор с возвратом, в котором каждая пара (pc, позиция) посещается не больше одного раза: время линейно,
+    /// как у Pike VM, но потоки не копируют группы. Ветки обходятся в порядке приоритета, поэтому первое найденное
+    /// совпадение то же, что выбрала бы Pike VM. Пары, не давшие совпадения с одного начала, не дадут его и с другого,
+    /// поэтому отметки общие для всех начальных позиций.
+    static bool RunBacktrack(const Program& program, Context& context, std::string_view input, bool fullMatch, std::vector<uint32_t>& groups) {
+        const auto length = static_cast<uint32_t>(input.size());
+        const bool anchored = fullMatch || program.anchored;
+
+        const size_t bits = program.code.size() * (static_cast<size_t>(length) + 1);
+        context.visited.assign((bits + 63) / 64, 0);
+
+        auto&& captures = context.scratch;
+        auto&& jobs = context.jobs;
+
+        for (uint32_t start = 0; start <= length; ++start) {
+            if (program.canSkip && !anchored) {
+                while (start < length && !program.firstChars.Test(static_cast<uint8_t>(input[start]))) {
+                    ++start;
+                }
+                if (start == length) {
+                    break;
+                }
+            }
+
+            std::fill(captures.begin(), captures.end(), NONE);
+
+            jobs.clear();
+            jobs.push_back({ 0, NONE, start });
+
+            while (!jobs.empty()) {
+                const Context::Frame job = jobs.back();
+                jobs.pop_back();
+
+                if (job.slot != NONE) {
+                    captures[job.slot] = job.value;
+                    continue;
+                }
+
+                uint32_t pc = job.pc;
+                uint32_t position = job.value;
+
+                /// идем по приоритетной ветке, вторые ветки и откаты групп откладываются на стек
+                while (true) {
+                    const size_t bit = static_cast<size_t>(pc) * (static_cast<size_t>(length) + 1) + position;
+                    uint64_t& word = context.visited[bit >> 6u];
+                    const uint64_t mask = 1ull << (bit & 63u);
+                    if (word & mask) {
+                        break;
+                    }
+                    word |= mask;
+
+                    auto&& instruction = program.code[pc];
+
+                    bool next = false;
+
+                    switch (instruction.code) {
+                        case OpCode::Char:
+                            next = position < length && static_cast<uint8_t>(input[position]) == instruction.ch;
+                            position += next ? 1 : 0;
+                            break;
+                        case OpCode::Any:
+                            next = position < length && input[position] != '\n' && input[position] != '\r';
+                            position += next ? 1 : 0;
+                            break;
+                        case OpCode::Class:
+                            next = position < length && program.classes[instruction.x].Test(static_cast<uint8_t>(input[position]));
+                            position += next ? 1 : 0;
+                            break;
+                        case OpCode::Split:
+                            jobs.push_back({ instruction.y, NONE, position });
+                            pc = instruction.x;
+                            continue;
+                        case OpCode::Jump:
+                            pc = instruction.x;
+                            continue;
+                        case OpCode::Save:
+                            jobs.push_back({ 0, instruction.x, captures[instruction.x] });
+                            captures[instruction.x] = position;
+                            next = true;
+                            break;
+                        case OpCode::LineBegin:
+                            next = position == 0;
+                            break;
+                        case OpCode::LineEnd:
+                            next = position == length;
+                            break;
+                        case OpCode::WordBoundary:
+                            next = IsWordBoundary(input, position);
+                            break;
+                        case OpCode::NotWordBoundary:
+                            next = !IsWordBoundary(input, position);
+                            break;
+                        case OpCode::Match:
+                            if (fullMatch && position != length) {
+                                break;
+                            }
+                            std::copy_n(captures.data(), context.slots, groups.data());
+                            return true;
+                    }
+
+                    if (!next) {
+                        break;
+                    }
+
+                    ++pc;
+                }
+            }
+
+            if (anchored) {
+                break;
+            }
+        }
+
+        return false;
+    }
+
+    /// Литеральный фильтр, затем самый дешевый подходящий исполнитель: однопроходный для полного совпадения,
+    /// перебор с возвратом для коротких входов, Pike VM для остальных
+    static bool Run(const Program& program, Context& context, std::string_view input, bool fullMatch, std::vector<uint32_t>& groups) {
+        if (!program.literal.empty() && input.find(program.literal) == std::string_view::npos) {
+            return false;
+        }
+
+        if (fullMatch && program.onePass) {
+            return RunOnePass(program, input, groups);
+        }
+
+        if (program.code.size() * (input.size() + 1) <= MAX_BACKTRACK_BITS) {
+            return RunBacktrack(program, context, input, fullMatch, groups);
+        }
+
+        return RunPike(program, context, input, fullMatch, groups);
+    }
+}
 
 namespace SR_HTYPES_NS {
-    Regex::Regex(const std::string& regex)
-        : m_regex(std::regex(regex))
-    { }
+    Regex::Regex() = default;
+
+    Regex::Regex(const std::string& regex) {
+        if ((m_program = RegexDetails::Compile(regex))) {
+            m_context = std::make_unique<RegexDetails::Context>(*m_program);
+            m_groups.resize(m_program->groupsCount * 2, RegexDetails::NONE);
+        }
+        else {
+            m_fallback = std::make_unique<std::regex>(regex);
+            m_groups.resize((m_fallback->mark_count() + 1) * 2, RegexDetails::NONE);
+        }
+    }
 
     Regex::Regex(Regex&& other) noexcept
-        : m_regex(SR_EXCHANGE(other.m_regex, std::regex()))
-        , m_match(SR_EXCHANGE(other.m_match, std::smatch()))
+        : m_program(std::move(other.m_program))
+        , m_context(std::move(other.m_context))
+        , m_fallback(std::move(other.m_fallback))
+        , m_fallbackMatch(SR_EXCHANGE(other.m_fallbackMatch, { }))
+        , m_input(SR_EXCHANGE(other.m_input, { }))
+        , m_groups(std::move(other.m_groups))
+        , m_matched(SR_EXCHANGE(other.m_matched, false))
     { }
 
-    Regex &Regex::operator=(Regex&& other) noexcept {
-        m_regex = SR_EXCHANGE(other.m_regex, std::regex());
-        m_match = SR_EXCHANGE(other.m_match, std::smatch());
+    Regex::~Regex() = default;
+
+    Regex& Regex::operator=(Regex&& other) noexcept {
+        m_program = std::move(other.m_program);
+        m_context = std::move(other.m_context);
+        m_fallback = std::move(other.m_fallback);
+        m_fallbackMatch = SR_EXCHANGE(other.m_fallbackMatch, { });
+        m_input = SR_EXCHANGE(other.m_input, { });
+        m_groups = std::move(other.m_groups);
+        m_matched = SR_EXCHANGE(other.m_matched, false);
         return *this;
     }
 
-    bool Regex::Search(const std::string& input) {
-        return std::regex_search(input, m_match, m_regex);
+    bool Regex::Search(std::string_view input) {
+        return Execute(input, false);
+    }
+
+    bool Regex::Match(std::string_view input) {
+        return Execute(input, true);
+    }
+
+    bool Regex::Execute(std::string_view input, bool fullMatch) {
+        SR_TRACY_ZONE;
+
+        m_input = input;
+        m_matched = false;
+
+        std::fill(m_groups.begin(), m_groups.end(), RegexDetails::NONE);
+
+        if (m_program && input.size() < RegexDetails::NONE) {
+            m_matched = RegexDetails::Run(*m_program, *m_context, input, fullMatch, m_groups);
+        }
+        else if (m_fallback || m_program) {
+            if (!m_fallback) {
+                SRHalt("Regex::Execute() : input is too large for the compiled automaton!");
+                return false;
+            }
+            m_matched = ExecuteFallback(input, fullMatch);
+        }
+
+        return m_matched;
+    }
+
+    bool Regex::ExecuteFallback(std::string_view input, bool fullMatch) {
+        const bool matched = fullMatch
+            ? std::regex_match(input.begin(), input.end(), m_fallbackMatch, *m_fallback)
+            : std::regex_search(input.begin(), input.end(), m_fallbackMatch, *m_fallback);
+
+        if (!matched) {
+            return false;
+        }
+
+        for (size_t i = 0; i < m_fallbackMatch.size() && i * 2 + 1 < m_groups.size(); ++i) {
+            if (m_fallbackMatch[i].matched) {
+                m_groups[i * 2] = static_cast<uint32_t>(m_fallbackMatch[i].first - input.begin());
+                m_groups[i * 2 + 1] = static_cast<uint32_t>(m_fallbackMatch[i].second - input.begin());
+            }
+        }
+
+        return true;
     }
 
     uint64_t Regex::Size() const noexcept {
-        return m_match.size();
+        return m_matched ? m_groups.size() / 2 : 0;
+    }
+
+    std::string_view Regex::GetGroup(uint64_t index) const noexcept {
+        if (index >= Size()) {
+            SRHalt("Out of range!");
+            return std::string_view();
+        }
+
+        const uint32_t begin = m_groups[index * 2];
+        const uint32_t end = m_groups[index * 2 + 1];
+
+        if (begin == RegexDetails::NONE || end == RegexDetails::NONE) {
+            return std::string_view();
+        }
+
+        return m_input.substr(begin, end - begin);
+    }
+
+    std::string_view Regex::PrefixView() const noexcept {
+        if (!m_matched) {
+            return std::string_view();
+        }
+        return m_input.substr(0, m_groups[0]);
+    }
+
+    std::string_view Regex::SuffixView() const noexcept {
+        if (!m_matched) {
+            return std::string_view();
+        }
+        return m_input.substr(m_groups[1]);
     }
 
     std::string Regex::Suffix() const noexcept {
-        return m_match.suffix();
+        return std::string(SuffixView());
     }
 
     std::string Regex::Prefix() const noexcept {
-        return m_match.prefix();
+        return std::string(PrefixView());
     }
 
     std::string Regex::operator[](int64_t index) const noexcept {
-        if (index < Size()) {
-            return m_match[index];
+        if (index >= 0 && static_cast<uint64_t>(index) < Size()) {
+            return std::string(GetGroup(static_cast<uint64_t>(index)));
         }
 
         SRHalt("Out of range!");
@@ -56,16 +56,37 @@ namespace SR_HTYPES_NS {
         , m_pos(SR_UTILS_NS::Exchange(other.m_pos, { }))
         , m_size(SR_UTILS_NS::Exchange(other.m_size, { }))
         , m_capacity(SR_UTILS_NS::Exchange(other.m_capacity, { }))
+        , m_isView(SR_UTILS_NS::Exchange(other.m_isView, { }))
     { }
 
     Stream::~Stream() {
-        if (!m_data) {
+        if (!m_data || m_isView) {
             return;
         }
         Free(m_data);
     }
 
+    Stream Stream::View(const char* pData, uint64_t size) noexcept {
+        Stream stream;
+        stream.m_data = const_cast<char*>(pData);
+        stream.m_size = stream.m_capacity = size;
+        stream.m_isView = true;
+        return stream;
+    }
+
     Stream& Stream::operator=(const Stream& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (m_data && !m_isView) {
+            Free(m_data);
+        }
+
+        m_data = nullptr;
+        /// копия всегда владеет своим буфером, даже если источник - представление
+        m_isView = false;
+
         m_capacity = other.m_capacity;
         m_size = other.m_size;
         m_pos = 0;
@@ -83,10 +104,19 @@ namespace SR_HTYPES_NS {
     }
 
     Stream& Stream::operator=(Stream&& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (m_data && !m_isView) {
+            Free(m_data);
+        }
+
         m_data = SR_UTILS_NS::Exchange(other.m_data, { });
         m_pos = SR_UTILS_NS::Exchange(other.m_pos, { });
         m_size = SR_UTILS_NS::Exchange(other.m_size, { });
         m_capacity = SR_UTILS_NS::Exchange(other.m_capacity, { });
+        m_isView = SR_UTILS_NS::Exchange(other.m_isView, { });
         return *this;
     }
 
@@ -134,17 +164,22 @@ namespace SR_HTYPES_NS {
     }
 
     void Stream::Reserve(uint64_t capacity) {
-        if (m_capacity >= capacity) {
+        /// чужую память нельзя менять, поэтому представление всегда переезжает в свой буфер
+        if (m_capacity >= capacity && !m_isView) {
             return;
         }
 
+        capacity = SR_MAX(capacity, m_capacity);
+
         if (m_data) {
             char* pNewData = Allocate(capacity);
             char* pOldData = m_data;
 
             memcpy(pNewData, pOldData, m_capacity);
 
-            Free(pOldData);
+            if (!m_isView) {
+                Free(pOldData);
+            }
 
             m_data = pNewData;
         }
@@ -153,6 +188,7 @@ namespace SR_HTYPES_NS {
         }
 
         m_capacity = capacity;
+        m_isView = false;
 
         SRAssert(m_capacity >= m_size);
     }
@@ -162,6 +198,42 @@ namespace SR_HTYPES_NS {
         m_pos += count;
     }
 
+    void Stream::Clear() noexcept {
+        if (m_isView) {
+            m_data = nullptr;
+            m_capacity = 0;
+            m_isView = false;
+        }
+
+        m_size = 0;
+        m_pos = 0;
+    }
+
+    void Stream::Replace(uint64_t offset, uint64_t count, const void* pSrc, uint64_t size) {
+        if (offset + count > m_size) {
+            SRHalt("Stream::Replace() : out of bounds!");
+            return;
+        }
+
+        const uint64_t tail = m_size - offset - count;
+        const uint64_t newSize = m_size - count + size;
+
+        if (newSize > m_capacity || m_isView) {
+            Reserve(SR_MAX(newSize, 64));
+        }
+
+        if (size != count && tail > 0) {
+            memmove(m_data + offset + size, m_data + offset + count, tail);
+        }
+
+        if (size > 0) {
+            memcpy(m_data + offset, pSrc, size);
+        }
+
+        m_size = newSize;
+        m_pos = std::min(m_pos, m_size);
+    }
+
     char* Stream::Allocate(uint64_t size) {
         char* pBlock = (char*)malloc(size);
         return pBlock;
@@ -8,6 +8,38 @@
 #include <Utils/Common/StringUtils.h>
 #include <Utils/Profile/TracyContext.h>
 
+namespace SR_UTILS_NS {
+    static ThreadIdentity CreateThisThreadIdentity() {
+        static std::atomic<uint64_t> counter = 0;
+
+        ThreadIdentity identity;
+        identity.number = ++counter;
+        identity.nativeId = SR_PLATFORM_NS::GetCurrentThreadNativeId();
+
+        /// формат совпадает с GetThreadId, по нему потоки лежат в фабрике
+        std::stringstream stream;
+        stream << std::this_thread::get_id();
+        identity.id = stream.str();
+
+        return identity;
+    }
+
+    ThreadIdentity& GetThisThreadIdentity() {
+        thread_local ThreadIdentity identity = CreateThisThreadIdentity();
+        return identity;
+    }
+
+    SR_UTILS_NS::StringAtom GetThisThreadName() {
+        auto&& identity = GetThisThreadIdentity();
+        if (identity.pThread) {
+            if (auto&& name = identity.pThread->GetName(); !name.Empty()) {
+                return name;
+            }
+        }
+        return identity.id;
+    }
+}
+
 namespace SR_HTYPES_NS {
     Thread::Thread(std::thread &&thread)
         : m_thread(std::exchange(thread, {}))
@@ -42,8 +74,39 @@ namespace SR_HTYPES_NS {
         Platform::Sleep(milliseconds);
     }
 
-    void Thread::SetPriority(ThreadPriority priority) {
-        Platform::SetThreadPriority(reinterpret_cast<void*>(m_thread.native_handle()), priority);
+    bool Thread::SetPriority(ThreadPriority priority) {
+        if (!m_nativeId) {
+            SR_ERROR("Thread::SetPriority() : thread \"{}\" is not started!", m_id.c_str());
+            return false;
+        }
+        return Platform::SetThreadPriority(m_nativeId, priority);
+    }
+
+    std::optional<ThreadPriority> Thread::GetPriority() const {
+        return m_nativeId ? Platform::GetThreadPriority(m_nativeId) : std::nullopt;
+    }
+
+    bool Thread::SetAffinity(const std::vector<uint32_t>& cpus) {
+        if (!m_nativeId) {
+            SR_ERROR("Thread::SetAffinity() : thread \"{}\" is not started!", m_id.c_str());
+            return false;
+        }
+        return Platform::SetThreadAffinity(m_nativeId, cpus);
+    }
+
+    std::vector<uint32_t> Thread::GetAffinity() const {
+        return m_nativeId ? Platform::GetThreadAffinity(m_nativeId) : std::vector<uint32_t>();
+    }
+
+    void Thread::OnStarted() {
+        auto&& identity = SR_UTILS_NS::GetThisThreadIdentity();
+        identity.pThread = this;
+        m_nativeId = identity.nativeId;
+
+        /// имя могли задать до старта, SetName в этом случае до системы не дошел
+        if (auto&& name = GetName(); !name.Empty()) {
+            Platform::SetThreadName(m_nativeId, name.ToStringRef());
+        }
     }
 
     SR_NODISCARD Thread::Ptr Thread::Factory::CreateEmpty() {
@@ -84,6 +147,10 @@ namespace SR_HTYPES_NS {
     }
 
     Thread::Ptr Thread::Factory::GetThisThread() {
+        if (auto&& pThisThread = SR_UTILS_NS::GetThisThreadIdentity().pThread) {
+            return pThisThread;
+        }
+
         SR_SCOPED_LOCK;
 
         auto&& pThisThread = TryGetThisThread();
@@ -107,6 +174,10 @@ namespace SR_HTYPES_NS {
 
         SR_LOG("Thread::Free() : free \"{}\" thread...", pThread->GetId().c_str());
 
+        if (auto&& identity = SR_UTILS_NS::GetThisThreadIdentity(); identity.pThread == pThread) {
+            identity.pThread = nullptr;
+        }
+
         if (pThread == m_main) {
             m_main = nullptr;
         }
@@ -168,8 +239,11 @@ namespace SR_HTYPES_NS {
     }
 
     void Thread::SetName(const std::string& name) {
-        SR_WRITE_LOCK;
-        m_name = name;
+        m_name.store(SR_UTILS_NS::StringAtom(name));
+
+        if (const uint64_t nativeId = m_nativeId) {
+            Platform::SetThreadName(nativeId, name);
+        }
     }
 
     uint32_t Thread::Factory::GetThreadsCount() {
@@ -186,6 +260,7 @@ namespace SR_HTYPES_NS {
         SR_LOG("Thread::Factory::SetMainThread() : initializing main thread...");
 
         m_main = new Thread(SR_UTILS_NS::GetThisThreadId());
+        m_main->OnStarted();
 
         SR_LOG("Thread::Factory::SetMainThread() : main thread id: \"{}\"", m_main->GetId().c_str());
     }
@@ -203,8 +278,8 @@ namespace SR_HTYPES_NS {
             if (pThread == m_main) {
                 log += "\tThread [Main]\n";
             }
-            else if (!pThread->m_name.empty()) {
-                log += "\tThread [" + id.ToStringRef() + "] - " + pThread->m_name + "\n";
+            else if (auto&& name = pThread->GetName(); !name.Empty()) {
+                log += "\tThread [" + id.ToStringRef() + "] - " + name.ToStringRef() + "\n";
             }
             else {
                 log += "\tThread [" + id.ToStringRef() + "]\n";
@@ -215,7 +290,15 @@ namespace SR_HTYPES_NS {
     }
 
     Thread::Ptr Thread::Factory::TryGetThisThread() {
-        auto&& threadId = SR_UTILS_NS::GetThisThreadId();
+        auto&& identity = SR_UTILS_NS::GetThisThreadIdentity();
+        if (identity.pThread) {
+            return identity.pThread;
+        }
+
+        /// поток создан не через фабрику (Create(std::thread)) - ищем по идентификатору
+        SR_SCOPED_LOCK;
+
+        auto&& threadId = identity.id;
 
         if (auto&& pIt = m_threads.find(threadId); pIt != m_threads.end()) {
             return pIt->second;
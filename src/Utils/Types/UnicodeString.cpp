@@ -35,11 +35,11 @@ namespace SR_HTYPES_NS {
     }
 
     UnicodeString::UnicodeString(const std::string& str)
-        : m_internal(std::begin(str), std::end(str))
+        : m_internal(SR_UTILS_NS::Localization::UtfToUtf<CharType>(str))
     { }
 
     UnicodeString::UnicodeString(const std::u16string& str)
-        : m_internal(std::begin(str), std::end(str))
+        : m_internal(SR_UTILS_NS::Localization::UtfToUtf<CharType>(str))
     { }
 
     UnicodeString::UnicodeString(const std::u32string &str)
@@ -54,6 +54,14 @@ namespace SR_HTYPES_NS {
         return m_internal[position];
     }
 
+    std::string UnicodeString::ToUtf8() const {
+        return SR_UTILS_NS::Localization::UtfToUtf<char>(m_internal);
+    }
+
+    std::u16string UnicodeString::ToUtf16() const {
+        return SR_UTILS_NS::Localization::UtfToUtf<char16_t>(m_internal);
+    }
+
     void UnicodeString::resize(size_t size) {
         m_internal.resize(size);
     }
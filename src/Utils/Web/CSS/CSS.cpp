@@ -240,6 +240,151 @@ namespace SR_UTILS_NS::Web {
 
     /// ----------------------------------------------------------------------------------------------------------------
 
+    /// регистр не учитывается, как и при разборе таблицы стилей
+    static SRHashType HashCSSName(std::string_view name) noexcept {
+        uint64_t hash = SR_FNV_OFFSET_BASIS;
+        for (const char c : name) {
+            const char lower = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+            hash = (hash ^ static_cast<uint64_t>(static_cast<uint8_t>(lower))) * SR_FNV_PRIME;
+        }
+        return hash;
+    }
+
+    static bool IsCSSNameSymbol(char c) noexcept {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_';
+    }
+
+    static std::string_view TrimCSSSelector(std::string_view text) noexcept {
+        const uint64_t begin = text.find_first_not_of(" \t\r\n");
+        if (begin == std::string_view::npos) {
+            return { };
+        }
+        const uint64_t end = text.find_last_not_of(" \t\r\n");
+        return text.substr(begin, end - begin + 1);
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    CSSElement::CSSElement(std::string_view tag, std::string_view id, std::string_view classList) {
+        SetTag(tag);
+        SetId(id);
+        SetClassList(classList);
+    }
+
+    void CSSElement::SetTag(std::string_view tag) {
+        m_tag = tag.empty() ? 0 : HashCSSName(tag);
+    }
+
+    void CSSElement::SetId(std::string_view id) {
+        m_id = id.empty() ? 0 : HashCSSName(id);
+    }
+
+    void CSSElement::AddClass(std::string_view name) {
+        if (name.empty()) {
+            return;
+        }
+        const SRHashType hash = HashCSSName(name);
+        const auto it = std::ranges::lower_bound(m_classes, hash);
+        if (it == m_classes.end() || *it != hash) {
+            m_classes.insert(it, hash);
+        }
+    }
+
+    void CSSElement::SetClassList(std::string_view classList) {
+        m_classes.clear();
+
+        uint64_t position = 0;
+        while (position < classList.size()) {
+            const uint64_t begin = classList.find_first_not_of(" \t\r\n", position);
+            if (begin == std::string_view::npos) {
+                break;
+            }
+            const uint64_t end = std::min(classList.find_first_of(" \t\r\n", begin), static_cast<uint64_t>(classList.size()));
+            AddClass(classList.substr(begin, end - begin));
+            position = end;
+        }
+    }
+
+    uint64_t CSSElement::GetSignature() const noexcept {
+        uint64_t signature = CombineTwoHashes(m_tag, m_id);
+        for (const SRHashType hash : m_classes) {
+            signature = CombineTwoHashes(signature, hash);
+        }
+        return signature;
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    CSSSelector CSSSelector::Parse(std::string_view text) {
+        CSSSelector selector;
+        selector.text = text;
+
+        uint32_t idCount = 0, classCount = 0, tagCount = 0;
+        uint64_t position = 0;
+
+        const auto readName = [&]() -> std::string_view {
+            const uint64_t begin = position;
+            while (position < text.size() && IsCSSNameSymbol(text[position])) {
+                ++position;
+            }
+            return text.substr(begin, position - begin);
+        };
+
+        selector.supported = !text.empty();
+
+        while (selector.supported && position < text.size()) {
+            const char c = text[position];
+
+            if (c == '*' && position == 0) {
+                ++position;
+            }
+            else if (c == '#') {
+                ++position;
+                const std::string_view name = readName();
+                selector.supported = !name.empty() && selector.id == 0;
+                selector.id = HashCSSName(name);
+                ++idCount;
+            }
+            else if (c == '.') {
+                ++position;
+                const std::string_view name = readName();
+                selector.supported = !name.empty();
+                selector.classes.emplace_back(HashCSSName(name));
+                ++classCount;
+            }
+            else if (position == 0 && IsCSSNameSymbol(c)) {
+                selector.tag = HashCSSName(readName());
+                ++tagCount;
+            }
+            else {
+                /// комбинаторы, псевдоклассы, атрибуты
+                selector.supported = false;
+            }
+        }
+
+        std::ranges::sort(selector.classes);
+        selector.classes.erase(std::unique(selector.classes.begin(), selector.classes.end()), selector.classes.end());
+
+        selector.specificity = (std::min(idCount, 255u) << 16) | (std::min(classCount, 255u) << 8) | std::min(tagCount, 255u);
+
+        return selector;
+    }
+
+    bool CSSSelector::Matches(const CSSElement& element) const noexcept {
+        if (!supported) {
+            return false;
+        }
+        if (tag != 0 && tag != element.GetTag()) {
+            return false;
+        }
+        if (id != 0 && id != element.GetId()) {
+            return false;
+        }
+        return std::ranges::includes(element.GetClasses(), classes);
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
     CSS::CSS()
         : Super(this, SR_UTILS_NS::SharedPtrPolicy::Automatic)
     { }
@@ -252,15 +397,172 @@ namespace SR_UTILS_NS::Web {
 
         result = "* {\n" + m_globalStyle.ToString(depth + 1) + "}\n";
 
-        for (const auto& [token, style] : m_styles) {
-            std::string body = "{\n" + style.ToString(depth + 1) + "}";
-            if (token.second) {
-                result += SR_FORMAT(".{} {}\n", token.first.c_str(), body);
+        for (const CSSRule& rule : m_rules) {
+            std::string body = "{\n" + rule.style.ToString(depth + 1) + "}";
+            result += SR_FORMAT("{} {}\n", rule.selector.text.c_str(), body);
+        }
+        return result;
+    }
+
+    SRHashType CSS::HashSelector(std::string_view selector) {
+        return HashCSSName(TrimCSSSelector(selector));
+    }
+
+    const CSSRule* CSS::FindRule(std::string_view selector) const {
+        SR_TRACY_ZONE;
+        const auto it = m_selectors.find(HashSelector(selector));
+        return it != m_selectors.end() ? &m_rules[it->second] : nullptr;
+    }
+
+    const CSSStyle* CSS::GetStyle(std::string_view selector) const {
+        const CSSRule* pRule = FindRule(selector);
+        return pRule ? &pRule->style : nullptr;
+    }
+
+    const CSSStyle* CSS::GetClassStyle(std::string_view token) const {
+        return GetStyle("." + std::string(token));
+    }
+
+    const CSSStyle* CSS::GetTagStyle(std::string_view token) const {
+        return GetStyle(token);
+    }
+
+    void CSS::AddClassStyle(std::string&& token, const CSSStyle& style) {
+        SRAssert2(!token.empty(), "Token is empty!");
+        if (!GetClassStyle(token)) {
+            *GetOrCreateStyle(token, true) = style;
+        }
+    }
+
+    void CSS::AddTagStyle(std::string&& token, const CSSStyle& style) {
+        SRAssert2(!token.empty(), "Token is empty!");
+        if (!GetTagStyle(token)) {
+            *GetOrCreateStyle(token, false) = style;
+        }
+    }
+
+    CSSStyle* CSS::GetOrCreateStyle(std::string_view token, bool isClass) {
+        return isClass ? GetOrCreateStyle("." + std::string(token)) : GetOrCreateStyle(token);
+    }
+
+    CSSStyle* CSS::GetOrCreateStyle(std::string_view selector) {
+        selector = TrimCSSSelector(selector);
+        SRAssert2(!selector.empty(), "Selector is empty!");
+
+        /// стиль отдается на запись, поэтому вычисленные стили больше не актуальны
+        Invalidate();
+
+        if (selector == "*") {
+            return &m_globalStyle;
+        }
+
+        const SRHashType hash = HashSelector(selector);
+        if (const auto it = m_selectors.find(hash); it != m_selectors.end()) {
+            return &m_rules[it->second].style;
+        }
+
+        const auto index = static_cast<uint32_t>(m_rules.size());
+
+        CSSRule& rule = m_rules.emplace_back();
+        rule.selector = CSSSelector::Parse(selector);
+        rule.style = m_globalStyle;
+        rule.order = index;
+
+        m_selectors[hash] = index;
+
+        if (!rule.selector.supported) {
+            SR_WARN("CSS::GetOrCreateStyle() : selector \"{}\" is not supported and will never match", rule.selector.text);
+        }
+        else if (rule.selector.id != 0) {
+            m_idRules[rule.selector.id].emplace_back(index);
+        }
+        else if (!rule.selector.classes.empty()) {
+            m_classRules[rule.selector.classes.front()].emplace_back(index);
+        }
+        else if (rule.selector.tag != 0) {
+            m_tagRules[rule.selector.tag].emplace_back(index);
+        }
+        else {
+            m_universalRules.emplace_back(index);
+        }
+
+        return &rule.style;
+    }
+
+    template<typename Function> void CSS::ForEachCandidate(const CSSElement& element, const Function& function) const {
+        const auto collect = [&](const RuleIndices& indices) {
+            for (const uint32_t index : indices) {
+                function(m_rules[index]);
             }
-            else {
-                result += SR_FORMAT("{} {}\n", token.first.c_str(), body);
+        };
+
+        if (element.GetId() != 0) {
+            if (const auto it = m_idRules.find(element.GetId()); it != m_idRules.end()) {
+                collect(it->second);
             }
         }
-        return result;
+
+        for (const SRHashType hash : element.GetClasses()) {
+            if (const auto it = m_classRules.find(hash); it != m_classRules.end()) {
+                collect(it->second);
+            }
+        }
+
+        if (element.GetTag() != 0) {
+            if (const auto it = m_tagRules.find(element.GetTag()); it != m_tagRules.end()) {
+                collect(it->second);
+            }
+        }
+
+        collect(m_universalRules);
+    }
+
+    uint64_t CSS::CountCandidates(const CSSElement& element) const {
+        uint64_t count = 0;
+        ForEachCandidate(element, [&count](const CSSRule&) { ++count; });
+        return count;
+    }
+
+    void CSS::MatchRules(const CSSElement& element, std::vector<const CSSRule*>& rules) const {
+        SR_TRACY_ZONE;
+
+        rules.clear();
+
+        /// каждое правило лежит ровно в одной корзине, а классы элемента уникальны, поэтому дублей нет
+        ForEachCandidate(element, [&](const CSSRule& rule) {
+            if (rule.selector.Matches(element)) {
+                rules.emplace_back(&rule);
+            }
+        });
+
+        std::ranges::sort(rules, [](const CSSRule* pLeft, const CSSRule* pRight) {
+            if (pLeft->selector.specificity != pRight->selector.specificity) {
+                return pLeft->selector.specificity < pRight->selector.specificity;
+            }
+            return pLeft->order < pRight->order;
+        });
+    }
+
+    const CSSStyle& CSS::ComputeStyle(const CSSElement& element) const {
+        SR_TRACY_ZONE;
+
+        const uint64_t signature = element.GetSignature();
+        if (const auto it = m_computed.find(signature); it != m_computed.end()) {
+            return it->second;
+        }
+
+        MatchRules(element, m_matched);
+
+        CSSStyle style = m_globalStyle;
+        for (const CSSRule* pRule : m_matched) {
+            style = CSSStyle::Merge(style, pRule->style);
+        }
+
+        return m_computed.emplace(signature, std::move(style)).first->second;
+    }
+
+    void CSS::Invalidate() {
+        m_computed.clear();
+        ++m_generation;
     }
 }
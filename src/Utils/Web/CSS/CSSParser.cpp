@@ -3,6 +3,7 @@
 //
 
 #include <Utils/Web/CSS/CSSParser.h>
+#include <Utils/Common/StringTokenizer.h>
 
 #include <cssparser/cssparser/CSSParser.h>
 
@@ -44,8 +45,6 @@ namespace SR_UTILS_NS::Web {
 
         ::CSSParser::token token = parser.get_next_token();
 
-        CSSStyle* pStyle = nullptr;
-        bool isClass = false;
         std::string styleName;
         std::string propertyName;
 
@@ -58,11 +57,12 @@ namespace SR_UTILS_NS::Web {
             /** propery value */
 
             if (!propertyName.empty()) {
-                pStyle = m_pCSS->GetOrCreateStyle(styleName, isClass);
-
                 if (token.type == ::CSSParser::VALUE) {
                     SR_UTILS_NS::StringUtils::ToLowerRef(propertyName);
-                    pStyle->ParseProperty(propertyName, token.data);
+                    /// список селекторов через запятую - отдельное правило на каждый, со своей специфичностью
+                    for (auto&& selector : SR_UTILS_NS::StringTokenizer(styleName, ',')) {
+                        m_pCSS->GetOrCreateStyle(selector)->ParseProperty(propertyName, token.data);
+                    }
                     propertyName.clear();
                 }
                 else {
@@ -78,7 +78,6 @@ namespace SR_UTILS_NS::Web {
                     SRHalt("CSSParser::Parse() : unexpected SEL_END!");
                 }
                 styleName.clear();
-                pStyle = nullptr;
                 token = parser.get_next_token();
                 continue;
             }
@@ -102,21 +101,10 @@ namespace SR_UTILS_NS::Web {
             /** styles */
 
             if (token.type == ::CSSParser::SEL_START) {
-                styleName.clear();
-                isClass = false;
-                if (token.data.starts_with(".")) {
-                    styleName = token.data.substr(1);
-                    isClass = true;
-                }
-                else if (token.data == "*") {
-                    styleName = token.data;
-                }
-                else if (!token.data.empty() && styleName.empty() && propertyName.empty() && !pStyle) {
-                    styleName = token.data;
-                }
-                else {
+                if (token.data.empty() || !styleName.empty() || !propertyName.empty()) {
                     SRHalt("CSSParser::Parse() : unexpected SEL_START!");
                 }
+                styleName = token.data;
                 SR_UTILS_NS::StringUtils::ToLowerRef(styleName);
                 token = parser.get_next_token();
                 continue;
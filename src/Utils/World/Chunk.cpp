@@ -126,6 +126,11 @@ namespace SR_WORLD_NS {
         return true;
     }
 
+    bool Chunk::Generate(const WorldGen::GeneratedChunk::Ptr& pGenerated) {
+        m_generated = pGenerated;
+        return static_cast<bool>(m_generated);
+    }
+
     bool Chunk::PreLoad(SR_HTYPES_NS::Marshal* pMarshal) {
         SR_TRACY_ZONE;
 
@@ -151,5 +151,39 @@ namespace SR_WORLD_NS {
         m_targetPosition = SR_MATH_NS::FVector3();
 
         m_offset = Offset();
+
+        ResetVelocity();
+    }
+
+    void Observer::UpdateVelocity(float_t dt) {
+        if (dt <= 0.f) {
+            return;
+        }
+
+        if (!m_hasLastTargetPosition) {
+            m_lastTargetPosition = m_targetPosition;
+            m_hasLastTargetPosition = true;
+            return;
+        }
+
+        const SR_MATH_NS::FVector3 velocity = (m_targetPosition - m_lastTargetPosition) / static_cast<SR_MATH_NS::Unit>(dt);
+        m_lastTargetPosition = m_targetPosition;
+
+        if (!velocity.IsFinite() || velocity.ContainsNaN()) {
+            return;
+        }
+
+        /// экспоненциальное сглаживание, чтобы единичные рывки не сбивали предсказание
+        constexpr SR_MATH_NS::Unit smoothing = 0.2;
+        m_velocity = m_velocity + (velocity - m_velocity) * smoothing;
+    }
+
+    void Observer::ResetVelocity() {
+        m_velocity = SR_MATH_NS::FVector3();
+        m_hasLastTargetPosition = false;
+    }
+
+    SR_MATH_NS::FVector3 Observer::PredictPosition(float_t seconds) const {
+        return m_targetPosition + m_velocity * static_cast<SR_MATH_NS::Unit>(seconds);
     }
 }
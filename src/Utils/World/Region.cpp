@@ -3,6 +3,7 @@
 //
 
 #include <Utils/World/Region.h>
+#include <Utils/World/RegionStreamer.h>
 #include <Utils/World/Chunk.h>
 
 namespace SR_WORLD_NS {
@@ -15,6 +16,10 @@ namespace SR_WORLD_NS {
             return;
         }
 
+        if (!m_awaitingGeneration.empty()) {
+            UpdateGeneration();
+        }
+
         SR_HTYPES_NS::DataStorage* pContext = nullptr;
 
         for (auto&& pIt = m_loadedChunks.begin(); pIt != m_loadedChunks.end(); ) {
@@ -70,6 +75,20 @@ namespace SR_WORLD_NS {
         }
 
         if (pChunk && pChunk->GetState() == Chunk::LoadState::Unload) {
+            /// рельеф не хранится в кэше региона, он генерируется заново, а из кэша приходят только объекты.
+            /// Основной поток не ждет генерацию: если рельефа еще нет, он ставится в очередь потоков генератора
+            /// и подставляется в Update(), когда будет готов
+            if (auto&& pLogic = m_observer->m_scene->GetLogicBase().DynamicCast<SceneCubeChunkLogic>()) {
+                if (auto&& pWorldGen = pLogic->GetWorldGen()) {
+                    if (auto&& pGenerated = pWorldGen->TryGet(m_position, position)) {
+                        pChunk->Generate(pGenerated);
+                    }
+                    else {
+                        m_awaitingGeneration.emplace_back(position);
+                    }
+                }
+            }
+
             if (auto pCacheIt = m_cached.find(position); pCacheIt != m_cached.end()) {
                 /// TODO: OPTIMIZE!!!!!!!!!!!!!!!!!!!
                 SR_HTYPES_NS::Marshal copy = pCacheIt->second->Copy();
@@ -86,6 +105,36 @@ namespace SR_WORLD_NS {
         return pChunk;
     }
 
+    void Region::UpdateGeneration() {
+        SR_TRACY_ZONE;
+
+        auto&& pLogic = m_observer->m_scene->GetLogicBase().DynamicCast<SceneCubeChunkLogic>();
+        auto&& pWorldGen = pLogic ? pLogic->GetWorldGen() : nullptr;
+
+        if (!pWorldGen) {
+            m_awaitingGeneration.clear();
+            return;
+        }
+
+        for (auto&& pIt = m_awaitingGeneration.begin(); pIt != m_awaitingGeneration.end(); ) {
+            auto&& pChunkIt = m_loadedChunks.find(*pIt);
+
+            /// чанк успели выгрузить, или он уже получил рельеф при повторной загрузке
+            if (pChunkIt == m_loadedChunks.end() || pChunkIt->second->GetGenerated()) {
+                pIt = m_awaitingGeneration.erase(pIt);
+                continue;
+            }
+
+            if (auto&& pGenerated = pWorldGen->TryGet(m_position, *pIt)) {
+                pChunkIt->second->Generate(pGenerated);
+                pIt = m_awaitingGeneration.erase(pIt);
+            }
+            else {
+                ++pIt;
+            }
+        }
+    }
+
     Region::~Region() {
         for (auto&& [position, chunk] : m_loadedChunks) {
             delete chunk;
@@ -250,32 +299,45 @@ namespace SR_WORLD_NS {
         auto&& pLogic = m_observer->m_scene->GetLogicBase().DynamicCast<SceneCubeChunkLogic>();
         const auto&& path = pLogic->GetRegionsPath().Concat(m_position.ToString()).ConcatExt("dat");
 
+        if (auto&& pStreamer = pLogic->GetRegionStreamer(); pStreamer && pStreamer->IsActive()) {
+            return pStreamer->Take(m_position, path, m_cached);
+        }
+
         if (path.Exists()) {
-            auto &&marshal = SR_HTYPES_NS::Marshal::Load(path);
+            auto&& marshal = SR_HTYPES_NS::Marshal::Load(path);
+            return ReadCache(marshal, m_cached);
+        }
 
-            const uint16_t version = marshal.Read<uint16_t>();
-            if (version != VERSION) {
-                SR_ERROR("Region::Load() : version is different!");
-                return false;
-            }
+        return true;
+    }
 
-            const uint64_t count = marshal.Read<uint64_t>();
+    bool Region::ReadCache(SR_HTYPES_NS::Marshal& marshal, CachedChunks& chunks) {
+        SR_TRACY_ZONE;
 
-            for (uint64_t i = 0; i < count; ++i) {
-                const uint64_t size = marshal.Read<uint64_t>();
+        const uint16_t version = marshal.Read<uint16_t>();
+        if (version != VERSION) {
+            SR_ERROR("Region::ReadCache() : version is different!");
+            return false;
+        }
 
-                SRAssert(size != 0);
+        const uint64_t count = marshal.Read<uint64_t>();
 
-                auto&& pMarshalChunk = marshal.ReadBytesPtr(size);
+        for (uint64_t i = 0; i < count; ++i) {
+            const uint64_t size = marshal.Read<uint64_t>();
 
-                auto&& position = pMarshalChunk->View<Math::IVector3>(0);
-                if (pMarshalChunk->Valid()) {
-                    m_cached[position] = pMarshalChunk;
-                }
-                else {
-                    SRHalt("invalid cache!");
-                    SR_SAFE_DELETE_PTR(pMarshalChunk);
-                }
+            SRAssert(size != 0);
+
+            auto&& pMarshalChunk = marshal.ReadBytesPtr(size);
+
+            auto&& position = pMarshalChunk->View<Math::IVector3>(0);
+            if (pMarshalChunk->Valid()) {
+                auto&& pSlot = chunks[position];
+                SR_SAFE_DELETE_PTR(pSlot);
+                pSlot = pMarshalChunk;
+            }
+            else {
+                SRHalt("invalid cache!");
+                SR_SAFE_DELETE_PTR(pMarshalChunk);
             }
         }
 
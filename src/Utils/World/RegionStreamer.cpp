@@ -0,0 +1,365 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/World/RegionStreamer.h>
+#include <Utils/Platform/Platform.h>
+
+namespace SR_WORLD_NS {
+    RegionStreamer::RegionStreamer(uint32_t threadsCount, uint64_t memoryBudget)
+        : m_threadsCount(SR_MAX(threadsCount, 1u))
+        , m_memoryBudget(memoryBudget)
+    { }
+
+    RegionStreamer::~RegionStreamer() {
+        /// потоки обращаются к полям загрузчика, поэтому без Stop() их нельзя оставить работать на освобожденной памяти
+        if (m_isActive || !m_threads.empty()) {
+            SR_WARN("RegionStreamer::~RegionStreamer() : streamer was not stopped, stopping it now.");
+            Stop();
+        }
+
+        for (auto&& [position, entry] : m_entries) {
+            FreeEntry(entry);
+        }
+        m_entries.clear();
+    }
+
+    void RegionStreamer::Start() {
+        SR_TRACY_ZONE;
+
+        if (m_isActive) {
+            SRHalt("RegionStreamer::Start() : streamer is already active!");
+            return;
+        }
+
+        m_isActive = true;
+
+        for (uint32_t i = 0; i < m_threadsCount; ++i) {
+            SR_HTYPES_NS::Thread::Ptr pThread = nullptr;
+            SR_HTYPES_NS::Thread::Factory::Instance().Create(pThread, &RegionStreamer::Work, this);
+            pThread->SetName(SR_FORMAT("RegionStreamer-{}", i));
+            m_threads.emplace_back(pThread);
+        }
+    }
+
+    void RegionStreamer::Stop() {
+        SR_TRACY_ZONE;
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_isActive = false;
+        }
+
+        m_workCondition.notify_all();
+
+        /// потоки дописывают все сохранения перед выходом
+        for (auto&& pThread : m_threads) {
+            if (pThread->Joinable()) {
+                pThread->Join();
+            }
+            pThread->Free();
+        }
+        m_threads.clear();
+
+        std::lock_guard lock(m_mutex);
+
+        for (auto&& [position, entry] : m_entries) {
+            FreeEntry(entry);
+        }
+        m_entries.clear();
+        m_usedMemory = 0;
+    }
+
+    void RegionStreamer::Prefetch(const SR_MATH_NS::IVector3& region, const SR_UTILS_NS::Path& path, float_t priority) {
+        if (!m_isActive) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+
+            if (auto&& pIt = m_entries.find(region); pIt != m_entries.end()) {
+                if (pIt->second.state == Entry::State::Queued) {
+                    pIt->second.priority = std::min(pIt->second.priority, priority);
+                }
+                else if (pIt->second.state == Entry::State::Ready) {
+                    pIt->second.lastUse = ++m_useCounter;
+                }
+                return;
+            }
+
+            auto&& entry = m_entries[region];
+            entry.state = Entry::State::Queued;
+            entry.priority = priority;
+            entry.path = path;
+        }
+
+        m_workCondition.notify_one();
+    }
+
+    void RegionStreamer::CancelQueued() {
+        std::lock_guard lock(m_mutex);
+
+        for (auto&& pIt = m_entries.begin(); pIt != m_entries.end(); ) {
+            if (pIt->second.state == Entry::State::Queued) {
+                pIt = m_entries.erase(pIt);
+            }
+            else {
+                ++pIt;
+            }
+        }
+    }
+
+    void RegionStreamer::Save(const SR_MATH_NS::IVector3& region, const SR_UTILS_NS::Path& path, SR_HTYPES_NS::Marshal::Ptr pMarshal) {
+        if (!m_isActive) {
+            WriteRegion(path, pMarshal);
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+
+            /// все, что было прочитано до этого сохранения, уже устарело
+            if (auto&& pIt = m_entries.find(region); pIt != m_entries.end()) {
+                if (pIt->second.state == Entry::State::Loading) {
+                    pIt->second.stale = true;
+                }
+                else {
+                    m_usedMemory -= pIt->second.bytes;
+                    FreeEntry(pIt->second);
+                    m_entries.erase(pIt);
+                }
+            }
+
+            ++m_pendingSaves[region];
+
+            SaveJob job;
+            job.position = region;
+            job.path = path;
+            job.pMarshal = pMarshal;
+            m_saves.emplace_back(std::move(job));
+        }
+
+        m_workCondition.notify_one();
+    }
+
+    bool RegionStreamer::Take(const SR_MATH_NS::IVector3& region, const SR_UTILS_NS::Path& path, CachedChunks& chunks) {
+        SR_TRACY_ZONE;
+
+        {
+            std::unique_lock lock(m_mutex);
+
+            m_doneCondition.wait(lock, [this, &region]() {
+                if (m_pendingSaves.count(region) != 0) {
+                    return false;
+                }
+
+                auto&& pIt = m_entries.find(region);
+                return pIt == m_entries.end() || pIt->second.state != Entry::State::Loading;
+            });
+
+            if (auto&& pIt = m_entries.find(region); pIt != m_entries.end()) {
+                Entry& entry = pIt->second;
+
+                if (entry.state == Entry::State::Ready) {
+                    const bool failed = entry.failed;
+
+                    for (auto&& [position, pMarshal] : entry.chunks) {
+                        auto&& pSlot = chunks[position];
+                        SR_SAFE_DELETE_PTR(pSlot);
+                        pSlot = pMarshal;
+                    }
+
+                    entry.chunks.clear();
+                    m_usedMemory -= entry.bytes;
+                    m_entries.erase(pIt);
+
+                    return !failed;
+                }
+
+                m_entries.erase(pIt);
+            }
+        }
+
+        /// регион не успел предзагрузиться, читаем его в текущем потоке
+        uint64_t bytes = 0;
+        return ReadRegion(path, chunks, bytes);
+    }
+
+    void RegionStreamer::Flush() {
+        SR_TRACY_ZONE;
+
+        std::unique_lock lock(m_mutex);
+
+        m_doneCondition.wait(lock, [this]() {
+            return m_saves.empty() && m_pendingSaves.empty();
+        });
+    }
+
+    bool RegionStreamer::IsQueued(const SR_MATH_NS::IVector3& region) const {
+        std::lock_guard lock(m_mutex);
+        return m_entries.count(region) != 0;
+    }
+
+    void RegionStreamer::Work() {
+        std::unique_lock lock(m_mutex);
+
+        while (true) {
+            if (ProcessSave(lock)) {
+                continue;
+            }
+
+            if (!m_isActive) {
+                break;
+            }
+
+            if (ProcessLoad(lock)) {
+                continue;
+            }
+
+            m_workCondition.wait(lock);
+        }
+    }
+
+    bool RegionStreamer::ProcessSave(std::unique_lock<std::mutex>& lock) {
+        if (m_saves.empty()) {
+            return false;
+        }
+
+        SaveJob job = std::move(m_saves.front());
+        m_saves.pop_front();
+
+        lock.unlock();
+        WriteRegion(job.path, job.pMarshal);
+        lock.lock();
+
+        if (auto&& pIt = m_pendingSaves.find(job.position); pIt != m_pendingSaves.end() && --pIt->second == 0) {
+            m_pendingSaves.erase(pIt);
+        }
+
+        m_doneCondition.notify_all();
+
+        return true;
+    }
+
+    bool RegionStreamer::ProcessLoad(std::unique_lock<std::mutex>& lock) {
+        /// предзагрузка не должна выходить за бюджет, недостающее дочитает Take()
+        if (m_usedMemory >= m_memoryBudget) {
+            return false;
+        }
+
+        SR_MATH_NS::IVector3 position;
+        Entry* pEntry = nullptr;
+
+        for (auto&& [entryPosition, entry] : m_entries) {
+            if (entry.state != Entry::State::Queued || m_pendingSaves.count(entryPosition) != 0) {
+                continue;
+            }
+
+            if (!pEntry || entry.priority < pEntry->priority) {
+                pEntry = &entry;
+                position = entryPosition;
+            }
+        }
+
+        if (!pEntry) {
+            return false;
+        }
+
+        pEntry->state = Entry::State::Loading;
+        const SR_UTILS_NS::Path path = pEntry->path;
+
+        lock.unlock();
+
+        CachedChunks chunks;
+        uint64_t bytes = 0;
+        const bool success = ReadRegion(path, chunks, bytes);
+
+        lock.lock();
+
+        /// Take() ждет завершения загрузки, поэтому запись не могла быть удалена
+        Entry& entry = m_entries.at(position);
+
+        if (entry.stale) {
+            for (auto&& [chunkPosition, pMarshal] : chunks) {
+                delete pMarshal;
+            }
+            m_entries.erase(position);
+        }
+        else {
+            entry.state = Entry::State::Ready;
+            entry.failed = !success;
+            entry.chunks = std::move(chunks);
+            entry.bytes = bytes;
+            entry.lastUse = ++m_useCounter;
+
+            m_usedMemory += bytes;
+
+            EvictLocked();
+        }
+
+        m_doneCondition.notify_all();
+
+        return true;
+    }
+
+    void RegionStreamer::EvictLocked() {
+        while (m_usedMemory > m_memoryBudget) {
+            auto&& pOldest = m_entries.end();
+
+            for (auto&& pIt = m_entries.begin(); pIt != m_entries.end(); ++pIt) {
+                if (pIt->second.state != Entry::State::Ready) {
+                    continue;
+                }
+
+                if (pOldest == m_entries.end() || pIt->second.lastUse < pOldest->second.lastUse) {
+                    pOldest = pIt;
+                }
+            }
+
+            if (pOldest == m_entries.end()) {
+                break;
+            }
+
+            m_usedMemory -= pOldest->second.bytes;
+            FreeEntry(pOldest->second);
+            m_entries.erase(pOldest);
+        }
+    }
+
+    void RegionStreamer::FreeEntry(Entry& entry) {
+        for (auto&& [position, pMarshal] : entry.chunks) {
+            delete pMarshal;
+        }
+
+        entry.chunks.clear();
+        entry.bytes = 0;
+    }
+
+    bool RegionStreamer::ReadRegion(const SR_UTILS_NS::Path& path, CachedChunks& chunks, uint64_t& bytes) {
+        SR_TRACY_ZONE;
+
+        if (!path.Exists()) {
+            bytes = 0;
+            return true;
+        }
+
+        auto&& marshal = SR_HTYPES_NS::Marshal::Load(path);
+        bytes = marshal.Size();
+
+        return Region::ReadCache(marshal, chunks);
+    }
+
+    void RegionStreamer::WriteRegion(const SR_UTILS_NS::Path& path, SR_HTYPES_NS::Marshal::Ptr pMarshal) {
+        SR_TRACY_ZONE;
+
+        if (pMarshal && pMarshal->Valid()) {
+            pMarshal->Save(path);
+        }
+        else if (path.IsFile()) {
+            SR_PLATFORM_NS::Delete(path);
+        }
+
+        SR_SAFE_DELETE_PTR(pMarshal);
+    }
+}
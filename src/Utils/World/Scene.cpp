@@ -17,6 +17,8 @@
 
 #include <Utils/ECS/Component.h>
 #include <Utils/ECS/GameObject.h>
+#include <Utils/ECS/TagManager.h>
+#include <Utils/ECS/LayerManager.h>
 
 #include <Utils/Platform/Platform.h>
 
@@ -129,9 +131,19 @@ namespace SR_WORLD_NS {
         scene->m_path = path;
         scene->m_logic = SceneLogic::CreateByExt(scene, path.GetExtension());
 
-        if (!scene->m_logic->Load(scene->m_absPath)) {
+        SR_UTILS_NS::EntityRefUtils::RemapTable remapTable;
+        bool loaded = false;
+
+        {
+            SR_UTILS_NS::EntityRefUtils::RemapTable::Scope remapScope(remapTable);
+            loaded = scene->m_logic->Load(scene->m_absPath);
+        }
+
+        if (!loaded) {
             SR_ERROR("Scene::Load() : failed to load scene logic!");
 
+            remapTable.Clear();
+
             scene.AutoFree([](SR_WORLD_NS::Scene* pScene) {
                 pScene->Destroy();
                 delete pScene;
@@ -140,6 +152,9 @@ namespace SR_WORLD_NS {
             return Scene::Ptr();
         }
 
+        /// разрешаем все ссылки сцены одним проходом, пока таблица переназначения ещё заполнена
+        remapTable.Resolve();
+
         return scene;
     }
 
@@ -222,6 +237,80 @@ namespace SR_WORLD_NS {
         m_isHierarchyChanged = true;
     }
 
+    void Scene::SetObjectMask(uint64_t idInScene, const SceneObject* pObject) {
+        if (m_tagMasks.size() < m_sceneObjects.size()) {
+            m_tagMasks.resize(m_sceneObjects.size(), SR_UTILS_NS::SR_OBJECT_MASK_NONE);
+            m_layerMasks.resize(m_sceneObjects.size(), SR_UTILS_NS::SR_OBJECT_MASK_NONE);
+        }
+
+        if (idInScene >= m_tagMasks.size()) {
+            return;
+        }
+
+        if (!pObject) {
+            m_tagMasks[idInScene] = SR_UTILS_NS::SR_OBJECT_MASK_NONE;
+            m_layerMasks[idInScene] = SR_UTILS_NS::SR_OBJECT_MASK_NONE;
+            return;
+        }
+
+        m_tagMasks[idInScene] = SR_UTILS_NS::TagManager::Instance().GetTagMask(pObject->GetTag());
+        m_layerMasks[idInScene] = SR_UTILS_NS::LayerManager::Instance().GetLayerMask(pObject->GetLayer());
+    }
+
+    void Scene::UpdateObjectMask(const SceneObject* pObject) {
+        const uint64_t idInScene = pObject->GetIdInScene();
+        if (idInScene >= m_sceneObjects.size() || m_sceneObjects[idInScene].Get() != pObject) {
+            return; /// объект еще в очереди на добавление
+        }
+
+        SetObjectMask(idInScene, pObject);
+    }
+
+    void Scene::RebuildObjectMasks() {
+        SR_TRACY_ZONE;
+
+        m_tagMasks.assign(m_sceneObjects.size(), SR_UTILS_NS::SR_OBJECT_MASK_NONE);
+        m_layerMasks.assign(m_sceneObjects.size(), SR_UTILS_NS::SR_OBJECT_MASK_NONE);
+
+        for (uint64_t i = 0; i < m_sceneObjects.size(); ++i) {
+            if (auto&& pObject = m_sceneObjects[i]) {
+                SetObjectMask(i, pObject.Get());
+            }
+        }
+    }
+
+    std::span<const uint32_t> Scene::QueryObjectIds(const SR_UTILS_NS::ObjectMaskQuery& query) {
+        SR_TRACY_ZONE;
+
+        /// после перезагрузки настроек индексы тегов и слоев могли сместиться
+        const uint64_t tagsHashState = SR_UTILS_NS::TagManager::Instance().GetHashState();
+        const uint64_t layersHashState = SR_UTILS_NS::LayerManager::Instance().GetHashState();
+
+        if (tagsHashState != m_tagsHashState || layersHashState != m_layersHashState || m_tagMasks.size() != m_sceneObjects.size()) {
+            m_tagsHashState = tagsHashState;
+            m_layersHashState = layersHashState;
+            RebuildObjectMasks();
+        }
+
+        m_queryIds.resize(m_tagMasks.size());
+
+        const uint32_t count = SR_UTILS_NS::FilterObjectMasks(
+            m_tagMasks.data(), m_layerMasks.data(), static_cast<uint32_t>(m_tagMasks.size()), query, m_queryIds.data()
+        );
+
+        return std::span<const uint32_t>(m_queryIds.data(), count);
+    }
+
+    void Scene::QueryObjects(const SR_UTILS_NS::ObjectMaskQuery& query, SceneObjects& objects) {
+        auto&& ids = QueryObjectIds(query);
+
+        objects.reserve(objects.size() + ids.size());
+
+        for (const uint32_t id : ids) {
+            objects.emplace_back(m_sceneObjects[id]);
+        }
+    }
+
     bool Scene::Save() {
         return SaveAt(m_path);
     }
@@ -274,6 +363,7 @@ namespace SR_WORLD_NS {
 
         m_sceneObjects.at(idInScene) = SceneObject::Ptr();
         m_freeObjIndices.emplace_back(idInScene);
+        SetObjectMask(idInScene, nullptr);
 
         SetDirty(true);
         OnChanged();
@@ -404,6 +494,8 @@ namespace SR_WORLD_NS {
                     m_sceneObjects[m_freeObjIndices.front()] = gameObject;
                     m_freeObjIndices.erase(m_freeObjIndices.begin());
                 }
+
+                SetObjectMask(id, gameObject.Get());
             }
         }
 
@@ -16,6 +16,13 @@ namespace SR_WORLD_NS {
     }
 
     SceneCubeChunkLogic::~SceneCubeChunkLogic() {
+        /// если Destroy не вызывался, потоки загрузчика еще работают и должны завершиться до удаления
+        if (m_streamer && m_streamer->IsActive()) {
+            m_streamer->Stop();
+        }
+
+        SR_SAFE_DELETE_PTR(m_streamer);
+        SR_SAFE_DELETE_PTR(m_worldGen);
         SR_SAFE_DELETE_PTR(m_observer);
         SRAssert(!m_isAlive);
     }
@@ -35,6 +42,7 @@ namespace SR_WORLD_NS {
                     configs.TryGetNode("DefaultChunkHeight").TryGetAttribute("Value").ToInt(10)
             );
             m_regionWidth = configs.TryGetNode("DefaultRegionWidth").TryGetAttribute("Value").ToInt(6);
+            m_tensor.SetRegionWidth(m_regionWidth);
 
             m_observer->SetWorldMetrics(m_chunkSize, m_regionWidth);
             m_observer->SetShiftDist(configs.TryGetNode("DefaultShiftDistance").TryGetAttribute("Value").ToInt(10));
@@ -44,6 +52,23 @@ namespace SR_WORLD_NS {
             m_shiftEnabled = configs.TryGetNode("ShiftEnabled").TryGetAttribute("Value").ToBool(true);
             m_updateContainer = configs.TryGetNode("UpdateContainer").TryGetAttribute("Value").ToBool(true);
 
+            /// потоковая загрузка и ограничение чанков за кадр выключены, пока их не включат в World.xml
+            m_streamingEnabled = configs.TryGetNode("StreamingEnabled").TryGetAttribute("Value").ToBool(false);
+            m_streamingThreads = configs.TryGetNode("StreamingThreads").TryGetAttribute("Value").ToUInt(1);
+            m_streamingMemoryBudget = configs.TryGetNode("StreamingMemoryBudget").TryGetAttribute("Value").ToUInt64(256) * 1024 * 1024;
+            m_prefetchLookahead = configs.TryGetNode("PrefetchLookahead").TryGetAttribute("Value").ToFloat(2.f);
+            m_prefetchRadius = configs.TryGetNode("PrefetchRadius").TryGetAttribute("Value").ToInt(1);
+            m_maxChunkLoadsPerFrame = configs.TryGetNode("MaxChunkLoadsPerFrame").TryGetAttribute("Value").ToUInt(0);
+
+            m_worldGenEnabled = configs.TryGetNode("WorldGenEnabled").TryGetAttribute("Value").ToBool(false);
+            m_worldGenThreads = configs.TryGetNode("WorldGenThreads").TryGetAttribute("Value").ToUInt(2);
+            m_worldGenCacheCapacity = configs.TryGetNode("WorldGenCacheCapacity").TryGetAttribute("Value").ToUInt(1024);
+            m_worldGenSettings.seed = configs.TryGetNode("WorldGenSeed").TryGetAttribute("Value").ToUInt64(0);
+            m_worldGenSettings.resolution = configs.TryGetNode("WorldGenResolution").TryGetAttribute("Value").ToUInt(17);
+            m_worldGenSettings.heightScale = configs.TryGetNode("WorldGenHeightScale").TryGetAttribute("Value").ToFloat(1.f);
+            m_worldGenSettings.fbm.octaves = configs.TryGetNode("WorldGenOctaves").TryGetAttribute("Value").ToUInt(4);
+            m_worldGenSettings.fbm.frequency = configs.TryGetNode("WorldGenFrequency").TryGetAttribute("Value").ToFloat(0.01f);
+
             return true;
         }
         else {
@@ -75,13 +100,12 @@ namespace SR_WORLD_NS {
     const Scene::SceneObjects& SceneCubeChunkLogic::GetGameObjectsAtChunk(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk) const {
         SR_TRACY_ZONE;
 
-        const auto key = TensorKey(region, chunk);
-        if (m_tensor.count(key) == 0) {
-            static SceneObjects _default = SceneObjects();
-            return _default;
+        if (auto&& pObjects = m_tensor.Find(TensorKey(region, chunk))) {
+            return *pObjects;
         }
 
-        return m_tensor.at(key);
+        static SceneObjects _default = SceneObjects();
+        return _default;
     }
 
     bool SceneCubeChunkLogic::Reload() {
@@ -128,11 +152,8 @@ namespace SR_WORLD_NS {
 
     SR_NODISCARD Region* SceneCubeChunkLogic::GetRegion(const SR_MATH_NS::IVector3& region) const {
         /// если объект находится за пределами загруженной области, то нужно ее загрузить и поместить туда его
-        auto&& pIt = std::find_if(m_regions.begin(), m_regions.end(), [&region](auto&& pRegion) {
-            return pRegion->GetPosition() == region;
-        });
-
-        return pIt == m_regions.end() ? nullptr : *pIt;
+        auto&& ppRegion = m_regions.Find(region);
+        return ppRegion ? *ppRegion : nullptr;
     }
 
     SR_NODISCARD Region* SceneCubeChunkLogic::GetOrLoadRegion(const SR_MATH_NS::IVector3& region) {
@@ -140,7 +161,7 @@ namespace SR_WORLD_NS {
 
         if (!pRegion) {
             pRegion = Region::Allocate(m_observer, m_regionWidth, m_chunkSize, region);
-            m_regions.emplace_front(pRegion);
+            m_regions.Insert(pRegion->GetPosition(), pRegion);
             pRegion->Load();
             m_debugDirty = true;
         }
@@ -186,6 +207,9 @@ namespace SR_WORLD_NS {
                 offset.m_chunk - region * m_regionWidth
         );
 
+        /// позиция цели скачком смещается вместе с миром, старая скорость больше не актуальна
+        m_observer->ResetVelocity();
+
         SR_LOG("SceneCubeChunkLogic::SetWorldOffset() : set new offset " + m_observer->m_offset.ToString());
 
         const auto deltaOffset = m_observer->m_offset - prevOffset;
@@ -264,9 +288,7 @@ namespace SR_WORLD_NS {
 
         const auto chunkSize = SR_MATH_NS::IVector3(m_chunkSize.x, m_chunkSize.y, m_chunkSize.x);
 
-        const uint64_t reserved = m_tensor.size();
-        m_tensor.clear();
-        m_tensor.reserve(reserved);
+        m_tensor.Clear();
 
         auto&& root = m_scene->GetRootSceneObjects();
 
@@ -287,12 +309,12 @@ namespace SR_WORLD_NS {
 
             const TensorKey key = TensorKey(region, MakeChunk(chunk, m_regionWidth));
 
-            if (auto&& pIt = m_tensor.find(key); pIt != m_tensor.end()) {
-                pIt->second.emplace_back(std::move(pObject));
-            }
-            else {
-                m_tensor[key].emplace_back(std::move(pObject));
+            auto&& pObjects = m_tensor.Find(key);
+            const bool isFirstInChunk = !pObjects || pObjects->empty();
+
+            m_tensor.Add(key, std::move(pObject));
 
+            if (isFirstInChunk) {
                 if (GetOrLoadRegion(key.region)->GetChunk(key.chunk)) {
                     /// подгружаем чанк, чтобы объект не остался висеть в пустоте
                 }
@@ -307,6 +329,13 @@ namespace SR_WORLD_NS {
         path.Create();
 
         auto&& regPath = path.Concat(pRegion->GetPosition().ToString()).ConcatExt("dat");
+
+        if (m_streamer && m_streamer->IsActive()) {
+            /// сериализация объектов остается в основном потоке, в фон уходит только запись файла
+            m_streamer->Save(pRegion->GetPosition(), regPath, pRegion->Save(pContext));
+            return;
+        }
+
         if (auto&& pRegionMarshal = pRegion->Save(pContext); pRegionMarshal) {
             if (pRegionMarshal->Valid()) {
                 pRegionMarshal->Save(regPath);
@@ -327,6 +356,10 @@ namespace SR_WORLD_NS {
         return m_scene->GetAbsPath().Concat("regions");
     }
 
+    Path SceneCubeChunkLogic::GetRegionPath(const SR_MATH_NS::IVector3& region) const {
+        return GetRegionsPath().Concat(region.ToString()).ConcatExt("dat");
+    }
+
     std::pair<SR_MATH_NS::IVector3, SR_MATH_NS::IVector3> SceneCubeChunkLogic::GetRegionAndChunk(const SR_MATH_NS::FVector3& pos) const {
         const auto chunkSize = Math::IVector3(m_chunkSize.x, m_chunkSize.y, m_chunkSize.x);
         const World::Offset& offset = m_observer->m_offset;
@@ -370,6 +403,10 @@ namespace SR_WORLD_NS {
             SaveRegion(path.Concat("regions"), pRegion, pContext);
         }
 
+        if (m_streamer) {
+            m_streamer->Flush();
+        }
+
         auto&& pSceneRootMarshal = m_scene->SaveComponents(SR_UTILS_NS::SavableContext(nullptr, SAVABLE_FLAG_NONE));
         if (!pSceneRootMarshal->Save(path.Concat("data/components.bin"))) {
             SR_ERROR("SceneCubeChunkLogic::Save() : failed to save scene components!");
@@ -420,7 +457,16 @@ namespace SR_WORLD_NS {
             pRegion->Unload(true);
             delete pRegion;
         }
-        m_regions.clear();
+        m_regions.Clear();
+
+        if (m_streamer) {
+            m_streamer->Flush();
+            m_streamer->Stop();
+        }
+
+        if (m_worldGen && m_worldGen->IsActive()) {
+            m_worldGen->Stop();
+        }
 
 		m_debugDirty = true;
     }
@@ -443,6 +489,8 @@ namespace SR_WORLD_NS {
             }
         }
 
+        m_observer->UpdateVelocity(dt);
+
         auto&& lastChunk = m_observer->m_lastChunk;
         auto&& lastRegion = m_observer->m_lastRegion;
 
@@ -476,7 +524,7 @@ namespace SR_WORLD_NS {
             if (!pRegion) {
                 pRegion = Region::Allocate(m_observer, m_regionWidth, m_chunkSize, m_observer->m_region);
                 pRegion->Load();
-                m_regions.emplace_front(pRegion);
+                m_regions.Insert(pRegion->GetPosition(), pRegion);
 				m_debugDirty = true;
             }
 
@@ -495,6 +543,8 @@ namespace SR_WORLD_NS {
             lastChunk = currentChunk;
         }
 
+        UpdatePrefetch();
+
         if (m_updateContainer) {
             UpdateContainers();
         }
@@ -513,6 +563,60 @@ namespace SR_WORLD_NS {
         return chunk;
     }
 
+    SR_MATH_NS::IVector3 SceneCubeChunkLogic::CalculateRegion(const SR_MATH_NS::FVector3& position) const {
+        const auto regSize = Math::IVector3(m_regionWidth);
+        const auto regSize2 = Math::IVector3(m_regionWidth - 1);
+
+        auto&& [region, chunk] = GetRegionAndChunk(position);
+        return AddOffset(chunk.Singular(regSize2) / regSize, -m_observer->m_offset.m_region);
+    }
+
+    void SceneCubeChunkLogic::UpdatePrefetch() {
+        SR_TRACY_ZONE;
+
+        if (!m_streamer || !m_streamer->IsActive() || m_prefetchRadius < 0) {
+            return;
+        }
+
+        const auto currentRegion = CalculateRegion(m_observer->m_targetPosition);
+        const auto predictedRegion = CalculateRegion(m_observer->PredictPosition(m_prefetchLookahead));
+
+        if (currentRegion == m_lastPrefetchRegion && predictedRegion == m_lastPredictedRegion) {
+            return;
+        }
+
+        m_lastPrefetchRegion = currentRegion;
+        m_lastPredictedRegion = predictedRegion;
+
+        /// очередь перестраивается целиком, регионы, ставшие неактуальными, так и не будут прочитаны
+        m_streamer->CancelQueued();
+
+        const auto prefetchAround = [this](const SR_MATH_NS::IVector3& center, float_t basePriority) {
+            const int32_t radius = m_prefetchRadius;
+
+            for (int32_t x = -radius; x <= radius; ++x) {
+                for (int32_t y = -radius; y <= radius; ++y) {
+                    for (int32_t z = -radius; z <= radius; ++z) {
+                        const auto region = AddOffset(center, SR_MATH_NS::IVector3(x, y, z));
+                        if (region.HasZero() || GetRegion(region)) {
+                            continue;
+                        }
+
+                        const float_t distance = std::sqrt(static_cast<float_t>(SR_SQUARE(x) + SR_SQUARE(y) + SR_SQUARE(z)));
+                        m_streamer->Prefetch(region, GetRegionPath(region), basePriority + distance);
+                    }
+                }
+            }
+        };
+
+        prefetchAround(currentRegion, 0.f);
+
+        if (predictedRegion != currentRegion) {
+            /// регион по ходу движения идет сразу за ближайшими соседями текущего
+            prefetchAround(predictedRegion, 1.f);
+        }
+    }
+
     void SceneCubeChunkLogic::UpdateDebug() {
         SR_TRACY_ZONE;
 
@@ -601,6 +705,21 @@ namespace SR_WORLD_NS {
 
         m_isAlive = true;
 
+        if (m_streamingEnabled) {
+            if (!m_streamer) {
+                m_streamer = new RegionStreamer(m_streamingThreads, m_streamingMemoryBudget);
+            }
+            m_streamer->Start();
+        }
+
+        if (m_worldGenEnabled) {
+            if (!m_worldGen) {
+                m_worldGen = new WorldGen(m_worldGenSettings, m_chunkSize, m_regionWidth);
+                m_worldGen->SetCacheCapacity(m_worldGenCacheCapacity);
+            }
+            m_worldGen->Start(m_worldGenThreads);
+        }
+
         Super::Init();
     }
 
@@ -608,6 +727,18 @@ namespace SR_WORLD_NS {
         const auto neighbour = m_observer->MathNeighbour(chunk);
         auto&& pRegion = GetOrLoadRegion(neighbour.m_region);
 
+        if (m_maxChunkLoadsPerFrame > 0 && !chunk.Empty() && !pRegion->IsChunkLoaded(neighbour.m_chunk)) {
+            /// создание объектов чанка идет в основном потоке, поэтому за кадр поднимаем ограниченное число чанков
+            if (m_chunkLoadsThisFrame >= m_maxChunkLoadsPerFrame) {
+                /// пока чанк ждет своего кадра, его рельеф успеет сгенерироваться в фоне
+                if (m_worldGen) {
+                    m_worldGen->Request(neighbour.m_region, neighbour.m_chunk);
+                }
+                return;
+            }
+            ++m_chunkLoadsThisFrame;
+        }
+
         if (auto&& pChunk = pRegion->GetChunk(neighbour.m_chunk)) {
             pChunk->Access(dt);
         }
@@ -616,8 +747,24 @@ namespace SR_WORLD_NS {
     void SceneCubeChunkLogic::UpdateChunks(float_t dt) {
         SR_TRACY_ZONE;
 
+        if (m_scopeOffsetsScope != m_observer->m_scope) {
+            UpdateScopeOffsets();
+        }
+
+        m_chunkLoadsThisFrame = 0;
+
+        for (auto&& offset : m_scopeOffsets) {
+            UpdateChunk(offset, dt);
+        }
+    }
+
+    void SceneCubeChunkLogic::UpdateScopeOffsets() {
+        SR_TRACY_ZONE;
+
         const auto scope = m_observer->m_scope;
 
+        m_scopeOffsets.clear();
+
         for (int32_t x = -scope; x <= scope; ++x) {
             for (int32_t y = -scope; y <= scope; ++y) {
                 for (int32_t z = -scope; z <= scope; ++z) {
@@ -625,10 +772,17 @@ namespace SR_WORLD_NS {
                         continue;
                     }
 
-                    UpdateChunk(SR_MATH_NS::IVector3(x, y, z), dt);
+                    m_scopeOffsets.emplace_back(x, y, z);
                 }
             }
         }
+
+        /// ближние чанки подгружаются первыми, если лимит на кадр исчерпан
+        std::stable_sort(m_scopeOffsets.begin(), m_scopeOffsets.end(), [](const SR_MATH_NS::IVector3& a, const SR_MATH_NS::IVector3& b) {
+            return SR_SQUARE(a.x) + SR_SQUARE(a.y) + SR_SQUARE(a.z) < SR_SQUARE(b.x) + SR_SQUARE(b.y) + SR_SQUARE(b.z);
+        });
+
+        m_scopeOffsetsScope = scope;
     }
 
     void SceneCubeChunkLogic::UpdateRegions(float_t dt) {
@@ -636,19 +790,20 @@ namespace SR_WORLD_NS {
 
         auto&& pContext = SR_THIS_THREAD->GetContext();
 
-        for (auto&& pIt = m_regions.begin(); pIt != m_regions.end(); ) {
-            const auto& pRegion = *pIt;
+        for (uint32_t i = 0; i < m_regions.size(); ) {
+            auto&& pRegion = m_regions.GetValue(i);
 
             pRegion->Update(dt);
 
             if (pRegion->IsAlive()) {
-                ++pIt;
+                ++i;
             }
             else {
                 SaveRegion(GetRegionsPath(), pRegion, pContext);
                 pRegion->Unload();
                 delete pRegion;
-                pIt = m_regions.erase(pIt);
+                /// на место удаленного региона встает последний, поэтому индекс не увеличиваем
+                m_regions.EraseAt(i);
                 m_debugDirty = true;
             }
         }
@@ -0,0 +1,116 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/World/Tensor.h>
+#include <Utils/ECS/SceneObject.h>
+
+namespace SR_WORLD_NS {
+    void Tensor::SetRegionWidth(int32_t width) {
+        SRAssert(width > 0);
+
+        if (width == m_regionWidth) {
+            return;
+        }
+
+        m_regionWidth = width;
+        m_cells.Clear();
+        m_objectsCount = 0;
+    }
+
+    SR_MATH_NS::IVector3 Tensor::ToCell(const TensorKey& key) const noexcept {
+        /// регионы нумеруются без нуля (..., -2, -1, 1, 2, ...), чанки внутри региона с единицы
+        const auto axis = [width = m_regionWidth](int32_t region, int32_t chunk) -> int32_t {
+            return (region > 0 ? (region - 1) * width : region * width) + (chunk - 1);
+        };
+
+        return SR_MATH_NS::IVector3(
+            axis(key.region.x, key.chunk.x),
+            axis(key.region.y, key.chunk.y),
+            axis(key.region.z, key.chunk.z)
+        );
+    }
+
+    TensorKey Tensor::ToKey(const SR_MATH_NS::IVector3& cell) const noexcept {
+        TensorKey key;
+
+        const auto axis = [width = m_regionWidth](int32_t value, int32_t& region, int32_t& chunk) {
+            if (value >= 0) {
+                region = value / width + 1;
+                chunk = value % width + 1;
+            }
+            else {
+                region = -((-value - 1) / width + 1);
+                chunk = value - region * width + 1;
+            }
+        };
+
+        axis(cell.x, key.region.x, key.chunk.x);
+        axis(cell.y, key.region.y, key.chunk.y);
+        axis(cell.z, key.region.z, key.chunk.z);
+
+        return key;
+    }
+
+    const Tensor::SceneObjects* Tensor::Find(const TensorKey& key) const {
+        return m_cells.Find(ToCell(key));
+    }
+
+    void Tensor::Add(const TensorKey& key, SceneObjectPtr pObject) {
+        m_cells[ToCell(key)].emplace_back(std::move(pObject));
+        ++m_objectsCount;
+    }
+
+    bool Tensor::Remove(const TensorKey& key, const SceneObjectPtr& pObject) {
+        auto&& pObjects = m_cells.Find(ToCell(key));
+        if (!pObjects) {
+            return false;
+        }
+
+        auto&& pIt = std::find(pObjects->begin(), pObjects->end(), pObject);
+        if (pIt == pObjects->end()) {
+            return false;
+        }
+
+        /// порядок объектов внутри чанка не важен
+        if (pIt != std::prev(pObjects->end())) {
+            *pIt = std::move(pObjects->back());
+        }
+        pObjects->pop_back();
+        --m_objectsCount;
+
+        return true;
+    }
+
+    bool Tensor::Move(const SceneObjectPtr& pObject, const TensorKey& from, const TensorKey& to) {
+        if (from == to) {
+            return true;
+        }
+
+        if (!Remove(from, pObject)) {
+            return false;
+        }
+
+        Add(to, pObject);
+
+        return true;
+    }
+
+    void Tensor::Clear() {
+        SR_TRACY_ZONE;
+
+        for (uint32_t i = 0; i < m_cells.size(); ) {
+            auto&& objects = m_cells.GetValue(i);
+
+            if (objects.empty()) {
+                m_cells.EraseAt(i);
+                continue;
+            }
+
+            objects.clear();
+            ++i;
+        }
+
+        m_objectsCount = 0;
+    }
+}
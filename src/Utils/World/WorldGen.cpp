@@ -0,0 +1,338 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/World/WorldGen.h>
+
+namespace SR_WORLD_NS {
+    namespace {
+        SR_NODISCARD uint64_t SplitMix64(uint64_t value) noexcept {
+            value += 0x9E3779B97F4A7C15ULL;
+            value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+            value = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+            return value ^ (value >> 31U);
+        }
+
+        /// регионы и чанки нумеруются без нуля, глобальный индекс чанка - сплошной
+        SR_NODISCARD int64_t GetGlobalChunkIndex(int32_t region, int32_t chunk, uint32_t regionWidth) noexcept {
+            const int64_t regionIndex = region > 0 ? region - 1 : region;
+            return regionIndex * static_cast<int64_t>(regionWidth) + (chunk - 1);
+        }
+    }
+
+    WorldGen::WorldGen(const Settings& settings, const SR_MATH_NS::IVector2& chunkSize, uint32_t regionWidth)
+        : m_settings(settings)
+        , m_chunkSize(chunkSize)
+        , m_regionWidth(regionWidth)
+    {
+        SRAssert(m_settings.resolution >= 2);
+        SRAssert(m_regionWidth > 0);
+    }
+
+    WorldGen::~WorldGen() {
+        /// потоки обращаются к полям генератора, поэтому без Stop() их нельзя оставить работать на освобожденной памяти
+        if (m_isActive || !m_threads.empty()) {
+            SR_WARN("WorldGen::~WorldGen() : generator was not stopped, stopping it now.");
+            Stop();
+        }
+    }
+
+    void WorldGen::Start(uint32_t threadsCount) {
+        SR_TRACY_ZONE;
+
+        if (m_isActive) {
+            SRHalt("WorldGen::Start() : generator is already active!");
+            return;
+        }
+
+        if (threadsCount == 0) {
+            return;
+        }
+
+        m_isActive = true;
+
+        for (uint32_t i = 0; i < threadsCount; ++i) {
+            SR_HTYPES_NS::Thread::Ptr pThread = nullptr;
+            SR_HTYPES_NS::Thread::Factory::Instance().Create(pThread, &WorldGen::Work, this);
+            pThread->SetName(SR_FORMAT("WorldGen-{}", i));
+            m_threads.emplace_back(pThread);
+        }
+    }
+
+    void WorldGen::Stop() {
+        SR_TRACY_ZONE;
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_isActive = false;
+        }
+
+        m_workCondition.notify_all();
+
+        for (auto&& pThread : m_threads) {
+            if (pThread->Joinable()) {
+                pThread->Join();
+            }
+            pThread->Free();
+        }
+        m_threads.clear();
+
+        std::lock_guard lock(m_mutex);
+
+        m_queue.clear();
+
+        for (auto&& pIt = m_entries.begin(); pIt != m_entries.end(); ) {
+            if (pIt->second.state == Entry::State::Queued) {
+                pIt = m_entries.erase(pIt);
+            }
+            else {
+                ++pIt;
+            }
+        }
+    }
+
+    WorldGen::GeneratedChunk::Ptr WorldGen::Get(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk) {
+        SR_TRACY_ZONE;
+
+        std::unique_lock lock(m_mutex);
+        return WaitLocked(lock, ChunkKey(region, chunk));
+    }
+
+    WorldGen::GeneratedChunk::Ptr WorldGen::TryGet(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk) {
+        if (!m_isActive) {
+            return Get(region, chunk);
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+
+            if (auto&& pIt = m_entries.find(ChunkKey(region, chunk)); pIt != m_entries.end()) {
+                pIt->second.lastUse = ++m_useCounter;
+                return pIt->second.state == Entry::State::Ready ? pIt->second.pChunk : nullptr;
+            }
+        }
+
+        Request(region, chunk);
+
+        return nullptr;
+    }
+
+    void WorldGen::Request(const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk) {
+        if (!m_isActive) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+
+            const ChunkKey key(region, chunk);
+
+            if (auto&& pIt = m_entries.find(key); pIt != m_entries.end()) {
+                pIt->second.lastUse = ++m_useCounter;
+                return;
+            }
+
+            m_entries[key].state = Entry::State::Queued;
+            m_queue.emplace_back(key);
+        }
+
+        m_workCondition.notify_one();
+    }
+
+    std::vector<WorldGen::GeneratedChunk::Ptr> WorldGen::GenerateBatch(const std::vector<ChunkKey>& chunks) {
+        SR_TRACY_ZONE;
+
+        for (auto&& [region, chunk] : chunks) {
+            Request(region, chunk);
+        }
+
+        std::vector<GeneratedChunk::Ptr> result;
+        result.reserve(chunks.size());
+
+        /// вызывающий поток не простаивает: еще не взятые потоками чанки он генерирует сам
+        std::unique_lock lock(m_mutex);
+
+        for (auto&& key : chunks) {
+            result.emplace_back(WaitLocked(lock, key));
+        }
+
+        return result;
+    }
+
+    WorldGen::GeneratedChunk::Ptr WorldGen::WaitLocked(std::unique_lock<std::mutex>& lock, const ChunkKey& key) {
+        auto&& pIt = m_entries.find(key);
+
+        if (pIt != m_entries.end() && pIt->second.state == Entry::State::Generating) {
+            m_doneCondition.wait(lock, [this, &key]() {
+                auto&& pEntryIt = m_entries.find(key);
+                return pEntryIt == m_entries.end() || pEntryIt->second.state != Entry::State::Generating;
+            });
+            pIt = m_entries.find(key);
+        }
+
+        if (pIt != m_entries.end() && pIt->second.state == Entry::State::Ready) {
+            pIt->second.lastUse = ++m_useCounter;
+            return pIt->second.pChunk;
+        }
+
+        if (pIt == m_entries.end()) {
+            pIt = m_entries.emplace(key, Entry()).first;
+        }
+
+        /// запись в очереди пропускается потоками, так как она уже не Queued
+        pIt->second.state = Entry::State::Generating;
+
+        lock.unlock();
+        auto&& pChunk = GenerateShared(key);
+        lock.lock();
+
+        /// Generating-записи никто кроме генерирующего потока не удаляет
+        Entry& entry = m_entries.at(key);
+        entry.state = Entry::State::Ready;
+        entry.pChunk = pChunk;
+        entry.lastUse = ++m_useCounter;
+        ++m_readyCount;
+
+        EvictLocked();
+
+        m_doneCondition.notify_all();
+
+        return pChunk;
+    }
+
+    void WorldGen::SetCacheCapacity(uint32_t capacity) {
+        std::lock_guard lock(m_mutex);
+        m_cacheCapacity = capacity;
+        EvictLocked();
+    }
+
+    void WorldGen::ClearCache() {
+        std::lock_guard lock(m_mutex);
+
+        for (auto&& pIt = m_entries.begin(); pIt != m_entries.end(); ) {
+            if (pIt->second.state == Entry::State::Ready) {
+                pIt = m_entries.erase(pIt);
+            }
+            else {
+                ++pIt;
+            }
+        }
+
+        m_readyCount = 0;
+    }
+
+    uint32_t WorldGen::GetCacheSize() const {
+        std::lock_guard lock(m_mutex);
+        return m_readyCount;
+    }
+
+    void WorldGen::Work() {
+        std::unique_lock lock(m_mutex);
+
+        while (m_isActive) {
+            if (m_queue.empty()) {
+                m_workCondition.wait(lock);
+                continue;
+            }
+
+            const ChunkKey key = m_queue.front();
+            m_queue.pop_front();
+
+            auto&& pIt = m_entries.find(key);
+            if (pIt == m_entries.end() || pIt->second.state != Entry::State::Queued) {
+                continue;
+            }
+
+            pIt->second.state = Entry::State::Generating;
+
+            lock.unlock();
+            auto&& pChunk = GenerateShared(key);
+            lock.lock();
+
+            Entry& entry = m_entries.at(key);
+            entry.state = Entry::State::Ready;
+            entry.pChunk = std::move(pChunk);
+            entry.lastUse = ++m_useCounter;
+            ++m_readyCount;
+
+            EvictLocked();
+
+            m_doneCondition.notify_all();
+        }
+    }
+
+    void WorldGen::EvictLocked() {
+        while (m_readyCount > m_cacheCapacity) {
+            auto&& pOldest = m_entries.end();
+
+            for (auto&& pIt = m_entries.begin(); pIt != m_entries.end(); ++pIt) {
+                if (pIt->second.state != Entry::State::Ready) {
+                    continue;
+                }
+
+                if (pOldest == m_entries.end() || pIt->second.lastUse < pOldest->second.lastUse) {
+                    pOldest = pIt;
+                }
+            }
+
+            if (pOldest == m_entries.end()) {
+                break;
+            }
+
+            m_entries.erase(pOldest);
+            --m_readyCount;
+        }
+    }
+
+    WorldGen::GeneratedChunk::Ptr WorldGen::GenerateShared(const ChunkKey& key) const {
+        return std::make_shared<const GeneratedChunk>(Generate(m_settings, m_chunkSize, m_regionWidth, key.first, key.second));
+    }
+
+    WorldGen::GeneratedChunk WorldGen::Generate(const Settings& settings, const SR_MATH_NS::IVector2& chunkSize, uint32_t regionWidth,
+        const SR_MATH_NS::IVector3& region, const SR_MATH_NS::IVector3& chunk)
+    {
+        SR_TRACY_ZONE;
+
+        GeneratedChunk generated;
+        generated.region = region;
+        generated.chunk = chunk;
+        generated.resolution = SR_MAX(settings.resolution, 2u);
+        generated.heights.resize(static_cast<uint64_t>(generated.resolution) * generated.resolution);
+
+        /// зерно сдвигает мир внутри периода таблицы шума (256 клеток), а не меняет саму таблицу
+        const uint64_t seedHash = SplitMix64(settings.seed);
+        const double_t seedOffsetX = static_cast<double_t>(seedHash & 0xFFFFFFULL) / 65536.0;
+        const double_t seedOffsetZ = static_cast<double_t>((seedHash >> 24U) & 0xFFFFFFULL) / 65536.0;
+
+        /// отсчеты на границе ставятся ровно в мировые координаты края, чтобы соседи сшивались без швов
+        const double_t width = static_cast<double_t>(chunkSize.x);
+        const double_t step = width / static_cast<double_t>(generated.resolution - 1);
+        const double_t originX = static_cast<double_t>(GetGlobalChunkIndex(region.x, chunk.x, regionWidth)) * width + seedOffsetX;
+        const double_t originZ = static_cast<double_t>(GetGlobalChunkIndex(region.z, chunk.z, regionWidth)) * width + seedOffsetZ;
+
+        SR_MATH_NS::FBmGrid2D(generated.heights.data(), generated.resolution, generated.resolution,
+            originX, originZ, step, step, settings.fbm
+        );
+
+        if (settings.heightScale != 1.f) {
+            for (auto&& height : generated.heights) {
+                height *= settings.heightScale;
+            }
+        }
+
+        generated.hash = CalculateHash(generated);
+
+        return generated;
+    }
+
+    uint64_t WorldGen::CalculateHash(const GeneratedChunk& generated) {
+        uint64_t hash = SR_UTILS_NS::FNV1AAppendValue(SR_UTILS_NS::SR_FNV_OFFSET_BASIS, generated.region);
+        hash = SR_UTILS_NS::FNV1AAppendValue(hash, generated.chunk);
+        hash = SR_UTILS_NS::FNV1AAppendValue(hash, generated.resolution);
+
+        return SR_UTILS_NS::FNV1AAppendBytes(hash,
+            reinterpret_cast<const unsigned char*>(generated.heights.data()),
+            generated.heights.size() * sizeof(float_t)
+        );
+    }
+}